@@ -3,13 +3,14 @@
 // accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
-// This is a byte oriented implementation
-// Note: this implementation does not handle message longer than
-//       2^32 bytes.
+// Full 64 byte blocks are transformed directly from the input buffer, only partial blocks
+// are staged through the internal block buffer.
 
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/std/algorithm.h>
+#include <string.h>
 
 namespace AZ
 {
@@ -29,7 +30,7 @@ namespace AZ
         void GetDigest(DigestType digest);
 
     private:
-        void ProcessBlock();
+        void TransformBlock(const unsigned char* block);
 
         AZ_FORCE_INLINE AZ::u32 LeftRotate(AZ::u32 x, size_t n)
         {
@@ -41,7 +42,7 @@ namespace AZ
         unsigned char m_block[64];
 
         size_t m_blockByteIndex;
-        size_t m_byteCount;
+        AZ::u64 m_byteCount;
     };
 
     inline Sha1::Sha1()
@@ -68,7 +69,7 @@ namespace AZ
         if (m_blockByteIndex == 64)
         {
             m_blockByteIndex = 0;
-            ProcessBlock();
+            TransformBlock(m_block);
         }
     }
 
@@ -76,27 +77,52 @@ namespace AZ
     {
         unsigned char const* begin = static_cast<unsigned char const*>(bytesBegin);
         unsigned char const* end = static_cast<unsigned char const*>(bytesEnd);
-        for (; begin != end; ++begin)
-        {
-            ProcessByte(*begin);
-        }
+        ProcessBytes(begin, end - begin);
     }
 
     inline void Sha1::ProcessBytes(void const* buffer, size_t byteCount)
     {
-        unsigned char const* b = static_cast<unsigned char const*>(buffer);
-        ProcessBlock(b, b + byteCount);
+        unsigned char const* bytes = static_cast<unsigned char const*>(buffer);
+        m_byteCount += byteCount;
+
+        // top up a partially filled block first
+        if (m_blockByteIndex != 0)
+        {
+            size_t toCopy = AZStd::GetMin(byteCount, sizeof(m_block) - m_blockByteIndex);
+            memcpy(m_block + m_blockByteIndex, bytes, toCopy);
+            m_blockByteIndex += toCopy;
+            bytes += toCopy;
+            byteCount -= toCopy;
+            if (m_blockByteIndex < sizeof(m_block))
+            {
+                return;
+            }
+            m_blockByteIndex = 0;
+            TransformBlock(m_block);
+        }
+
+        // then consume whole blocks straight from the input
+        for (; byteCount >= sizeof(m_block); bytes += sizeof(m_block), byteCount -= sizeof(m_block))
+        {
+            TransformBlock(bytes);
+        }
+
+        if (byteCount != 0)
+        {
+            memcpy(m_block, bytes, byteCount);
+            m_blockByteIndex = byteCount;
+        }
     }
 
-    inline void Sha1::ProcessBlock()
+    inline void Sha1::TransformBlock(const unsigned char* block)
     {
         AZ::u32 w[80];
         for (size_t i = 0; i < 16; ++i)
         {
-            w[i] = (m_block[i * 4 + 0] << 24);
-            w[i] |= (m_block[i * 4 + 1] << 16);
-            w[i] |= (m_block[i * 4 + 2] << 8);
-            w[i] |= (m_block[i * 4 + 3]);
+            w[i] = (static_cast<AZ::u32>(block[i * 4 + 0]) << 24)
+                | (static_cast<AZ::u32>(block[i * 4 + 1]) << 16)
+                | (static_cast<AZ::u32>(block[i * 4 + 2]) << 8)
+                | (static_cast<AZ::u32>(block[i * 4 + 3]));
         }
         for (size_t i = 16; i < 80; ++i)
         {
@@ -109,38 +135,32 @@ namespace AZ
         AZ::u32 d = m_h[3];
         AZ::u32 e = m_h[4];
 
-        for (size_t i = 0; i < 80; ++i)
+        // the four rounds are split into separate loops so the round function is not selected per step
+        auto step = [&](AZ::u32 f, AZ::u32 k, AZ::u32 wi)
         {
-            AZ::u32 f;
-            AZ::u32 k;
-
-            if (i < 20)
-            {
-                f = (b & c) | (~b & d);
-                k = 0x5A827999;
-            }
-            else if (i < 40)
-            {
-                f = b ^ c ^ d;
-                k = 0x6ED9EBA1;
-            }
-            else if (i < 60)
-            {
-                f = (b & c) | (b & d) | (c & d);
-                k = 0x8F1BBCDC;
-            }
-            else
-            {
-                f = b ^ c ^ d;
-                k = 0xCA62C1D6;
-            }
-
-            AZ::u32 temp = LeftRotate(a, 5) + f + e + k + w[i];
+            AZ::u32 temp = LeftRotate(a, 5) + f + e + k + wi;
             e = d;
             d = c;
             c = LeftRotate(b, 30);
             b = a;
             a = temp;
+        };
+
+        for (size_t i = 0; i < 20; ++i)
+        {
+            step((b & c) | (~b & d), 0x5A827999, w[i]);
+        }
+        for (size_t i = 20; i < 40; ++i)
+        {
+            step(b ^ c ^ d, 0x6ED9EBA1, w[i]);
+        }
+        for (size_t i = 40; i < 60; ++i)
+        {
+            step((b & c) | (b & d) | (c & d), 0x8F1BBCDC, w[i]);
+        }
+        for (size_t i = 60; i < 80; ++i)
+        {
+            step(b ^ c ^ d, 0xCA62C1D6, w[i]);
         }
 
         m_h[0] += a;
@@ -152,46 +172,19 @@ namespace AZ
 
     inline void Sha1::GetDigest(DigestType digest)
     {
-        size_t bit_count = m_byteCount * 8;
+        AZ::u64 bitCount = m_byteCount * 8;
 
-        // append the bit '1' to the message
-        ProcessByte(0x80);
-
-        // append k bits '0', where k is the minimum number >= 0
+        // append the bit '1' to the message, then k bits '0', where k is the minimum number >= 0
         // such that the resulting message length is congruent to 56 (mod 64)
-        // check if there is enough space for padding and bit_count
-        if (m_blockByteIndex > 56)
-        {
-            // finish this block
-            while (m_blockByteIndex != 0)
-            {
-                ProcessByte(0);
-            }
+        unsigned char padding[128] = { 0x80 };
+        size_t paddingSize = (m_blockByteIndex < 56) ? (56 - m_blockByteIndex) : (120 - m_blockByteIndex);
 
-            // one more block
-            while (m_blockByteIndex < 56)
-            {
-                ProcessByte(0);
-            }
-        }
-        else
+        // append length of message (before pre-processing) as a 64-bit big-endian integer
+        for (size_t i = 0; i < 8; ++i)
         {
-            while (m_blockByteIndex < 56)
-            {
-                ProcessByte(0);
-            }
+            padding[paddingSize + i] = static_cast<unsigned char>((bitCount >> (56 - i * 8)) & 0xFF);
         }
-
-        // append length of message (before pre-processing) 
-        // as a 64-bit big-endian integer
-        ProcessByte(0);
-        ProcessByte(0);
-        ProcessByte(0);
-        ProcessByte(0);
-        ProcessByte(static_cast<unsigned char>((bit_count >> 24) & 0xFF));
-        ProcessByte(static_cast<unsigned char>((bit_count >> 16) & 0xFF));
-        ProcessByte(static_cast<unsigned char>((bit_count >> 8) & 0xFF));
-        ProcessByte(static_cast<unsigned char>((bit_count) & 0xFF));
+        ProcessBytes(padding, paddingSize + 8);
 
         // get final digest
         digest[0] = m_h[0];
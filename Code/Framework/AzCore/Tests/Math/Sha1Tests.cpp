@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    namespace Sha1TestsInternal
+    {
+        AZStd::string DigestToString(AZ::Sha1& sha)
+        {
+            AZ::u32 digest[5];
+            sha.GetDigest(digest);
+            return AZStd::string::format("%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+        }
+
+        AZStd::string HashString(const AZStd::string& input)
+        {
+            AZ::Sha1 sha;
+            sha.ProcessBytes(input.data(), input.size());
+            return DigestToString(sha);
+        }
+    }
+
+    class MATH_Sha1Test
+        : public AllocatorsFixture
+    {
+    };
+
+    TEST_F(MATH_Sha1Test, KnownVectors_MatchReference)
+    {
+        using Sha1TestsInternal::HashString;
+        EXPECT_EQ(HashString(""), "da39a3ee5e6b4b0d3255bfef95601890afd80709");
+        EXPECT_EQ(HashString("abc"), "a9993e364706816aba3e25717850c26c9cd0d89d");
+        EXPECT_EQ(HashString("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"), "84983e441c3bd26ebaae4aa1f95129e5e54670f1");
+        EXPECT_EQ(HashString(AZStd::string(1000000, 'a')), "34aa973cd4c4daa4f61eeb2bdbad27316534016f");
+    }
+
+    TEST_F(MATH_Sha1Test, SplitInput_MatchesSingleUpdate)
+    {
+        // crosses block boundaries at every possible offset and exercises both padding paths
+        AZStd::string input;
+        for (size_t i = 0; i < 300; ++i)
+        {
+            input.push_back(static_cast<char>('a' + i % 26));
+
+            AZ::Sha1 byteBySha;
+            for (char c : input)
+            {
+                byteBySha.ProcessByte(static_cast<unsigned char>(c));
+            }
+
+            AZ::Sha1 chunkedSha;
+            size_t offset = 0;
+            size_t chunkSize = 1;
+            while (offset < input.size())
+            {
+                size_t count = AZStd::GetMin(chunkSize, input.size() - offset);
+                chunkedSha.ProcessBlock(input.data() + offset, input.data() + offset + count);
+                offset += count;
+                chunkSize = chunkSize * 3 % 71 + 1;
+            }
+
+            const AZStd::string expected = Sha1TestsInternal::HashString(input);
+            EXPECT_EQ(Sha1TestsInternal::DigestToString(byteBySha), expected);
+            EXPECT_EQ(Sha1TestsInternal::DigestToString(chunkedSha), expected);
+        }
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+namespace Benchmark
+{
+    static void BM_Sha1ProcessBytes(benchmark::State& state)
+    {
+        std::vector<unsigned char> buffer(static_cast<size_t>(state.range(0)));
+        for (size_t i = 0; i < buffer.size(); ++i)
+        {
+            buffer[i] = static_cast<unsigned char>(i * 31);
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::Sha1 sha;
+            sha.ProcessBytes(buffer.data(), buffer.size());
+            AZ::u32 digest[5];
+            sha.GetDigest(digest);
+            benchmark::DoNotOptimize(digest);
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+    BENCHMARK(BM_Sha1ProcessBytes)->Arg(64)->Arg(4 * 1024)->Arg(1024 * 1024);
+}
+
+#endif
@@ -154,6 +154,7 @@ set(FILES
     Math/ShapeIntersectionPerformanceTests.cpp
     Math/ShapeIntersectionTests.cpp
     Math/SfmtTests.cpp
+    Math/Sha1Tests.cpp
     Math/SimdMathTests.cpp
     Math/SphereTests.cpp
     Math/SplineTests.cpp
@@ -60,6 +60,7 @@ namespace AzNetworking
         , VersionMismatch
         , NonceRejected
         , DtlsHandshakeError
+        , CompressorMismatch
         , MAX
     );
 
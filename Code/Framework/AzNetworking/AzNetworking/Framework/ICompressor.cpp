@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Framework/ICompressor.h>
+#include <AzNetworking/Utilities/IpAddress.h>
+#include <AzCore/Console/ILogger.h>
+
+namespace AzNetworking
+{
+    CompressorType GetCompressorType(const ICompressor* compressor)
+    {
+        return compressor ? compressor->GetType() : InvalidCompressorType;
+    }
+
+    bool ValidateRemoteCompressorType(const ICompressor* compressor, CompressorType remoteType, const IpAddress& remoteAddress)
+    {
+        const CompressorType localType = GetCompressorType(compressor);
+        if (remoteType != localType)
+        {
+            AZLOG_WARN("Rejected connection from %s, remote compressor type %u does not match local compressor type %u",
+                remoteAddress.GetString().c_str(), aznumeric_cast<uint32_t>(remoteType), aznumeric_cast<uint32_t>(localType));
+            return false;
+        }
+        return true;
+    }
+}
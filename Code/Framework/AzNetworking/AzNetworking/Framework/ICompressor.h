@@ -16,6 +16,8 @@
 
 namespace AzNetworking
 {
+    class IpAddress;
+
     //! Collection of compression related error codes
     enum class CompressorError
     {
@@ -28,13 +30,20 @@ namespace AzNetworking
     //! Unique identifier of a given compressor
     AZ_TYPE_SAFE_INTEGRAL(CompressorType, uint32_t);
 
+    //! Compressor type advertised by endpoints that do not compress their traffic
+    static constexpr CompressorType InvalidCompressorType = CompressorType{ 0 };
+
     //! @class ICompressor
     //! @brief Packet data compressor interface.
     //!
     //! ICompressor is an abstract compression interface meant for user provided GEMs to implement (such as the [Multiplayer
     //! Compression Gem](http://o3de.org/docs/user-guide/gems/reference/multiplayer-compression)).
     //! Compression is supported for both TCP and UDP connections.  Instantiation of a compressor is controlled by the
-    //! `net_UdpCompressor` or `net_TcpCompressor` cvar for their respective protocols.  
+    //! `net_UdpCompressor` or `net_TcpCompressor` cvar for their respective protocols.  Compressors that report
+    //! RequiresOrderedDelivery() are only used for TCP.
+    //! The connecting endpoint advertises the result of GetType() when it initiates a connection, and the accepting endpoint
+    //! refuses the connection if its own compressor reports a different type. Compressors whose output depends on shared
+    //! state, such as a trained dictionary, should fold an identifier for that state into their type.
 
     class ICompressor
     {
@@ -45,9 +54,14 @@ namespace AzNetworking
         //! Initialize compressor.
         virtual bool Init() = 0;
 
-        //! Unique identifier of a given compressor.
+        //! Unique identifier of a given compressor, two compressors must only report the same type if they can decode each other's output.
         virtual CompressorType GetType() const = 0;
 
+        //! Returns true if packets can only be decompressed in the order they were compressed, with none missing.
+        //! Compressors that match packets against earlier packets keep history per stream, which UDP's shared compressor, loss and
+        //! reordering would desynchronize, so UDP network interfaces refuse to use them.
+        virtual bool RequiresOrderedDelivery() const { return false; }
+
         //! Returns max possible size of uncompressed data chunk needed to fit compressed data in maxCompSize bytes.
         virtual AZStd::size_t GetMaxChunkSize(AZStd::size_t maxCompSize) const = 0;
 
@@ -89,6 +103,19 @@ namespace AzNetworking
         ) = 0;
     };
 
+    //! Returns the compressor type an endpoint advertises when it initiates a connection.
+    //! @param compressor the endpoint's compressor, nullptr if it does not compress its traffic
+    //! @return the type of the compressor, or InvalidCompressorType if there is none
+    CompressorType GetCompressorType(const ICompressor* compressor);
+
+    //! Checks that a connecting endpoint compresses its traffic the same way as the local endpoint.
+    //! Both endpoints must agree on how payloads are compressed, otherwise every packet after the handshake would fail to decode.
+    //! @param compressor    the local endpoint's compressor, nullptr if it does not compress its traffic
+    //! @param remoteType    the compressor type advertised by the remote endpoint
+    //! @param remoteAddress the address of the remote endpoint, used when logging a mismatch
+    //! @return true if the compressor types match, false and logs a warning if the connection should be rejected
+    bool ValidateRemoteCompressorType(const ICompressor* compressor, CompressorType remoteType, const IpAddress& remoteAddress);
+
     //! @class ICompressorFactory
     //! @brief Abstract factory to instantiate compressors.
     //!
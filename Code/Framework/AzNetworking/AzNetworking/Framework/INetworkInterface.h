@@ -74,6 +74,13 @@ namespace AzNetworking
         //! @param deltaTimeMs milliseconds since update was last invoked
         virtual void Update(AZ::TimeMs deltaTimeMs) = 0;
 
+        //! Starts batching outgoing packets, so that everything sent until the matching EndSendBatch call can be
+        //! written to the network with as few system calls as possible. Calls may be nested.
+        virtual void BeginSendBatch() = 0;
+
+        //! Ends a batch started by BeginSendBatch, writing out any queued packets once the outermost batch ends.
+        virtual void EndSendBatch() = 0;
+
         //! A helper function that transmits a packet on this connection reliably.
         //! Note that a packetId is not returned here, since retransmits may cause the packetId to change
         //! @param connectionId identifier of the connection to send to
@@ -82,12 +82,12 @@ namespace AzNetworking
         //! @return the total time spent updating our TcpListenThread
         virtual AZ::TimeMs GetTcpListenThreadUpdateTime() const = 0;
 
-        //! Returns the number of sockets monitored by our UdpReaderThread.
-        //! @return the number of sockets monitored by our UdpReaderThread
+        //! Returns the number of sockets monitored by our UdpReaderThreads.
+        //! @return the number of sockets monitored by our UdpReaderThreads
         virtual uint32_t GetUdpReaderThreadSocketCount() const = 0;
 
-        //! Returns the total time spent updating our UdpReaderThread.
-        //! @return the total time spent updating our UdpReaderThread
+        //! Returns the total time spent updating our UdpReaderThreads, summed across all of them.
+        //! @return the total time spent updating our UdpReaderThreads
         virtual AZ::TimeMs GetUdpReaderThreadUpdateTime() const = 0;
     };
 }
@@ -22,6 +22,8 @@ namespace AzNetworking
         AZ::TimeMs m_sendTimeMs = AZ::TimeMs{ 0 };
         //! Returns the total number of packets sent on this socket.
         uint64_t m_sendPackets = 0;
+        //! Returns the total number of system calls made to send data on this socket, m_sendPackets / m_sendCalls gives packets per syscall.
+        uint64_t m_sendCalls = 0;
         //! Returns the total number of encrypted packets sent on this socket.
         uint64_t m_sendPacketsEncrypted = 0;
         //! Returns the total number of bytes sent on this socket after compression.
@@ -34,17 +36,23 @@ namespace AzNetworking
         int64_t m_sendBytesCompressedDelta = 0;
         //! Returns the numbers of bytes added by encryption.
         uint64_t m_sendBytesEncryptionInflation = 0;
+        //! Returns the total number of bytes copied between buffers after serialization, m_sendBytesCopied / m_sendPackets gives bytes copied per packet.
+        uint64_t m_sendBytesCopied = 0;
         //! Returns the total number of packets that had to be resent on this network interface due to packet loss.
         uint64_t m_resentPackets = 0;
         //! Returns the total number of milliseconds spent processing received data on this network interface.
         AZ::TimeMs m_recvTimeMs = AZ::TimeMs{ 0 };
         //! Returns the total number of packets received on this socket.
         uint64_t m_recvPackets = 0;
+        //! Returns the total number of system calls made to receive data on this socket, m_recvPackets / m_recvCalls gives packets per syscall.
+        uint64_t m_recvCalls = 0;
         //! Returns the total number of bytes received on this socket after compression.
         uint64_t m_recvBytes = 0;
         //! Returns the total number of bytes received on this socket before compression.
         uint64_t m_recvBytesUncompressed = 0;
         //! Returns the total number of packets that were discarded due to timeslice budgets.
         uint64_t m_discardedPackets = 0;
+        //! Returns the total number of packets a reader thread dropped because their receive queue was full.
+        uint64_t m_recvQueueDrops = 0;
     };
 }
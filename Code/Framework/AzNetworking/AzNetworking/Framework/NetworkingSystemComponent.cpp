@@ -16,6 +16,9 @@
 
 namespace AzNetworking
 {
+    AZ_CVAR(uint32_t, net_UdpReaderThreadCount, 1, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The number of UDP reader threads, listening sockets are sharded across all of them. Read when the networking system starts");
+
     void NetworkingSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -42,7 +45,11 @@ namespace AzNetworking
         AZ::Interface<INetworking>::Register(this);
 
         m_listenThread = AZStd::make_unique<TcpListenThread>();
-        m_readerThread = AZStd::make_unique<UdpReaderThread>();
+        const uint32_t readerThreadCount = AZStd::max<uint32_t>(net_UdpReaderThreadCount, 1);
+        for (uint32_t i = 0; i < readerThreadCount; ++i)
+        {
+            m_readerThreads.emplace_back(AZStd::make_unique<UdpReaderThread>());
+        }
     }
 
     NetworkingSystemComponent::~NetworkingSystemComponent()
@@ -52,7 +59,7 @@ namespace AzNetworking
 
         m_compressorFactories.clear();
 
-        m_readerThread = nullptr;
+        m_readerThreads.clear();
         m_listenThread = nullptr;
 
         AZ::Interface<INetworking>::Unregister(this);
@@ -73,7 +80,6 @@ namespace AzNetworking
     void NetworkingSystemComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
         AZ::TimeMs elapsedMs = aznumeric_cast<AZ::TimeMs>(aznumeric_cast<int64_t>(deltaTime / 1000.0f));
-        m_readerThread->SwapBuffers();
         for (auto& networkInterface : m_networkInterfaces)
         {
             networkInterface.second->Update(elapsedMs);
@@ -96,7 +102,7 @@ namespace AzNetworking
             result = AZStd::make_unique<TcpNetworkInterface>(name, listener, trustZone, *m_listenThread);
             break;
         case ProtocolType::Udp:
-            result = AZStd::make_unique<UdpNetworkInterface>(name, listener, trustZone, *m_readerThread);
+            result = AZStd::make_unique<UdpNetworkInterface>(name, listener, trustZone, m_readerThreads);
             break;
         }
         INetworkInterface* returnResult = result.get();
@@ -162,18 +168,29 @@ namespace AzNetworking
 
     uint32_t NetworkingSystemComponent::GetUdpReaderThreadSocketCount() const
     {
-        return m_readerThread->GetSocketCount();
+        uint32_t socketCount = 0;
+        for (const AZStd::unique_ptr<UdpReaderThread>& readerThread : m_readerThreads)
+        {
+            socketCount += readerThread->GetSocketCount();
+        }
+        return socketCount;
     }
 
     AZ::TimeMs NetworkingSystemComponent::GetUdpReaderThreadUpdateTime() const
     {
-        return m_readerThread->GetUpdateTimeMs();
+        AZ::TimeMs updateTimeMs = AZ::TimeMs{ 0 };
+        for (const AZStd::unique_ptr<UdpReaderThread>& readerThread : m_readerThreads)
+        {
+            updateTimeMs += readerThread->GetUpdateTimeMs();
+        }
+        return updateTimeMs;
     }
 
     void NetworkingSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
     {
         AZLOG_INFO("Total sockets monitored by TcpListenThread: %u", GetTcpListenThreadSocketCount());
         AZLOG_INFO("Total time spent updating TcpListenThread: %lld", aznumeric_cast<AZ::s64>(GetTcpListenThreadUpdateTime()));
+        AZLOG_INFO("Total UdpReaderThreads: %u", aznumeric_cast<uint32_t>(m_readerThreads.size()));
         AZLOG_INFO("Total sockets monitored by UdpReaderThread: %u", GetUdpReaderThreadSocketCount());
         AZLOG_INFO("Total time spent updating UdpReaderThread: %lld", aznumeric_cast<AZ::s64>(GetUdpReaderThreadUpdateTime()));
 
@@ -189,16 +206,20 @@ namespace AzNetworking
             AZLOG_INFO(" - Total number of connections: %llu", aznumeric_cast<AZ::u64>(metrics.m_connectionCount));
             AZLOG_INFO(" - Total send time in milliseconds: %lld", aznumeric_cast<AZ::s64>(metrics.m_sendTimeMs));
             AZLOG_INFO(" - Total sent packets: %llu", aznumeric_cast<AZ::s64>(metrics.m_sendPackets));
+            AZLOG_INFO(" - Sent packets per syscall: %.2f", metrics.m_sendCalls > 0 ? aznumeric_cast<double>(metrics.m_sendPackets) / aznumeric_cast<double>(metrics.m_sendCalls) : 0.0);
             AZLOG_INFO(" - Total sent bytes after compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendBytes));
             AZLOG_INFO(" - Total sent bytes before compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendBytesUncompressed));
             AZLOG_INFO(" - Total sent compressed packets without benefit: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendCompressedPacketsNoGain));
             AZLOG_INFO(" - Total gain from packet compression: %lld", aznumeric_cast<AZ::s64>(metrics.m_sendBytesCompressedDelta));
+            AZLOG_INFO(" - Bytes copied per sent packet: %.2f", metrics.m_sendPackets > 0 ? aznumeric_cast<double>(metrics.m_sendBytesCopied) / aznumeric_cast<double>(metrics.m_sendPackets) : 0.0);
             AZLOG_INFO(" - Total packets resent: %llu", aznumeric_cast<AZ::u64>(metrics.m_resentPackets));
             AZLOG_INFO(" - Total receive time in milliseconds: %lld", aznumeric_cast<AZ::s64>(metrics.m_recvTimeMs));
             AZLOG_INFO(" - Total received packets: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvPackets));
+            AZLOG_INFO(" - Received packets per syscall: %.2f", metrics.m_recvCalls > 0 ? aznumeric_cast<double>(metrics.m_recvPackets) / aznumeric_cast<double>(metrics.m_recvCalls) : 0.0);
             AZLOG_INFO(" - Total received bytes after compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytes));
             AZLOG_INFO(" - Total received bytes before compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytesUncompressed));
             AZLOG_INFO(" - Total packets discarded due to load: %llu", aznumeric_cast<AZ::u64>(metrics.m_discardedPackets));
+            AZLOG_INFO(" - Total packets dropped by full receive queues: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvQueueDrops));
         }
     }
 }
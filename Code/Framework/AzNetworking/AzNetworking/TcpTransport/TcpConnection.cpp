@@ -87,10 +87,17 @@ namespace AzNetworking
             return false;
         }
         m_state = ConnectionState::Connecting;
-        SendReliablePacket(CorePackets::InitiateConnectionPacket());
+        SendInitiateConnectionPacket();
         return true;
     }
 
+    bool TcpConnection::SendInitiateConnectionPacket()
+    {
+        CorePackets::InitiateConnectionPacket packet;
+        packet.SetCompressorType(GetCompressorType(m_compressor.get()));
+        return SendReliablePacket(packet);
+    }
+
     void TcpConnection::UpdateSend()
     {
         const uint32_t numSendBytes = m_sendRingbuffer.GetReadBufferSize();
@@ -171,6 +178,16 @@ namespace AzNetworking
             timeoutItem->UpdateTimeoutTime(startTimeMs);
 
             NetworkOutputSerializer serializer(buffer.GetBuffer(), buffer.GetSize());
+            if (m_state == ConnectionState::Connecting && m_connectionRole == ConnectionRole::Acceptor)
+            {
+                NetworkOutputSerializer initiateSerializer(buffer.GetBuffer(), buffer.GetSize());
+                if (!ValidateInitiateConnectionPacket(header, initiateSerializer))
+                {
+                    Disconnect(DisconnectReason::CompressorMismatch, TerminationEndpoint::Local);
+                    return true;
+                }
+            }
+
             if (m_state == ConnectionState::Connecting)
             {
                 const ConnectResult connectResult = m_networkInterface.GetConnectionListener().ValidateConnect(GetRemoteAddress(), header, serializer);
@@ -385,6 +402,23 @@ namespace AzNetworking
         return true;
     }
 
+    bool TcpConnection::ValidateInitiateConnectionPacket(const TcpPacketHeader& header, ISerializer& serializer) const
+    {
+        if (header.GetPacketType() != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket))
+        {
+            // Not an initiate packet, leave validation of the connection to the connection listener
+            return true;
+        }
+
+        CorePackets::InitiateConnectionPacket packet;
+        if (!serializer.Serialize(packet, "Packet"))
+        {
+            return false;
+        }
+
+        return ValidateRemoteCompressorType(m_compressor.get(), packet.GetCompressorType(), GetRemoteAddress());
+    }
+
     bool TcpConnection::DecompressPacket(const uint8_t* packetBuffer, AZStd::size_t packetSize, TcpPacketEncodingBuffer& packetBufferOut) const
     {
         if (!m_compressor) // should probably have some compression handshake than relying on existence of compressor
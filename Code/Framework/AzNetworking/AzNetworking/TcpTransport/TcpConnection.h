@@ -85,6 +85,10 @@ namespace AzNetworking
         //! @return boolean true on success
         bool Connect();
 
+        //! Sends the packet that opens this connection, advertising the type of compressor this connection uses.
+        //! @return boolean true if the packet was transmitted
+        bool SendInitiateConnectionPacket();
+
         //! Handles any new outgoing network traffic.
         void UpdateSend();
 
@@ -129,6 +133,12 @@ namespace AzNetworking
         //! @return boolean true if a packet has been received, false otherwise
         bool ReceivePacketInternal(TcpPacketHeader& outHeader, TcpPacketEncodingBuffer& outBuffer, AZ::TimeMs currentTimeMs);
 
+        //! Validates the packet that opened an accepted connection.
+        //! @param header     header of the received packet
+        //! @param serializer serializer over the received packet payload
+        //! @return boolean true if the remote endpoint is compatible with this connection
+        bool ValidateInitiateConnectionPacket(const TcpPacketHeader& header, ISerializer& serializer) const;
+
         //! Decompresses an incoming packet data buffer.
         //! @param packetBuffer    the compressed packet buffer to decode
         //! @param packetSize      the size of the compressed packet buffer
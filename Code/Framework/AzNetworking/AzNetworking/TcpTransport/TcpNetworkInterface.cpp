@@ -99,7 +99,7 @@ namespace AzNetworking
         AZLOG_INFO("Adding new socket %d", static_cast<int32_t>(tcpSocket->GetSocketFd()));
         const TimeoutId newTimeoutId = m_connectionTimeoutQueue.RegisterItem(static_cast<uint64_t>(tcpSocket->GetSocketFd()), net_TcpHearthbeatTimeMs);
         connection->SetTimeoutId(newTimeoutId);
-        connection->SendReliablePacket(CorePackets::InitiateConnectionPacket());
+        connection->SendInitiateConnectionPacket();
         m_connectionListener.OnConnect(connection.get());
         m_connectionSet.AddConnection(AZStd::move(connection));
         return connectionId;
@@ -128,6 +128,16 @@ namespace AzNetworking
         GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
 
+    void TcpNetworkInterface::BeginSendBatch()
+    {
+        // No-op, TCP already coalesces writes on the stream
+    }
+
+    void TcpNetworkInterface::EndSendBatch()
+    {
+        // No-op, see BeginSendBatch
+    }
+
     bool TcpNetworkInterface::SendReliablePacket(ConnectionId connectionId, const IPacket& packet)
     {
         IConnection* connection = m_connectionSet.GetConnection(connectionId);
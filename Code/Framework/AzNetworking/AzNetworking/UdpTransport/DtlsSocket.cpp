@@ -84,9 +84,26 @@ namespace AzNetworking
         }
 
 #if AZ_TRAIT_USE_OPENSSL
-        uint8_t encrpytedSendBuffer[MaxUdpTransmissionUnit];
         // Write out the packet we were requested to send
         const int32_t sentBytesRaw = SSL_write(dtlsEndpoint.m_sslSocket, data, size);
+
+        // When batching, read the encrypted record straight into the send batch instead of staging it on the stack
+        if (uint8_t* batchData = ReserveBatchedSend(MaxUdpTransmissionUnit))
+        {
+            const int32_t sentBytesEnc = BIO_read(dtlsEndpoint.m_writeBio, batchData, MaxUdpTransmissionUnit);
+            if (sentBytesEnc <= 0)
+            {
+                return sentBytesEnc;
+            }
+
+            // Track encryption metrics
+            m_sentBytesEncryptionInflation += aznumeric_cast<uint32_t>(sentBytesEnc - aznumeric_cast<int32_t>(size));
+            m_sentPacketsEncrypted++;
+
+            return CommitBatchedSend(address, aznumeric_cast<uint32_t>(sentBytesEnc));
+        }
+
+        uint8_t encrpytedSendBuffer[MaxUdpTransmissionUnit];
         const int32_t sentBytesEnc = BIO_read(dtlsEndpoint.m_writeBio, encrpytedSendBuffer, sizeof(encrpytedSendBuffer));
 
         // Track encryption metrics
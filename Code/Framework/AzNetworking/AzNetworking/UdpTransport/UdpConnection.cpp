@@ -162,7 +162,7 @@ namespace AzNetworking
         }
     }
 
-    void UdpConnection::ProcessSent(PacketId packetId, [[maybe_unused]] const IPacket& packet, 
+    void UdpConnection::ProcessSent(PacketId packetId, [[maybe_unused]] PacketType packetType, 
         uint32_t packetSize, [[maybe_unused]] ReliabilityType reliability)
     {
         const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
@@ -105,17 +105,18 @@ namespace AzNetworking
     protected:
 
         //! Prepare a reliable packet for transmission.
-        //! @param packetId identifier of the packet being sent
-        //! @param packet   reference to the packet being transmitted
+        //! @param packetId   identifier of the packet being sent
+        //! @param packetType type of the packet being sent
+        //! @param payload    the serialized payload of the packet being transmitted
         //! @return boolean true on success, false on failure
-        bool PrepareReliablePacketForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet);
+        bool PrepareReliablePacketForSend(PacketId packetId, SequenceId reliableSequenceId, PacketType packetType, const UdpPacketBufferPtr& payload);
 
         //! Process a packet for sending.
         //! @param packetId   identifier of the packet being sent
-        //! @param packet     reference to the packet being transmitted
+        //! @param packetType type of the packet being transmitted
         //! @param packetSize packet size in bytes
         //! @param reliability whether or not to guarantee delivery
-        void ProcessSent(PacketId packetId, const IPacket& packet, uint32_t packetSize, ReliabilityType reliability);
+        void ProcessSent(PacketId packetId, PacketType packetType, uint32_t packetSize, ReliabilityType reliability);
 
         //! Process a timed out packet header.
         //! @param packetId    identifier of the packet that timed out
@@ -50,8 +50,8 @@ namespace AzNetworking
         return m_timeoutId;
     }
 
-    inline bool UdpConnection::PrepareReliablePacketForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet)
+    inline bool UdpConnection::PrepareReliablePacketForSend(PacketId packetId, SequenceId reliableSequenceId, PacketType packetType, const UdpPacketBufferPtr& payload)
     {
-        return m_reliableQueue.PrepareForSend(packetId, reliableSequenceId, packet);
+        return m_reliableQueue.PrepareForSend(packetId, reliableSequenceId, packetType, payload);
     }
 }
@@ -37,8 +37,12 @@ namespace AzNetworking
     AZ_CVAR(int32_t, net_MaxTimeoutsPerFrame, 1000, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Maximum number of packet timeouts to allow to process in a single frame");
     AZ_CVAR(float, net_RttFudgeScalar, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar value to multiply computed Rtt by to determine an optimal packet timeout threshold");
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
+    AZ_CVAR(uint32_t, net_UdpPacketBufferPoolSize, 256, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The maximum number of released packet buffers of each size class each Udp network interface keeps around for reuse");
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
 
+    // A socket that only connects out hears from few endpoints, so it doesn't need a queue as deep as a listening socket's
+    static constexpr uint32_t ConnectReceivePacketCount = UdpReaderThread::MaxUdpReceivePacketCount / 4;
+
     static uint64_t ConstructTimeoutId(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability)
     {
         const uint64_t intConnectionId = aznumeric_cast<uint64_t>(connectionId);
@@ -55,21 +59,27 @@ namespace AzNetworking
         outReliability = ((timeoutId & 0x8000000000000000) > 0) ? ReliabilityType::Reliable : ReliabilityType::Unreliable;
     }
 
-    UdpNetworkInterface::UdpNetworkInterface(AZ::Name name, IConnectionListener& connectionListener, TrustZone trustZone, UdpReaderThread& readerThread)
+    UdpNetworkInterface::UdpNetworkInterface(AZ::Name name, IConnectionListener& connectionListener, TrustZone trustZone, UdpReaderThreads& readerThreads)
         : m_name(name)
         , m_trustZone(trustZone)
         , m_connectionListener(connectionListener)
+        , m_packetBufferPool(net_UdpPacketBufferPoolSize)
         , m_socket(net_UdpUseEncryption ? new DtlsSocket() : new UdpSocket())
-        , m_readerThread(readerThread)
+        , m_readerThreads(readerThreads)
     {
         const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_UdpCompressor);
         const AZ::Name compressorName = AZ::Name(compressor);
         m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(compressorName);
+        if (m_compressor && m_compressor->RequiresOrderedDelivery())
+        {
+            AZLOG_ERROR("UDP compressor %s requires ordered delivery and can only be used for TCP, UDP traffic will not be compressed", compressor.c_str());
+            m_compressor.reset();
+        }
     }
 
     UdpNetworkInterface::~UdpNetworkInterface()
     {
-        m_readerThread.UnregisterSocket(m_socket.get());
+        UnregisterReceiveShards();
     }
 
     AZ::Name UdpNetworkInterface::GetName() const
@@ -112,15 +122,37 @@ namespace AzNetworking
 
         m_port = port;
         m_allowIncomingConnections = true;
-        if (m_socket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
+
+        // Shard the listen port across all reader threads, the kernel hashes each remote endpoint to a single shard
+        uint32_t shardCount = 1;
+#if AZ_TRAIT_USE_SOCKET_REUSEPORT
+        if (m_port != 0)
         {
-            m_readerThread.RegisterSocket(m_socket.get());
-            return true;
+            shardCount = aznumeric_cast<uint32_t>(m_readerThreads.size());
         }
-        else
+#endif
+
+        m_socket->SetReusePort(shardCount > 1);
+        if (!m_socket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
         {
             return false;
         }
+        RegisterReceiveShard(*m_socket, 0, UdpReaderThread::MaxUdpReceivePacketCount);
+
+        // Additional shards only receive, all sends and encryption go through m_socket
+        for (uint32_t shardIndex = 1; shardIndex < shardCount; ++shardIndex)
+        {
+            AZStd::unique_ptr<UdpSocket> shardSocket = AZStd::make_unique<UdpSocket>();
+            shardSocket->SetReusePort(true);
+            if (!shardSocket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
+            {
+                AZLOG_WARN("Failed to open receive shard %u/%u on port %u, continuing with fewer shards", shardIndex, shardCount, aznumeric_cast<uint32_t>(m_port));
+                break;
+            }
+            RegisterReceiveShard(*shardSocket, shardIndex, UdpReaderThread::MaxUdpReceivePacketCount);
+            m_shardSockets.emplace_back(AZStd::move(shardSocket));
+        }
+        return true;
     }
 
     ConnectionId UdpNetworkInterface::Connect(const IpAddress& remoteAddress)
@@ -129,7 +161,16 @@ namespace AzNetworking
         {
             if (m_socket->Open(m_port, UdpSocket::CanAcceptConnections::False, m_trustZone))
             {
-                m_readerThread.RegisterSocket(m_socket.get());
+                // Outgoing only sockets go to whichever reader thread is least loaded
+                uint32_t readerThreadIndex = 0;
+                for (uint32_t i = 1; i < m_readerThreads.size(); ++i)
+                {
+                    if (m_readerThreads[i]->GetSocketCount() < m_readerThreads[readerThreadIndex]->GetSocketCount())
+                    {
+                        readerThreadIndex = i;
+                    }
+                }
+                RegisterReceiveShard(*m_socket, readerThreadIndex, ConnectReceivePacketCount);
             }
             else
             {
@@ -152,6 +193,7 @@ namespace AzNetworking
         // Signal the connection attempt
         CorePackets::InitiateConnectionPacket connectPacket = CorePackets::InitiateConnectionPacket();
         connectPacket.SetHandshakeBuffer(dtlsData);
+        connectPacket.SetCompressorType(GetCompressorType(m_compressor.get()));
         connection->SendReliablePacket(connectPacket);
 
         m_connectionListener.OnConnect(connection.get());
@@ -167,148 +209,33 @@ namespace AzNetworking
         }
 
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
-        const UdpReaderThread::ReceivedPackets* packets = m_readerThread.GetReceivedPackets(m_socket.get());
-        if (packets == nullptr)
-        {
-            // Socket is not yet registered with the reader thread and is likely still pending, try again later
-            return;
-        }
-
-        for (uint32_t i = 0; i < packets->size(); ++i)
-        {
-            const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
-            const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
-
-            // Don't exceed our timeslice, even if unprocessed data remains
-            if ((currentTimeMs - startTimeMs) > net_UdpPacketTimeSliceMs)
-            {
-                AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(packets->size() - i), aznumeric_cast<int32_t>(packets->size()));
-                GetMetrics().m_discardedPackets += packets->size() - i;
-                break;
-            }
-
-            UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
-            if (connection == nullptr)
-            {
-                AcceptConnection(packet);
-                continue;
-            }
 
-            const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(packet.m_receivedBytes);
-            if (disconnectReason != DisconnectReason::MAX)
-            {
-                connection->Disconnect(disconnectReason, TerminationEndpoint::Local);
-                continue;
-            }
-            
-            const ConnectionState connectionState = connection->GetConnectionState();
-            if (connectionState == ConnectionState::Disconnecting || connectionState == ConnectionState::Disconnected)
-            {
-                // Skip packets from disconnected connections
-                continue;
-            }
-
-            int32_t decodedPacketSize = 0;
-            m_decryptBuffer.Resize(m_decryptBuffer.GetCapacity());
-            const uint8_t* decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, m_decryptBuffer.GetBuffer(), decodedPacketSize);
-            m_decryptBuffer.Resize(decodedPacketSize);
+        // Acks, handshake replies and retransmits generated while updating go out in one batch
+        m_socket->BeginSendBatch();
 
-            if (decodedPacketSize == 0)
-            {
-                // OpenSSL may have consumed packets during handshake negotiation
-                continue;
-            }
-            else if (decodedPacketSize < 0)
+        bool timeSliceExceeded = false;
+        for (ReceiveShard& shard : m_receiveShards)
+        {
+            UdpReceiveQueue& receiveQueue = *shard.m_receiveQueue;
+            const uint32_t packetCount = receiveQueue.GetReadableCount();
+            for (uint32_t i = 0; i < packetCount; ++i)
             {
-                // Late unencrypted handshake packets or just random garbage can show up, discard and continue
-                continue;
-            }
+                const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
 
-            connection->GetMetrics().m_recvDatarate.LogPacket(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
-            connection->GetMetrics().m_packetsRecv++;
-
-            // Decode the packet flag bitset first since it's always uncompressed
-            UdpPacketHeader header;
-            {
-                NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
-                if (!header.SerializePacketFlags(flagSerializer))
+                // Don't exceed our timeslice, even if unprocessed data remains
+                if (timeSliceExceeded || ((currentTimeMs - startTimeMs) > net_UdpPacketTimeSliceMs))
                 {
-                    continue;
+                    AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(packetCount - i), aznumeric_cast<int32_t>(packetCount));
+                    GetMetrics().m_discardedPackets += packetCount - i;
+                    timeSliceExceeded = true;
+                    break;
                 }
-                // Adjust decoded tracking to represent the payload now that we've grabbed the flags
-                decodedPacketData = flagSerializer.GetUnreadData();
-                decodedPacketSize = flagSerializer.GetUnreadSize();
-                GetMetrics().m_recvBytesUncompressed += flagSerializer.GetReadSize();
-            }
 
-            if (m_compressor && header.IsPacketFlagSet(PacketFlag::Compressed))
-            {
-                // Only the payload is compressed
-                if (!DecompressPacket(decodedPacketData, decodedPacketSize, m_decompressBuffer))
-                {
-                    AZLOG_WARN("Failed to decompress packet!");
-                    continue;
-                }
-                decodedPacketData = m_decompressBuffer.GetBuffer();
-                decodedPacketSize = m_decompressBuffer.GetSize();
+                ProcessReceivedPacket(receiveQueue.GetPacket(i), startTimeMs, currentTimeMs);
             }
-            GetMetrics().m_recvBytesUncompressed += decodedPacketSize;
 
-            TimeoutQueue::TimeoutItem* timeoutItem = m_connectionTimeoutQueue.RetrieveItem(connection->GetTimeoutId());
-            if (timeoutItem == nullptr)
-            {
-                connection->Disconnect(DisconnectReason::Unknown, TerminationEndpoint::Local);
-                continue;
-            }
-            else
-            {
-                // Deserialize the packet header
-                NetworkOutputSerializer packetSerializer(decodedPacketData, decodedPacketSize);
-                ISerializer& serializer = packetSerializer; // To get the default typeinfo parameters in ISerializer
-                if (!serializer.Serialize(header, "Header"))
-                {
-                    continue;
-                }
-
-                // Note that the serializer passed in here is unused for UDP
-                if (!connection->ProcessReceived(header, packetSerializer, packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs))
-                {
-                    continue;
-                }
-
-                timeoutItem->UpdateTimeoutTime(startTimeMs);
-
-                bool handledPacket = false;
-                if (header.GetPacketType() < aznumeric_cast<PacketType>(CorePackets::PacketType::MAX))
-                {
-                    handledPacket = connection->HandleCorePacket(m_connectionListener, header, packetSerializer);
-                }
-                else
-                {
-                    handledPacket = m_connectionListener.OnPacketReceived(connection, header, packetSerializer);
-                }
-
-                if (handledPacket)
-                {
-                    connection->UpdateHeartbeat(currentTimeMs);
-                    if (connection->GetConnectionState() == ConnectionState::Connecting && !connection->GetDtlsEndpoint().IsConnecting())
-                    {
-                        // Connection is realized once a packet is received and socket handshake is verified complete
-                        connection->m_state = ConnectionState::Connected;
-                    }
-                }
-                else if (m_socket->IsEncrypted() && connection->GetDtlsEndpoint().IsConnecting() &&
-                    !IsHandshakePacket(connection->GetDtlsEndpoint(), header.GetPacketType()))
-                {
-                    // It's possible for one side to finish its half of the handshake and start sending encrypted data
-                    // If it's not an expected unencrypted type then skip it for now
-                    continue;
-                }
-                else if (connection->GetConnectionState() != ConnectionState::Disconnecting)
-                {
-                    connection->Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
-                }
-            }
+            // Hand the slots back to the reader thread
+            receiveQueue.Release(packetCount);
         }
         const AZ::TimeMs receiveTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
 
@@ -332,18 +259,168 @@ namespace AzNetworking
         }
         m_removedConnections.clear();
 
+        m_socket->EndSendBatch();
+
         // Update metrics
         GetMetrics().m_sendPackets = m_socket->GetSentPackets();
+        GetMetrics().m_sendCalls = m_socket->GetSendCalls();
         GetMetrics().m_sendBytes = m_socket->GetSentBytes();
         GetMetrics().m_sendPacketsEncrypted = m_socket->GetSentPacketsEncrypted();
         GetMetrics().m_sendBytesEncryptionInflation = m_socket->GetSentBytesEncryptionInflation();
+        GetMetrics().m_sendBytesCopied = m_sendBytesCopied + m_socket->GetSentBytesCopied();
         GetMetrics().m_recvTimeMs += receiveTimeMs;
-        GetMetrics().m_recvPackets = m_socket->GetRecvPackets();
-        GetMetrics().m_recvBytes = m_socket->GetRecvBytes();
+        GetMetrics().m_recvPackets = 0;
+        GetMetrics().m_recvCalls = 0;
+        GetMetrics().m_recvBytes = 0;
+        GetMetrics().m_recvQueueDrops = 0;
+        for (const ReceiveShard& shard : m_receiveShards)
+        {
+            GetMetrics().m_recvPackets += shard.m_socket->GetRecvPackets();
+            GetMetrics().m_recvCalls += shard.m_socket->GetRecvCalls();
+            GetMetrics().m_recvBytes += shard.m_socket->GetRecvBytes();
+            GetMetrics().m_recvQueueDrops += shard.m_receiveQueue->GetDroppedCount();
+        }
         GetMetrics().m_connectionCount = m_connectionSet.GetConnectionCount();
         GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
 
+    void UdpNetworkInterface::ProcessReceivedPacket(const UdpReaderThread::ReceivedPacket& packet, AZ::TimeMs startTimeMs, AZ::TimeMs currentTimeMs)
+    {
+        // Packets from a remote endpoint may arrive on any shard, connections are looked up by remote address only
+        UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
+        if (connection == nullptr)
+        {
+            AcceptConnection(packet);
+            return;
+        }
+
+        const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(packet.m_receivedBytes);
+        if (disconnectReason != DisconnectReason::MAX)
+        {
+            connection->Disconnect(disconnectReason, TerminationEndpoint::Local);
+            return;
+        }
+        
+        const ConnectionState connectionState = connection->GetConnectionState();
+        if (connectionState == ConnectionState::Disconnecting || connectionState == ConnectionState::Disconnected)
+        {
+            // Skip packets from disconnected connections
+            return;
+        }
+
+        int32_t decodedPacketSize = 0;
+        m_decryptBuffer.Resize(m_decryptBuffer.GetCapacity());
+        const uint8_t* decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, m_decryptBuffer.GetBuffer(), decodedPacketSize);
+        m_decryptBuffer.Resize(decodedPacketSize);
+
+        if (decodedPacketSize == 0)
+        {
+            // OpenSSL may have consumed packets during handshake negotiation
+            return;
+        }
+        else if (decodedPacketSize < 0)
+        {
+            // Late unencrypted handshake packets or just random garbage can show up, discard and continue
+            return;
+        }
+
+        connection->GetMetrics().m_recvDatarate.LogPacket(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
+        connection->GetMetrics().m_packetsRecv++;
+
+        // Decode the packet flag bitset first since it's always uncompressed
+        UdpPacketHeader header;
+        {
+            NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
+            if (!header.SerializePacketFlags(flagSerializer))
+            {
+                return;
+            }
+            // Adjust decoded tracking to represent the payload now that we've grabbed the flags
+            decodedPacketData = flagSerializer.GetUnreadData();
+            decodedPacketSize = flagSerializer.GetUnreadSize();
+            GetMetrics().m_recvBytesUncompressed += flagSerializer.GetReadSize();
+        }
+
+        if (m_compressor && header.IsPacketFlagSet(PacketFlag::Compressed))
+        {
+            // Only the payload is compressed
+            if (!DecompressPacket(decodedPacketData, decodedPacketSize, m_decompressBuffer))
+            {
+                AZLOG_WARN("Failed to decompress packet!");
+                return;
+            }
+            decodedPacketData = m_decompressBuffer.GetBuffer();
+            decodedPacketSize = m_decompressBuffer.GetSize();
+        }
+        GetMetrics().m_recvBytesUncompressed += decodedPacketSize;
+
+        TimeoutQueue::TimeoutItem* timeoutItem = m_connectionTimeoutQueue.RetrieveItem(connection->GetTimeoutId());
+        if (timeoutItem == nullptr)
+        {
+            connection->Disconnect(DisconnectReason::Unknown, TerminationEndpoint::Local);
+            return;
+        }
+        else
+        {
+            // Deserialize the packet header
+            NetworkOutputSerializer packetSerializer(decodedPacketData, decodedPacketSize);
+            ISerializer& serializer = packetSerializer; // To get the default typeinfo parameters in ISerializer
+            if (!serializer.Serialize(header, "Header"))
+            {
+                return;
+            }
+
+            // Note that the serializer passed in here is unused for UDP
+            if (!connection->ProcessReceived(header, packetSerializer, packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs))
+            {
+                return;
+            }
+
+            timeoutItem->UpdateTimeoutTime(startTimeMs);
+
+            bool handledPacket = false;
+            if (header.GetPacketType() < aznumeric_cast<PacketType>(CorePackets::PacketType::MAX))
+            {
+                handledPacket = connection->HandleCorePacket(m_connectionListener, header, packetSerializer);
+            }
+            else
+            {
+                handledPacket = m_connectionListener.OnPacketReceived(connection, header, packetSerializer);
+            }
+
+            if (handledPacket)
+            {
+                connection->UpdateHeartbeat(currentTimeMs);
+                if (connection->GetConnectionState() == ConnectionState::Connecting && !connection->GetDtlsEndpoint().IsConnecting())
+                {
+                    // Connection is realized once a packet is received and socket handshake is verified complete
+                    connection->m_state = ConnectionState::Connected;
+                }
+            }
+            else if (m_socket->IsEncrypted() && connection->GetDtlsEndpoint().IsConnecting() &&
+                !IsHandshakePacket(connection->GetDtlsEndpoint(), header.GetPacketType()))
+            {
+                // It's possible for one side to finish its half of the handshake and start sending encrypted data
+                // If it's not an expected unencrypted type then skip it for now
+                return;
+            }
+            else if (connection->GetConnectionState() != ConnectionState::Disconnecting)
+            {
+                connection->Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
+            }
+        }
+    }
+
+    void UdpNetworkInterface::BeginSendBatch()
+    {
+        m_socket->BeginSendBatch();
+    }
+
+    void UdpNetworkInterface::EndSendBatch()
+    {
+        m_socket->EndSendBatch();
+    }
+
     bool UdpNetworkInterface::SendReliablePacket(ConnectionId connectionId, const IPacket& packet)
     {
         IConnection* connection = m_connectionSet.GetConnection(connectionId);
@@ -382,7 +459,7 @@ namespace AzNetworking
         }
 
         m_port = 0;
-        m_readerThread.UnregisterSocket(m_socket.get());
+        UnregisterReceiveShards();
         m_allowIncomingConnections = false;
         m_socket->Close();
         return true;
@@ -403,6 +480,11 @@ namespace AzNetworking
         return m_socket->IsEncrypted();
     }
 
+    bool UdpNetworkInterface::IsCompressed() const
+    {
+        return m_compressor != nullptr;
+    }
+
     bool UdpNetworkInterface::IsOpen() const
     {
         return m_socket->IsOpen();
@@ -448,12 +530,33 @@ namespace AzNetworking
 
     PacketId UdpNetworkInterface::SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence)
     {
-        AZLOG(NET_DebugPacketSend, "Sending packet type %u to remote address %s", aznumeric_cast<uint32_t>(packet.GetPacketType()), connection.GetRemoteAddress().GetString().c_str());
+        // Serialize the payload once, directly into a pooled buffer with room for the header in front of it
+        // The same buffer is retained by the reliable queue, so reliable retransmits never reserialize the packet
+        UdpPacketBufferPtr payload = m_packetBufferPool.Acquire();
+        {
+            NetworkInputSerializer networkSerializer(payload->GetBuffer(), UdpPacketBuffer::PayloadCapacity);
+            ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
+
+            if (!serializer.Serialize(const_cast<IPacket&>(packet), "Payload"))
+            {
+                AZLOG_ERROR("Packet type %u failed payload serialization and will not be sent", aznumeric_cast<uint32_t>(packet.GetPacketType()));
+                return InvalidPacketId;
+            }
+
+            payload->Resize(serializer.GetSize());
+        }
+
+        return SendPayload(connection, packet.GetPacketType(), payload, reliableSequence);
+    }
+
+    PacketId UdpNetworkInterface::SendPayload(UdpConnection& connection, PacketType packetType, const UdpPacketBufferPtr& serializedPayload, SequenceId reliableSequence)
+    {
+        AZLOG(NET_DebugPacketSend, "Sending packet type %u to remote address %s", aznumeric_cast<uint32_t>(packetType), connection.GetRemoteAddress().GetString().c_str());
 
         // The ordering inside this function is incredibly important and fragile
         const IpAddress& address = connection.GetRemoteAddress();
         // We don't want to compress the initial InitiateConnectionPacket, ConnectionHandshakePackets or FragmentedPackets of those two
-        const bool shouldCompress = packet.GetPacketType() != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket);
+        const bool shouldCompress = packetType != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket);
 
         if (address.GetAddress(ByteOrder::Host) == 0)
         {
@@ -462,17 +565,28 @@ namespace AzNetworking
 
         const ReliabilityType reliabilityType = (reliableSequence == InvalidSequenceId) ? ReliabilityType::Unreliable : ReliabilityType::Reliable;
 
+        // Reliable payloads are retained until they are acked, so they are moved to a buffer sized for them
+        UdpPacketBufferPtr payload = serializedPayload;
+        if (reliabilityType == ReliabilityType::Reliable)
+        {
+            payload = m_packetBufferPool.Compact(serializedPayload);
+            if (payload != serializedPayload)
+            {
+                m_sendBytesCopied += payload->GetSize();
+            }
+        }
+
         // Check if we need to fragment this packet first
         // We don't ack aggregate packets that get fragmented, so we want to get this chunk out of the way before
         // we start throwing PacketId's and SequenceId's into our other tracking data structures below
-        UdpPacketHeader header(connection.GetPacketTracker(), packet.GetPacketType(), reliableSequence);
+        UdpPacketHeader header(connection.GetPacketTracker(), packetType, reliableSequence);
         const PacketId localPacketId = header.GetPacketId();
 
         // If it's a reliable packet, make sure our reliable queue knows about it now because we might need to drop it if our connection is
         // not set up
         if (reliabilityType == ReliabilityType::Reliable)
         {
-            if (!connection.PrepareReliablePacketForSend(localPacketId, reliableSequence, packet))
+            if (!connection.PrepareReliablePacketForSend(localPacketId, reliableSequence, packetType, payload))
             {
                 connection.Disconnect(DisconnectReason::ReliableQueueFull, TerminationEndpoint::Local);
             }
@@ -481,21 +595,21 @@ namespace AzNetworking
         // If we're still connecting, only transmit packets related to establishing connection and queue the rest for later
         // This implicitly enforces that the only FragmentedPackets sent here are of ConnectionHandshakePacket
         // Other large packets are simply queued before they are fragmented
-        if (connection.GetDtlsEndpoint().IsConnecting() && !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType()))
+        if (connection.GetDtlsEndpoint().IsConnecting() && !IsHandshakePacket(connection.GetDtlsEndpoint(), packetType))
         {
             // IMPORTANT that we register with the timeout queue here, otherwise we don't have the timer to pop for reliable packets
             RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
             AZLOG(
                 NET_DebugDtls, "Connection is still in handshake negotiation, blocking packet send for packet type %d",
-                (int)packet.GetPacketType());
+                (int)packetType);
             return localPacketId;
         }
 
-        UdpPacketEncodingBuffer buffer;
+        // Serialize the flags and header on their own, then place them in the headroom directly in front of the payload
+        uint8_t headerBuffer[UdpPacketBuffer::Headroom];
+        uint32_t headerSize = 0;
         {
-            buffer.Resize(buffer.GetCapacity());
-
-            NetworkInputSerializer networkSerializer(buffer.GetBuffer(), buffer.GetCapacity());
+            NetworkInputSerializer networkSerializer(headerBuffer, sizeof(headerBuffer));
             ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
 
             if (!header.SerializePacketFlags(serializer))
@@ -510,16 +624,12 @@ namespace AzNetworking
                 return InvalidPacketId;
             }
 
-            if (!serializer.Serialize(const_cast<IPacket&>(packet), "Payload"))
-            {
-                AZLOG_ERROR("PacketId %u failed payload serialization and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
-                return InvalidPacketId;
-            }
-
-            buffer.Resize(serializer.GetSize());
+            headerSize = serializer.GetSize();
         }
-        uint32_t packetSize = buffer.GetSize();
-        uint8_t* packetData = buffer.GetBuffer();
+        const uint32_t uncompressedSize = headerSize + payload->GetSize();
+        uint32_t packetSize = uncompressedSize;
+        uint8_t* packetData = payload->Prepend(headerBuffer, headerSize);
+        m_sendBytesCopied += headerSize;
 
         // If the packet doesn't fit within our MTU (minus potential SSL encryption overhead), break it up
         if (packetSize > connection.GetConnectionMtu() - net_SslInflationOverhead)
@@ -531,12 +641,14 @@ namespace AzNetworking
             const uint8_t* chunkStart = packetData;
             const SequenceId fragmentedSequence = connection.m_fragmentQueue.GetNextFragmentedSequenceId();
             uint32_t bytesRemaining = packetSize;
-            ChunkBuffer chunkBuffer;
+            // Chunks are copied straight into the fragment packet, which is then serialized into its own pooled buffer
+            CorePackets::FragmentedPacket fragmentedPacket(ToSequenceId(localPacketId), fragmentedSequence, 0, aznumeric_cast<uint8_t>(numChunks), ChunkBuffer());
             for (uint32_t chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
             {
                 const uint32_t nextChunkSize = AZStd::min(bytesRemaining, chunkSize);
-                chunkBuffer.CopyValues(chunkStart, nextChunkSize);
-                CorePackets::FragmentedPacket fragmentedPacket(ToSequenceId(localPacketId), fragmentedSequence, aznumeric_cast<uint8_t>(chunkIndex), aznumeric_cast<uint8_t>(numChunks), chunkBuffer);
+                fragmentedPacket.SetChunkIndex(aznumeric_cast<uint8_t>(chunkIndex));
+                fragmentedPacket.ModifyChunkBuffer().CopyValues(chunkStart, nextChunkSize);
+                m_sendBytesCopied += nextChunkSize;
                 const SequenceId chunkReliableId = (reliabilityType == ReliabilityType::Reliable) ? connection.m_reliableQueue.GetNextSequenceId() : InvalidSequenceId;
                 SendPacket(connection, fragmentedPacket, chunkReliableId);
                 bytesRemaining -= nextChunkSize;
@@ -547,10 +659,13 @@ namespace AzNetworking
             return localPacketId;
         }
 
-        UdpPacketEncodingBuffer writeBuffer;
+        UdpPacketBufferPtr compressedBuffer;
         if (m_compressor && shouldCompress)
         {
-            NetworkInputSerializer flagSerializer(writeBuffer.GetBuffer(), writeBuffer.GetCapacity());
+            compressedBuffer = m_packetBufferPool.Acquire();
+            uint8_t* compressedData = compressedBuffer->GetBuffer();
+
+            NetworkInputSerializer flagSerializer(compressedData, UdpPacketBuffer::PayloadCapacity);
             ISerializer& serializer = flagSerializer; // To get the default typeinfo parameters in ISerializer
 
             header.SetPacketFlag(PacketFlag::Compressed, true);
@@ -563,11 +678,11 @@ namespace AzNetworking
             AZ_Assert(flagSize == 1, "Flag bitfield should serialize to one byte");
 
             // Compress the packet, make sure to offset by the size of the flag which is now serialized
-            const uint32_t payloadSize = buffer.GetSize() - flagSize;
-            uint8_t* payload = buffer.GetBuffer() + flagSize;
-            const AZStd::size_t maxSizeNeeded = m_compressor->GetMaxCompressedBufferSize(payloadSize);
+            const uint32_t compressInputSize = uncompressedSize - flagSize;
+            const uint8_t* compressInput = packetData + flagSize;
+            const AZStd::size_t maxSizeNeeded = m_compressor->GetMaxCompressedBufferSize(compressInputSize);
             AZStd::size_t compressionMemBytesUsed = 0;
-            CompressorError compErr = m_compressor->Compress(payload, payloadSize, writeBuffer.GetBuffer() + flagSize, maxSizeNeeded, compressionMemBytesUsed);
+            CompressorError compErr = m_compressor->Compress(compressInput, compressInputSize, compressedData + flagSize, maxSizeNeeded, compressionMemBytesUsed);
 
             if (compErr != CompressorError::Ok)
             {
@@ -576,11 +691,11 @@ namespace AzNetworking
             }
 
             // Only use compression if there's actual gain
-            if (compressionMemBytesUsed < payloadSize)
+            if (compressionMemBytesUsed < compressInputSize)
             {
-                writeBuffer.Resize(aznumeric_cast<int32_t>(flagSize + compressionMemBytesUsed));
-                packetSize = writeBuffer.GetSize();
-                packetData = writeBuffer.GetBuffer();
+                compressedBuffer->Resize(aznumeric_cast<uint32_t>(flagSize + compressionMemBytesUsed));
+                packetSize = compressedBuffer->GetSize();
+                packetData = compressedData;
                 // Track byte delta caused by compression
                 GetMetrics().m_sendBytesCompressedDelta += (packetSize - compressionMemBytesUsed);
             }        
@@ -594,14 +709,14 @@ namespace AzNetworking
             aznumeric_cast<uint32_t>(header.GetSequenceWindow())
         );
 
-        AZLOG(NET_DebugDtls, "Connection is sending packet type %d", aznumeric_cast<int32_t>(packet.GetPacketType()));
+        AZLOG(NET_DebugDtls, "Connection is sending packet type %d", aznumeric_cast<int32_t>(packetType));
         // If we're not connected then we're still handshaking and require packets to be unencrypted
-        const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType());
+        const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packetType);
         if (m_socket->Send(address, packetData, packetSize, shouldEncrypt, connection.GetDtlsEndpoint(), connection.GetConnectionQuality()))
         {
             RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
-            connection.ProcessSent(localPacketId, packet, packetSize + UdpPacketHeaderSize, reliabilityType);
-            GetMetrics().m_sendBytesUncompressed += buffer.GetSize() + UdpPacketHeaderSize + (shouldEncrypt ? DtlsPacketHeaderSize : 0);
+            connection.ProcessSent(localPacketId, packetType, packetSize + UdpPacketHeaderSize, reliabilityType);
+            GetMetrics().m_sendBytesUncompressed += uncompressedSize + UdpPacketHeaderSize + (shouldEncrypt ? DtlsPacketHeaderSize : 0);
             return localPacketId;
         }
         else
@@ -651,6 +766,11 @@ namespace AzNetworking
                 }
             }
 
+            if (!ValidateRemoteCompressorType(m_compressor.get(), packet.GetCompressorType(), connectPacket.m_address))
+            {
+                return;
+            }
+
             // Retrieve the connection type, and run application layer connection filtering (state checks, CIDR address filtering, etc..)
             const ConnectResult connectResult = m_connectionListener.ValidateConnect(connectPacket.m_address, header, networkSerializer);
 
@@ -679,6 +799,26 @@ namespace AzNetworking
         m_connectionSet.AddConnection(AZStd::move(connection));
     }
 
+    void UdpNetworkInterface::RegisterReceiveShard(UdpSocket& socket, uint32_t readerThreadIndex, uint32_t queueCapacity)
+    {
+        UdpReaderThread* readerThread = m_readerThreads[readerThreadIndex % m_readerThreads.size()].get();
+        UdpReceiveQueue* receiveQueue = readerThread->RegisterSocket(&socket, queueCapacity);
+        if (receiveQueue != nullptr)
+        {
+            m_receiveShards.emplace_back(ReceiveShard{ &socket, readerThread, receiveQueue });
+        }
+    }
+
+    void UdpNetworkInterface::UnregisterReceiveShards()
+    {
+        for (const ReceiveShard& shard : m_receiveShards)
+        {
+            shard.m_readerThread->UnregisterSocket(shard.m_socket);
+        }
+        m_receiveShards.clear();
+        m_shardSockets.clear();
+    }
+
     void UdpNetworkInterface::RequestDisconnect(UdpConnection* connection, DisconnectReason reason, TerminationEndpoint endpoint)
     {
         if (connection == nullptr)
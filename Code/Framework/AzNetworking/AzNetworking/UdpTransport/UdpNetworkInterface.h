@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzNetworking/UdpTransport/UdpPacketBuffer.h>
 #include <AzNetworking/UdpTransport/UdpPacketHeader.h>
 #include <AzNetworking/UdpTransport/UdpConnectionSet.h>
 #include <AzNetworking/UdpTransport/UdpReaderThread.h>
@@ -66,6 +67,9 @@ namespace AzNetworking
     //! on a given packet, we operate on a bit in the packet's Flags. The Sender writes this bit while the Receiver checks it to
     //! see if a packet needs to be decompressed.
     //! 
+    //! A single compressor is shared by every connection, and packets may be lost or reordered, so compressors that report
+    //! RequiresOrderedDelivery() are rejected and the interface sends uncompressed.
+    //! 
     //! O3DE could potentially move from over MTU to under with compression, and the UDP interface doesn't check for this. Detecting a change
     //! that would reduce the number of fragmented packets would require pre-emptively compressing payloads to tell if that change happened,
     //! which could potentially lead to a lot of unnecessary calls to the compressor.
@@ -84,8 +88,8 @@ namespace AzNetworking
         //! @param name               the name of this network interface instance.
         //! @param connectionListener reference to the connection listener responsible for handling all connection events
         //! @param trustZone          the trust level assigned to this network interface, server to server or client to server
-        //! @param readerThread       pointer to the reader thread to be bound to this network interface
-        UdpNetworkInterface(AZ::Name name, IConnectionListener& connectionListener, TrustZone trustZone, UdpReaderThread& readerThread);
+        //! @param readerThreads      the reader threads this network interface's sockets will be spread across
+        UdpNetworkInterface(AZ::Name name, IConnectionListener& connectionListener, TrustZone trustZone, UdpReaderThreads& readerThreads);
         ~UdpNetworkInterface() override;
 
         //! INetworkInterface interface.
@@ -99,6 +103,8 @@ namespace AzNetworking
         bool Listen(uint16_t port) override;
         ConnectionId Connect(const IpAddress& remoteAddress) override;
         void Update(AZ::TimeMs deltaTimeMs) override;
+        void BeginSendBatch() override;
+        void EndSendBatch() override;
         bool SendReliablePacket(ConnectionId connectionId, const IPacket& packet) override;
         PacketId SendUnreliablePacket(ConnectionId connectionId, const IPacket& packet) override;
         bool WasPacketAcked(ConnectionId connectionId, PacketId packetId) override;
@@ -110,6 +116,10 @@ namespace AzNetworking
         //! @return boolean true if this is an encrypted socket, false if not
         bool IsEncrypted() const;
 
+        //! Returns true if payloads are run through a compressor, false if not.
+        //! @return boolean true if payloads are run through a compressor, false if not
+        bool IsCompressed() const;
+
         //! Returns true if this connection instance is in an open state, and is capable of actively sending and receiving packets.
         //! @return boolean true if this connection instance is in an open state
         bool IsOpen() const;
@@ -137,6 +147,29 @@ namespace AzNetworking
         //! @return packet id for the transmitted packet
         PacketId SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence);
 
+        //! Sends an already serialized packet payload to the remote connection, writing a fresh header in front of it.
+        //! @param connection         the UdpConnection instance to send the packet on
+        //! @param packetType         type of the serialized packet
+        //! @param serializedPayload  the serialized packet payload, a copy in a buffer of its size class is retained by the reliable queue for reliable packets
+        //! @param reliableSequence   the reliable sequence number to use for this packet, providing InvalidSequenceId will cause the packet to be sent unreliably
+        //! @return packet id for the transmitted packet
+        PacketId SendPayload(UdpConnection& connection, PacketType packetType, const UdpPacketBufferPtr& serializedPayload, SequenceId reliableSequence);
+
+        //! Processes a single packet handed over by a reader thread.
+        //! @param packet        the received packet
+        //! @param startTimeMs   the time the current update started
+        //! @param currentTimeMs the current time
+        void ProcessReceivedPacket(const UdpReaderThread::ReceivedPacket& packet, AZ::TimeMs startTimeMs, AZ::TimeMs currentTimeMs);
+
+        //! Registers a socket with a reader thread, received packets will be consumed from the returned queue during Update.
+        //! @param socket            the socket to read from
+        //! @param readerThreadIndex index of the reader thread to register with, wrapped to the number of reader threads
+        //! @param queueCapacity     the number of packets that may be pending processing for this socket
+        void RegisterReceiveShard(UdpSocket& socket, uint32_t readerThreadIndex, uint32_t queueCapacity);
+
+        //! Unregisters all sockets from their reader threads and closes any additional shard sockets.
+        void UnregisterReceiveShards();
+
         //! Accepts an incoming udp connection.
         //! @param connectPacket the initial connectPacket
         void AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket);
@@ -180,12 +213,23 @@ namespace AzNetworking
         uint16_t m_port = 0;
         bool m_allowIncomingConnections = false;
         IConnectionListener& m_connectionListener;
+        UdpPacketBufferPool m_packetBufferPool; //!< Declared ahead of the connections so it outlives the payloads their reliable queues retain
         UdpConnectionSet m_connectionSet;
         TimeoutQueue m_connectionTimeoutQueue;
         TimeoutQueue m_packetTimeoutQueue;
         AZStd::unique_ptr<UdpSocket> m_socket;
         AZStd::unique_ptr<ICompressor> m_compressor;
-        UdpReaderThread& m_readerThread;
+        UdpReaderThreads& m_readerThreads;
+
+        //! A socket bound to the listen port and the reader thread feeding its packets to this interface.
+        struct ReceiveShard
+        {
+            UdpSocket* m_socket;
+            UdpReaderThread* m_readerThread;
+            UdpReceiveQueue* m_receiveQueue;
+        };
+        AZStd::vector<ReceiveShard> m_receiveShards;
+        AZStd::vector<AZStd::unique_ptr<UdpSocket>> m_shardSockets; //!< Receive only sockets sharing the port with m_socket
 
         struct RemovedConnection
         {
@@ -197,6 +241,7 @@ namespace AzNetworking
 
         UdpPacketEncodingBuffer m_decryptBuffer;
         UdpPacketEncodingBuffer m_decompressBuffer;
+        uint64_t m_sendBytesCopied = 0;
 
         friend class UdpReliableQueue;
         friend class UdpConnection; // For access to private RequestDisconnect() method
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpPacketBuffer.h>
+
+namespace AzNetworking
+{
+    void UdpPacketBufferRecycler::operator()(const AZStd::intrusive_refcount<AZStd::atomic_uint, UdpPacketBufferRecycler>* ptr) const
+    {
+        UdpPacketBuffer* buffer = const_cast<UdpPacketBuffer*>(static_cast<const UdpPacketBuffer*>(ptr));
+        m_pool->Recycle(buffer);
+    }
+
+    UdpPacketBufferPool::UdpPacketBufferPool(uint32_t maxFreeCount)
+        : m_maxFreeCount(maxFreeCount)
+    {
+        ;
+    }
+
+    UdpPacketBufferPool::~UdpPacketBufferPool()
+    {
+        AZ_Assert(GetFreeCount() == m_allocatedCount, "UdpPacketBufferPool destroyed while %u buffers are still referenced",
+            m_allocatedCount - GetFreeCount());
+
+        for (AZStd::vector<UdpPacketBuffer*>& freeBuffers : m_freeBuffers)
+        {
+            for (UdpPacketBuffer* buffer : freeBuffers)
+            {
+                delete buffer;
+            }
+        }
+    }
+
+    UdpPacketBufferPtr UdpPacketBufferPool::Acquire(uint32_t capacity)
+    {
+        const uint32_t sizeClass = UdpPacketBuffer::GetSizeClass(capacity);
+        UdpPacketBuffer* buffer = nullptr;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            AZStd::vector<UdpPacketBuffer*>& freeBuffers = m_freeBuffers[sizeClass];
+            if (!freeBuffers.empty())
+            {
+                buffer = freeBuffers.back();
+                freeBuffers.pop_back();
+            }
+            else
+            {
+                ++m_allocatedCount;
+            }
+        }
+
+        if (buffer == nullptr)
+        {
+            buffer = new UdpPacketBuffer(UdpPacketBufferRecycler{ this }, sizeClass);
+        }
+
+        buffer->Resize(0);
+        return UdpPacketBufferPtr(buffer);
+    }
+
+    UdpPacketBufferPtr UdpPacketBufferPool::Compact(const UdpPacketBufferPtr& buffer)
+    {
+        if (UdpPacketBuffer::GetSizeClass(buffer->GetSize()) >= buffer->GetSizeClass())
+        {
+            return buffer;
+        }
+
+        UdpPacketBufferPtr compactBuffer = Acquire(buffer->GetSize());
+        memcpy(compactBuffer->GetBuffer(), buffer->GetBuffer(), buffer->GetSize());
+        compactBuffer->Resize(buffer->GetSize());
+        return compactBuffer;
+    }
+
+    void UdpPacketBufferPool::Recycle(UdpPacketBuffer* buffer)
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            AZStd::vector<UdpPacketBuffer*>& freeBuffers = m_freeBuffers[buffer->GetSizeClass()];
+            if (freeBuffers.size() < m_maxFreeCount)
+            {
+                freeBuffers.push_back(buffer);
+                return;
+            }
+            --m_allocatedCount;
+        }
+
+        delete buffer;
+    }
+}
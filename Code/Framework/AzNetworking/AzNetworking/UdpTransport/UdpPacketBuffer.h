@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/intrusive_ptr.h>
+#include <AzCore/std/smart_ptr/intrusive_refcount.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AzNetworking
+{
+    // Forwards
+    class UdpPacketBufferPool;
+
+    //! Hands a UdpPacketBuffer back to the pool it was acquired from once its last reference is released.
+    struct UdpPacketBufferRecycler
+    {
+        void operator()(const AZStd::intrusive_refcount<AZStd::atomic_uint, UdpPacketBufferRecycler>* ptr) const;
+        UdpPacketBufferPool* m_pool = nullptr;
+    };
+
+    //! @class UdpPacketBuffer
+    //! @brief reference counted, pooled buffer holding a serialized packet payload.
+    //!
+    //! The payload is written after a fixed amount of headroom, so the packet header can be placed directly in front of it
+    //! without moving the payload. The reliable queue keeps a reference to the payload of every unacked reliable packet, so a
+    //! retransmit only rewrites the header instead of cloning and reserializing the packet.
+    //! Buffers come in a few size classes, so the payloads retained by the reliable queue only hold about their own size.
+    class UdpPacketBuffer final
+        : public AZStd::intrusive_refcount<AZStd::atomic_uint, UdpPacketBufferRecycler>
+    {
+    public:
+
+        //! Space reserved in front of the payload, large enough for the packet flags and a UdpPacketHeader.
+        static constexpr uint32_t Headroom = 32;
+
+        //! Maximum size of the payload.
+        static constexpr uint32_t PayloadCapacity = MaxPacketSize;
+
+        //! Payload capacities of the size classes, the last one fits any payload.
+        static constexpr uint32_t SizeClassCount = 4;
+        static constexpr uint32_t SizeClassCapacities[SizeClassCount] = { 256, 1024, 4096, PayloadCapacity };
+
+        //! Returns the smallest size class whose capacity fits the payload size.
+        //! @param payloadSize the size of the payload in bytes, must not exceed PayloadCapacity
+        //! @return the index of the size class
+        static uint32_t GetSizeClass(uint32_t payloadSize);
+
+        UdpPacketBuffer(UdpPacketBufferRecycler recycler, uint32_t sizeClass);
+
+        //! Returns a pointer to the start of the payload.
+        //! @return a pointer to the start of the payload
+        uint8_t* GetBuffer();
+        const uint8_t* GetBuffer() const;
+
+        //! Returns the size of the payload in bytes.
+        //! @return the size of the payload in bytes
+        uint32_t GetSize() const;
+
+        //! Returns the maximum size of the payload in bytes.
+        //! @return the maximum size of the payload in bytes
+        uint32_t GetCapacity() const;
+
+        //! Returns the size class of the buffer.
+        //! @return the index of the size class of the buffer
+        uint32_t GetSizeClass() const;
+
+        //! Sets the size of the payload, after it was written to GetBuffer.
+        //! @param size the new size of the payload, must not exceed GetCapacity
+        void Resize(uint32_t size);
+
+        //! Copies a header into the headroom so that it directly precedes the payload.
+        //! The headroom is scratch space: the payload is left untouched, but any previously prepended header is overwritten.
+        //! @param header     pointer to the header bytes to place in front of the payload
+        //! @param headerSize size of the header in bytes, must not exceed Headroom
+        //! @return a pointer to the start of the header, followed by the payload
+        uint8_t* Prepend(const uint8_t* header, uint32_t headerSize);
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(UdpPacketBuffer);
+
+        uint32_t m_size = 0;
+        uint32_t m_sizeClass = 0;
+        AZStd::unique_ptr<uint8_t[]> m_storage;
+    };
+
+    using UdpPacketBufferPtr = AZStd::intrusive_ptr<UdpPacketBuffer>;
+
+    //! @class UdpPacketBufferPool
+    //! @brief recycles UdpPacketBuffers so that sending a packet does not allocate.
+    //!
+    //! Buffers return to the pool when their last reference is released, from any thread. The pool must outlive every
+    //! buffer acquired from it.
+    class UdpPacketBufferPool
+    {
+    public:
+
+        //! Constructor.
+        //! @param maxFreeCount the maximum number of released buffers of each size class kept around for reuse
+        explicit UdpPacketBufferPool(uint32_t maxFreeCount);
+        ~UdpPacketBufferPool();
+
+        //! Returns an empty buffer, reusing a released one when possible.
+        //! @param capacity the payload size the buffer must be able to hold
+        //! @return an empty buffer of the smallest size class which fits capacity
+        UdpPacketBufferPtr Acquire(uint32_t capacity = UdpPacketBuffer::PayloadCapacity);
+
+        //! Returns a buffer of the smallest size class which fits the payload of buffer, for payloads which are retained.
+        //! @param buffer the buffer holding the payload
+        //! @return buffer itself if it is already of that size class, otherwise a copy of its payload in a smaller buffer
+        UdpPacketBufferPtr Compact(const UdpPacketBufferPtr& buffer);
+
+        //! Returns the number of buffers currently held by the pool for reuse.
+        //! @return the number of buffers currently held by the pool for reuse
+        uint32_t GetFreeCount() const;
+
+        //! Returns the number of buffers currently allocated by the pool, whether free or in use.
+        //! @return the number of buffers currently allocated by the pool
+        uint32_t GetAllocatedCount() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(UdpPacketBufferPool);
+
+        void Recycle(UdpPacketBuffer* buffer);
+
+        const uint32_t m_maxFreeCount;
+        uint32_t m_allocatedCount = 0;
+        mutable AZStd::mutex m_mutex;
+        AZStd::vector<UdpPacketBuffer*> m_freeBuffers[UdpPacketBuffer::SizeClassCount];
+
+        friend struct UdpPacketBufferRecycler;
+    };
+}
+
+#include <AzNetworking/UdpTransport/UdpPacketBuffer.inl>
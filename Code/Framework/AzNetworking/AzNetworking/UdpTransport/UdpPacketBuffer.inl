@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AzNetworking
+{
+    inline uint32_t UdpPacketBuffer::GetSizeClass(uint32_t payloadSize)
+    {
+        uint32_t sizeClass = 0;
+        while (sizeClass < SizeClassCount - 1 && SizeClassCapacities[sizeClass] < payloadSize)
+        {
+            ++sizeClass;
+        }
+        return sizeClass;
+    }
+
+    inline UdpPacketBuffer::UdpPacketBuffer(UdpPacketBufferRecycler recycler, uint32_t sizeClass)
+        : AZStd::intrusive_refcount<AZStd::atomic_uint, UdpPacketBufferRecycler>{ recycler }
+        , m_sizeClass(sizeClass)
+        , m_storage(new uint8_t[Headroom + SizeClassCapacities[sizeClass]])
+    {
+        ;
+    }
+
+    inline uint8_t* UdpPacketBuffer::GetBuffer()
+    {
+        return m_storage.get() + Headroom;
+    }
+
+    inline const uint8_t* UdpPacketBuffer::GetBuffer() const
+    {
+        return m_storage.get() + Headroom;
+    }
+
+    inline uint32_t UdpPacketBuffer::GetSize() const
+    {
+        return m_size;
+    }
+
+    inline uint32_t UdpPacketBuffer::GetCapacity() const
+    {
+        return SizeClassCapacities[m_sizeClass];
+    }
+
+    inline uint32_t UdpPacketBuffer::GetSizeClass() const
+    {
+        return m_sizeClass;
+    }
+
+    inline void UdpPacketBuffer::Resize(uint32_t size)
+    {
+        AZ_Assert(size <= GetCapacity(), "Requested payload size %u exceeds the capacity of the packet buffer", size);
+        m_size = size;
+    }
+
+    inline uint8_t* UdpPacketBuffer::Prepend(const uint8_t* header, uint32_t headerSize)
+    {
+        AZ_Assert(headerSize <= Headroom, "Header of %u bytes does not fit in the packet buffer headroom", headerSize);
+        uint8_t* headerStart = GetBuffer() - headerSize;
+        memcpy(headerStart, header, headerSize);
+        return headerStart;
+    }
+
+    inline uint32_t UdpPacketBufferPool::GetFreeCount() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        size_t freeCount = 0;
+        for (const AZStd::vector<UdpPacketBuffer*>& freeBuffers : m_freeBuffers)
+        {
+            freeCount += freeBuffers.size();
+        }
+        return aznumeric_cast<uint32_t>(freeCount);
+    }
+
+    inline uint32_t UdpPacketBufferPool::GetAllocatedCount() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_allocatedCount;
+    }
+}
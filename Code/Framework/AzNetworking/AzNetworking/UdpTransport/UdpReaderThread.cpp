@@ -11,6 +11,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AzNetworking
 {
@@ -21,7 +22,9 @@ namespace AzNetworking
     UdpReaderThread::UdpReaderThread()
         : TimedThread("UdpReaderThread", ReaderThreadUpdateRateMs)
     {
-        ;
+        m_dropAddresses.resize(UdpSocket::MaxBatchPacketCount);
+        m_dropSizes.resize(UdpSocket::MaxBatchPacketCount);
+        m_dropBuffer.resize_no_construct(UdpSocket::MaxBatchPacketCount * MaxUdpTransmissionUnit);
     }
 
     UdpReaderThread::~UdpReaderThread()
@@ -30,96 +33,46 @@ namespace AzNetworking
         Join();
     }
 
-    bool UdpReaderThread::RegisterSocket(UdpSocket* socket)
+    UdpReceiveQueue* UdpReaderThread::RegisterSocket(UdpSocket* socket, uint32_t queueCapacity)
     {
-        if (SocketExists(socket))
-        {
-            AZLOG_ERROR("Attempting to add a duplicate socket to the UdpReaderThread");
-            return false;
-        }
-        m_pendingAdds.push_back(socket);
-        if (!IsRunning())
-        {
-            Start();
-        }
-        return true;
-    }
-
-    void UdpReaderThread::UnregisterSocket(UdpSocket* socket)
-    {
-        // We need to null out the socket immediately in both the front and back
-        // buffers so that the reader thread doesn't try and use a deleted socket
-        AZStd::scoped_lock<AZStd::recursive_mutex> lock(m_mutex);
-        {
-            const int32_t frontIndex = 1 - m_backIndex;
-            ReaderBuffer& front = m_readerBuffers[frontIndex];
-            for (auto& socketEntry : front.m_entries)
-            {
-                if (socketEntry.m_socket == socket)
-                {
-                    socketEntry.m_socket = nullptr;
-                }
-            }
-        }
+        UdpReceiveQueue* receiveQueue = nullptr;
         {
-            ReaderBuffer& back = m_readerBuffers[m_backIndex];
-            for (auto& socketEntry : back.m_entries)
+            AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+            for (const SocketEntry& socketEntry : m_entries)
             {
                 if (socketEntry.m_socket == socket)
                 {
-                    socketEntry.m_socket = nullptr;
+                    AZLOG_ERROR("Attempting to add a duplicate socket to the UdpReaderThread");
+                    return nullptr;
                 }
             }
+
+            m_entries.emplace_back(SocketEntry{ socket, AZStd::make_unique<UdpReceiveQueue>(queueCapacity) });
+            receiveQueue = m_entries.back().m_receiveQueue.get();
         }
-    }
 
-    const UdpReaderThread::ReceivedPackets* UdpReaderThread::GetReceivedPackets(UdpSocket* socket) const
-    {
-        const int32_t frontIndex = 1 - m_backIndex;
-        const ReaderBuffer& front = m_readerBuffers[frontIndex];
-        for (const auto& socketEntry : front.m_entries)
+        if (!IsRunning())
         {
-            if (socketEntry.m_socket == socket)
-            {
-                return &(socketEntry.m_receivedPackets);
-            }
+            Start();
         }
-        return nullptr;
+        return receiveQueue;
     }
 
-    void UdpReaderThread::SwapBuffers()
+    void UdpReaderThread::UnregisterSocket(UdpSocket* socket)
     {
-        const int32_t frontIndex = 1 - m_backIndex;
-        ReaderBuffer& front = m_readerBuffers[frontIndex];
-
-        // Clear all the packets we've already processed on our main thread
-        for (auto& socketEntry : front.m_entries)
-        {
-            socketEntry.m_receivedPackets.clear();
-        }
-
-        AZStd::scoped_lock<AZStd::recursive_mutex> lock(m_mutex);
-        {
-            // This scope is sync-safe between the main and reader threads
-            ReaderBuffer& back = m_readerBuffers[m_backIndex];
-            for (UdpSocket* socket : m_pendingAdds)
-            {
-                front.m_entries.emplace_back(SocketEntry{ socket, ReceivedPackets() });
-                back.m_entries.emplace_back(SocketEntry{ socket, ReceivedPackets() });
-            }
-            m_pendingAdds.clear();
-            AZStd::remove_if(front.m_entries.begin(), front.m_entries.end(), [](auto& socketEntry) { return socketEntry.m_socket == nullptr; });
-            AZStd::remove_if(back.m_entries.begin(), back.m_entries.end(), [](auto& socketEntry) { return socketEntry.m_socket == nullptr; });
-            m_backIndex = 1 - m_backIndex;
-            m_readerBuffers[m_backIndex].m_receiveBuffer.Resize(0);
-        }
+        // Holding the lock guarantees the reader thread is not in the middle of reading from the socket or writing its queue
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        m_entries.erase
+        (
+            AZStd::remove_if(m_entries.begin(), m_entries.end(), [socket](const SocketEntry& socketEntry) { return socketEntry.m_socket == socket; }),
+            m_entries.end()
+        );
     }
 
     uint32_t UdpReaderThread::GetSocketCount() const
     {
-        const int32_t frontIndex = 1 - m_backIndex;
-        const ReaderBuffer& front = m_readerBuffers[frontIndex];
-        return aznumeric_cast<uint32_t>(front.m_entries.size());
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        return aznumeric_cast<uint32_t>(m_entries.size());
     }
 
     AZ::TimeMs UdpReaderThread::GetUpdateTimeMs() const
@@ -127,20 +80,6 @@ namespace AzNetworking
         return m_updateTimeMs;
     }
 
-    bool UdpReaderThread::SocketExists(UdpSocket* socket) const
-    {
-        const int32_t frontIndex = 1 - m_backIndex;
-        const ReaderBuffer& front = m_readerBuffers[frontIndex];
-        for (auto& socketEntry : front.m_entries)
-        {
-            if (socketEntry.m_socket == socket)
-            {
-                return true;
-            }
-        }
-        return false;
-    }
-
     void UdpReaderThread::OnStart()
     {
         ;
@@ -155,18 +94,11 @@ namespace AzNetworking
     {
         AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
 
-        AZStd::scoped_lock<AZStd::recursive_mutex> lock(m_mutex);
-        ReaderBuffer& back = m_readerBuffers[m_backIndex];
-        ByteBuffer<MaxUdpReceiveBufferSize>& receiveBuffer = back.m_receiveBuffer;
-        for (auto& socketEntry : back.m_entries)
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        for (SocketEntry& socketEntry : m_entries)
         {
             UdpSocket* socket = socketEntry.m_socket;
-            if (socket == nullptr)
-            {
-                continue;
-            }
-
-            ReceivedPackets& receivedPackets = socketEntry.m_receivedPackets;
+            UdpReceiveQueue& receiveQueue = *socketEntry.m_receiveQueue;
             for (;;)
             {
                 AZ::TimeMs elapsedTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
@@ -176,39 +108,36 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
-                const uint32_t bufferHead = receiveBuffer.GetSize();
-                if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
+                const uint32_t batchCount = AZStd::min(receiveQueue.GetWritableCount(), UdpSocket::MaxBatchPacketCount);
+                if (batchCount == 0)
                 {
-                    AZLOG_INFO("Receive buffer full, leaving data on the socket. Size exceeded by %d",
-                        aznumeric_cast<int32_t>(bufferHead + MaxUdpTransmissionUnit - receiveBuffer.GetCapacity()));
-                    break;
+                    // The network interface has not caught up yet. Drop what arrives rather than leave it to go stale on the socket,
+                    // so the dropped datagrams are counted.
+                    const uint32_t droppedCount = socket->ReceiveBatch
+                    (
+                        m_dropAddresses.data(), m_dropSizes.data(), m_dropBuffer.data(), MaxUdpTransmissionUnit, UdpSocket::MaxBatchPacketCount
+                    );
+                    receiveQueue.RecordDropped(droppedCount);
+                    if (droppedCount < UdpSocket::MaxBatchPacketCount)
+                    {
+                        break;
+                    }
+                    continue;
                 }
 
-                uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                // Receive straight into the queue's slots
+                const uint32_t receivedCount = socket->ReceiveBatch
+                (
+                    receiveQueue.GetWriteAddresses(), receiveQueue.GetWriteSizes(), receiveQueue.GetWriteBuffer(), MaxUdpTransmissionUnit, batchCount
+                );
+                receiveQueue.CommitWrite(receivedCount);
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                if (receivedCount < batchCount)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
-                }
-                else
-                {
-                    receiveBuffer.Resize(bufferHead);
                     break;
                 }
             }
         }
         m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
-
-    UdpReaderThread::ReceivedPacket::ReceivedPacket(const IpAddress& address, const uint8_t* buffer, int32_t receivedBytes)
-        : m_address(address)
-        , m_buffer(buffer)
-        , m_receivedBytes(receivedBytes)
-    {
-        ;
-    }
 }
@@ -9,56 +9,45 @@
 #pragma once
 
 #include <AzNetworking/Utilities/IpAddress.h>
-#include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Utilities/TimedThread.h>
-#include <AzNetworking/UdpTransport/DtlsEndpoint.h>
-#include <AzCore/std/containers/unordered_map.h>
+#include <AzNetworking/UdpTransport/UdpReceiveQueue.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AzNetworking
 {
     // Forwards
     class UdpSocket;
 
-    //! @class UdpSocketReader
-    //! @brief reads lots of data off a UDP socket for deferred processing.
+    //! @class UdpReaderThread
+    //! @brief reads lots of data off UDP sockets for deferred processing.
+    //!
+    //! Every registered socket gets its own UdpReceiveQueue. The reader thread is the only producer for these queues and the
+    //! thread ticking the owning network interface is the only consumer, so received packets are handed over without locking.
+    //! The socket list itself is guarded by a mutex, which is only contended while sockets are registered or unregistered.
     class UdpReaderThread
         : public TimedThread
     {
     public:
 
         static constexpr uint32_t MaxUdpReceivePacketCount = 1024;
-        static constexpr uint32_t MaxUdpReceiveBufferSize = MaxUdpReceivePacketCount * MaxUdpTransmissionUnit;
 
-        struct ReceivedPacket
-        {
-            ReceivedPacket() = default;
-            ReceivedPacket(const IpAddress& address, const uint8_t* buffer, int32_t receivedBytes);
-            IpAddress      m_address;
-            const uint8_t* m_buffer = nullptr;
-            int32_t        m_receivedBytes = 0;
-        };
-
-        using ReceivedPackets = AZStd::fixed_vector<ReceivedPacket, MaxUdpReceivePacketCount>;
+        using ReceivedPacket = UdpReceiveQueue::ReceivedPacket;
 
         UdpReaderThread();
         ~UdpReaderThread();
 
         //! Adds the provided socket to the socket reader for processing.
-        //! @param socket pointer to the UdpSocket to read incoming data from
-        //! @return boolean true on success, false for failure
-        bool RegisterSocket(UdpSocket* socket);
+        //! @param socket        pointer to the UdpSocket to read incoming data from
+        //! @param queueCapacity number of packets that may be pending processing before newly received packets are dropped
+        //! @return pointer to the queue received packets will be written to, nullptr on failure
+        UdpReceiveQueue* RegisterSocket(UdpSocket* socket, uint32_t queueCapacity = MaxUdpReceivePacketCount);
 
-        //! Removes the provided socket from the socket reader for processing.
+        //! Removes the provided socket from the socket reader for processing, destroying its receive queue.
         //! @param socket pointer to the UdpSocket to read incoming data from
         void UnregisterSocket(UdpSocket* socket);
 
-        //! Returns the set of all packets consumed off the socket during the last call to ReadDataFromSocket().
-        //! @return all packets consumed off the socket during the last call to ReadDataFromSocket()
-        const ReceivedPackets* GetReceivedPackets(UdpSocket* socket) const;
-
-        //! Should be called immediately before any registered sockets have processed their received packets.
-        void SwapBuffers();
-
         //! Returns the number of active sockets bound to this thread.
         //! @return the number of active sockets bound to this thread
         uint32_t GetSocketCount() const;
@@ -69,9 +58,6 @@ namespace AzNetworking
 
     private:
 
-        //! Helper to determine if a given socket is monitored by this reader thread instance
-        bool SocketExists(UdpSocket* socket) const;
-
         void OnStart() override;
         void OnStop() override;
         void OnUpdate(AZ::TimeMs updateRateMs) override;
@@ -81,19 +67,19 @@ namespace AzNetworking
         struct SocketEntry
         {
             UdpSocket* m_socket;
-            ReceivedPackets m_receivedPackets;
+            AZStd::unique_ptr<UdpReceiveQueue> m_receiveQueue;
         };
 
-        struct ReaderBuffer
-        {
-            AZStd::vector<SocketEntry> m_entries;
-            ByteBuffer<MaxUdpReceiveBufferSize> m_receiveBuffer;
-        };
+        mutable AZStd::mutex m_mutex;
+        AZStd::vector<SocketEntry> m_entries;
 
-        AZStd::recursive_mutex m_mutex;
-        int32_t m_backIndex = 0;
-        AZStd::array<ReaderBuffer, 2> m_readerBuffers;
-        AZStd::vector<UdpSocket*> m_pendingAdds;
+        // Datagrams received while their queue is full are read into these and dropped
+        AZStd::vector<IpAddress> m_dropAddresses;
+        AZStd::vector<int32_t> m_dropSizes;
+        AZStd::vector<uint8_t> m_dropBuffer;
         AZ::TimeMs m_updateTimeMs = AZ::TimeMs{ 0 };
     };
+
+    //! The pool of reader threads owned by the networking system, sharded sockets spread across all of them.
+    using UdpReaderThreads = AZStd::vector<AZStd::unique_ptr<UdpReaderThread>>;
 }
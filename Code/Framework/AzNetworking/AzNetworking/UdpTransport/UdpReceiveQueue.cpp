@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpReceiveQueue.h>
+
+namespace AzNetworking
+{
+    UdpReceiveQueue::UdpReceiveQueue(uint32_t capacity)
+        : m_writeIndex(0)
+        , m_droppedCount(0)
+        , m_readIndex(0)
+    {
+        AZ_Assert(capacity > 0, "UdpReceiveQueue requires at least one slot");
+
+        // A power of two capacity keeps the free running indices valid across wrap around
+        m_capacity = 1;
+        while (m_capacity < capacity)
+        {
+            m_capacity <<= 1;
+        }
+        m_mask = m_capacity - 1;
+        m_addresses.resize(m_capacity);
+        m_sizes.resize(m_capacity);
+        m_buffer.resize_no_construct(m_capacity * MaxUdpTransmissionUnit);
+    }
+}
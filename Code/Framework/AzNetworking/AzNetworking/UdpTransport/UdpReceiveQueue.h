@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/Utilities/IpAddress.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace AzNetworking
+{
+    //! @class UdpReceiveQueue
+    //! @brief single producer, single consumer ring of datagrams received off a UDP socket.
+    //!
+    //! A reader thread receives datagrams directly into MTU sized slots and publishes them by advancing the write index.
+    //! The network tick consumes them in order, then hands the slots back by advancing the read index. Neither side locks.
+    class UdpReceiveQueue
+    {
+    public:
+
+        struct ReceivedPacket
+        {
+            ReceivedPacket() = default;
+            ReceivedPacket(const IpAddress& address, const uint8_t* buffer, int32_t receivedBytes);
+            IpAddress      m_address;
+            const uint8_t* m_buffer = nullptr;
+            int32_t        m_receivedBytes = 0;
+        };
+
+        //! Constructor.
+        //! @param capacity the number of packet slots, rounded up to a power of two
+        explicit UdpReceiveQueue(uint32_t capacity);
+
+        //! Producer interface, only to be used by the thread reading the socket.
+        //! @{
+
+        //! Returns the number of free slots that are contiguous in memory starting at the write position.
+        //! @return the number of slots that may be written before calling CommitWrite
+        uint32_t GetWritableCount() const;
+
+        //! Returns the address array, size array and MTU strided data buffer starting at the write position.
+        //! These are laid out so they can be handed straight to UdpSocket::ReceiveBatch.
+        IpAddress* GetWriteAddresses();
+        int32_t* GetWriteSizes();
+        uint8_t* GetWriteBuffer();
+
+        //! Publishes the given number of freshly written slots to the consumer.
+        //! @param count the number of slots written, must not exceed GetWritableCount
+        void CommitWrite(uint32_t count);
+
+        //! Records datagrams that were received while the queue was full, and dropped.
+        //! @param count the number of datagrams dropped
+        void RecordDropped(uint32_t count);
+        //! @}
+
+        //! Consumer interface, only to be used by the thread ticking the network interface.
+        //! @{
+
+        //! Returns the number of packets published by the producer that have not been released yet.
+        //! @return the number of packets that may be retrieved with GetPacket
+        uint32_t GetReadableCount() const;
+
+        //! Returns the packet at the given offset from the read position, valid until it is released.
+        //! @param index offset from the read position, must be less than GetReadableCount
+        //! @return the received packet
+        ReceivedPacket GetPacket(uint32_t index) const;
+
+        //! Hands the given number of packets back to the producer.
+        //! @param count the number of packets to release, must not exceed GetReadableCount
+        void Release(uint32_t count);
+        //! @}
+
+        //! Returns the number of slots in this queue.
+        //! @return the number of slots in this queue
+        uint32_t GetCapacity() const;
+
+        //! Returns the number of datagrams the producer dropped because this queue was full.
+        //! @return the number of datagrams the producer dropped because this queue was full
+        uint64_t GetDroppedCount() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(UdpReceiveQueue);
+
+        uint32_t m_capacity = 0;
+        uint32_t m_mask = 0;
+        AZStd::vector<IpAddress> m_addresses;
+        AZStd::vector<int32_t> m_sizes;
+        AZStd::vector<uint8_t> m_buffer;
+
+        // Written by the producer and consumer respectively, kept on separate cache lines
+        AZ_ALIGN(AZStd::atomic<uint32_t> m_writeIndex, 64);
+        AZStd::atomic<uint64_t> m_droppedCount;
+        AZ_ALIGN(AZStd::atomic<uint32_t> m_readIndex, 64);
+    };
+}
+
+#include <AzNetworking/UdpTransport/UdpReceiveQueue.inl>
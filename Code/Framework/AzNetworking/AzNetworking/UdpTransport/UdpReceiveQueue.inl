@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AzNetworking
+{
+    inline UdpReceiveQueue::ReceivedPacket::ReceivedPacket(const IpAddress& address, const uint8_t* buffer, int32_t receivedBytes)
+        : m_address(address)
+        , m_buffer(buffer)
+        , m_receivedBytes(receivedBytes)
+    {
+        ;
+    }
+
+    inline uint32_t UdpReceiveQueue::GetWritableCount() const
+    {
+        // Only the producer modifies the write index, the read index has to be synchronized with the consumer
+        const uint32_t writeIndex = m_writeIndex.load(AZStd::memory_order_relaxed);
+        const uint32_t freeCount = m_capacity - (writeIndex - m_readIndex.load(AZStd::memory_order_acquire));
+        const uint32_t contiguousCount = m_capacity - (writeIndex & m_mask);
+        return (freeCount < contiguousCount) ? freeCount : contiguousCount;
+    }
+
+    inline IpAddress* UdpReceiveQueue::GetWriteAddresses()
+    {
+        return m_addresses.data() + (m_writeIndex.load(AZStd::memory_order_relaxed) & m_mask);
+    }
+
+    inline int32_t* UdpReceiveQueue::GetWriteSizes()
+    {
+        return m_sizes.data() + (m_writeIndex.load(AZStd::memory_order_relaxed) & m_mask);
+    }
+
+    inline uint8_t* UdpReceiveQueue::GetWriteBuffer()
+    {
+        return m_buffer.data() + (m_writeIndex.load(AZStd::memory_order_relaxed) & m_mask) * MaxUdpTransmissionUnit;
+    }
+
+    inline void UdpReceiveQueue::CommitWrite(uint32_t count)
+    {
+        m_writeIndex.store(m_writeIndex.load(AZStd::memory_order_relaxed) + count, AZStd::memory_order_release);
+    }
+
+    inline void UdpReceiveQueue::RecordDropped(uint32_t count)
+    {
+        m_droppedCount.fetch_add(count, AZStd::memory_order_relaxed);
+    }
+
+    inline uint32_t UdpReceiveQueue::GetReadableCount() const
+    {
+        return m_writeIndex.load(AZStd::memory_order_acquire) - m_readIndex.load(AZStd::memory_order_relaxed);
+    }
+
+    inline UdpReceiveQueue::ReceivedPacket UdpReceiveQueue::GetPacket(uint32_t index) const
+    {
+        const uint32_t slot = (m_readIndex.load(AZStd::memory_order_relaxed) + index) & m_mask;
+        return ReceivedPacket(m_addresses[slot], m_buffer.data() + slot * MaxUdpTransmissionUnit, m_sizes[slot]);
+    }
+
+    inline void UdpReceiveQueue::Release(uint32_t count)
+    {
+        m_readIndex.store(m_readIndex.load(AZStd::memory_order_relaxed) + count, AZStd::memory_order_release);
+    }
+
+    inline uint32_t UdpReceiveQueue::GetCapacity() const
+    {
+        return m_capacity;
+    }
+
+    inline uint64_t UdpReceiveQueue::GetDroppedCount() const
+    {
+        return m_droppedCount.load(AZStd::memory_order_relaxed);
+    }
+}
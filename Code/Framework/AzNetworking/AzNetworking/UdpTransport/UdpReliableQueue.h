@@ -11,6 +11,7 @@
 #include <AzNetworking/PacketLayer/IPacket.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/SequenceGenerator.h>
+#include <AzNetworking/UdpTransport/UdpPacketBuffer.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
 #include <AzCore/std/containers/unordered_map.h>
 
@@ -24,7 +25,8 @@ namespace AzNetworking
     struct PendingPacket
     {
         SequenceId m_reliableSequenceId;
-        AZStd::unique_ptr<IPacket> m_packet;
+        PacketType m_packetType;
+        UdpPacketBufferPtr m_payload;
     };
 
     //! @class UdpReliableQueue
@@ -47,9 +49,10 @@ namespace AzNetworking
         //! Called when we're going to transmit a packet that we want to be reliable.
         //! @param packetId           packet id of the packet we're sending
         //! @param reliableSequenceId the reliable sequence identifier of the packet we're sending
-        //! @param packet             reference to the packet being transmitted
+        //! @param packetType         type of the packet we're sending
+        //! @param payload            the serialized packet payload, retained until the packet is acked so it can be resent as is
         //! @return boolean true on success, false on failure
-        bool PrepareForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet);
+        bool PrepareForSend(PacketId packetId, SequenceId reliableSequenceId, PacketType packetType, const UdpPacketBufferPtr& payload);
 
         //! Called when a reliable packet has been received.
         //! @param header the header for the received reliable packet
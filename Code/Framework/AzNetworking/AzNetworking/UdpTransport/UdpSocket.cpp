@@ -18,12 +18,40 @@
 #include <AzCore/EBus/ScheduledEvent.h>
 #include <AzCore/Interface/Interface.h>
 
+#if AZ_TRAIT_USE_SOCKET_MMSG
+#   include <errno.h>
+#   include <netinet/udp.h>
+#   ifndef SOL_UDP
+#       define SOL_UDP 17
+#   endif
+#   ifndef UDP_SEGMENT
+#       define UDP_SEGMENT 103
+#   endif
+#endif
+
 namespace AzNetworking
 {
     AZ_CVAR(int32_t, net_UdpSendBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket send buffer size");
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
+    AZ_CVAR(bool, net_UdpUseSegmentationOffload, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, batched UDP sends will use UDP segmentation offload where the kernel supports it");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
 
+#if AZ_TRAIT_USE_SOCKET_MMSG
+    // A single segmentation offload send must fit in one IPv4 datagram, and the kernel caps the number of segments per send
+    static constexpr uint32_t MaxSegmentationOffloadBytes = 65000;
+    static constexpr uint32_t MaxSegmentationOffloadSegments = 64;
+#endif
+
+    static sockaddr_in GetSockAddr(const IpAddress& address)
+    {
+        sockaddr_in sockAddr;
+        memset(&sockAddr, 0, sizeof(sockAddr));
+        sockAddr.sin_family = AF_INET;
+        sockAddr.sin_addr.s_addr = address.GetAddress(ByteOrder::Network);
+        sockAddr.sin_port = address.GetPort(ByteOrder::Network);
+        return sockAddr;
+    }
+
     UdpSocket::~UdpSocket()
     {
         Close();
@@ -68,6 +96,11 @@ namespace AzNetworking
             }
         }
 
+        if (m_reusePort && !SetSocketReusePort(m_socketFd))
+        {
+            return false;
+        }
+
         // Handle binding
         {
             sockaddr_in hints;
@@ -93,11 +126,29 @@ namespace AzNetworking
             return false;
         }
 
+#if AZ_TRAIT_USE_SOCKET_MMSG
+        // Kernels without UDP segmentation offload silently ignore the control message instead of failing the send,
+        // so probe for support up front rather than relying on send errors
+        {
+            int32_t segmentSize = 0;
+            socklen_t segmentSizeLen = sizeof(segmentSize);
+            m_useSegmentationOffload = (::getsockopt(static_cast<int32_t>(m_socketFd), SOL_UDP, UDP_SEGMENT, &segmentSize, &segmentSizeLen) == 0);
+        }
+#else
+        m_useSegmentationOffload = false;
+#endif
+
         return true;
     }
 
     void UdpSocket::Close()
     {
+        if (m_sendBatch != nullptr)
+        {
+            // Nothing queued can reach its destination once the socket is gone
+            m_sendBatch->m_packets.clear();
+            m_sendBatch->m_data.Resize(0);
+        }
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -161,9 +212,10 @@ namespace AzNetworking
             const AZ::TimeMs currTimeMs = AZ::GetElapsedTimeMs();
             const AZ::TimeMs deferTimeMs = (connectionQuality.m_latencyMs / aznumeric_cast<AZ::TimeMs>(2)) + jitterMs;
 
-            DeferredData deferred = DeferredData(address, data, size, encrypt, dtlsEndpoint);
-            AZ::Interface<AZ::IEventScheduler>::Get()->AddCallback([&, deferredData = deferred]
+            // Build the deferred copy directly in the capture rather than copying it in from a local
+            AZ::Interface<AZ::IEventScheduler>::Get()->AddCallback([&, deferredData = DeferredData(address, data, size, encrypt, dtlsEndpoint)]
                     { SendInternalDeferred(deferredData); }, AZ::Name("Deferred packet"), deferTimeMs);
+            m_sentBytesCopied += size;
         }
 #endif
 
@@ -186,6 +238,7 @@ namespace AzNetworking
         sockaddr_in from;
         socklen_t   fromLen = sizeof(from);
 
+        ++m_recvCalls;
         const int32_t receivedBytes = recvfrom(static_cast<int32_t>(m_socketFd), reinterpret_cast<char*>(outData), static_cast<int32_t>(size), 0, (sockaddr*)&from, &fromLen);
 
         outAddress = IpAddress(ByteOrder::Network, from.sin_addr.s_addr, from.sin_port);
@@ -225,17 +278,279 @@ namespace AzNetworking
         return receivedBytes;
     }
 
+    uint32_t UdpSocket::ReceiveBatch(IpAddress* outAddresses, int32_t* outSizes, uint8_t* outData, uint32_t packetCapacity, uint32_t maxPackets) const
+    {
+        AZ_Assert(packetCapacity > 0, "Invalid packet capacity for receive");
+        AZ_Assert(outData != nullptr, "NULL data pointer passed to receive");
+
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+        maxPackets = AZStd::min(maxPackets, MaxBatchPacketCount);
+
+#if AZ_TRAIT_USE_SOCKET_MMSG
+        mmsghdr messages[MaxBatchPacketCount];
+        iovec buffers[MaxBatchPacketCount];
+        sockaddr_in fromAddrs[MaxBatchPacketCount];
+        memset(messages, 0, sizeof(mmsghdr) * maxPackets);
+
+        for (uint32_t i = 0; i < maxPackets; ++i)
+        {
+            buffers[i].iov_base = outData + i * packetCapacity;
+            buffers[i].iov_len = packetCapacity;
+            messages[i].msg_hdr.msg_name = &fromAddrs[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            messages[i].msg_hdr.msg_iov = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        ++m_recvCalls;
+        const int32_t receivedCount = ::recvmmsg(static_cast<int32_t>(m_socketFd), messages, maxPackets, MSG_DONTWAIT, nullptr);
+
+        if (receivedCount < 0)
+        {
+            const int32_t error = GetLastNetworkError();
+
+            bool ignoreForciblyClosedError = false;
+            if (!ErrorIsWouldBlock(error) && !ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+            {
+                AZLOG_ERROR("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            }
+            return 0;
+        }
+
+        for (int32_t i = 0; i < receivedCount; ++i)
+        {
+            outAddresses[i] = IpAddress(ByteOrder::Network, fromAddrs[i].sin_addr.s_addr, fromAddrs[i].sin_port);
+            outSizes[i] = static_cast<int32_t>(messages[i].msg_len);
+            m_recvPackets++;
+            m_recvBytes += messages[i].msg_len;
+        }
+        return static_cast<uint32_t>(receivedCount);
+#else
+        uint32_t receivedCount = 0;
+        for (; receivedCount < maxPackets; ++receivedCount)
+        {
+            const int32_t receivedBytes = Receive(outAddresses[receivedCount], outData + receivedCount * packetCapacity, packetCapacity);
+            if (receivedBytes <= 0)
+            {
+                break;
+            }
+            outSizes[receivedCount] = receivedBytes;
+        }
+        return receivedCount;
+#endif
+    }
+
+    void UdpSocket::BeginSendBatch()
+    {
+        if (m_sendBatch == nullptr)
+        {
+            m_sendBatch = AZStd::make_unique<SendBatch>();
+        }
+        ++m_sendBatchDepth;
+    }
+
+    void UdpSocket::EndSendBatch()
+    {
+        AZ_Assert(m_sendBatchDepth > 0, "EndSendBatch called without a matching BeginSendBatch");
+
+        if ((m_sendBatchDepth > 0) && (--m_sendBatchDepth == 0))
+        {
+            FlushSendBatch();
+        }
+    }
+
+    void UdpSocket::FlushSendBatch() const
+    {
+        SendBatch& batch = *m_sendBatch;
+        const uint32_t packetCount = aznumeric_cast<uint32_t>(batch.m_packets.size());
+
+        uint32_t packetIndex = 0;
+        while ((packetIndex < packetCount) && IsOpen())
+        {
+            const uint32_t writtenCount = WriteSendBatch(packetIndex, packetCount - packetIndex);
+            if (writtenCount == 0)
+            {
+                // The socket would block, drop the remainder just like an unbatched send would
+                break;
+            }
+            packetIndex += writtenCount;
+        }
+
+        batch.m_packets.clear();
+        batch.m_data.Resize(0);
+    }
+
+    uint32_t UdpSocket::WriteSendBatch(uint32_t startIndex, uint32_t count) const
+    {
+        SendBatch& batch = *m_sendBatch;
+
+#if AZ_TRAIT_USE_SOCKET_MMSG
+        mmsghdr messages[MaxBatchPacketCount];
+        iovec buffers[MaxBatchPacketCount];
+        sockaddr_in destAddrs[MaxBatchPacketCount];
+        alignas(cmsghdr) char controls[MaxBatchPacketCount][CMSG_SPACE(sizeof(uint16_t))];
+        uint32_t segmentCounts[MaxBatchPacketCount];
+
+        const bool useSegmentationOffload = m_useSegmentationOffload && net_UdpUseSegmentationOffload;
+        const uint32_t endIndex = startIndex + count;
+        uint32_t messageCount = 0;
+        for (uint32_t packetIndex = startIndex; packetIndex < endIndex; ++messageCount)
+        {
+            const PendingSend& first = batch.m_packets[packetIndex];
+            uint32_t segmentCount = 1;
+            uint32_t totalSize = first.m_size;
+
+            if (useSegmentationOffload)
+            {
+                // Consecutive packets to the same endpoint can be handed to the kernel as a single buffer, which it splits
+                // back into datagrams of first.m_size bytes. Every segment but the last must be exactly that size.
+                // Queued packets are stored back to back, so the segments are already contiguous.
+                uint32_t lastSize = first.m_size;
+                while (packetIndex + segmentCount < endIndex)
+                {
+                    const PendingSend& next = batch.m_packets[packetIndex + segmentCount];
+                    if ((next.m_address != first.m_address) || (lastSize != first.m_size) || (next.m_size > first.m_size)
+                        || (segmentCount >= MaxSegmentationOffloadSegments) || (totalSize + next.m_size > MaxSegmentationOffloadBytes))
+                    {
+                        break;
+                    }
+                    lastSize = next.m_size;
+                    totalSize += next.m_size;
+                    ++segmentCount;
+                }
+            }
+
+            destAddrs[messageCount] = GetSockAddr(first.m_address);
+            buffers[messageCount].iov_base = batch.m_data.GetBuffer() + first.m_offset;
+            buffers[messageCount].iov_len = totalSize;
+
+            memset(&messages[messageCount], 0, sizeof(mmsghdr));
+            msghdr& header = messages[messageCount].msg_hdr;
+            header.msg_name = &destAddrs[messageCount];
+            header.msg_namelen = sizeof(sockaddr_in);
+            header.msg_iov = &buffers[messageCount];
+            header.msg_iovlen = 1;
+
+            if (segmentCount > 1)
+            {
+                header.msg_control = controls[messageCount];
+                header.msg_controllen = sizeof(controls[messageCount]);
+
+                cmsghdr* control = CMSG_FIRSTHDR(&header);
+                control->cmsg_level = SOL_UDP;
+                control->cmsg_type = UDP_SEGMENT;
+                control->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+                const uint16_t segmentSize = aznumeric_cast<uint16_t>(first.m_size);
+                memcpy(CMSG_DATA(control), &segmentSize, sizeof(segmentSize));
+            }
+
+            segmentCounts[messageCount] = segmentCount;
+            packetIndex += segmentCount;
+        }
+
+        ++m_sendCalls;
+        const int32_t sentCount = ::sendmmsg(static_cast<int32_t>(m_socketFd), messages, messageCount, 0);
+
+        if (sentCount < 0)
+        {
+            const int32_t error = GetLastNetworkError();
+            if (ErrorIsWouldBlock(error))
+            {
+                return 0;
+            }
+
+            if ((segmentCounts[0] > 1) && ((error == EIO) || (error == EINVAL) || (error == ENOPROTOOPT) || (error == EOPNOTSUPP)))
+            {
+                // Segmentation offload was advertised but the route or device can't handle it, stop using it on this socket
+                AZLOG_WARN("UDP segmentation offload failed (%d:%s), falling back to individual datagrams", error, GetNetworkErrorDesc(error));
+                m_useSegmentationOffload = false;
+                return WriteSendBatch(startIndex, count);
+            }
+
+            AZLOG_ERROR("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            // Skip the message that failed so the rest of the batch still goes out
+            return segmentCounts[0];
+        }
+
+        uint32_t sentPackets = 0;
+        for (int32_t i = 0; i < sentCount; ++i)
+        {
+            sentPackets += segmentCounts[i];
+        }
+        return sentPackets;
+#else
+        AZ_UNUSED(count);
+        const PendingSend& packet = batch.m_packets[startIndex];
+        const sockaddr_in destAddr = GetSockAddr(packet.m_address);
+
+        ++m_sendCalls;
+        const int32_t sentBytes = sendto(static_cast<int32_t>(m_socketFd), reinterpret_cast<const char*>(batch.m_data.GetBuffer() + packet.m_offset),
+            packet.m_size, 0, (sockaddr*)&destAddr, sizeof(destAddr));
+        if (sentBytes < 0)
+        {
+            const int32_t error = GetLastNetworkError();
+            if (ErrorIsWouldBlock(error))
+            {
+                return 0;
+            }
+            AZLOG_ERROR("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+        }
+        return 1;
+#endif
+    }
+
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
-        sockaddr_in destAddr;
-        memset(&destAddr, 0, sizeof(destAddr));
-        destAddr.sin_family = AF_INET;
-        destAddr.sin_addr.s_addr = address.GetAddress(ByteOrder::Network);
-        destAddr.sin_port = address.GetPort(ByteOrder::Network);
+        if (uint8_t* batchData = ReserveBatchedSend(size))
+        {
+            // Queue the packet, it will be written out along with the rest of the batch
+            memcpy(batchData, data, size);
+            m_sentBytesCopied += size;
+            return CommitBatchedSend(address, size);
+        }
+
+        // Preserve ordering with anything already queued for the same batch
+        if (m_sendBatchDepth > 0)
+        {
+            FlushSendBatch();
+        }
+
+        const sockaddr_in destAddr = GetSockAddr(address);
+        ++m_sendCalls;
         return sendto(static_cast<int32_t>(m_socketFd), reinterpret_cast<const char*>(data), size, 0, (sockaddr*)&destAddr, sizeof(destAddr));
     }
 
+    uint8_t* UdpSocket::ReserveBatchedSend(uint32_t size) const
+    {
+        if ((m_sendBatchDepth == 0) || (size > MaxUdpTransmissionUnit))
+        {
+            return nullptr;
+        }
+
+        SendBatch& batch = *m_sendBatch;
+        if (batch.m_packets.full() || (batch.m_data.GetSize() + size > batch.m_data.GetCapacity()))
+        {
+            FlushSendBatch();
+        }
+
+        return batch.m_data.GetBuffer() + batch.m_data.GetSize();
+    }
+
+    int32_t UdpSocket::CommitBatchedSend(const IpAddress& address, uint32_t size) const
+    {
+        SendBatch& batch = *m_sendBatch;
+        const uint32_t offset = static_cast<uint32_t>(batch.m_data.GetSize());
+        AZ_Assert(offset + size <= batch.m_data.GetCapacity(), "Committed more data than the send batch can hold");
+        batch.m_data.Resize(offset + size);
+        batch.m_packets.push_back(PendingSend{ address, offset, size });
+        return static_cast<int32_t>(size);
+    }
+
 #ifdef ENABLE_LATENCY_DEBUG
     int32_t UdpSocket::SendInternalDeferred(const DeferredData& data) const
     {
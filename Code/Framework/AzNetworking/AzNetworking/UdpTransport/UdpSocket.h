@@ -12,8 +12,10 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -69,6 +71,11 @@ namespace AzNetworking
         //! @return boolean true on success
         virtual bool Open(uint16_t port, CanAcceptConnections canAccept, TrustZone trustZone);
 
+        //! Lets this socket share its port with other sockets that also enable it, the kernel then spreads incoming
+        //! datagrams across them by flow. Must be called before Open, and is ignored on platforms without support.
+        //! @param reusePort if true, the socket will be opened with port sharing enabled
+        void SetReusePort(bool reusePort);
+
         //! Closes an open socket.
         virtual void Close();
 
@@ -93,6 +100,35 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives up to maxPackets payloads from the UDP socket, using a single recvmmsg call where the platform supports it.
+        //! Packet i is written to outData + i * packetCapacity, its sender to outAddresses[i] and its size to outSizes[i].
+        //! @param outAddresses   on success, the addresses of the endpoints that sent each packet
+        //! @param outSizes       on success, the number of bytes received for each packet
+        //! @param outData        on success, address to write the received data to, must hold maxPackets * packetCapacity bytes
+        //! @param packetCapacity maximum size of a single packet
+        //! @param maxPackets     maximum number of packets to receive, clamped to MaxBatchPacketCount
+        //! @return number of packets received, 0 if no data was pending or on error
+        uint32_t ReceiveBatch(IpAddress* outAddresses, int32_t* outSizes, uint8_t* outData, uint32_t packetCapacity, uint32_t maxPackets) const;
+
+        //! Starts queueing outgoing packets instead of writing them to the socket immediately.
+        //! Queued packets are written with as few system calls as possible (sendmmsg and UDP segmentation offload on Linux)
+        //! when the matching EndSendBatch is called, or whenever the queue fills up. Calls may be nested.
+        void BeginSendBatch();
+
+        //! Ends a batch started by BeginSendBatch, flushing any queued packets once the outermost batch ends.
+        void EndSendBatch();
+
+        //! Returns the total number of system calls made to send data on this socket.
+        //! @return the total number of system calls made to send data on this socket
+        uint32_t GetSendCalls() const;
+
+        //! Returns the total number of system calls made to receive data on this socket.
+        //! @return the total number of system calls made to receive data on this socket
+        uint32_t GetRecvCalls() const;
+
+        //! Maximum number of packets queued by a send batch or read by a single ReceiveBatch call.
+        static constexpr uint32_t MaxBatchPacketCount = 64;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -113,6 +149,10 @@ namespace AzNetworking
         //! @return the total number of additional bytes sent on this socket due to SSL encryption
         uint32_t GetSentBytesEncryptionInflation() const;
 
+        //! Returns the total number of bytes this socket copied into intermediate buffers before writing them out.
+        //! @return the total number of bytes this socket copied into intermediate buffers before writing them out
+        uint32_t GetSentBytesCopied() const;
+
         //! Returns the total number of packets received on this socket.
         //! @return the total number of packets received on this socket
         uint32_t GetRecvPackets() const;
@@ -128,6 +168,17 @@ namespace AzNetworking
 
         virtual int32_t SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const;
 
+        //! Returns space for an outgoing packet inside the active send batch, so it can be written there directly.
+        //! @param size the maximum number of bytes that will be written
+        //! @return pointer to write the packet to, nullptr if no send batch is active or the packet can not be batched
+        uint8_t* ReserveBatchedSend(uint32_t size) const;
+
+        //! Queues a packet written to the space returned by the last call to ReserveBatchedSend.
+        //! @param address the address to send the packet to
+        //! @param size    the number of bytes written, must not exceed the reserved size
+        //! @return number of bytes queued
+        int32_t CommitBatchedSend(const IpAddress& address, uint32_t size) const;
+
     private:
 
         SocketFd m_socketFd = InvalidSocketFd;
@@ -135,6 +186,33 @@ namespace AzNetworking
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
         mutable uint32_t m_recvBytes = 0;
+        mutable uint32_t m_sendCalls = 0;
+        mutable uint32_t m_recvCalls = 0;
+        mutable uint32_t m_sentBytesCopied = 0;
+
+        //! Writes out all packets queued by the current send batch.
+        void FlushSendBatch() const;
+
+        //! Writes count queued packets starting at startIndex, returns the number of packets consumed.
+        uint32_t WriteSendBatch(uint32_t startIndex, uint32_t count) const;
+
+        struct PendingSend
+        {
+            IpAddress m_address;
+            uint32_t m_offset = 0;
+            uint32_t m_size = 0;
+        };
+
+        struct SendBatch
+        {
+            AZStd::fixed_vector<PendingSend, MaxBatchPacketCount> m_packets;
+            ByteBuffer<MaxBatchPacketCount * MaxUdpTransmissionUnit> m_data;
+        };
+
+        AZStd::unique_ptr<SendBatch> m_sendBatch;
+        uint32_t m_sendBatchDepth = 0;
+        bool m_reusePort = false;
+        mutable bool m_useSegmentationOffload = true;
 
 #ifdef ENABLE_LATENCY_DEBUG
         struct DeferredData
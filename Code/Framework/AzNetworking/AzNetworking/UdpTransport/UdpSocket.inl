@@ -15,6 +15,11 @@ namespace AzNetworking
         return (m_socketFd > SocketFd{ 0 });
     }
 
+    inline void UdpSocket::SetReusePort(bool reusePort)
+    {
+        m_reusePort = reusePort;
+    }
+
     inline SocketFd UdpSocket::GetSocketFd() const
     {
         return m_socketFd;
@@ -49,4 +54,19 @@ namespace AzNetworking
     {
         return m_recvBytes;
     }
+
+    inline uint32_t UdpSocket::GetSentBytesCopied() const
+    {
+        return m_sentBytesCopied;
+    }
+
+    inline uint32_t UdpSocket::GetSendCalls() const
+    {
+        return m_sendCalls;
+    }
+
+    inline uint32_t UdpSocket::GetRecvCalls() const
+    {
+        return m_recvCalls;
+    }
 }
@@ -90,6 +90,24 @@ namespace AzNetworking
         return true;
     }
 
+    bool SetSocketReusePort([[maybe_unused]] SocketFd socketFd)
+    {
+#if AZ_TRAIT_USE_SOCKET_REUSEPORT
+        int flag = 1;
+
+        if (setsockopt(int32_t(socketFd), SOL_SOCKET, SO_REUSEPORT, (const char *)&flag, sizeof(flag)) != SocketOpResultSuccess)
+        {
+            const int32_t error = GetLastNetworkError();
+            AZLOG_ERROR("Failed to enable port reuse for socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            return false;
+        }
+
+        return true;
+#else
+        return false;
+#endif
+    }
+
     void CloseSocket(SocketFd socketFd)
     {
         if (int32_t(socketFd) <= 0)
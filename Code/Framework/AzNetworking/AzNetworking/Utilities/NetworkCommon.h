@@ -82,6 +82,12 @@ namespace AzNetworking
     //! @return boolean true on success
     bool SetSocketBufferSizes(SocketFd socketFd, int32_t sendSize, int32_t recvSize);
 
+    //! Allows several sockets to bind the same port, with the kernel distributing incoming datagrams between them by flow.
+    //! Must be called before the socket is bound.
+    //! @param socketFd identifier of the socket to enable port sharing on
+    //! @return boolean true on success, false on failure or if the platform does not support load balanced port sharing
+    bool SetSocketReusePort(SocketFd socketFd);
+
     //! Closes the provided socket.
     //! @param socketFd identifier of socket to close
     void CloseSocket(SocketFd socketFd);
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Utilities/QuantizedSerializers.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/math.h>
+
+namespace AzNetworking
+{
+    namespace QuantizedSerializersInternal
+    {
+        // Largest magnitude of any component other than the largest in a unit quaternion
+        static constexpr float SmallestThreeRange = 0.70710678f;
+
+        inline double GetMaxQuantizedValue(uint32_t bitCount)
+        {
+            return static_cast<double>((uint64_t(1) << bitCount) - 1);
+        }
+
+        template <uint32_t NUM_ELEMENTS>
+        bool SerializeRangeElements(ISerializer& serializer, float* values, const QuantizedRange& range, const char* name)
+        {
+            AZ_Assert(range.m_bits > 0 && range.m_bits <= 32, "QuantizedRange supports between 1 and 32 bits per element");
+            // The current value is encoded even when reading into the object, so serializers that compare against the
+            // existing value, such as TrackChangedSerializer, see the current quantized value rather than zero
+            PackedBits packedBits;
+            for (uint32_t i = 0; i < NUM_ELEMENTS; ++i)
+            {
+                packedBits.Write(QuantizeFloat(values[i], range.m_min, range.m_max, range.m_bits), range.m_bits);
+            }
+
+            packedBits.Serialize(serializer, NUM_ELEMENTS * range.m_bits, name);
+
+            if (serializer.GetSerializerMode() == SerializerMode::WriteToObject)
+            {
+                for (uint32_t i = 0; i < NUM_ELEMENTS; ++i)
+                {
+                    values[i] = DequantizeFloat(packedBits.Read(range.m_bits), range.m_min, range.m_max, range.m_bits);
+                }
+            }
+            return serializer.IsValid();
+        }
+    }
+
+    uint32_t QuantizeFloat(float value, float minValue, float maxValue, uint32_t bitCount)
+    {
+        using namespace QuantizedSerializersInternal;
+        const double maxQuantized = GetMaxQuantizedValue(bitCount);
+        const double normalized = (static_cast<double>(value) - minValue) / (static_cast<double>(maxValue) - minValue);
+        return static_cast<uint32_t>(AZStd::clamp(normalized, 0.0, 1.0) * maxQuantized + 0.5);
+    }
+
+    float DequantizeFloat(uint32_t quantized, float minValue, float maxValue, uint32_t bitCount)
+    {
+        using namespace QuantizedSerializersInternal;
+        const double maxQuantized = GetMaxQuantizedValue(bitCount);
+        return static_cast<float>(minValue + (static_cast<double>(maxValue) - minValue) * (static_cast<double>(quantized) / maxQuantized));
+    }
+
+    bool QuantizedRange::Serialize(ISerializer& serializer, float& value, const char* name) const
+    {
+        return QuantizedSerializersInternal::SerializeRangeElements<1>(serializer, &value, *this, name);
+    }
+
+    bool QuantizedRange::Serialize(ISerializer& serializer, AZ::Vector2& value, const char* name) const
+    {
+        float values[2] = { value.GetX(), value.GetY() };
+        const bool result = QuantizedSerializersInternal::SerializeRangeElements<2>(serializer, values, *this, name);
+        value = AZ::Vector2(values[0], values[1]);
+        return result;
+    }
+
+    bool QuantizedRange::Serialize(ISerializer& serializer, AZ::Vector3& value, const char* name) const
+    {
+        float values[4];
+        value.StoreToFloat3(values);
+        const bool result = QuantizedSerializersInternal::SerializeRangeElements<3>(serializer, values, *this, name);
+        value = AZ::Vector3::CreateFromFloat3(values);
+        return result;
+    }
+
+    bool QuantizedSmallestThree::Serialize(ISerializer& serializer, AZ::Quaternion& value, const char* name) const
+    {
+        using namespace QuantizedSerializersInternal;
+        AZ_Assert(m_bits > 0 && m_bits <= 32, "QuantizedSmallestThree supports between 1 and 32 bits per component");
+
+        PackedBits packedBits;
+        float components[4];
+        value.GetNormalized().StoreToFloat4(components);
+
+        uint32_t largestIndex = 0;
+        for (uint32_t i = 1; i < 4; ++i)
+        {
+            if (AZStd::abs(components[i]) > AZStd::abs(components[largestIndex]))
+            {
+                largestIndex = i;
+            }
+        }
+
+        // q and -q are the same rotation, flip the sign so the dropped component is always positive
+        const float sign = (components[largestIndex] < 0.0f) ? -1.0f : 1.0f;
+        packedBits.Write(largestIndex, 2);
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            if (i != largestIndex)
+            {
+                packedBits.Write(QuantizeFloat(sign * components[i], -SmallestThreeRange, SmallestThreeRange, m_bits), m_bits);
+            }
+        }
+
+        packedBits.Serialize(serializer, 2 + 3 * m_bits, name);
+
+        if (serializer.GetSerializerMode() == SerializerMode::WriteToObject)
+        {
+            const uint32_t decodedLargestIndex = packedBits.Read(2);
+            float sumSquares = 0.0f;
+            for (uint32_t i = 0; i < 4; ++i)
+            {
+                if (i != decodedLargestIndex)
+                {
+                    components[i] = DequantizeFloat(packedBits.Read(m_bits), -SmallestThreeRange, SmallestThreeRange, m_bits);
+                    sumSquares += components[i] * components[i];
+                }
+            }
+            components[decodedLargestIndex] = AZ::Sqrt(AZStd::max(0.0f, 1.0f - sumSquares));
+            value = AZ::Quaternion::CreateFromFloat4(components);
+        }
+        return serializer.IsValid();
+    }
+
+    bool QuantizedGridRelative::Serialize(ISerializer& serializer, AZ::Vector3& value, const char* name) const
+    {
+        AZ_Assert(m_cellBits > 0 && m_bits > 0 && m_cellBits + m_bits <= 32, "QuantizedGridRelative supports at most 32 bits per axis");
+
+        const int64_t cellBias = int64_t(1) << (m_cellBits - 1);
+        const uint32_t axisBits = m_cellBits + m_bits;
+
+        PackedBits packedBits;
+        float position[4];
+        value.StoreToFloat3(position);
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            const int64_t unclampedCell = static_cast<int64_t>(AZStd::floor(position[i] / m_cellSize));
+            const int64_t cell = AZStd::clamp(unclampedCell, -cellBias, cellBias - 1);
+            // Only values being sent are checked, values being received are overwritten by what was sent
+            AZ_WarningOnce("QuantizedSerializers", (cell == unclampedCell) || (serializer.GetSerializerMode() == SerializerMode::WriteToObject),
+                "%s position %f is beyond the %f addressable by QuantizedGridRelative and is clamped, increase its cell size or cell bits",
+                name, position[i], static_cast<float>(cellBias) * m_cellSize);
+            const float offset = position[i] - static_cast<float>(cell) * m_cellSize;
+            const uint32_t quantizedOffset = QuantizeFloat(offset, 0.0f, m_cellSize, m_bits);
+            const uint64_t axisValue = (static_cast<uint64_t>(cell + cellBias) << m_bits) | quantizedOffset;
+            packedBits.Write(static_cast<uint32_t>(axisValue), axisBits);
+        }
+
+        packedBits.Serialize(serializer, 3 * axisBits, name);
+
+        if (serializer.GetSerializerMode() == SerializerMode::WriteToObject)
+        {
+            const uint64_t offsetMask = (uint64_t(1) << m_bits) - 1;
+            for (uint32_t i = 0; i < 3; ++i)
+            {
+                const uint64_t axisValue = packedBits.Read(axisBits);
+                const int64_t cell = static_cast<int64_t>(axisValue >> m_bits) - cellBias;
+                const float offset = DequantizeFloat(static_cast<uint32_t>(axisValue & offsetMask), 0.0f, m_cellSize, m_bits);
+                position[i] = static_cast<float>(cell) * m_cellSize + offset;
+            }
+            value = AZ::Vector3::CreateFromFloat3(position);
+        }
+        return serializer.IsValid();
+    }
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+
+namespace AzNetworking
+{
+    //! @class PackedBits
+    //! @brief Packs several narrow integral values into the smallest whole number of bytes.
+    //!
+    //! Values are written and read back in the same order. When serialized, the packed bits are visited in the fewest
+    //! possible 32, 16 and 8 bit chunks, so a packed value costs a handful of serializer calls regardless of how many fields
+    //! it holds, and no more than one byte of padding.
+    class PackedBits
+    {
+    public:
+
+        //! Maximum number of bits that can be packed.
+        static constexpr uint32_t MaxBits = 128;
+
+        //! Appends a value to the packed bits.
+        //! @param value    the value to append, bits above bitCount are ignored
+        //! @param bitCount the number of bits to append, must not exceed 32
+        void Write(uint32_t value, uint32_t bitCount);
+
+        //! Reads the next value from the packed bits.
+        //! @param bitCount the number of bits to read, must not exceed 32
+        //! @return the value read
+        uint32_t Read(uint32_t bitCount);
+
+        //! Serializes the packed bits.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @param bitCount   the total number of bits packed, must be identical when reading and writing
+        //! @param name       the name of the packed value
+        //! @return boolean true for success, false for serialization failure
+        bool Serialize(ISerializer& serializer, uint32_t bitCount, const char* name);
+
+    private:
+
+        uint32_t GetBits(uint32_t offset, uint32_t bitCount) const;
+        void SetBits(uint32_t offset, uint32_t bitCount, uint32_t value);
+
+        uint32_t m_words[MaxBits / 32] = {};
+        uint32_t m_writeOffset = 0;
+        uint32_t m_readOffset = 0;
+    };
+
+    //! Quantizes a float, or every element of a vector, to a fixed number of bits over a fixed range.
+    //! Values outside of the range are clamped.
+    struct QuantizedRange
+    {
+        float m_min = 0.0f;
+        float m_max = 1.0f;
+        uint32_t m_bits = 16; //!< Bits per element, at most 32
+
+        bool Serialize(ISerializer& serializer, float& value, const char* name) const;
+        bool Serialize(ISerializer& serializer, AZ::Vector2& value, const char* name) const;
+        bool Serialize(ISerializer& serializer, AZ::Vector3& value, const char* name) const;
+    };
+
+    //! Quantizes a unit quaternion using smallest three encoding.
+    //! Only the index of the largest component and the three remaining components are sent, the largest component is
+    //! restored from the unit length constraint. The remaining components are known to lie within [-1/sqrt(2), 1/sqrt(2)].
+    struct QuantizedSmallestThree
+    {
+        uint32_t m_bits = 10; //!< Bits per sent component, at most 32
+
+        bool Serialize(ISerializer& serializer, AZ::Quaternion& value, const char* name) const;
+    };
+
+    //! Quantizes a position as the grid cell containing it and a fixed precision offset within that cell.
+    //! Positions beyond the cells addressable with m_cellBits are clamped to the outermost cells, with a warning when sent.
+    struct QuantizedGridRelative
+    {
+        float m_cellSize = 64.0f;
+        uint32_t m_cellBits = 12; //!< Bits per signed cell index
+        uint32_t m_bits = 14; //!< Bits per offset within the cell, m_cellBits + m_bits must not exceed 32
+
+        bool Serialize(ISerializer& serializer, AZ::Vector3& value, const char* name) const;
+    };
+
+    //! Maps a float onto an unsigned integer of the given number of bits.
+    //! @param value    the value to quantize, clamped to [minValue, maxValue]
+    //! @param minValue the value mapped to zero
+    //! @param maxValue the value mapped to the largest integer representable in bitCount bits
+    //! @param bitCount the number of bits to quantize to, at most 32
+    //! @return the quantized value
+    uint32_t QuantizeFloat(float value, float minValue, float maxValue, uint32_t bitCount);
+
+    //! Maps an unsigned integer produced by QuantizeFloat back onto a float.
+    //! @param quantized the quantized value
+    //! @param minValue  the value mapped to zero
+    //! @param maxValue  the value mapped to the largest integer representable in bitCount bits
+    //! @param bitCount  the number of bits quantized to, at most 32
+    //! @return the dequantized value
+    float DequantizeFloat(uint32_t quantized, float minValue, float maxValue, uint32_t bitCount);
+}
+
+#include <AzNetworking/Utilities/QuantizedSerializers.inl>
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AzNetworking
+{
+    inline void PackedBits::Write(uint32_t value, uint32_t bitCount)
+    {
+        AZ_Assert(m_writeOffset + bitCount <= MaxBits, "Exceeded PackedBits capacity");
+        SetBits(m_writeOffset, bitCount, value);
+        m_writeOffset += bitCount;
+    }
+
+    inline uint32_t PackedBits::Read(uint32_t bitCount)
+    {
+        AZ_Assert(m_readOffset + bitCount <= MaxBits, "Read past the end of PackedBits");
+        const uint32_t value = GetBits(m_readOffset, bitCount);
+        m_readOffset += bitCount;
+        return value;
+    }
+
+    inline bool PackedBits::Serialize(ISerializer& serializer, uint32_t bitCount, const char* name)
+    {
+        AZ_Assert(bitCount <= MaxBits, "Exceeded PackedBits capacity");
+        uint32_t offset = 0;
+        while (offset < bitCount)
+        {
+            const uint32_t remaining = bitCount - offset;
+            if (remaining > 24)
+            {
+                uint32_t chunk = GetBits(offset, 32);
+                serializer.Serialize(chunk, name);
+                SetBits(offset, 32, chunk);
+                offset += 32;
+            }
+            else if (remaining > 8)
+            {
+                uint16_t chunk = static_cast<uint16_t>(GetBits(offset, 16));
+                serializer.Serialize(chunk, name);
+                SetBits(offset, 16, chunk);
+                offset += 16;
+            }
+            else
+            {
+                uint8_t chunk = static_cast<uint8_t>(GetBits(offset, 8));
+                serializer.Serialize(chunk, name);
+                SetBits(offset, 8, chunk);
+                offset += 8;
+            }
+        }
+        return serializer.IsValid();
+    }
+
+    inline uint32_t PackedBits::GetBits(uint32_t offset, uint32_t bitCount) const
+    {
+        const uint32_t wordIndex = offset / 32;
+        const uint32_t wordOffset = offset % 32;
+        uint64_t bits = m_words[wordIndex] >> wordOffset;
+        if ((wordOffset + bitCount > 32) && (wordIndex + 1 < MaxBits / 32))
+        {
+            bits |= static_cast<uint64_t>(m_words[wordIndex + 1]) << (32 - wordOffset);
+        }
+        const uint64_t mask = (uint64_t(1) << bitCount) - 1;
+        return static_cast<uint32_t>(bits & mask);
+    }
+
+    inline void PackedBits::SetBits(uint32_t offset, uint32_t bitCount, uint32_t value)
+    {
+        const uint32_t wordIndex = offset / 32;
+        const uint32_t wordOffset = offset % 32;
+        const uint64_t mask = ((uint64_t(1) << bitCount) - 1) << wordOffset;
+        const uint64_t bits = (static_cast<uint64_t>(value) << wordOffset) & mask;
+        m_words[wordIndex] = (m_words[wordIndex] & ~static_cast<uint32_t>(mask)) | static_cast<uint32_t>(bits);
+        if ((wordOffset + bitCount > 32) && (wordIndex + 1 < MaxBits / 32))
+        {
+            const uint32_t highMask = static_cast<uint32_t>(mask >> 32);
+            m_words[wordIndex + 1] = (m_words[wordIndex + 1] & ~highMask) | static_cast<uint32_t>(bits >> 32);
+        }
+    }
+}
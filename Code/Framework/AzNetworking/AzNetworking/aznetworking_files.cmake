@@ -39,6 +39,7 @@ set(FILES
     DataStructures/TimeoutQueue.cpp
     DataStructures/TimeoutQueue.h
     DataStructures/TimeoutQueue.inl
+    Framework/ICompressor.cpp
     Framework/ICompressor.h
     Framework/INetworking.h
     Framework/INetworkInterface.h
@@ -105,6 +106,9 @@ set(FILES
     UdpTransport/UdpFragmentQueue.h
     UdpTransport/UdpNetworkInterface.cpp
     UdpTransport/UdpNetworkInterface.h
+    UdpTransport/UdpPacketBuffer.cpp
+    UdpTransport/UdpPacketBuffer.h
+    UdpTransport/UdpPacketBuffer.inl
     UdpTransport/UdpPacketHeader.cpp
     UdpTransport/UdpPacketHeader.h
     UdpTransport/UdpPacketHeader.inl
@@ -116,6 +120,9 @@ set(FILES
     UdpTransport/UdpPacketTracker.inl
     UdpTransport/UdpReaderThread.cpp
     UdpTransport/UdpReaderThread.h
+    UdpTransport/UdpReceiveQueue.cpp
+    UdpTransport/UdpReceiveQueue.h
+    UdpTransport/UdpReceiveQueue.inl
     UdpTransport/UdpReliableQueue.cpp
     UdpTransport/UdpReliableQueue.h
     UdpTransport/UdpSocket.cpp
@@ -135,6 +142,9 @@ set(FILES
     Utilities/NetworkIncludes.h
     Utilities/QuantizedValues.h
     Utilities/QuantizedValues.inl
+    Utilities/QuantizedSerializers.cpp
+    Utilities/QuantizedSerializers.h
+    Utilities/QuantizedSerializers.inl
     Utilities/TimedThread.cpp
     Utilities/TimedThread.h
 )
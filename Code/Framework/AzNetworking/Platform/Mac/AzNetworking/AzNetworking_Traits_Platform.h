@@ -14,4 +14,6 @@
 #define AZ_TRAIT_USE_SOCKET_SERVER_SELECT 1
 #define AZ_TRAIT_USE_OPENSSL 1
 #define AZ_TRAIT_NEEDS_HTONLL 0
+#define AZ_TRAIT_USE_SOCKET_MMSG 0
+#define AZ_TRAIT_USE_SOCKET_REUSEPORT 0
 
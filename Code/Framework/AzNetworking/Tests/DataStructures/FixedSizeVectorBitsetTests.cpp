@@ -11,4 +11,22 @@
 
 namespace UnitTest
 {
+    TEST(FixedSizeVectorBitset, TestEquality)
+    {
+        AzNetworking::FixedSizeVectorBitset<128> lhs;
+        AzNetworking::FixedSizeVectorBitset<128> rhs;
+        lhs.Resize(40);
+        rhs.Resize(40);
+        EXPECT_TRUE(lhs == rhs);
+
+        lhs.SetBit(33, true);
+        EXPECT_TRUE(lhs != rhs);
+
+        rhs.SetBit(33, true);
+        EXPECT_TRUE(lhs == rhs);
+
+        // Same bits set, but a different size
+        rhs.Resize(41);
+        EXPECT_FALSE(lhs == rhs);
+    }
 }
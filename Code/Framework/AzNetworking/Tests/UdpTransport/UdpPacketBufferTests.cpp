@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpPacketBuffer.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    class UdpPacketBufferTests
+        : public AllocatorsFixture
+    {
+    };
+
+    TEST_F(UdpPacketBufferTests, ReleasedBuffersAreReused)
+    {
+        UdpPacketBufferPool pool(4);
+
+        const UdpPacketBuffer* firstAddress = nullptr;
+        {
+            UdpPacketBufferPtr buffer = pool.Acquire();
+            firstAddress = buffer.get();
+            buffer->Resize(16);
+            EXPECT_EQ(pool.GetAllocatedCount(), 1u);
+            EXPECT_EQ(pool.GetFreeCount(), 0u);
+        }
+        EXPECT_EQ(pool.GetFreeCount(), 1u);
+
+        UdpPacketBufferPtr buffer = pool.Acquire();
+        EXPECT_EQ(buffer.get(), firstAddress);
+        EXPECT_EQ(buffer->GetSize(), 0u);
+        EXPECT_EQ(pool.GetAllocatedCount(), 1u);
+    }
+
+    TEST_F(UdpPacketBufferTests, SharedBufferReturnsAfterLastReference)
+    {
+        UdpPacketBufferPool pool(4);
+
+        UdpPacketBufferPtr buffer = pool.Acquire();
+        UdpPacketBufferPtr retained = buffer;
+        buffer.reset();
+        EXPECT_EQ(pool.GetFreeCount(), 0u);
+
+        retained.reset();
+        EXPECT_EQ(pool.GetFreeCount(), 1u);
+    }
+
+    TEST_F(UdpPacketBufferTests, FreeListIsCapped)
+    {
+        UdpPacketBufferPool pool(2);
+        {
+            UdpPacketBufferPtr buffers[4] = { pool.Acquire(), pool.Acquire(), pool.Acquire(), pool.Acquire() };
+            EXPECT_EQ(pool.GetAllocatedCount(), 4u);
+        }
+        EXPECT_EQ(pool.GetFreeCount(), 2u);
+        EXPECT_EQ(pool.GetAllocatedCount(), 2u);
+    }
+
+    TEST_F(UdpPacketBufferTests, PrependKeepsPayloadInPlace)
+    {
+        UdpPacketBufferPool pool(1);
+        UdpPacketBufferPtr buffer = pool.Acquire();
+
+        const uint8_t payload[] = { 4, 5, 6 };
+        memcpy(buffer->GetBuffer(), payload, sizeof(payload));
+        buffer->Resize(sizeof(payload));
+
+        // Prepending twice, as a retransmit would, only replaces the header
+        const uint8_t firstHeader[] = { 9, 9 };
+        buffer->Prepend(firstHeader, sizeof(firstHeader));
+
+        const uint8_t header[] = { 1, 2, 3 };
+        const uint8_t* packet = buffer->Prepend(header, sizeof(header));
+        EXPECT_EQ(packet + sizeof(header), buffer->GetBuffer());
+
+        const uint8_t expected[] = { 1, 2, 3, 4, 5, 6 };
+        EXPECT_EQ(memcmp(packet, expected, sizeof(expected)), 0);
+        EXPECT_EQ(buffer->GetSize(), sizeof(payload));
+    }
+
+    TEST_F(UdpPacketBufferTests, AcquireUsesSmallestFittingSizeClass)
+    {
+        UdpPacketBufferPool pool(4);
+
+        EXPECT_EQ(pool.Acquire(1)->GetCapacity(), UdpPacketBuffer::SizeClassCapacities[0]);
+        EXPECT_EQ(pool.Acquire(UdpPacketBuffer::SizeClassCapacities[0])->GetCapacity(), UdpPacketBuffer::SizeClassCapacities[0]);
+        EXPECT_EQ(pool.Acquire(UdpPacketBuffer::SizeClassCapacities[0] + 1)->GetCapacity(), UdpPacketBuffer::SizeClassCapacities[1]);
+        EXPECT_EQ(pool.Acquire()->GetCapacity(), UdpPacketBuffer::PayloadCapacity);
+
+        // Released buffers are only reused for their own size class
+        EXPECT_EQ(pool.GetFreeCount(), 3u);
+        UdpPacketBufferPtr buffer = pool.Acquire(UdpPacketBuffer::SizeClassCapacities[2]);
+        EXPECT_EQ(pool.GetAllocatedCount(), 4u);
+    }
+
+    TEST_F(UdpPacketBufferTests, CompactCopiesPayloadToSmallerBuffer)
+    {
+        UdpPacketBufferPool pool(4);
+
+        const uint8_t payload[] = { 4, 5, 6 };
+        UdpPacketBufferPtr buffer = pool.Acquire();
+        memcpy(buffer->GetBuffer(), payload, sizeof(payload));
+        buffer->Resize(sizeof(payload));
+
+        UdpPacketBufferPtr compactBuffer = pool.Compact(buffer);
+        EXPECT_NE(compactBuffer, buffer);
+        EXPECT_EQ(compactBuffer->GetCapacity(), UdpPacketBuffer::SizeClassCapacities[0]);
+        ASSERT_EQ(compactBuffer->GetSize(), sizeof(payload));
+        EXPECT_EQ(memcmp(compactBuffer->GetBuffer(), payload, sizeof(payload)), 0);
+
+        // A buffer already of the smallest fitting size class is kept
+        EXPECT_EQ(pool.Compact(compactBuffer), compactBuffer);
+    }
+}
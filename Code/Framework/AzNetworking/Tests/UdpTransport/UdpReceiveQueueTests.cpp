@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpReceiveQueue.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    class UdpReceiveQueueTests
+        : public AllocatorsFixture
+    {
+    };
+
+    // Writes count packets tagged with sequential values starting at firstValue, returns the number actually written
+    static uint32_t WritePackets(UdpReceiveQueue& queue, uint32_t firstValue, uint32_t count)
+    {
+        const uint32_t writeCount = AZStd::min(queue.GetWritableCount(), count);
+        for (uint32_t i = 0; i < writeCount; ++i)
+        {
+            queue.GetWriteAddresses()[i] = IpAddress(127, 0, 0, 1, 1000);
+            queue.GetWriteSizes()[i] = sizeof(uint32_t);
+            const uint32_t value = firstValue + i;
+            memcpy(queue.GetWriteBuffer() + i * MaxUdpTransmissionUnit, &value, sizeof(value));
+        }
+        queue.CommitWrite(writeCount);
+        return writeCount;
+    }
+
+    static uint32_t ReadValue(const UdpReceiveQueue& queue, uint32_t index)
+    {
+        uint32_t value = 0;
+        memcpy(&value, queue.GetPacket(index).m_buffer, sizeof(value));
+        return value;
+    }
+
+    TEST_F(UdpReceiveQueueTests, CapacityRoundsUpToPowerOfTwo)
+    {
+        UdpReceiveQueue queue(100);
+        EXPECT_EQ(queue.GetCapacity(), 128u);
+        EXPECT_EQ(queue.GetWritableCount(), 128u);
+        EXPECT_EQ(queue.GetReadableCount(), 0u);
+    }
+
+    TEST_F(UdpReceiveQueueTests, WrapsAroundInOrder)
+    {
+        UdpReceiveQueue queue(8);
+
+        EXPECT_EQ(WritePackets(queue, 0, 6), 6u);
+        EXPECT_EQ(queue.GetReadableCount(), 6u);
+        EXPECT_EQ(queue.GetWritableCount(), 2u);
+        queue.Release(4);
+
+        // Only the two slots before the end of the buffer are contiguous, even though six are free
+        EXPECT_EQ(queue.GetWritableCount(), 2u);
+        EXPECT_EQ(WritePackets(queue, 6, 2), 2u);
+        EXPECT_EQ(queue.GetWritableCount(), 4u);
+        EXPECT_EQ(WritePackets(queue, 8, 4), 4u);
+        EXPECT_EQ(queue.GetWritableCount(), 0u);
+
+        ASSERT_EQ(queue.GetReadableCount(), 8u);
+        for (uint32_t i = 0; i < 8; ++i)
+        {
+            EXPECT_EQ(ReadValue(queue, i), i + 4);
+            EXPECT_EQ(queue.GetPacket(i).m_receivedBytes, static_cast<int32_t>(sizeof(uint32_t)));
+        }
+        queue.Release(8);
+        EXPECT_EQ(queue.GetReadableCount(), 0u);
+    }
+
+    TEST_F(UdpReceiveQueueTests, ProducerConsumerThreads)
+    {
+        constexpr uint32_t TotalPackets = 100000;
+        UdpReceiveQueue queue(64);
+
+        AZStd::thread producer([&queue]()
+        {
+            uint32_t written = 0;
+            while (written < TotalPackets)
+            {
+                const uint32_t writeCount = WritePackets(queue, written, AZStd::min(TotalPackets - written, 16u));
+                if (writeCount == 0)
+                {
+                    AZStd::this_thread::yield();
+                }
+                written += writeCount;
+            }
+        });
+
+        uint32_t expected = 0;
+        bool inOrder = true;
+        while (expected < TotalPackets)
+        {
+            const uint32_t readCount = queue.GetReadableCount();
+            for (uint32_t i = 0; i < readCount; ++i)
+            {
+                inOrder &= (ReadValue(queue, i) == expected + i);
+            }
+            queue.Release(readCount);
+            expected += readCount;
+        }
+        producer.join();
+
+        EXPECT_TRUE(inOrder);
+        EXPECT_EQ(queue.GetReadableCount(), 0u);
+    }
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    //! Simulates a server sending one update packet to each of its connections per tick, then reading them back on loopback.
+    //! Range 0 selects whether the sends are batched (1) or written one at a time (0).
+    class BM_UdpSocketLoopback
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t NumConnections = 200;
+        static constexpr uint32_t PacketSize = 512;
+        static constexpr uint16_t ReceivePortBase = 33000;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SocketLayerInit();
+
+            m_sendSocket = AZStd::make_unique<UdpSocket>();
+            m_sendSocket->Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer);
+
+            // One receiving socket per simulated connection, so every packet of the tick goes to a different endpoint
+            m_recvSockets.resize(NumConnections);
+            m_recvAddresses.resize(NumConnections);
+            for (uint32_t i = 0; i < NumConnections; ++i)
+            {
+                const uint16_t port = aznumeric_cast<uint16_t>(ReceivePortBase + i);
+                m_recvSockets[i] = AZStd::make_unique<UdpSocket>();
+                m_recvSockets[i]->Open(port, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer);
+                m_recvAddresses[i] = IpAddress(127, 0, 0, 1, port);
+            }
+            m_dtlsEndpoint = AZStd::make_unique<DtlsEndpoint>();
+            memset(m_packet, 0xA5, sizeof(m_packet));
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_dtlsEndpoint.reset();
+            m_recvSockets.clear();
+            m_recvAddresses.clear();
+            m_sendSocket.reset();
+            SocketLayerShutdown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZStd::unique_ptr<UdpSocket> m_sendSocket;
+        AZStd::vector<AZStd::unique_ptr<UdpSocket>> m_recvSockets;
+        AZStd::vector<IpAddress> m_recvAddresses;
+        AZStd::unique_ptr<DtlsEndpoint> m_dtlsEndpoint;
+        uint8_t m_packet[PacketSize];
+    };
+
+    BENCHMARK_DEFINE_F(BM_UdpSocketLoopback, SendTick)(benchmark::State& state)
+    {
+        const bool useBatching = (state.range(0) != 0);
+        const ConnectionQuality connectionQuality;
+
+        IpAddress addresses[UdpSocket::MaxBatchPacketCount];
+        int32_t sizes[UdpSocket::MaxBatchPacketCount];
+        AZStd::vector<uint8_t> recvBuffer(UdpSocket::MaxBatchPacketCount * MaxUdpTransmissionUnit);
+
+        const uint32_t startSendCalls = m_sendSocket->GetSendCalls();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            if (useBatching)
+            {
+                m_sendSocket->BeginSendBatch();
+            }
+            for (const IpAddress& address : m_recvAddresses)
+            {
+                m_sendSocket->Send(address, m_packet, PacketSize, false, *m_dtlsEndpoint, connectionQuality);
+            }
+            if (useBatching)
+            {
+                m_sendSocket->EndSendBatch();
+            }
+
+            // Drain the receivers so the socket buffers never fill up and start dropping
+            for (const AZStd::unique_ptr<UdpSocket>& recvSocket : m_recvSockets)
+            {
+                while (recvSocket->ReceiveBatch(addresses, sizes, recvBuffer.data(), MaxUdpTransmissionUnit, UdpSocket::MaxBatchPacketCount) > 0)
+                {
+                    ;
+                }
+            }
+        }
+
+        const int64_t sentPackets = aznumeric_cast<int64_t>(state.iterations()) * NumConnections;
+        state.SetItemsProcessed(sentPackets);
+        state.counters["PacketsPerSendCall"] = benchmark::Counter(
+            aznumeric_cast<double>(sentPackets) / AZStd::max(1.0, aznumeric_cast<double>(m_sendSocket->GetSendCalls() - startSendCalls)));
+    }
+    BENCHMARK_REGISTER_F(BM_UdpSocketLoopback, SendTick)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+} // namespace Benchmark
+
+#endif
@@ -9,7 +9,10 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpReaderThread.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
+#include <AzNetworking/Framework/ICompressor.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
 #include <AzCore/Interface/Interface.h>
@@ -57,12 +60,12 @@ namespace UnitTest
     class TestUdpClient
     {
     public:
-        TestUdpClient()
+        TestUdpClient(uint16_t serverPort = 12345)
         {
             AZStd::string name = AZStd::string::format("UdpClient%d", ++s_numClients);
             m_name = name;
             m_clientNetworkInterface = AZ::Interface<INetworking>::Get()->CreateNetworkInterface(m_name, ProtocolType::Udp, TrustZone::ExternalClientToServer, m_connectionListener);
-            m_clientNetworkInterface->Connect(IpAddress(127, 0, 0, 1, 12345));
+            m_clientNetworkInterface->Connect(IpAddress(127, 0, 0, 1, serverPort));
         }
 
         ~TestUdpClient()
@@ -95,6 +98,68 @@ namespace UnitTest
         INetworkInterface* m_serverNetworkInterface;
     };
 
+    // Passes data through unchanged, optionally reporting that it needs ordered delivery like a streaming compressor
+    class TestCompressor
+        : public ICompressor
+    {
+    public:
+        explicit TestCompressor(bool requiresOrderedDelivery)
+            : m_requiresOrderedDelivery(requiresOrderedDelivery)
+        {
+            ;
+        }
+
+        bool Init() override { return true; }
+        CompressorType GetType() const override { return CompressorType{ 1 }; }
+        bool RequiresOrderedDelivery() const override { return m_requiresOrderedDelivery; }
+        AZStd::size_t GetMaxChunkSize(AZStd::size_t maxCompSize) const override { return maxCompSize; }
+        AZStd::size_t GetMaxCompressedBufferSize(AZStd::size_t uncompSize) const override { return uncompSize; }
+
+        CompressorError Compress(const void* uncompData, AZStd::size_t uncompSize, void* compData, AZStd::size_t compDataSize, AZStd::size_t& compSize) override
+        {
+            if (uncompSize > compDataSize)
+            {
+                return CompressorError::InsufficientBuffer;
+            }
+            memcpy(compData, uncompData, uncompSize);
+            compSize = uncompSize;
+            return CompressorError::Ok;
+        }
+
+        CompressorError Decompress(const void* compData, AZStd::size_t compDataSize, void* uncompData, AZStd::size_t uncompDataSize, AZStd::size_t& consumedSize, AZStd::size_t& uncompSize) override
+        {
+            if (compDataSize > uncompDataSize)
+            {
+                return CompressorError::InsufficientBuffer;
+            }
+            memcpy(uncompData, compData, compDataSize);
+            consumedSize = compDataSize;
+            uncompSize = compDataSize;
+            return CompressorError::Ok;
+        }
+
+    private:
+        bool m_requiresOrderedDelivery = false;
+    };
+
+    // Registers under the default net_UdpCompressor name
+    class TestCompressorFactory
+        : public ICompressorFactory
+    {
+    public:
+        explicit TestCompressorFactory(bool requiresOrderedDelivery)
+            : m_requiresOrderedDelivery(requiresOrderedDelivery)
+        {
+            ;
+        }
+
+        AZStd::unique_ptr<ICompressor> Create() override { return AZStd::make_unique<TestCompressor>(m_requiresOrderedDelivery); }
+        AZ::Name GetFactoryName() const override { return AZ::Name(AZStd::string_view("MultiplayerCompressor")); }
+
+    private:
+        bool m_requiresOrderedDelivery = false;
+    };
+
     class UdpTransportTests
         : public AllocatorsFixture
     {
@@ -244,6 +309,28 @@ namespace UnitTest
         EXPECT_EQ(ackState, PacketAckState::Nacked); // Testing that PacketId is not flagged as acked
     }
 
+    TEST_F(UdpTransportTests, CompressorRequiringOrderedDelivery_IsNotUsed)
+    {
+        const AZ::Name interfaceName = AZ::Name(AZStd::string_view("UdpCompressed"));
+        TestUdpConnectionListener connectionListener;
+
+        // The networking system takes ownership of registered factories, and destroys them when they are unregistered
+        TestCompressorFactory* statelessFactory = new TestCompressorFactory(false);
+        const AZ::Name factoryName = statelessFactory->GetFactoryName();
+        m_networkingSystemComponent->RegisterCompressorFactory(statelessFactory);
+        INetworkInterface* networkInterface = m_networkingSystemComponent->CreateNetworkInterface(interfaceName, ProtocolType::Udp, TrustZone::ExternalClientToServer, connectionListener);
+        EXPECT_TRUE(static_cast<UdpNetworkInterface*>(networkInterface)->IsCompressed());
+        m_networkingSystemComponent->DestroyNetworkInterface(interfaceName);
+        m_networkingSystemComponent->UnregisterCompressorFactory(factoryName);
+
+        // A compressor keeping history across packets would desynchronize with loss and reordering, so UDP sends uncompressed
+        m_networkingSystemComponent->RegisterCompressorFactory(new TestCompressorFactory(true));
+        networkInterface = m_networkingSystemComponent->CreateNetworkInterface(interfaceName, ProtocolType::Udp, TrustZone::ExternalClientToServer, connectionListener);
+        EXPECT_FALSE(static_cast<UdpNetworkInterface*>(networkInterface)->IsCompressed());
+        m_networkingSystemComponent->DestroyNetworkInterface(interfaceName);
+        m_networkingSystemComponent->UnregisterCompressorFactory(factoryName);
+    }
+
     TEST_F(UdpTransportTests, TestSingleClient)
     {
         TestUdpServer testServer;
@@ -299,4 +386,160 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, TestShardedServer)
+    {
+        constexpr uint32_t NumReaderThreads = 4;
+        constexpr uint32_t NumTestClients = 20;
+        constexpr uint16_t ShardedPort = 12347;
+
+        UdpReaderThreads readerThreads;
+        for (uint32_t i = 0; i < NumReaderThreads; ++i)
+        {
+            readerThreads.emplace_back(AZStd::make_unique<UdpReaderThread>());
+        }
+
+        TestUdpConnectionListener serverListener;
+        UdpNetworkInterface testServer(AZ::Name("ShardedUdpServer"), serverListener, TrustZone::ExternalClientToServer, readerThreads);
+        ASSERT_TRUE(testServer.Listen(ShardedPort));
+
+#if AZ_TRAIT_USE_SOCKET_REUSEPORT
+        // One receive shard per reader thread
+        for (const AZStd::unique_ptr<UdpReaderThread>& readerThread : readerThreads)
+        {
+            EXPECT_EQ(readerThread->GetSocketCount(), 1u);
+        }
+#endif
+
+        AZStd::vector<AZStd::unique_ptr<TestUdpClient>> testClients;
+        for (uint32_t i = 0; i < NumTestClients; ++i)
+        {
+            testClients.emplace_back(AZStd::make_unique<TestUdpClient>(ShardedPort));
+        }
+
+        constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        for (;;)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+            m_networkingSystemComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+            testServer.Update(AZ::TimeMs{ 0 });
+            bool timeExpired = (AZ::GetElapsedTimeMs() - startTimeMs > TotalIterationTimeMs);
+            bool canTerminate = testServer.GetConnectionSet().GetConnectionCount() == NumTestClients;
+            for (const AZStd::unique_ptr<TestUdpClient>& testClient : testClients)
+            {
+                canTerminate &= testClient->m_clientNetworkInterface->GetConnectionSet().GetConnectionCount() == 1;
+            }
+            if (canTerminate || timeExpired)
+            {
+                break;
+            }
+        }
+
+        // Every client is found by address no matter which shard its packets arrived on
+        EXPECT_EQ(testServer.GetConnectionSet().GetConnectionCount(), NumTestClients);
+        for (const AZStd::unique_ptr<TestUdpClient>& testClient : testClients)
+        {
+            EXPECT_EQ(testClient->m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
+        }
+        EXPECT_EQ(testServer.GetMetrics().m_recvQueueDrops, 0u);
+    }
+
+    TEST_F(UdpTransportTests, BatchedSendAndReceive)
+    {
+        constexpr uint32_t NumTestPackets = 16;
+        constexpr uint32_t TestPacketSize = 512;
+        constexpr uint32_t LastTestPacketSize = 100;
+        constexpr uint16_t TestPort = 12346;
+
+        UdpSocket serverSocket;
+        UdpSocket clientSocket;
+        ASSERT_TRUE(serverSocket.Open(TestPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        ASSERT_TRUE(clientSocket.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+
+        DtlsEndpoint dtlsEndpoint;
+        const ConnectionQuality connectionQuality;
+        const IpAddress serverAddress(127, 0, 0, 1, TestPort);
+
+        uint8_t sendBuffer[MaxUdpTransmissionUnit];
+        clientSocket.BeginSendBatch();
+        for (uint32_t i = 0; i < NumTestPackets; ++i)
+        {
+            // Equal sized packets followed by a shorter one, so segmentation offload can combine the whole batch
+            const uint32_t packetSize = (i == NumTestPackets - 1) ? LastTestPacketSize : TestPacketSize;
+            memset(sendBuffer, static_cast<int>(i), packetSize);
+            EXPECT_EQ(clientSocket.Send(serverAddress, sendBuffer, packetSize, false, dtlsEndpoint, connectionQuality), static_cast<int32_t>(packetSize));
+        }
+        EXPECT_EQ(clientSocket.GetSendCalls(), 0u); // Nothing is written until the batch ends
+        clientSocket.EndSendBatch();
+        EXPECT_EQ(clientSocket.GetSentPackets(), NumTestPackets);
+#if AZ_TRAIT_USE_SOCKET_MMSG
+        EXPECT_EQ(clientSocket.GetSendCalls(), 1u);
+#endif
+
+        IpAddress addresses[UdpSocket::MaxBatchPacketCount];
+        int32_t sizes[UdpSocket::MaxBatchPacketCount];
+        AZStd::vector<uint8_t> recvBuffer(UdpSocket::MaxBatchPacketCount * MaxUdpTransmissionUnit);
+
+        uint32_t receivedCount = 0;
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while ((receivedCount < NumTestPackets) && (AZ::GetElapsedTimeMs() - startTimeMs < AZ::TimeMs{ 1000 }))
+        {
+            receivedCount += serverSocket.ReceiveBatch(addresses + receivedCount, sizes + receivedCount,
+                recvBuffer.data() + receivedCount * MaxUdpTransmissionUnit, MaxUdpTransmissionUnit, NumTestPackets - receivedCount);
+        }
+
+        ASSERT_EQ(receivedCount, NumTestPackets);
+        for (uint32_t i = 0; i < NumTestPackets; ++i)
+        {
+            const uint32_t packetSize = (i == NumTestPackets - 1) ? LastTestPacketSize : TestPacketSize;
+            const uint8_t* packetData = recvBuffer.data() + i * MaxUdpTransmissionUnit;
+            EXPECT_EQ(sizes[i], static_cast<int32_t>(packetSize));
+            EXPECT_EQ(addresses[i].GetAddress(ByteOrder::Host), serverAddress.GetAddress(ByteOrder::Host));
+            EXPECT_EQ(packetData[0], static_cast<uint8_t>(i));
+            EXPECT_EQ(packetData[packetSize - 1], static_cast<uint8_t>(i));
+        }
+        EXPECT_EQ(serverSocket.GetRecvPackets(), NumTestPackets);
+    }
+
+    TEST_F(UdpTransportTests, ReaderThread_QueueFull_CountsEachDroppedPacket)
+    {
+        constexpr uint32_t QueueCapacity = 4;
+        constexpr uint32_t NumTestPackets = 20;
+        constexpr uint16_t TestPort = 12347;
+
+        UdpSocket serverSocket;
+        UdpSocket clientSocket;
+        ASSERT_TRUE(serverSocket.Open(TestPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        ASSERT_TRUE(clientSocket.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+
+        UdpReaderThread readerThread;
+        UdpReceiveQueue* receiveQueue = readerThread.RegisterSocket(&serverSocket, QueueCapacity);
+        ASSERT_NE(receiveQueue, nullptr);
+
+        DtlsEndpoint dtlsEndpoint;
+        const ConnectionQuality connectionQuality;
+        const IpAddress serverAddress(127, 0, 0, 1, TestPort);
+        uint8_t sendBuffer[64] = {};
+        for (uint32_t i = 0; i < NumTestPackets; ++i)
+        {
+            clientSocket.Send(serverAddress, sendBuffer, sizeof(sendBuffer), false, dtlsEndpoint, connectionQuality);
+        }
+
+        // Nothing consumes the queue, so every packet past its capacity is dropped
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while ((receiveQueue->GetReadableCount() + receiveQueue->GetDroppedCount() < NumTestPackets)
+            && (AZ::GetElapsedTimeMs() - startTimeMs < AZ::TimeMs{ 1000 }))
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        }
+        EXPECT_EQ(receiveQueue->GetReadableCount(), QueueCapacity);
+        EXPECT_EQ(receiveQueue->GetDroppedCount(), NumTestPackets - QueueCapacity);
+
+        // Reader thread ticks that find the queue still full drop nothing more once the socket is empty
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(50));
+        EXPECT_EQ(receiveQueue->GetDroppedCount(), NumTestPackets - QueueCapacity);
+
+        readerThread.UnregisterSocket(&serverSocket);
+    }
 }
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+#include <AzNetworking/Utilities/QuantizedSerializers.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    //! Serializes the rotation and translation of many entities, the way a server writes and a client reads transform updates.
+    //! Range 0 selects whether the transforms are quantized (1) or sent at full precision (0), using the specs the
+    //! NetworkTransformComponent documents for its rotation and for positions within a bounded world.
+    class BM_QuantizedTransform
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t NumTransforms = 1000;
+        static constexpr float WorldSize = 4000.0f;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            AZ::SimpleLcgRandom random(1234);
+            m_translations.resize(NumTransforms);
+            m_rotations.resize(NumTransforms);
+            for (uint32_t i = 0; i < NumTransforms; ++i)
+            {
+                m_translations[i] = AZ::Vector3(
+                    (random.GetRandomFloat() - 0.5f) * WorldSize, (random.GetRandomFloat() - 0.5f) * WorldSize, random.GetRandomFloat() * 100.0f);
+                m_rotations[i] = AZ::Quaternion(
+                    random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f).GetNormalized();
+            }
+            m_buffer.resize(NumTransforms * (sizeof(AZ::Vector3) + sizeof(AZ::Quaternion)));
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_translations = {};
+            m_rotations = {};
+            m_buffer = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void SerializeTransforms(ISerializer& serializer, bool quantized)
+        {
+            for (uint32_t i = 0; i < NumTransforms; ++i)
+            {
+                if (quantized)
+                {
+                    m_rotationQuantizer.Serialize(serializer, m_rotations[i], "Rotation");
+                    m_translationQuantizer.Serialize(serializer, m_translations[i], "Translation");
+                }
+                else
+                {
+                    serializer.Serialize(m_rotations[i], "Rotation");
+                    serializer.Serialize(m_translations[i], "Translation");
+                }
+            }
+        }
+
+        void SetCounters(::benchmark::State& state, uint32_t serializedSize)
+        {
+            state.SetItemsProcessed(state.iterations() * NumTransforms);
+            state.SetBytesProcessed(state.iterations() * serializedSize);
+            state.counters["BytesPerTransform"] = static_cast<double>(serializedSize) / NumTransforms;
+        }
+
+        const QuantizedSmallestThree m_rotationQuantizer{ 12 };
+        const QuantizedGridRelative m_translationQuantizer{ 64.0f, 12, 14 };
+        AZStd::vector<AZ::Vector3> m_translations;
+        AZStd::vector<AZ::Quaternion> m_rotations;
+        AZStd::vector<uint8_t> m_buffer;
+    };
+
+    BENCHMARK_DEFINE_F(BM_QuantizedTransform, Write)(benchmark::State& state)
+    {
+        const bool quantized = (state.range(0) != 0);
+        uint32_t serializedSize = 0;
+        for (auto _ : state)
+        {
+            NetworkInputSerializer serializer(m_buffer.data(), static_cast<uint32_t>(m_buffer.size()));
+            SerializeTransforms(serializer, quantized);
+            serializedSize = serializer.GetSize();
+            benchmark::DoNotOptimize(serializedSize);
+        }
+        SetCounters(state, serializedSize);
+    }
+
+    BENCHMARK_DEFINE_F(BM_QuantizedTransform, Read)(benchmark::State& state)
+    {
+        const bool quantized = (state.range(0) != 0);
+        NetworkInputSerializer inputSerializer(m_buffer.data(), static_cast<uint32_t>(m_buffer.size()));
+        SerializeTransforms(inputSerializer, quantized);
+        const uint32_t serializedSize = inputSerializer.GetSize();
+
+        for (auto _ : state)
+        {
+            NetworkOutputSerializer serializer(m_buffer.data(), serializedSize);
+            SerializeTransforms(serializer, quantized);
+            benchmark::DoNotOptimize(m_translations.data());
+        }
+        SetCounters(state, serializedSize);
+    }
+
+    BENCHMARK_REGISTER_F(BM_QuantizedTransform, Write)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(BM_QuantizedTransform, Read)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+}
+
+#endif
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Utilities/QuantizedSerializers.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    TEST(QuantizedSerializers, TestPackedBits)
+    {
+        AzNetworking::PackedBits packedIn;
+        packedIn.Write(0x3, 2);
+        packedIn.Write(0x1FFFF, 17);
+        packedIn.Write(0xDEADBEEF, 32);
+        packedIn.Write(0x5, 3);
+        constexpr uint32_t TotalBits = 2 + 17 + 32 + 3;
+
+        AZStd::array<uint8_t, 1024> buffer;
+        AzNetworking::NetworkInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(packedIn.Serialize(inputSerializer, TotalBits, "Packed"));
+        EXPECT_EQ(inputSerializer.GetSize(), (TotalBits + 7) / 8);
+
+        AzNetworking::PackedBits packedOut;
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), inputSerializer.GetSize());
+        EXPECT_TRUE(packedOut.Serialize(outputSerializer, TotalBits, "Packed"));
+        EXPECT_EQ(packedOut.Read(2), 0x3u);
+        EXPECT_EQ(packedOut.Read(17), 0x1FFFFu);
+        EXPECT_EQ(packedOut.Read(32), 0xDEADBEEFu);
+        EXPECT_EQ(packedOut.Read(3), 0x5u);
+    }
+
+    TEST(QuantizedSerializers, TestQuantizedRange)
+    {
+        const AzNetworking::QuantizedRange range{ -100.0f, 100.0f, 12 };
+
+        AZStd::array<uint8_t, 1024> buffer;
+        AzNetworking::NetworkInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+
+        AZ::Vector3 valueIn(-42.5f, 0.0f, 150.0f);
+        EXPECT_TRUE(range.Serialize(inputSerializer, valueIn, "Value"));
+        EXPECT_EQ(inputSerializer.GetSize(), 5u); // 36 bits
+
+        AZ::Vector3 valueOut = AZ::Vector3::CreateZero();
+        EXPECT_TRUE(range.Serialize(outputSerializer, valueOut, "Value"));
+        EXPECT_TRUE(valueOut.IsClose(AZ::Vector3(-42.5f, 0.0f, 100.0f), 0.05f)); // Values outside the range are clamped
+    }
+
+    TEST(QuantizedSerializers, TestQuantizedSmallestThree)
+    {
+        const AzNetworking::QuantizedSmallestThree smallestThree{ 10 };
+
+        AZStd::array<uint8_t, 1024> buffer;
+        AzNetworking::NetworkInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+
+        const AZ::Quaternion rotations[] =
+        {
+            AZ::Quaternion::CreateIdentity(),
+            AZ::Quaternion::CreateRotationZ(AZ::DegToRad(90.0f)),
+            AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(1.0f, -2.0f, 3.0f).GetNormalized(), AZ::DegToRad(-135.0f)),
+        };
+
+        for (const AZ::Quaternion& rotation : rotations)
+        {
+            AZ::Quaternion valueIn = rotation;
+            EXPECT_TRUE(smallestThree.Serialize(inputSerializer, valueIn, "Rotation"));
+        }
+        EXPECT_EQ(inputSerializer.GetSize(), 3u * 4u); // 32 bits each
+
+        for (const AZ::Quaternion& rotation : rotations)
+        {
+            AZ::Quaternion valueOut = AZ::Quaternion::CreateZero();
+            EXPECT_TRUE(smallestThree.Serialize(outputSerializer, valueOut, "Rotation"));
+            // Either sign of the quaternion represents the same rotation
+            EXPECT_TRUE(valueOut.IsClose(rotation, 0.005f) || valueOut.IsClose(-rotation, 0.005f));
+        }
+    }
+
+    TEST(QuantizedSerializers, TestQuantizedGridRelative)
+    {
+        const AzNetworking::QuantizedGridRelative gridRelative{ 64.0f, 12, 14 };
+
+        AZStd::array<uint8_t, 1024> buffer;
+        AzNetworking::NetworkInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+
+        AZ::Vector3 valueIn(-1234.567f, 0.001f, 9876.5f);
+        EXPECT_TRUE(gridRelative.Serialize(inputSerializer, valueIn, "Position"));
+        EXPECT_EQ(inputSerializer.GetSize(), 10u); // 78 bits
+
+        AZ::Vector3 valueOut = AZ::Vector3::CreateZero();
+        EXPECT_TRUE(gridRelative.Serialize(outputSerializer, valueOut, "Position"));
+        EXPECT_TRUE(valueOut.IsClose(valueIn, 0.005f));
+    }
+}
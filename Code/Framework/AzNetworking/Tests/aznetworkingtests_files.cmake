@@ -21,9 +21,14 @@ set(FILES
     Serialization/NetworkOutputSerializerTests.cpp
     Serialization/TrackChangedSerializerTests.cpp
     TcpTransport/TcpTransportTests.cpp
+    UdpTransport/UdpPacketBufferTests.cpp
+    UdpTransport/UdpReceiveQueueTests.cpp
+    UdpTransport/UdpSocketBenchmarks.cpp
     UdpTransport/UdpTransportTests.cpp
     Utilities/CidrAddressTests.cpp
     Utilities/IpAddressTests.cpp
     Utilities/NetworkCommonTests.cpp
+    Utilities/QuantizedSerializersBenchmarks.cpp
+    Utilities/QuantizedSerializersTests.cpp
     Utilities/QuantizedValuesTests.cpp
 )
@@ -107,6 +107,7 @@ namespace AzToolsFramework
                 FinalizeAll();
                 sqlite3_close(m_db);
                 m_db = NULL;
+                m_transactionDepth = 0;
             }
         }
 
@@ -210,14 +211,34 @@ namespace AzToolsFramework
             }
         }
 
-        void Connection::BeginTransaction()
+        bool Connection::BeginTransaction()
         {
             AZ_Assert(m_db, "BeginTransaction:  Database is not open!");
             if (!m_db)
             {
-                return;
+                return false;
+            }
+
+            int res = SQLITE_OK;
+            if (m_transactionDepth == 0)
+            {
+                res = sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+            }
+            else
+            {
+                // sqlite does not nest BEGIN, the inner transactions are savepoints named after their depth
+                AZStd::string savepoint = AZStd::string::format("SAVEPOINT nested_%d;", m_transactionDepth);
+                res = sqlite3_exec(m_db, savepoint.c_str(), NULL, NULL, NULL);
             }
-            sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+
+            if (res != SQLITE_OK)
+            {
+                // the depth only counts transactions that are actually open, or commit and rollback would end the wrong one
+                AZ_Error("Sqlite", false, "Failed to begin a transaction at depth %d.  Error code %d: %s", m_transactionDepth, sqlite3_extended_errcode(m_db), sqlite3_errmsg(m_db));
+                return false;
+            }
+            ++m_transactionDepth;
+            return true;
         }
 
         void Connection::CommitTransaction()
@@ -227,7 +248,19 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+
+            AZ_Assert(m_transactionDepth > 0, "CommitTransaction:  No transaction is open!");
+            if (m_transactionDepth <= 1)
+            {
+                m_transactionDepth = 0;
+                sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+            }
+            else
+            {
+                --m_transactionDepth;
+                AZStd::string release = AZStd::string::format("RELEASE nested_%d;", m_transactionDepth);
+                sqlite3_exec(m_db, release.c_str(), NULL, NULL, NULL);
+            }
         }
 
         void Connection::RollbackTransaction()
@@ -237,7 +270,25 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+
+            AZ_Assert(m_transactionDepth > 0, "RollbackTransaction:  No transaction is open!");
+            if (m_transactionDepth <= 1)
+            {
+                m_transactionDepth = 0;
+                sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+            }
+            else
+            {
+                // rolling back to a savepoint leaves it open, it still has to be released
+                --m_transactionDepth;
+                AZStd::string rollback = AZStd::string::format("ROLLBACK TO nested_%d; RELEASE nested_%d;", m_transactionDepth, m_transactionDepth);
+                sqlite3_exec(m_db, rollback.c_str(), NULL, NULL, NULL);
+            }
+        }
+
+        int Connection::GetTransactionDepth() const
+        {
+            return m_transactionDepth;
         }
 
         void Connection::Vacuum()
@@ -760,7 +811,11 @@ namespace AzToolsFramework
         ScopedTransaction::ScopedTransaction(Connection* connect)
         {
             m_connection = connect;
-            m_connection->BeginTransaction();
+            if (!m_connection->BeginTransaction())
+            {
+                // nothing to commit or roll back, the writes apply as they are made
+                m_connection = nullptr;
+            }
         }
 
         ScopedTransaction::~ScopedTransaction()
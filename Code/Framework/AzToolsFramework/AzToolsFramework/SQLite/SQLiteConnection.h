@@ -46,9 +46,15 @@ namespace AzToolsFramework
             bool IsOpen() const;
 
             // ----- Transaction support -----
-            void BeginTransaction();
+            //! Transactions nest: only the outermost one is a real transaction, the ones inside it are savepoints.
+            //! This lets a caller group many writes (each of which may open its own transaction) into a single commit,
+            //! while an inner rollback still only undoes its own writes.
+            //! BeginTransaction returns false, leaving the depth unchanged, if sqlite could not open the transaction.
+            bool BeginTransaction();
             void CommitTransaction();
             void RollbackTransaction();
+            //! Number of transactions currently open on this connection, including the nested ones.
+            int GetTransactionDepth() const;
             // -------------------------------
 
             //! SQLite-specific, compacts the database and cleans up any temporary space allocated.
@@ -89,6 +95,7 @@ namespace AzToolsFramework
             sqlite3* m_db;
             typedef AZStd::unordered_map< AZStd::string, StatementPrototype* > StatementContainer;
             StatementContainer m_statementPrototypes;
+            int m_transactionDepth = 0;
         };
 
         AZStd::string GetColumnText(sqlite3_stmt* statement, int col);
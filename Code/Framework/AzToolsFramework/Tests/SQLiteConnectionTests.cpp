@@ -12,6 +12,7 @@
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzToolsFramework/SQLite/SQLiteConnection.h>
 
 namespace UnitTest
@@ -126,4 +127,227 @@ namespace UnitTest
         }
     }
 
+    class SQLiteTransactionTest
+        : public SQLiteTest
+    {
+    public:
+        void SetUp() override
+        {
+            SQLiteTest::SetUp();
+            m_database->AddStatement("CreateTable", "CREATE TABLE IF NOT EXISTS Rows( rowID INTEGER PRIMARY KEY, value INTEGER NOT NULL);");
+            m_database->AddStatement("InsertRow", "INSERT INTO Rows (value) VALUES (:value);");
+            ASSERT_TRUE(m_database->ExecuteOneOffStatement("CreateTable"));
+        }
+
+        void InsertRow(int value)
+        {
+            SQLite::StatementAutoFinalizer autoFinal(*m_database, "InsertRow");
+            SQLite::Statement* statement = autoFinal.Get();
+            ASSERT_NE(statement, nullptr);
+            statement->BindValueInt(statement->GetNamedParamIdx(":value"), value);
+            EXPECT_EQ(statement->Step(), SQLite::Statement::SqlDone);
+        }
+
+        int CountRows()
+        {
+            int count = 0;
+            m_database->ExecuteRawSqlQuery("SELECT COUNT(*) FROM Rows;",
+                [&count](sqlite3_stmt* statement)
+                {
+                    count = SQLite::GetColumnInt(statement, 0);
+                    return true;
+                }, nullptr);
+            return count;
+        }
+    };
+
+    TEST_F(SQLiteTransactionTest, NestedTransaction_InnerRollback_KeepsOuterWrites)
+    {
+        m_database->BeginTransaction();
+        InsertRow(1);
+        {
+            SQLite::ScopedTransaction inner(m_database.get());
+            EXPECT_EQ(m_database->GetTransactionDepth(), 2);
+            InsertRow(2);
+            // not committed, rolls back on scope exit
+        }
+        EXPECT_EQ(m_database->GetTransactionDepth(), 1);
+        m_database->CommitTransaction();
+
+        EXPECT_EQ(m_database->GetTransactionDepth(), 0);
+        EXPECT_EQ(CountRows(), 1);
+    }
+
+    TEST_F(SQLiteTransactionTest, NestedTransaction_OuterRollback_DiscardsCommittedInnerWrites)
+    {
+        m_database->BeginTransaction();
+        {
+            SQLite::ScopedTransaction inner(m_database.get());
+            InsertRow(1);
+            inner.Commit();
+        }
+        m_database->RollbackTransaction();
+
+        EXPECT_EQ(m_database->GetTransactionDepth(), 0);
+        EXPECT_EQ(CountRows(), 0);
+    }
+
+    TEST_F(SQLiteTransactionTest, BeginTransaction_Fails_DepthUnchanged)
+    {
+        // A transaction opened behind the connection's back makes BEGIN fail
+        ASSERT_TRUE(m_database->ExecuteRawSqlQuery("BEGIN TRANSACTION;", nullptr, nullptr));
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(m_database->BeginTransaction());
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_EQ(m_database->GetTransactionDepth(), 0);
+
+        {
+            AZ_TEST_START_TRACE_SUPPRESSION;
+            SQLite::ScopedTransaction transaction(m_database.get());
+            AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+            EXPECT_EQ(m_database->GetTransactionDepth(), 0);
+            InsertRow(1);
+            // the transaction never began, so leaving the scope must not roll back the one that is open
+        }
+        EXPECT_EQ(m_database->GetTransactionDepth(), 0);
+
+        ASSERT_TRUE(m_database->ExecuteRawSqlQuery("COMMIT TRANSACTION;", nullptr, nullptr));
+        EXPECT_EQ(CountRows(), 1);
+    }
+
+    TEST_F(SQLiteTransactionTest, NestedTransaction_AllCommitted_KeepsAllWrites)
+    {
+        m_database->BeginTransaction();
+        for (int value = 0; value < 10; ++value)
+        {
+            SQLite::ScopedTransaction inner(m_database.get());
+            InsertRow(value);
+            inner.Commit();
+        }
+        m_database->CommitTransaction();
+
+        EXPECT_EQ(CountRows(), 10);
+    }
 }
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AzToolsFramework;
+
+    //! Inserts and then updates 100k rows shaped like the AssetProcessor's Products table.
+    //! Every write opens its own transaction, like the AssetDatabaseConnection setters do, and the argument is the number
+    //! of writes grouped into one outer transaction (1 means every write commits on its own).
+    class BM_SQLiteProducts
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr int ProductCount = 100000;
+
+        using ::benchmark::Fixture::SetUp;
+        using ::benchmark::Fixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_database = AZStd::make_unique<SQLite::Connection>();
+            m_databaseFileName = AZStd::string::format("%s_benchmark.sqlite", AZ::Uuid::CreateRandom().ToString<AZStd::string>().c_str());
+            m_database->Open(m_databaseFileName, false);
+
+            m_database->AddStatement("CreateProducts",
+                "CREATE TABLE IF NOT EXISTS Products( "
+                "    ProductID   INTEGER PRIMARY KEY AUTOINCREMENT, "
+                "    JobPK       INTEGER NOT NULL, "
+                "    SubID       INTEGER NOT NULL, "
+                "    ProductName TEXT NOT NULL collate nocase, "
+                "    AssetType   BLOB NOT NULL);");
+            m_database->AddStatement("CreateProductsIndex", "CREATE INDEX IF NOT EXISTS Products_JobPK ON Products (JobPK);");
+            m_database->AddStatement("DeleteProducts", "DELETE FROM Products;");
+            m_database->AddStatement("InsertProduct",
+                "INSERT INTO Products (JobPK, SubID, ProductName, AssetType) VALUES (:jobpk, :subid, :productname, :assettype);");
+            m_database->AddStatement("UpdateProduct", "UPDATE Products SET SubID = :subid, AssetType = :assettype WHERE ProductID = :productid;");
+            m_database->ExecuteOneOffStatement("CreateProducts");
+            m_database->ExecuteOneOffStatement("CreateProductsIndex");
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_database->Close();
+            m_database.reset();
+            AZ::IO::SystemFile::Delete(m_databaseFileName.c_str());
+            m_databaseFileName = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void WriteProduct(const char* statementName, int productIndex, AZ::s64 productID)
+        {
+            SQLite::ScopedTransaction transaction(m_database.get());
+            SQLite::StatementAutoFinalizer autoFinal(*m_database, statementName);
+            SQLite::Statement* statement = autoFinal.Get();
+
+            AZ::Uuid assetType = AZ::Uuid::CreateName(statementName);
+            statement->BindValueInt(statement->GetNamedParamIdx(":subid"), productIndex);
+            statement->BindValueUuid(statement->GetNamedParamIdx(":assettype"), assetType);
+            if (productID == 0)
+            {
+                m_productName = AZStd::string::format("pc/textures/texture_%d.dds.streamingimage", productIndex);
+                statement->BindValueInt64(statement->GetNamedParamIdx(":jobpk"), productIndex / 4);
+                statement->BindValueText(statement->GetNamedParamIdx(":productname"), m_productName.c_str());
+            }
+            else
+            {
+                statement->BindValueInt64(statement->GetNamedParamIdx(":productid"), productID);
+            }
+            statement->Step();
+            transaction.Commit();
+        }
+
+        AZStd::unique_ptr<SQLite::Connection> m_database;
+        AZStd::string m_databaseFileName;
+        AZStd::string m_productName;
+    };
+
+    BENCHMARK_DEFINE_F(BM_SQLiteProducts, InsertAndUpdateProducts)(benchmark::State& state)
+    {
+        const int writesPerCommit = aznumeric_cast<int>(state.range(0));
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            m_database->ExecuteOneOffStatement("DeleteProducts");
+            state.ResumeTiming();
+
+            AZStd::vector<AZ::s64> productIDs;
+            productIDs.reserve(ProductCount);
+            for (int productIndex = 0; productIndex < ProductCount; ++productIndex)
+            {
+                if (productIndex % writesPerCommit == 0)
+                {
+                    m_database->BeginTransaction();
+                }
+                WriteProduct("InsertProduct", productIndex, 0);
+                productIDs.push_back(m_database->GetLastRowID());
+                if ((productIndex + 1) % writesPerCommit == 0 || productIndex + 1 == ProductCount)
+                {
+                    m_database->CommitTransaction();
+                }
+            }
+
+            for (int productIndex = 0; productIndex < ProductCount; ++productIndex)
+            {
+                if (productIndex % writesPerCommit == 0)
+                {
+                    m_database->BeginTransaction();
+                }
+                WriteProduct("UpdateProduct", productIndex + 1, productIDs[productIndex]);
+                if ((productIndex + 1) % writesPerCommit == 0 || productIndex + 1 == ProductCount)
+                {
+                    m_database->CommitTransaction();
+                }
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * ProductCount * 2);
+    }
+    BENCHMARK_REGISTER_F(BM_SQLiteProducts, InsertAndUpdateProducts)->Arg(1)->Arg(16)->Arg(1024)->Unit(benchmark::kMillisecond)->Iterations(1);
+} // namespace Benchmark
+#endif
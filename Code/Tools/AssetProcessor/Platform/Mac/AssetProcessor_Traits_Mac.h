@@ -9,3 +9,5 @@
 
 #define ASSETPROCESSOR_TRAIT_LEGACY_RC_RELATIVE_PATH "rc"
 #define ASSETPROCESSOR_TRAIT_CASE_SENSITIVE_FILESYSTEM false
+//! Directory enumeration on this platform returns names only, so the scan journal can stand in for it on a relaunch
+#define ASSETPROCESSOR_TRAIT_USE_SCAN_JOURNAL true
@@ -9,3 +9,5 @@
 
 #define ASSETPROCESSOR_TRAIT_LEGACY_RC_RELATIVE_PATH "rc.exe"
 #define ASSETPROCESSOR_TRAIT_CASE_SENSITIVE_FILESYSTEM false
+//! FindFirstFileEx already returns the size and time stamps along with the names, so the scan journal would not save any IO
+#define ASSETPROCESSOR_TRAIT_USE_SCAN_JOURNAL false
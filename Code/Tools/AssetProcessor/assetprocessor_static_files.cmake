@@ -17,10 +17,14 @@ set(FILES
     native/AssetManager/AssetRequestHandler.h
     native/AssetManager/assetScanFolderInfo.h
     native/AssetManager/assetScanFolderInfo.cpp
+    native/AssetManager/AssetScanJournal.cpp
+    native/AssetManager/AssetScanJournal.h
     native/AssetManager/assetScanner.cpp
     native/AssetManager/assetScanner.h
     native/AssetManager/assetScannerWorker.cpp
     native/AssetManager/assetScannerWorker.h
+    native/AssetManager/DirectoryEnumerator.cpp
+    native/AssetManager/DirectoryEnumerator.h
     native/AssetManager/FileStateCache.cpp
     native/AssetManager/FileStateCache.h
     native/AssetManager/PathDependencyManager.cpp
@@ -78,6 +82,8 @@ set(FILES
     native/utilities/AssetBuilderInfo.h
     native/utilities/AssetServerHandler.cpp
     native/utilities/AssetServerHandler.h
+    native/utilities/LocalBuildCache.cpp
+    native/utilities/LocalBuildCache.h
     native/utilities/AssetUtilEBusHelper.h
     native/utilities/assetUtils.cpp
     native/utilities/assetUtils.h
@@ -31,6 +31,7 @@ set(FILES
     native/tests/assetmanager/AssetProcessorManagerTest.cpp
     native/tests/assetmanager/AssetProcessorManagerTest.h
     native/tests/utilities/assetUtilsTest.cpp
+    native/tests/utilities/LocalBuildCacheTests.cpp
     native/tests/platformconfiguration/platformconfigurationtests.cpp
     native/tests/platformconfiguration/platformconfigurationtests.h
     native/tests/utilities/JobModelTest.cpp
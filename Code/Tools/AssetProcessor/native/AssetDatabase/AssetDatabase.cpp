@@ -1332,6 +1332,22 @@ namespace AssetProcessor
         }
     }
 
+    void AssetDatabaseConnection::BeginWriteBatch()
+    {
+        if (m_databaseConnection)
+        {
+            m_databaseConnection->BeginTransaction();
+        }
+    }
+
+    void AssetDatabaseConnection::CommitWriteBatch()
+    {
+        if (m_databaseConnection)
+        {
+            m_databaseConnection->CommitTransaction();
+        }
+    }
+
     bool AssetDatabaseConnection::GetScanFolderByScanFolderID(AZ::s64 scanfolderID, ScanFolderDatabaseEntry& entry)
     {
         bool found = false;
@@ -2304,11 +2320,14 @@ namespace AssetProcessor
             return false;
         }
         
+        // one commit for the whole container, each SetProduct becomes a savepoint inside it
+        ScopedTransaction transaction(m_databaseConnection);
         bool succeeded = true;
         for (auto& entry : container)
         {
             succeeded &= SetProduct(entry);
         }
+        transaction.Commit();
         return succeeded;
     }
 
@@ -2484,11 +2503,14 @@ namespace AssetProcessor
 
     bool AssetDatabaseConnection::SetSourceFileDependencies(SourceFileDependencyEntryContainer& container)
     {
+        ScopedTransaction transaction(m_databaseConnection);
         bool succeeded = true;
         for (auto& entry : container)
         {
             succeeded = succeeded && SetSourceFileDependency(entry);
         }
+        // the dependencies written before a failure are kept, as they were when each one committed on its own
+        transaction.Commit();
         return succeeded;
     }
 
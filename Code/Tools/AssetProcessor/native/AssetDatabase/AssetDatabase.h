@@ -44,6 +44,12 @@ namespace AssetProcessor
         } 
         void VacuumAndAnalyze();
 
+        //! Groups every write made until CommitWriteBatch into a single transaction.
+        //! Writes that open their own transaction in between become savepoints inside it, so they can still roll back
+        //! on their own.  Other connections to the database only see the writes once the batch is committed.
+        void BeginWriteBatch();
+        void CommitWriteBatch();
+
     protected:
         void CreateStatements() override;
         bool PostOpenDatabase() override;
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/AssetManager/AssetScanJournal.h>
+
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+
+namespace AssetProcessor
+{
+    namespace AssetScanJournalInternal
+    {
+        static constexpr quint32 JournalMagic = 0x4A534341;
+        static constexpr quint32 JournalVersion = 1;
+        static constexpr QDataStream::Version StreamVersion = QDataStream::Qt_5_12;
+    } // namespace AssetScanJournalInternal
+
+    bool AssetScanJournal::Load(const QString& journalPath)
+    {
+        using namespace AssetScanJournalInternal;
+
+        m_directories.clear();
+
+        QFile journalFile(journalPath);
+        if (!journalFile.open(QIODevice::ReadOnly))
+        {
+            return false;
+        }
+
+        QDataStream stream(&journalFile);
+        stream.setVersion(StreamVersion);
+
+        quint32 magic = 0;
+        quint32 version = 0;
+        quint32 directoryCount = 0;
+        stream >> magic >> version >> directoryCount;
+        if (stream.status() != QDataStream::Ok || magic != JournalMagic || version != JournalVersion)
+        {
+            return false;
+        }
+
+        m_directories.reserve(directoryCount);
+        for (quint32 directoryIndex = 0; directoryIndex < directoryCount; ++directoryIndex)
+        {
+            QString directoryPath;
+            Directory directory;
+            quint32 entryCount = 0;
+            stream >> directoryPath >> directory.m_modTimeMs >> entryCount;
+            if (stream.status() != QDataStream::Ok)
+            {
+                break;
+            }
+
+            directory.m_entries.reserve(entryCount);
+            for (quint32 entryIndex = 0; entryIndex < entryCount && stream.status() == QDataStream::Ok; ++entryIndex)
+            {
+                Entry entry;
+                stream >> entry.m_name >> entry.m_isDirectory;
+                directory.m_entries.push_back(AZStd::move(entry));
+            }
+
+            m_directories.insert(directoryPath, AZStd::move(directory));
+        }
+
+        if (stream.status() != QDataStream::Ok)
+        {
+            // a truncated journal cannot be trusted, fall back to a full scan
+            m_directories.clear();
+            return false;
+        }
+
+        return true;
+    }
+
+    bool AssetScanJournal::Save(const QString& journalPath) const
+    {
+        using namespace AssetScanJournalInternal;
+
+        QDir().mkpath(QFileInfo(journalPath).absolutePath());
+
+        // write next to the journal and swap it in, so that an interrupted save does not leave a partial file behind
+        const QString tempPath = journalPath + QStringLiteral(".tmp");
+        {
+            QFile journalFile(tempPath);
+            if (!journalFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+            {
+                return false;
+            }
+
+            QDataStream stream(&journalFile);
+            stream.setVersion(StreamVersion);
+            stream << JournalMagic << JournalVersion << static_cast<quint32>(m_directories.size());
+
+            for (auto directoryItr = m_directories.constBegin(); directoryItr != m_directories.constEnd(); ++directoryItr)
+            {
+                const Directory& directory = directoryItr.value();
+                stream << directoryItr.key() << directory.m_modTimeMs << static_cast<quint32>(directory.m_entries.size());
+                for (const Entry& entry : directory.m_entries)
+                {
+                    stream << entry.m_name << entry.m_isDirectory;
+                }
+            }
+
+            if (stream.status() != QDataStream::Ok)
+            {
+                journalFile.close();
+                QFile::remove(tempPath);
+                return false;
+            }
+        }
+
+        QFile::remove(journalPath);
+        return QFile::rename(tempPath, journalPath);
+    }
+
+    const AssetScanJournal::Directory* AssetScanJournal::FindUnchangedDirectory(const QString& directoryPath, qint64 modTimeMs) const
+    {
+        auto directoryItr = m_directories.constFind(directoryPath);
+        if (directoryItr == m_directories.constEnd() || directoryItr.value().m_modTimeMs != modTimeMs)
+        {
+            return nullptr;
+        }
+        return &directoryItr.value();
+    }
+
+    void AssetScanJournal::SetDirectory(const QString& directoryPath, Directory&& directory)
+    {
+        m_directories.insert(directoryPath, AZStd::move(directory));
+    }
+
+    void AssetScanJournal::Clear()
+    {
+        m_directories.clear();
+    }
+
+    int AssetScanJournal::GetDirectoryCount() const
+    {
+        return m_directories.size();
+    }
+} // namespace AssetProcessor
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+#include <QHash>
+#include <QString>
+
+namespace AssetProcessor
+{
+    //! AssetScanJournal remembers the listing of every directory seen by the last scan, keyed by the modification time
+    //! of the directory.  Adding, removing or renaming an entry updates the modification time of its directory, so when
+    //! that time is unchanged on the next launch the recorded listing can be used instead of enumerating the directory.
+    //! Modifying a file in place does not touch its directory, so only the names are reused: the scanner still
+    //! stats every file to pick up its current size and time stamp.
+    class AssetScanJournal
+    {
+    public:
+        struct Entry
+        {
+            QString m_name;
+            bool m_isDirectory = false;
+        };
+
+        struct Directory
+        {
+            qint64 m_modTimeMs = 0;
+            AZStd::vector<Entry> m_entries;
+        };
+
+        //! Replaces the contents of the journal with the file at journalPath.
+        //! Returns false, leaving the journal empty, if it is missing, corrupt or from a different version.
+        bool Load(const QString& journalPath);
+        bool Save(const QString& journalPath) const;
+
+        //! Returns the recorded listing of directoryPath if its modification time is still modTimeMs, nullptr otherwise.
+        //! Safe to call from several threads as long as the journal is not modified at the same time.
+        const Directory* FindUnchangedDirectory(const QString& directoryPath, qint64 modTimeMs) const;
+
+        void SetDirectory(const QString& directoryPath, Directory&& directory);
+        void Clear();
+        int GetDirectoryCount() const;
+
+    private:
+        QHash<QString, Directory> m_directories;
+    };
+} // namespace AssetProcessor
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/AssetManager/DirectoryEnumerator.h>
+
+#include <QDir>
+#include <QFile>
+
+#if defined(AZ_PLATFORM_WINDOWS)
+#   include <windows.h>
+#else
+#   include <dirent.h>
+#   include <fcntl.h>
+#   include <sys/stat.h>
+#endif
+
+namespace AssetProcessor
+{
+    namespace DirectoryEnumeratorInternal
+    {
+#if defined(AZ_PLATFORM_WINDOWS)
+        //! Number of milliseconds between 1601-01-01 (the FILETIME epoch) and 1970-01-01.
+        static constexpr qint64 FileTimeToUnixEpochMs = 11644473600000LL;
+
+        qint64 FileTimeToMs(const FILETIME& fileTime)
+        {
+            const AZ::u64 ticks = (static_cast<AZ::u64>(fileTime.dwHighDateTime) << 32) | fileTime.dwLowDateTime;
+            // FILETIME counts in 100ns ticks
+            return static_cast<qint64>(ticks / 10000) - FileTimeToUnixEpochMs;
+        }
+
+        bool IsFiltered(DWORD attributes)
+        {
+            return (attributes & FILE_ATTRIBUTE_HIDDEN) != 0;
+        }
+
+        AZ::u64 GetFileSize(DWORD sizeHigh, DWORD sizeLow)
+        {
+            return (static_cast<AZ::u64>(sizeHigh) << 32) | sizeLow;
+        }
+#else
+        bool IsHidden(const char* name)
+        {
+            // this also skips "." and ".."
+            return name[0] == '.';
+        }
+
+        //! Stats name relative to the open directory, following symbolic links like QFileInfo does.
+        bool StatAt(int directoryFd, const char* name, DirectoryEntry& entry)
+        {
+            struct stat statBuffer;
+            if (::fstatat(directoryFd, name, &statBuffer, 0) != 0)
+            {
+                // gone since it was listed, or a broken symbolic link
+                return false;
+            }
+
+            if (S_ISDIR(statBuffer.st_mode))
+            {
+                entry.m_isDirectory = true;
+                entry.m_size = 0;
+            }
+            else if (S_ISREG(statBuffer.st_mode))
+            {
+                entry.m_isDirectory = false;
+                entry.m_size = static_cast<AZ::u64>(statBuffer.st_size);
+            }
+            else
+            {
+                // sockets, pipes and devices are not source files
+                return false;
+            }
+
+#if defined(AZ_PLATFORM_MAC)
+            const struct timespec& modTime = statBuffer.st_mtimespec;
+#else
+            const struct timespec& modTime = statBuffer.st_mtim;
+#endif
+            // QFileInfo::lastModified has millisecond precision, keep the same so the values compare equal
+            entry.m_modTimeMs = static_cast<qint64>(modTime.tv_sec) * 1000 + modTime.tv_nsec / 1000000;
+            return true;
+        }
+#endif
+    } // namespace DirectoryEnumeratorInternal
+
+    bool EnumerateDirectory(const QString& directoryPath, AZStd::vector<DirectoryEntry>& entries)
+    {
+        using namespace DirectoryEnumeratorInternal;
+
+#if defined(AZ_PLATFORM_WINDOWS)
+        const QString searchPath = QDir::toNativeSeparators(directoryPath) + QStringLiteral("\\*");
+        WIN32_FIND_DATAW findData;
+        HANDLE findHandle = ::FindFirstFileExW(
+            reinterpret_cast<const wchar_t*>(searchPath.utf16()), FindExInfoBasic, &findData, FindExSearchNameMatch, nullptr,
+            FIND_FIRST_EX_LARGE_FETCH);
+        if (findHandle == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        do
+        {
+            const wchar_t* name = findData.cFileName;
+            if (name[0] == L'.' && (name[1] == L'\0' || (name[1] == L'.' && name[2] == L'\0')))
+            {
+                continue;
+            }
+
+            if (IsFiltered(findData.dwFileAttributes))
+            {
+                continue;
+            }
+
+            DirectoryEntry entry;
+            entry.m_isDirectory = (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+            entry.m_name = QString::fromWCharArray(name);
+            entry.m_size = entry.m_isDirectory ? 0 : GetFileSize(findData.nFileSizeHigh, findData.nFileSizeLow);
+            entry.m_modTimeMs = FileTimeToMs(findData.ftLastWriteTime);
+            entries.push_back(AZStd::move(entry));
+        } while (::FindNextFileW(findHandle, &findData));
+
+        ::FindClose(findHandle);
+        return true;
+#else
+        DIR* directory = ::opendir(QFile::encodeName(directoryPath).constData());
+        if (!directory)
+        {
+            return false;
+        }
+
+        const int directoryFd = ::dirfd(directory);
+        while (const struct dirent* directoryEntry = ::readdir(directory))
+        {
+            if (IsHidden(directoryEntry->d_name))
+            {
+                continue;
+            }
+
+            DirectoryEntry entry;
+            if (!StatAt(directoryFd, directoryEntry->d_name, entry))
+            {
+                continue;
+            }
+
+            entry.m_name = QFile::decodeName(directoryEntry->d_name);
+            entries.push_back(AZStd::move(entry));
+        }
+
+        ::closedir(directory);
+        return true;
+#endif
+    }
+
+    bool StatDirectoryEntry(const QString& directoryPath, DirectoryEntry& entry)
+    {
+        using namespace DirectoryEnumeratorInternal;
+
+#if defined(AZ_PLATFORM_WINDOWS)
+        const QString entryPath = QDir::toNativeSeparators(directoryPath + QLatin1Char('/') + entry.m_name);
+        WIN32_FILE_ATTRIBUTE_DATA attributeData;
+        if (!::GetFileAttributesExW(reinterpret_cast<const wchar_t*>(entryPath.utf16()), GetFileExInfoStandard, &attributeData))
+        {
+            return false;
+        }
+
+        if (IsFiltered(attributeData.dwFileAttributes))
+        {
+            return false;
+        }
+
+        entry.m_isDirectory = (attributeData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+        entry.m_size = entry.m_isDirectory ? 0 : GetFileSize(attributeData.nFileSizeHigh, attributeData.nFileSizeLow);
+        entry.m_modTimeMs = FileTimeToMs(attributeData.ftLastWriteTime);
+        return true;
+#else
+        if (entry.m_name.startsWith(QLatin1Char('.')))
+        {
+            return false;
+        }
+        return StatAt(AT_FDCWD, QFile::encodeName(directoryPath + QLatin1Char('/') + entry.m_name).constData(), entry);
+#endif
+    }
+} // namespace AssetProcessor
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+#include <QString>
+
+namespace AssetProcessor
+{
+    //! One entry of a directory listing, along with the information the scanner needs about it.
+    struct DirectoryEntry
+    {
+        QString m_name;
+        AZ::u64 m_size = 0;
+        qint64 m_modTimeMs = 0; //!< last modification time in milliseconds since the epoch (UTC)
+        bool m_isDirectory = false;
+    };
+
+    //! Lists the files and sub directories of a directory in bulk, with their stats.
+    //! This is a thin wrapper around the native API (readdir + fstatat on the directory handle, FindFirstFileEx with a
+    //! large fetch on Windows), which avoids the per-entry overhead of QDir::entryInfoList.
+    //! Applies the same filter as QDir's defaults: hidden entries, "." and "..", broken symbolic links and anything that
+    //! is neither a file nor a directory are skipped.
+    //! Returns false if the directory could not be opened.
+    bool EnumerateDirectory(const QString& directoryPath, AZStd::vector<DirectoryEntry>& entries);
+
+    //! Fills in the stats of a single entry of a directory.  Returns false if it no longer exists or would be filtered out
+    //! by EnumerateDirectory.
+    bool StatDirectoryEntry(const QString& directoryPath, DirectoryEntry& entry);
+} // namespace AssetProcessor
@@ -10,10 +10,15 @@
 #include "native/utilities/assetUtils.h"
 #include <AssetProcessor_Traits_Platform.h>
 
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+
 #include <QDir>
 
 namespace AssetProcessor
 {
+    //! Upper bound on the number of threads used by WarmUpHashes, more than this only adds IO contention
+    static constexpr size_t MaxHashWorkerCount = 16;
 
     bool FileStateCache::GetFileInfo(const QString& absolutePath, FileStateInfo* foundFileInfo) const
     {
@@ -39,28 +44,105 @@ namespace AssetProcessor
 
     bool FileStateCache::GetHash(const QString& absolutePath, FileHash* foundHash)
     {
-        LockGuardType scopeLock(m_mapMutex);
-        auto fileInfoItr = m_fileInfoMap.find(PathToKey(absolutePath));
+        const QString key = PathToKey(absolutePath);
+        FileStateInfo hashedInfo;
+        {
+            LockGuardType scopeLock(m_mapMutex);
+            auto fileInfoItr = m_fileInfoMap.find(key);
+
+            if (fileInfoItr == m_fileInfoMap.end())
+            {
+                // No info on this file, return false
+                return false;
+            }
+
+            auto itr = m_fileHashMap.find(key);
+
+            if (itr != m_fileHashMap.end())
+            {
+                *foundHash = itr.value();
+                return true;
+            }
+
+            hashedInfo = fileInfoItr.value();
+        }
+
+        // There's no hash stored yet or its been invalidated, calculate it.
+        // This is done outside of the lock so other threads can query the cache while the file is read.
+        *foundHash = AssetUtilities::GetFileHash(absolutePath.toUtf8().constData(), true);
+
+        StoreHashIfUnchanged(key, hashedInfo, *foundHash);
+        return true;
+    }
 
-        if(fileInfoItr == m_fileInfoMap.end())
+    void FileStateCache::WarmUpHashes(const QStringList& absolutePaths)
+    {
+        if (!AssetUtilities::ShouldUseFileHashing())
         {
-            // No info on this file, return false
-            return false;
+            return;
         }
 
-        auto itr = m_fileHashMap.find(PathToKey(absolutePath));
+        struct PendingHash
+        {
+            QString m_key;
+            FileStateInfo m_info;
+            FileHash m_hash = 0;
+        };
 
-        if (itr != m_fileHashMap.end())
+        AZStd::vector<PendingHash> pendingHashes;
         {
-            *foundHash = itr.value();
-            return true;
+            LockGuardType scopeLock(m_mapMutex);
+            pendingHashes.reserve(absolutePaths.size());
+
+            for (const QString& absolutePath : absolutePaths)
+            {
+                QString key = PathToKey(absolutePath);
+                auto fileInfoItr = m_fileInfoMap.find(key);
+
+                if (fileInfoItr == m_fileInfoMap.end() || fileInfoItr.value().m_isDirectory || m_fileHashMap.contains(key))
+                {
+                    continue;
+                }
+
+                pendingHashes.push_back({ AZStd::move(key), fileInfoItr.value() });
+            }
         }
 
-        // There's no hash stored yet or its been invalidated, calculate it
-        *foundHash = AssetUtilities::GetFileHash(absolutePath.toUtf8().constData(), true);
+        if (pendingHashes.empty())
+        {
+            return;
+        }
 
-        m_fileHashMap[PathToKey(absolutePath)] = *foundHash;
-        return true;
+        // Every worker streams its files through one FileHashBufferSize read buffer, so the memory in flight is bounded by the
+        // worker count no matter how large the files are.  Running several workers keeps the disk busy while other cores hash.
+        const size_t workerCount = AZStd::min(AZStd::min(static_cast<size_t>(AZStd::max(AZStd::thread::hardware_concurrency(), 1u)), MaxHashWorkerCount), pendingHashes.size());
+        AZStd::atomic<size_t> nextIndex{ 0 };
+
+        auto hashWorker = [&pendingHashes, &nextIndex]()
+        {
+            for (size_t index = nextIndex++; index < pendingHashes.size(); index = nextIndex++)
+            {
+                PendingHash& pendingHash = pendingHashes[index];
+                pendingHash.m_hash = AssetUtilities::GetFileHash(pendingHash.m_info.m_absolutePath.toUtf8().constData(), true);
+            }
+        };
+
+        AZStd::vector<AZStd::thread> workers;
+        workers.reserve(workerCount - 1);
+        for (size_t workerIndex = 1; workerIndex < workerCount; ++workerIndex)
+        {
+            workers.emplace_back(hashWorker);
+        }
+        hashWorker();
+        for (AZStd::thread& worker : workers)
+        {
+            worker.join();
+        }
+
+        for (const PendingHash& pendingHash : pendingHashes)
+        {
+            StoreHashIfUnchanged(pendingHash.m_key, pendingHash.m_info, pendingHash.m_hash);
+        }
     }
 
     void FileStateCache::AddInfoSet(QSet<AssetFileInfo> infoSet)
@@ -156,6 +238,18 @@ namespace AssetProcessor
         m_fileInfoMap[PathToKey(fileInfo.absoluteFilePath())] = FileStateInfo(fileInfo.absoluteFilePath(), fileInfo.lastModified(), fileInfo.size(), fileInfo.isDir());
     }
 
+    void FileStateCache::StoreHashIfUnchanged(const QString& key, const FileStateInfo& hashedInfo, FileHash hash)
+    {
+        LockGuardType scopeLock(m_mapMutex);
+        auto fileInfoItr = m_fileInfoMap.find(key);
+
+        // UpdateFile/RemoveFile may have run while the file was being hashed, in which case the hash could be stale
+        if (fileInfoItr != m_fileInfoMap.end() && fileInfoItr.value() == hashedInfo)
+        {
+            m_fileHashMap[key] = hash;
+        }
+    }
+
     void FileStateCache::ScanFolder(const QString& absolutePath)
     {
         QDir inputFolder(absolutePath);
@@ -12,6 +12,7 @@
 #include <native/AssetManager/assetScanFolderInfo.h>
 #include <QString>
 #include <QSet>
+#include <QStringList>
 #include <QFileInfo>
 #include <AzCore/Interface/Interface.h>
 
@@ -51,6 +52,9 @@ namespace AssetProcessor
         /// Convenience function to check if a file or directory exists.
         virtual bool Exists(const QString& absolutePath) const = 0;
         virtual bool GetHash(const QString& absolutePath, FileHash* foundHash) = 0;
+        /// Computes the hashes of many files ahead of time, spreading the reads and hashing over several threads.
+        /// Later calls to GetHash for these files are answered from the cache.
+        virtual void WarmUpHashes(const QStringList& absolutePaths) = 0;
 
         AZ_DISABLE_COPY_MOVE(IFileStateRequests);
     };
@@ -94,6 +98,7 @@ namespace AssetProcessor
         bool GetFileInfo(const QString& absolutePath, FileStateInfo* foundFileInfo) const override;
         bool Exists(const QString& absolutePath) const override;
         bool GetHash(const QString& absolutePath, FileHash* foundHash) override;
+        void WarmUpHashes(const QStringList& absolutePaths) override;
 
         void AddInfoSet(QSet<AssetFileInfo> infoSet) override;
         void AddFile(const QString& absolutePath) override;
@@ -114,6 +119,9 @@ namespace AssetProcessor
         /// Recursively collects all the files contained in the directory specified by absolutePath
         void ScanFolder(const QString& absolutePath);
 
+        /// Stores a hash computed outside of the lock, unless the file changed while it was being hashed
+        void StoreHashIfUnchanged(const QString& key, const FileStateInfo& hashedInfo, FileHash hash);
+
         mutable AZStd::recursive_mutex m_mapMutex;
         QHash<QString, FileStateInfo> m_fileInfoMap;
         
@@ -131,5 +139,6 @@ namespace AssetProcessor
         bool GetFileInfo(const QString& absolutePath, FileStateInfo* foundFileInfo) const override;
         bool Exists(const QString& absolutePath) const override;
         bool GetHash(const QString& absolutePath, FileHash* foundHash) override;
+        void WarmUpHashes(const QStringList& /*absolutePaths*/) override {}
     };
 } // namespace AssetProcessor
@@ -23,6 +23,7 @@
 #include <AzCore/std/sort.h>
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
 
+#include <native/AssetManager/FileStateCache.h>
 #include <native/AssetManager/PathDependencyManager.h>
 #include <native/utilities/BuilderConfigurationBus.h>
 
@@ -976,6 +977,11 @@ namespace AssetProcessor
                 continue;
             }
 
+            // All the rows written for this job go out in a single commit instead of one per statement.
+            // Notifications are held back until then, since their listeners read the database on other connections.
+            m_stateData->BeginWriteBatch();
+            AZStd::vector<AssetNotificationMessage> pendingAssetMessages;
+
             if (m_stateData->GetSourcesBySourceNameScanFolderId(processedAsset.m_entry.m_databaseSourceName, scanFolder->ScanFolderID(), sources))
             {
                 AZ_Assert(sources.size() == 1, "Should have only found one source!!!");
@@ -1164,7 +1170,7 @@ namespace AssetProcessor
 
                         // we still need to tell everyone that its gone!
 
-                        Q_EMIT AssetMessage(message); // we notify that we are aware of a missing product either way.
+                        pendingAssetMessages.push_back(message); // we notify that we are aware of a missing product either way.
                     }
                     else
                     {
@@ -1179,7 +1185,7 @@ namespace AssetProcessor
                         else
                         {
                             AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Deleting file %s because the recompiled input file no longer emitted that product.\n", fullProductPath.toUtf8().constData());
-                            Q_EMIT AssetMessage(message); // we notify that we are aware of a missing product either way.
+                            pendingAssetMessages.push_back(message); // we notify that we are aware of a missing product either way.
                         }
                     }
                 }
@@ -1340,11 +1346,17 @@ namespace AssetProcessor
                     }
                 }
 
-                Q_EMIT AssetMessage( message);
-                
+                pendingAssetMessages.push_back(AZStd::move(message));
+
                 AddKnownFoldersRecursivelyForFile(fullProductPath, m_cacheRootDir.absolutePath());
             }
 
+            m_stateData->CommitWriteBatch();
+            for (const AssetNotificationMessage& pendingAssetMessage : pendingAssetMessages)
+            {
+                Q_EMIT AssetMessage(pendingAssetMessage);
+            }
+
             QString fullSourcePath = processedAsset.m_entry.GetAbsoluteSourcePath();
 
             // notify the system about inputs:
@@ -2825,6 +2837,8 @@ namespace AssetProcessor
     {
         int processedFileCount = 0;
 
+        WarmUpFileHashes(filePaths);
+
         for (const AssetFileInfo& fileInfo : filePaths)
         {
             if (m_allowModtimeSkippingFeature)
@@ -2862,6 +2876,51 @@ namespace AssetProcessor
         }
     }
 
+    void AssetProcessorManager::WarmUpFileHashes(const QSet<AssetFileInfo>& filePaths)
+    {
+        auto* fileStateInterface = AZ::Interface<IFileStateRequests>::Get();
+
+        if (!fileStateInterface)
+        {
+            return;
+        }
+
+        // Any file whose modtime does not match the database is hashed later on, either to compare against the hash
+        // in the database or to fingerprint its jobs.  Hash them all up front across several threads instead of
+        // one at a time on this thread.
+        QStringList filesToHash;
+
+        for (const AssetFileInfo& fileInfo : filePaths)
+        {
+            if (fileInfo.m_isDirectory)
+            {
+                continue;
+            }
+
+            if (m_allowModtimeSkippingFeature)
+            {
+                auto fileItr = m_fileModTimes.find(fileInfo.m_filePath.toUtf8().constData());
+
+                if (fileItr != m_fileModTimes.end() && fileItr->second != 0
+                    && fileItr->second == aznumeric_cast<AZ::u64>(AssetUtilities::AdjustTimestamp(fileInfo.m_modTime)))
+                {
+                    // unchanged files are skipped without hashing
+                    continue;
+                }
+            }
+
+            filesToHash.push_back(fileInfo.m_filePath);
+        }
+
+        if (!filesToHash.isEmpty())
+        {
+            QElapsedTimer hashTimer;
+            hashTimer.start();
+            fileStateInterface->WarmUpHashes(filesToHash);
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Hashed %d files from the scanner in %.2f seconds\n", filesToHash.size(), hashTimer.elapsed() / 1000.0f);
+        }
+    }
+
     bool AssetProcessorManager::CanSkipProcessingFile(const AssetFileInfo &fileInfo, AZ::u64& fileHashOut)
     {
         // Check to see if the file has changed since the last time we saw it
@@ -57,6 +57,21 @@ namespace AssetProcessor
         QMetaObject::invokeMethod(&m_assetScannerWorker, "StopScan", Qt::DirectConnection);
     }
 
+    void AssetScanner::SetScanJournalPath(const QString& journalPath)
+    {
+        m_assetScannerWorker.SetScanJournalPath(journalPath);
+    }
+
+    void AssetScanner::SetRacyModTimeWindowMs(qint64 racyModTimeWindowMs)
+    {
+        m_assetScannerWorker.SetRacyModTimeWindowMs(racyModTimeWindowMs);
+    }
+
+    AZ::u64 AssetScanner::GetDirectoriesFromJournalCount() const
+    {
+        return m_assetScannerWorker.GetDirectoriesFromJournalCount();
+    }
+
     AssetProcessor::AssetScanningStatus AssetScanner::status() const
     {
         return m_status;
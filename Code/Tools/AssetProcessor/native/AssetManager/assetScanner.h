@@ -36,6 +36,15 @@ namespace AssetProcessor
         void StartScan();//Should be called to start a scan
         void StopScan();//Should be called to stop a scan
 
+        //! Persists the directory listings to journalPath so that the next launch only lists directories that changed.
+        //! Must be called before StartScan.
+        void SetScanJournalPath(const QString& journalPath);
+        //! Sets how close to the start of the scan a directory can be modified and still be recorded in the journal.
+        //! Directories modified later could change again without their time stamp moving. Must be called before StartScan.
+        void SetRacyModTimeWindowMs(qint64 racyModTimeWindowMs);
+        //! Returns how many directory listings the last scan reused from the journal.
+        AZ::u64 GetDirectoriesFromJournalCount() const;
+
         Q_INVOKABLE AssetScanningStatus status() const;
 
     Q_SIGNALS:
@@ -7,8 +7,14 @@
  */
 #include "native/AssetManager/assetScannerWorker.h"
 #include "native/AssetManager/assetScanner.h"
+#include "native/AssetManager/DirectoryEnumerator.h"
 #include "native/utilities/PlatformConfiguration.h"
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AssetProcessor_Traits_Platform.h>
+#include <QDateTime>
 #include <QDir>
+#include <QElapsedTimer>
 
 using namespace AssetProcessor;
 
@@ -18,6 +24,21 @@ AssetScannerWorker::AssetScannerWorker(PlatformConfiguration* config, QObject* p
 {
 }
 
+void AssetScannerWorker::SetScanJournalPath(const QString& journalPath)
+{
+    m_scanJournalPath = journalPath;
+}
+
+void AssetScannerWorker::SetRacyModTimeWindowMs(qint64 racyModTimeWindowMs)
+{
+    m_racyModTimeWindowMs = racyModTimeWindowMs;
+}
+
+AZ::u64 AssetScannerWorker::GetDirectoriesFromJournalCount() const
+{
+    return m_directoriesFromJournalCount;
+}
+
 void AssetScannerWorker::StartScan()
 {
     // this must be called from the thread operating it and not the main thread.
@@ -32,11 +53,7 @@ void AssetScannerWorker::StartScan()
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Started);
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::InProgress);
 
-    for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
-    {
-        const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
-        ScanForSourceFiles(scanFolderInfo, scanFolderInfo);
-    }
+    ScanForSourceFiles();
 
     // we want not to emit any signals until we're finished scanning
     // so that we don't interleave directory tree walking (IO access to the file table)
@@ -46,6 +63,7 @@ void AssetScannerWorker::StartScan()
     {
         m_fileList.clear();
         m_folderList.clear();
+        m_excludedList.clear();
         Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Stopped);
         return;
     }
@@ -65,47 +83,203 @@ void AssetScannerWorker::StartScan()
 void AssetScannerWorker::StopScan()
 {
     m_doScan = false;
+    // wake up the scanning threads so they notice
+    AZStd::lock_guard<AZStd::mutex> lock(m_pendingDirectoriesMutex);
+    m_pendingDirectoriesCondition.notify_all();
 }
 
-void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder)
+void AssetScannerWorker::ScanForSourceFiles()
 {
+    QElapsedTimer scanTimer;
+    scanTimer.start();
+    m_scanStartTimeMs = QDateTime::currentMSecsSinceEpoch();
+
+    QDir projectCacheRoot;
+    m_projectCacheRoot = AssetUtilities::ComputeProjectCacheRoot(projectCacheRoot) ? QDir::cleanPath(projectCacheRoot.absolutePath()) : QString();
+
+    if (!m_scanJournalPath.isEmpty())
+    {
+        m_previousJournal.Load(m_scanJournalPath);
+    }
+
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_pendingDirectoriesMutex);
+        m_pendingDirectories.clear();
+        for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
+        {
+            const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
+            m_pendingDirectories.push_back({ QDir::cleanPath(scanFolderInfo.ScanPath()), -1, scanFolderInfo.RecurseSubFolders(), &scanFolderInfo });
+        }
+        m_unfinishedDirectoryCount = m_pendingDirectories.size();
+    }
+
+    // listing directories mostly waits on the file system, past a handful of threads they only contend on it
+    const AZ::u32 threadCount = AZStd::clamp<AZ::u32>(AZStd::thread::hardware_concurrency(), 1u, MaxScanThreadCount);
+    AZStd::vector<ScanResults> threadResults(threadCount);
+    AZStd::vector<AZStd::thread> threads;
+    threads.reserve(threadCount - 1);
+
+    AZStd::thread_desc threadDesc;
+    threadDesc.m_name = "AssetScannerWorker";
+    for (AZ::u32 threadIndex = 1; threadIndex < threadCount; ++threadIndex)
+    {
+        ScanResults* results = &threadResults[threadIndex];
+        threads.emplace_back([this, results]() { ScanThread(*results); }, &threadDesc);
+    }
+    // this thread takes part in the scan as well
+    ScanThread(threadResults[0]);
+
+    for (AZStd::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    AssetScanJournal journal;
+    AZ::u64 directoriesFromJournal = 0;
+    for (ScanResults& results : threadResults)
+    {
+        m_fileList.unite(results.m_fileList);
+        m_folderList.unite(results.m_folderList);
+        m_excludedList.unite(results.m_excludedList);
+        for (auto& journalDirectory : results.m_journalDirectories)
+        {
+            journal.SetDirectory(journalDirectory.first, AZStd::move(journalDirectory.second));
+        }
+        directoriesFromJournal += results.m_directoriesFromJournal;
+    }
+    m_previousJournal.Clear();
+    m_directoriesFromJournalCount = directoriesFromJournal;
+
     if (!m_doScan)
     {
+        // keep the previous journal rather than replacing it with a partial one
         return;
     }
 
-    QDir dir(scanFolderInfo.ScanPath());
+    if (!m_scanJournalPath.isEmpty())
+    {
+        if (!journal.Save(m_scanJournalPath))
+        {
+            AZ_Warning(AssetProcessor::ConsoleChannel, false, "Unable to save the scan journal to %s.\n", m_scanJournalPath.toUtf8().constData());
+        }
+    }
+
+    AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Scanned %d files and %d folders in %lld ms with %u threads (%llu folder listings reused from the scan journal).\n",
+        m_fileList.size(), m_folderList.size(), scanTimer.elapsed(), threadCount, directoriesFromJournal);
+}
+
+void AssetScannerWorker::ScanThread(ScanResults& results)
+{
+    AZStd::vector<PendingDirectory> subDirectories;
+
+    while (true)
+    {
+        PendingDirectory directory;
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_pendingDirectoriesMutex);
+            m_pendingDirectoriesCondition.wait(lock, [this]() { return !m_doScan || !m_pendingDirectories.empty() || m_unfinishedDirectoryCount == 0; });
+            if (!m_doScan || m_pendingDirectories.empty())
+            {
+                // either cancelled or every directory has been scanned
+                return;
+            }
+            directory = AZStd::move(m_pendingDirectories.front());
+            m_pendingDirectories.pop_front();
+        }
+
+        subDirectories.clear();
+        ScanDirectory(directory, results, subDirectories);
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingDirectoriesMutex);
+            for (PendingDirectory& subDirectory : subDirectories)
+            {
+                m_pendingDirectories.push_back(AZStd::move(subDirectory));
+            }
+            m_unfinishedDirectoryCount += subDirectories.size();
+            --m_unfinishedDirectoryCount;
+
+            if (m_unfinishedDirectoryCount == 0 || !subDirectories.empty())
+            {
+                m_pendingDirectoriesCondition.notify_all();
+            }
+        }
+    }
+}
+
+void AssetScannerWorker::ScanDirectory(const PendingDirectory& directory, ScanResults& results, AZStd::vector<PendingDirectory>& subDirectories)
+{
+    AZStd::vector<DirectoryEntry> entries;
+    bool listingFromJournal = false;
 
-    QFileInfoList entries;
+    qint64 directoryModTimeMs = directory.m_modTimeMs;
+    if (directoryModTimeMs < 0 && !m_scanJournalPath.isEmpty())
+    {
+        // scan folder roots are not listed by a parent directory
+        QFileInfo directoryInfo(directory.m_path);
+        directoryModTimeMs = directoryInfo.exists() ? directoryInfo.lastModified().toMSecsSinceEpoch() : -1;
+    }
 
-    //Only scan sub folders if recurseSubFolders flag is set
-    if (!scanFolderInfo.RecurseSubFolders())
+    if (directoryModTimeMs >= 0)
     {
-        entries = dir.entryInfoList(QDir::NoDotAndDotDot | QDir::Files);
+        if (const AssetScanJournal::Directory* journalDirectory = m_previousJournal.FindUnchangedDirectory(directory.m_path, directoryModTimeMs))
+        {
+            // nothing was added, removed or renamed in this directory, but files may have been modified in place so they are stat'ed again
+            listingFromJournal = true;
+            entries.reserve(journalDirectory->m_entries.size());
+            for (const AssetScanJournal::Entry& journalEntry : journalDirectory->m_entries)
+            {
+                DirectoryEntry entry;
+                entry.m_name = journalEntry.m_name;
+                if (StatDirectoryEntry(directory.m_path, entry))
+                {
+                    entries.push_back(AZStd::move(entry));
+                }
+            }
+            ++results.m_directoriesFromJournal;
+        }
     }
-    else
+
+    if (!listingFromJournal && !EnumerateDirectory(directory.m_path, entries))
     {
-        entries = dir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot | QDir::Files);
+        return;
     }
 
-    for (const QFileInfo& entry : entries)
+    // A directory modified within the time stamp resolution of the scan could change again without its time stamp moving,
+    // so it is not recorded (the same reasoning as git's racily clean entries).
+    const bool recordInJournal = !m_scanJournalPath.isEmpty() && directoryModTimeMs >= 0 && directoryModTimeMs < m_scanStartTimeMs - m_racyModTimeWindowMs;
+    AssetScanJournal::Directory journalDirectory;
+    if (recordInJournal)
+    {
+        journalDirectory.m_modTimeMs = directoryModTimeMs;
+        journalDirectory.m_entries.reserve(entries.size());
+    }
+
+    const ScanFolderInfo& rootScanFolder = *directory.m_rootScanFolder;
+    for (DirectoryEntry& entry : entries)
     {
         if (!m_doScan) // scan was cancelled!
         {
             return;
         }
 
-        QString absPath = entry.absoluteFilePath();
-        const bool isDirectory = entry.isDir();
-        QDateTime modTime = entry.lastModified();
-        AZ::u64 fileSize = isDirectory ? 0 : entry.size();
-        AssetFileInfo assetFileInfo(absPath, modTime, fileSize, &rootScanFolder, isDirectory);
+        if (recordInJournal)
+        {
+            journalDirectory.m_entries.push_back({ entry.m_name, entry.m_isDirectory });
+        }
+
+        //Only scan sub folders if recurseSubFolders flag is set
+        if (entry.m_isDirectory && !directory.m_recurseSubFolders)
+        {
+            continue;
+        }
+
+        QString absPath = directory.m_path + QLatin1Char('/') + entry.m_name;
+        const bool isDirectory = entry.m_isDirectory;
+        AssetFileInfo assetFileInfo(absPath, QDateTime::fromMSecsSinceEpoch(entry.m_modTimeMs), entry.m_size, &rootScanFolder, isDirectory);
 
         // Skip over the Cache folder if the file entry is the project cache root
-        QDir projectCacheRoot;
-        AssetUtilities::ComputeProjectCacheRoot(projectCacheRoot);
-        QString relativeToProjectCacheRoot = projectCacheRoot.relativeFilePath(absPath);
-        if (QDir::isRelativePath(relativeToProjectCacheRoot) && !relativeToProjectCacheRoot.startsWith(".."))
+        if (IsInProjectCache(absPath))
         {
             // The Cache folder should not be scanned
             continue;
@@ -114,23 +288,42 @@ void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo
         // Filtering out excluded files
         if (m_platformConfiguration->IsFileExcluded(absPath))
         {
-            m_excludedList.insert(AZStd::move(assetFileInfo));
+            results.m_excludedList.insert(AZStd::move(assetFileInfo));
             continue;
         }
 
         if (isDirectory)
         {
             //Entry is a directory
-            m_folderList.insert(AZStd::move(assetFileInfo));
-            ScanFolderInfo tempScanFolderInfo(absPath, "", "", false, true);
-            ScanForSourceFiles(tempScanFolderInfo, rootScanFolder);
+            results.m_folderList.insert(AZStd::move(assetFileInfo));
+            subDirectories.push_back({ absPath, entry.m_modTimeMs, true, &rootScanFolder });
         }
         else
         {
             //Entry is a file
-            m_fileList.insert(AZStd::move(assetFileInfo));
+            results.m_fileList.insert(AZStd::move(assetFileInfo));
         }
     }
+
+    if (recordInJournal)
+    {
+        results.m_journalDirectories.emplace_back(directory.m_path, AZStd::move(journalDirectory));
+    }
+}
+
+bool AssetScannerWorker::IsInProjectCache(const QString& absolutePath) const
+{
+    if (m_projectCacheRoot.isEmpty())
+    {
+        return false;
+    }
+
+    constexpr Qt::CaseSensitivity caseSensitivity = ASSETPROCESSOR_TRAIT_CASE_SENSITIVE_FILESYSTEM ? Qt::CaseSensitive : Qt::CaseInsensitive;
+    if (!absolutePath.startsWith(m_projectCacheRoot, caseSensitivity))
+    {
+        return false;
+    }
+    return absolutePath.size() == m_projectCacheRoot.size() || absolutePath.at(m_projectCacheRoot.size()) == QLatin1Char('/');
 }
 
 void AssetScannerWorker::EmitFiles()
@@ -11,6 +11,13 @@
 #if !defined(Q_MOC_RUN)
 #include "native/assetprocessor.h"
 #include "assetScanFolderInfo.h"
+#include "native/AssetManager/AssetScanJournal.h"
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/utils.h>
 #include <QString>
 #include <QSet>
 #include <QObject>
@@ -24,6 +31,8 @@ namespace AssetProcessor
      * and finding file of interest files.
      * Its created on the main thread and then moved to the worker thread
      * so it should contain no QObject-based classes at construction time (it can make them later)
+     * Directories are handed out to a pool of threads, each of which lists one directory at a time and queues up the
+     * sub directories it finds, so that deep and wide trees are both walked in parallel.
      */
     class AssetScannerWorker
         : public QObject
@@ -32,6 +41,13 @@ namespace AssetProcessor
     public:
         explicit AssetScannerWorker(PlatformConfiguration* config, QObject* parent = 0);
 
+        //! Sets the file the directory listings are persisted to between launches.  An empty path disables the journal.
+        void SetScanJournalPath(const QString& journalPath);
+        //! Sets how close to the start of the scan a directory can be modified and still be recorded in the journal.
+        void SetRacyModTimeWindowMs(qint64 racyModTimeWindowMs);
+        //! Returns how many directory listings the last scan reused from the journal.
+        AZ::u64 GetDirectoriesFromJournalCount() const;
+
 Q_SIGNALS:
         void ScanningStateChanged(AssetProcessor::AssetScanningStatus status);
         void FilesFound(QSet<AssetFileInfo> files); // QSet<QString> is a refcounted copy-on-write object, do not pass by ref.
@@ -43,17 +59,57 @@ Q_SIGNALS:
         void StopScan();
 
     protected:
-        // scanFolderInfo - the folder we're currently scanning (this will sometimes be a fake scanfolder created when recursing through directories)
-        // rootScanFolder - the actual scan folder we started with, which will either be the same as scanFolderInfo or a parent folder
-        void ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder);
+        struct PendingDirectory
+        {
+            QString m_path;
+            qint64 m_modTimeMs = -1; // -1 if it is not known yet
+            bool m_recurseSubFolders = true;
+            // the actual scan folder we started with, which will either be this directory or a parent of it
+            const ScanFolderInfo* m_rootScanFolder = nullptr;
+        };
+
+        //! What a single scanning thread found, merged once every thread is done so that they never contend on the results.
+        struct ScanResults
+        {
+            QSet<AssetFileInfo> m_fileList;
+            QSet<AssetFileInfo> m_folderList;
+            QSet<AssetFileInfo> m_excludedList;
+            AZStd::vector<AZStd::pair<QString, AssetScanJournal::Directory>> m_journalDirectories;
+            AZ::u64 m_directoriesFromJournal = 0;
+        };
+
+        //! Walks every scan folder, spreading the directories over up to MaxScanThreadCount threads.
+        void ScanForSourceFiles();
+        void ScanThread(ScanResults& results);
+        //! Lists a single directory into results, and returns the sub directories that still need to be scanned.
+        void ScanDirectory(const PendingDirectory& directory, ScanResults& results, AZStd::vector<PendingDirectory>& subDirectories);
+        bool IsInProjectCache(const QString& absolutePath) const;
         void EmitFiles();
 
     private:
-        volatile bool m_doScan = true;
+        static constexpr AZ::u32 MaxScanThreadCount = 8;
+        //! Directories modified this close to the start of the scan are not recorded in the journal.
+        static constexpr qint64 DefaultRacyModTimeWindowMs = 2000;
+
+        AZStd::atomic_bool m_doScan{ true };
         QSet<AssetFileInfo> m_fileList; // note:  neither QSet nor QString are qobject-derived
         QSet<AssetFileInfo> m_folderList;
         QSet<AssetFileInfo> m_excludedList;
         PlatformConfiguration* m_platformConfiguration;
+
+        // the Cache folder should not be scanned, computed once per scan rather than once per file
+        QString m_projectCacheRoot;
+
+        QString m_scanJournalPath;
+        AssetScanJournal m_previousJournal; // read only while the scan threads are running
+        qint64 m_scanStartTimeMs = 0;
+        qint64 m_racyModTimeWindowMs = DefaultRacyModTimeWindowMs;
+        AZStd::atomic<AZ::u64> m_directoriesFromJournalCount{ 0 };
+
+        AZStd::mutex m_pendingDirectoriesMutex;
+        AZStd::condition_variable m_pendingDirectoriesCondition;
+        AZStd::deque<PendingDirectory> m_pendingDirectories;
+        size_t m_unfinishedDirectoryCount = 0; // queued directories plus the ones being scanned
     };
 } // end namespace AssetProcessor
 
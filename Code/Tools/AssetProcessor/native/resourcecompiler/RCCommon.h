@@ -8,6 +8,7 @@
 #ifndef ASSETPROCESSOR_RCCOMMON_H
 #define ASSETPROCESSOR_RCCOMMON_H
 
+#include <AzCore/base.h>
 #include <QString>
 
 namespace AssetProcessor
@@ -56,6 +57,13 @@ namespace AssetProcessor
         QString m_jobDescriptor;
     };
     uint qHash(const AssetProcessor::QueueElementID& key, uint seed = 0);
+
+    //! Resource limits for the jobs of one builder, from the Jobs/Builders section of the Asset Processor settings.
+    struct BuilderJobLimits
+    {
+        int m_maxConcurrentJobs = 0; //!< how many jobs of the builder may run at once, 0 means no limit besides maxJobs
+        AZ::u64 m_memoryMB = 0; //!< expected peak memory of one job of the builder, counted against the jobs memory budget
+    };
 } // namespace AssetProcessor
 
 #endif //ASSETPROCESSOR_RCQUEUESORTMODEL_H
@@ -8,8 +8,37 @@
 #include <native/resourcecompiler/RCQueueSortModel.h>
 #include "rcjoblistmodel.h"
 
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <QHash>
+
 namespace AssetProcessor
 {
+    namespace RCQueueSortModelInternal
+    {
+        //! Assumed duration of a job before any job has finished.
+        static constexpr qint64 DefaultJobDurationMs = 1000;
+
+        //! Weights are recomputed at most this often while new jobs keep arriving, since that walks every queued job.
+        static constexpr qint64 DependencyWeightsUpdateIntervalMs = 250;
+
+        //! Once this many jobs started ahead of the first ready job held back by the admission, no other job is started
+        //! until it fits, so a steady stream of smaller jobs can't starve it.
+        static constexpr int MaxAdmissionSkips = 8;
+
+        bool IsOrderDependency(const JobDependencyInternal& jobDependencyInternal)
+        {
+            return jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::Order ||
+                jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce;
+        }
+
+        QueueElementID GetDependencyElementID(const JobDependencyInternal& jobDependencyInternal)
+        {
+            const AssetBuilderSDK::JobDependency& jobDependency = jobDependencyInternal.m_jobDependency;
+            return QueueElementID(jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str(), jobDependency.m_platformIdentifier.c_str(), jobDependency.m_jobKey.c_str());
+        }
+    } // namespace RCQueueSortModelInternal
+
     RCQueueSortModel::RCQueueSortModel(QObject* parent)
         : QSortFilterProxyModel(parent)
     {
@@ -37,8 +66,16 @@ namespace AssetProcessor
         }
     }
 
-    RCJob* RCQueueSortModel::GetNextPendingJob()
+    RCJob* RCQueueSortModel::GetNextPendingJob(const JobAdmissionFunction& canStartJob)
     {
+        using namespace RCQueueSortModelInternal;
+
+        if (m_dependencyWeightsDirty &&
+            (!m_dependencyWeightsTimer.isValid() || m_dependencyWeightsTimer.elapsed() >= DependencyWeightsUpdateIntervalMs || m_sourceModel->jobsInFlight() == 0))
+        {
+            UpdateDependencyWeights();
+        }
+
         if (m_dirtyNeedsResort)
         {
             setDynamicSortFilter(false);
@@ -47,6 +84,7 @@ namespace AssetProcessor
             m_dirtyNeedsResort = false;
         }
         RCJob* anyPendingJob = nullptr;
+        RCJob* heldBackJob = nullptr; // the first ready job the admission function rejected
         bool waitingOnCatalog = false; // If we find an asset thats waiting on the catalog, don't assume there's a cyclic dependency.  We'll wait until the catalog is updated and then check again.
 
         for (int idx = 0; idx < rowCount(); ++idx)
@@ -58,10 +96,9 @@ namespace AssetProcessor
                 bool canProcessJob = true;
                 for (const JobDependencyInternal& jobDepedencyInternal : actualJob->GetJobDependencies())
                 {
-                    if (jobDepedencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::Order || jobDepedencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce)
+                    if (IsOrderDependency(jobDepedencyInternal))
                     {
-                        const AssetBuilderSDK::JobDependency& jobDependency = jobDepedencyInternal.m_jobDependency;
-                        QueueElementID elementId(jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str(), jobDependency.m_platformIdentifier.c_str(), jobDependency.m_jobKey.c_str());
+                        QueueElementID elementId = GetDependencyElementID(jobDepedencyInternal);
 
                         if (m_sourceModel->isInFlight(elementId) || m_sourceModel->isInQueue(elementId))
                         {
@@ -81,6 +118,39 @@ namespace AssetProcessor
 
                 if (canProcessJob)
                 {
+                    if (canStartJob && !canStartJob(actualJob))
+                    {
+                        if (!heldBackJob)
+                        {
+                            heldBackJob = actualJob;
+                            if (m_heldBackJobRunKey == actualJob->GetJobEntry().m_jobRunKey)
+                            {
+                                if (m_heldBackJobSkipCount >= MaxAdmissionSkips && m_sourceModel->jobsInFlight() > 0)
+                                {
+                                    // reserve the capacity of the jobs in flight for it, it is started once enough of them finish
+                                    return nullptr;
+                                }
+                            }
+                            else
+                            {
+                                m_heldBackJobRunKey = actualJob->GetJobEntry().m_jobRunKey;
+                                m_heldBackJobSkipCount = 0;
+                            }
+                        }
+
+                        // ready, but held back by the caller (builder or memory limits), let the jobs after it go first
+                        continue;
+                    }
+
+                    if (heldBackJob)
+                    {
+                        ++m_heldBackJobSkipCount;
+                    }
+                    else if (canStartJob)
+                    {
+                        m_heldBackJobRunKey = 0;
+                        m_heldBackJobSkipCount = 0;
+                    }
                     return actualJob;
                 }
             }
@@ -190,6 +260,19 @@ namespace AssetProcessor
             }
         }
 
+        // jobs at the head of a long chain of order dependencies gate everything after them, so start them first.
+        // jobs nothing waits on all have a downstream path of 0 and fall through to the priority order.
+        if (leftJob->GetDownstreamPathMs() != rightJob->GetDownstreamPathMs())
+        {
+            return leftJob->GetDownstreamPathMs() > rightJob->GetDownstreamPathMs();
+        }
+
+        // then the ones which unblock the most jobs
+        if (leftJob->GetDependentCount() != rightJob->GetDependentCount())
+        {
+            return leftJob->GetDependentCount() > rightJob->GetDependentCount();
+        }
+
         int priorityLeft = leftJob->GetPriority();
         int priorityRight = rightJob->GetPriority();
 
@@ -230,6 +313,7 @@ namespace AssetProcessor
     void RCQueueSortModel::AddJobIdEntry(AssetProcessor::RCJob* rcJob)
     {
         m_currentJobRunKeyToJobEntries[rcJob->GetJobEntry().m_jobRunKey] = rcJob;
+        m_dependencyWeightsDirty = true;
     }
 
     void RCQueueSortModel::RemoveJobIdEntry(AssetProcessor::RCJob* rcJob)
@@ -250,5 +334,131 @@ namespace AssetProcessor
         }
     }
 
+    void RCQueueSortModel::RecordJobDuration(const RCJob* rcJob, qint64 durationMs)
+    {
+        BuilderDurations& builderDurations = m_builderDurations[rcJob->GetBuilderGuid()];
+        builderDurations.m_totalMs += durationMs;
+        ++builderDurations.m_jobCount;
+
+        m_allDurations.m_totalMs += durationMs;
+        ++m_allDurations.m_jobCount;
+    }
+
+    qint64 RCQueueSortModel::EstimateJobDuration(const RCJob* rcJob) const
+    {
+        auto found = m_builderDurations.find(rcJob->GetBuilderGuid());
+        if (found != m_builderDurations.end())
+        {
+            return found->second.m_totalMs / found->second.m_jobCount;
+        }
+
+        // nothing from this builder has finished yet, assume it is an average one
+        if (m_allDurations.m_jobCount > 0)
+        {
+            return m_allDurations.m_totalMs / m_allDurations.m_jobCount;
+        }
+        return RCQueueSortModelInternal::DefaultJobDurationMs;
+    }
+
+    void RCQueueSortModel::UpdateDependencyWeights()
+    {
+        using namespace RCQueueSortModelInternal;
+
+        m_dependencyWeightsDirty = false;
+        m_dependencyWeightsTimer.start();
+
+        // gather the queued jobs, then for each of them the queued jobs which wait on it
+        AZStd::vector<RCJob*> jobs;
+        jobs.reserve(rowCount());
+        QHash<QueueElementID, int> jobIndexByElement;
+        jobIndexByElement.reserve(rowCount());
+        for (int idx = 0; idx < rowCount(); ++idx)
+        {
+            RCJob* actualJob = m_sourceModel->getItem(mapToSource(index(idx, 0)).row());
+            if (actualJob && actualJob->GetState() == RCJob::pending)
+            {
+                jobIndexByElement.insert(actualJob->GetElementID(), static_cast<int>(jobs.size()));
+                jobs.push_back(actualJob);
+            }
+        }
+
+        const int jobCount = static_cast<int>(jobs.size());
+        AZStd::vector<AZStd::vector<int>> dependents(jobCount);
+        AZStd::vector<qint64> estimatedDurations(jobCount);
+        for (int jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+        {
+            estimatedDurations[jobIndex] = EstimateJobDuration(jobs[jobIndex]);
+            for (const JobDependencyInternal& jobDependencyInternal : jobs[jobIndex]->GetJobDependencies())
+            {
+                if (IsOrderDependency(jobDependencyInternal))
+                {
+                    auto found = jobIndexByElement.constFind(GetDependencyElementID(jobDependencyInternal));
+                    if (found != jobIndexByElement.constEnd() && found.value() != jobIndex)
+                    {
+                        dependents[found.value()].push_back(jobIndex);
+                    }
+                }
+            }
+        }
+
+        // longest path through the dependents of each job, depth first.  Chains of order dependencies can be thousands
+        // of jobs long, so this uses an explicit stack rather than recursion.
+        enum class VisitState : AZ::u8
+        {
+            NotVisited,
+            InProgress,
+            Done
+        };
+        AZStd::vector<VisitState> visitStates(jobCount, VisitState::NotVisited);
+        AZStd::vector<qint64> downstreamPaths(jobCount, 0);
+        AZStd::vector<AZStd::pair<int, size_t>> stack; // job index, index of the next dependent to visit
+        for (int rootIndex = 0; rootIndex < jobCount; ++rootIndex)
+        {
+            if (visitStates[rootIndex] != VisitState::NotVisited)
+            {
+                continue;
+            }
+
+            visitStates[rootIndex] = VisitState::InProgress;
+            stack.emplace_back(rootIndex, 0);
+            while (!stack.empty())
+            {
+                const int jobIndex = stack.back().first;
+                const size_t nextDependent = stack.back().second;
+                if (nextDependent < dependents[jobIndex].size())
+                {
+                    ++stack.back().second;
+                    const int dependentIndex = dependents[jobIndex][nextDependent];
+                    if (visitStates[dependentIndex] == VisitState::NotVisited)
+                    {
+                        visitStates[dependentIndex] = VisitState::InProgress;
+                        stack.emplace_back(dependentIndex, 0);
+                    }
+                    // a dependent still in progress closes a cycle.  GetNextPendingJob breaks those on its own, so the edge is ignored here
+                    continue;
+                }
+
+                qint64 longestPath = 0;
+                for (int dependentIndex : dependents[jobIndex])
+                {
+                    if (visitStates[dependentIndex] == VisitState::Done)
+                    {
+                        longestPath = AZStd::max(longestPath, estimatedDurations[dependentIndex] + downstreamPaths[dependentIndex]);
+                    }
+                }
+                downstreamPaths[jobIndex] = longestPath;
+                visitStates[jobIndex] = VisitState::Done;
+                stack.pop_back();
+            }
+        }
+
+        for (int jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+        {
+            jobs[jobIndex]->SetDownstreamWeight(downstreamPaths[jobIndex], static_cast<int>(dependents[jobIndex].size()));
+        }
+
+        m_dirtyNeedsResort = true;
+    }
+
 } // end namespace AssetProcessor
 
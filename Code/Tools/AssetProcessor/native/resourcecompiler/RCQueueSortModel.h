@@ -9,6 +9,7 @@
 #define ASSETPROCESSOR_RCQUEUESORTMODEL_H
 
 #if !defined(Q_MOC_RUN)
+#include <QElapsedTimer>
 #include <QSortFilterProxyModel>
 #include <QSet>
 #include <QString>
@@ -16,6 +17,7 @@
 
 #include "native/utilities/AssetUtilEBusHelper.h"
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/functional.h>
 #include "native/assetprocessor.h"
 #endif
 
@@ -33,7 +35,8 @@ namespace AssetProcessor
     //!  * Critical (currently Copy) jobs for currently connected platforms
     //!  * Jobs in Sync Compile Requests for currently connected platforms (with most recent requests first)
     //!  * Jobs in Async Compile Lists for currently connected platforms
-    //!  * Remaining jobs in currently connected platforms, in priority order
+    //!  * Remaining jobs in currently connected platforms, the ones at the head of the longest chain of order dependencies
+    //!    first (the critical path), then the ones most other jobs wait on, then in priority order
     //!  (The same, repeated, for unconnected platforms).
     class RCQueueSortModel
         : public QSortFilterProxyModel
@@ -44,8 +47,18 @@ namespace AssetProcessor
     public:
         explicit RCQueueSortModel(QObject* parent = 0);
 
+        //! Returns false if a job cannot be started right now, for example because its builder is at its limit.
+        using JobAdmissionFunction = AZStd::function<bool(const RCJob*)>;
+
         void AttachToModel(RCJobListModel* target);
-        RCJob* GetNextPendingJob();
+        //! Returns the first ready job canStartJob accepts.  Once a few jobs have started ahead of a ready job canStartJob
+        //! rejects, returns nullptr until that job is accepted, so the jobs in flight finish and make room for it.
+        RCJob* GetNextPendingJob(const JobAdmissionFunction& canStartJob = {});
+
+        //! Records how long a job took, which refines the estimated duration of the jobs of the same builder.
+        void RecordJobDuration(const RCJob* rcJob, qint64 durationMs);
+        //! Returns the expected duration of a job, the average duration of the finished jobs of its builder so far.
+        qint64 EstimateJobDuration(const RCJob* rcJob) const;
 
         void AddJobIdEntry(AssetProcessor::RCJob* rcJob);
         void RemoveJobIdEntry(AssetProcessor::RCJob* rcJob);
@@ -63,6 +76,24 @@ namespace AssetProcessor
 
         typedef AZStd::unordered_map<AZ::s64, AssetProcessor::RCJob*> JobRunKeyToRCJobMap;
 
+        //! Recomputes the downstream weight of every queued job from the order dependencies between them.
+        void UpdateDependencyWeights();
+
+        struct BuilderDurations
+        {
+            qint64 m_totalMs = 0;
+            qint64 m_jobCount = 0;
+        };
+        AZStd::unordered_map<AZ::Uuid, BuilderDurations> m_builderDurations;
+        BuilderDurations m_allDurations;
+
+        // the first ready job held back by the admission function, and how many jobs started ahead of it since
+        AZ::u64 m_heldBackJobRunKey = 0;
+        int m_heldBackJobSkipCount = 0;
+
+        bool m_dependencyWeightsDirty = false;
+        QElapsedTimer m_dependencyWeightsTimer; // time since the last update, to bound the cost while jobs are streaming in
+
         JobRunKeyToRCJobMap m_currentJobRunKeyToJobEntries;
 
         QSet<QString> m_currentlyConnectedPlatforms;
@@ -8,9 +8,12 @@
 
 #include "rccontroller.h"
 #include <native/resourcecompiler/RCCommon.h>
+#include <QDateTime>
 #include <QTimer>
 #include <QThreadPool>
 
+#include <cinttypes>
+
 
 
 namespace AssetProcessor
@@ -68,6 +71,13 @@ namespace AssetProcessor
             FinishJob(rcJob);
         }, Qt::QueuedConnection);
 
+        m_startedJobEstimatedDurations[rcJob] = m_RCQueueSortModel.EstimateJobDuration(rcJob);
+        if (const BuilderJobLimits* builderJobLimits = FindBuilderJobLimits(rcJob))
+        {
+            ++m_jobsInFlightPerBuilder[rcJob->GetBuilderName()];
+            m_memoryInFlightMB += builderJobLimits->m_memoryMB;
+        }
+
         // Mark as "being processed" by moving to Processing list
         m_RCJobListModel.markAsProcessing(rcJob);
         m_RCJobListModel.markAsStarted(rcJob);
@@ -102,6 +112,52 @@ namespace AssetProcessor
     void RCController::FinishJob(RCJob* rcJob)
     {
         m_RCQueueSortModel.RemoveJobIdEntry(rcJob);
+
+        // jobs removed from the queue before they started are finished here too, only the started ones hold resources
+        auto startedJob = m_startedJobEstimatedDurations.find(rcJob);
+        if (startedJob != m_startedJobEstimatedDurations.end())
+        {
+            const qint64 estimatedDurationMs = startedJob->second;
+            m_startedJobEstimatedDurations.erase(startedJob);
+
+            if (const BuilderJobLimits* builderJobLimits = FindBuilderJobLimits(rcJob))
+            {
+                --m_jobsInFlightPerBuilder[rcJob->GetBuilderName()];
+                m_memoryInFlightMB -= AZStd::min(m_memoryInFlightMB, builderJobLimits->m_memoryMB);
+            }
+
+            if (rcJob->GetState() == RCJob::completed)
+            {
+                const qint64 actualDurationMs = rcJob->GetTimeLaunched().msecsTo(QDateTime::currentDateTime());
+                m_RCQueueSortModel.RecordJobDuration(rcJob, actualDurationMs);
+
+                // extend the longest completed chain this job had to wait on
+                CriticalPath path;
+                for (const JobDependencyInternal& jobDependencyInternal : rcJob->GetJobDependencies())
+                {
+                    const AssetBuilderSDK::JobDependency& jobDependency = jobDependencyInternal.m_jobDependency;
+                    if (jobDependency.m_type == AssetBuilderSDK::JobDependencyType::Order || jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce)
+                    {
+                        QueueElementID elementId(jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str(), jobDependency.m_platformIdentifier.c_str(), jobDependency.m_jobKey.c_str());
+                        auto found = m_completedJobPaths.constFind(elementId);
+                        if (found != m_completedJobPaths.constEnd() && found.value().m_actualMs > path.m_actualMs)
+                        {
+                            path = found.value();
+                        }
+                    }
+                }
+                path.m_estimatedMs += estimatedDurationMs;
+                path.m_actualMs += actualDurationMs;
+                ++path.m_jobCount;
+                m_completedJobPaths.insert(rcJob->GetElementID(), path);
+
+                if (path.m_actualMs > m_criticalPath.m_actualMs)
+                {
+                    m_criticalPath = path;
+                }
+            }
+        }
+
         QString platform = rcJob->GetPlatformInfo().m_identifier.c_str();
         auto found = m_jobsCountPerPlatform.find(platform);
         if (found != m_jobsCountPerPlatform.end())
@@ -268,8 +324,12 @@ namespace AssetProcessor
         if (!m_dispatchingJobs)
         {
             m_dispatchingJobs = true;
-            RCJob* rcJob = m_RCQueueSortModel.GetNextPendingJob();
-            
+            auto canStartJob = [this](const RCJob* pendingJob)
+            {
+                return CanStartJob(pendingJob);
+            };
+            RCJob* rcJob = m_RCQueueSortModel.GetNextPendingJob(canStartJob);
+
             while (m_RCJobListModel.jobsInFlight() < m_maxJobs && rcJob && !m_shuttingDown)
             {
                 if (m_dispatchingPaused)
@@ -282,11 +342,64 @@ namespace AssetProcessor
                 }
 
                 StartJob(rcJob);
-                rcJob = m_RCQueueSortModel.GetNextPendingJob();
+                rcJob = m_RCQueueSortModel.GetNextPendingJob(canStartJob);
             }
             m_dispatchingJobs = false;
         }
     }
+    void RCController::SetJobLimits(AZ::u64 memoryBudgetMB, AZStd::unordered_map<AZStd::string, BuilderJobLimits> builderJobLimits)
+    {
+        m_jobMemoryBudgetMB = memoryBudgetMB;
+        m_builderJobLimits = AZStd::move(builderJobLimits);
+        for (const auto& builderLimits : m_builderJobLimits)
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Builder '%s' limited to %d concurrent jobs, %" PRIu64 " MB per job.\n",
+                builderLimits.first.c_str(), builderLimits.second.m_maxConcurrentJobs, builderLimits.second.m_memoryMB);
+        }
+    }
+
+    const RCController::CriticalPath& RCController::GetCriticalPath() const
+    {
+        return m_criticalPath;
+    }
+
+    const BuilderJobLimits* RCController::FindBuilderJobLimits(const RCJob* rcJob) const
+    {
+        if (m_builderJobLimits.empty())
+        {
+            return nullptr;
+        }
+
+        auto found = m_builderJobLimits.find(rcJob->GetBuilderName());
+        return found != m_builderJobLimits.end() ? &found->second : nullptr;
+    }
+
+    bool RCController::CanStartJob(const RCJob* rcJob) const
+    {
+        if (rcJob->IsAutoFail() || m_RCJobListModel.jobsInFlight() == 0)
+        {
+            // auto fail jobs do no work, and the only job running is never held back or a job over budget would never run
+            return true;
+        }
+
+        const BuilderJobLimits* builderJobLimits = FindBuilderJobLimits(rcJob);
+        if (!builderJobLimits)
+        {
+            return true;
+        }
+
+        if (builderJobLimits->m_maxConcurrentJobs > 0)
+        {
+            auto found = m_jobsInFlightPerBuilder.find(rcJob->GetBuilderName());
+            if (found != m_jobsInFlightPerBuilder.end() && found->second >= builderJobLimits->m_maxConcurrentJobs)
+            {
+                return false;
+            }
+        }
+
+        return m_jobMemoryBudgetMB == 0 || m_memoryInFlightMB + builderJobLimits->m_memoryMB <= m_jobMemoryBudgetMB;
+    }
+
     void RCController::DispatchJobs()
     {
         if (!m_dispatchJobsQueued)
@@ -20,6 +20,7 @@
 #include "rcjoblistmodel.h"
 #include "RCQueueSortModel.h"
 
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzFramework/Asset/AssetProcessorMessages.h>
 #include <AzToolsFramework/API/EditorAssetSystemAPI.h>
 #endif
@@ -58,6 +59,20 @@ namespace AssetProcessor
         int NumberOfPendingJobsPerPlatform(QString platform);
         bool IsIdle();
         bool IsPriorityCopyJob(AssetProcessor::RCJob* rcJob);
+
+        //! Limits which jobs may run at the same time: at most m_maxConcurrentJobs of a builder, and the summed memoryMB
+        //! of the running jobs within memoryBudgetMB (0 means no budget).  A job is always allowed to start when
+        //! nothing else is running, so a job over budget still runs on its own.
+        void SetJobLimits(AZ::u64 memoryBudgetMB, AZStd::unordered_map<AZStd::string, BuilderJobLimits> builderJobLimits);
+
+        //! The longest chain of order dependent jobs completed so far, with its estimated and actual duration.
+        struct CriticalPath
+        {
+            qint64 m_estimatedMs = 0;
+            qint64 m_actualMs = 0;
+            int m_jobCount = 0;
+        };
+        const CriticalPath& GetCriticalPath() const;
     Q_SIGNALS:
         void FileCompiled(JobEntry entry, AssetBuilderSDK::ProcessJobResponse response);
         void FileFailed(JobEntry entry);
@@ -108,9 +123,20 @@ namespace AssetProcessor
 
     private:
         void FinishJob(AssetProcessor::RCJob* rcJob);
+        bool CanStartJob(const AssetProcessor::RCJob* rcJob) const;
+        const BuilderJobLimits* FindBuilderJobLimits(const AssetProcessor::RCJob* rcJob) const;
 
         unsigned int m_maxJobs;
 
+        AZ::u64 m_jobMemoryBudgetMB = 0;
+        AZStd::unordered_map<AZStd::string, BuilderJobLimits> m_builderJobLimits;
+        AZStd::unordered_map<AZStd::string, int> m_jobsInFlightPerBuilder;
+        AZ::u64 m_memoryInFlightMB = 0;
+        AZStd::unordered_map<const AssetProcessor::RCJob*, qint64> m_startedJobEstimatedDurations; // jobs started by StartJob, with the duration expected at that time
+
+        QHash<AssetProcessor::QueueElementID, CriticalPath> m_completedJobPaths; // longest chain of completed jobs ending with each job
+        CriticalPath m_criticalPath;
+
         bool m_dispatchingJobs = false;
         bool m_shuttingDown = false;
         bool m_dispatchingPaused = true;// dispatching starts out paused.
@@ -12,6 +12,7 @@
 #include <AzToolsFramework/UI/Logging/LogLine.h>
 
 #include <native/utilities/BuilderManager.h>
+#include <native/utilities/LocalBuildCache.h>
 #include <native/utilities/ThreadHelper.h>
 
 #include <QtConcurrent/QtConcurrentRun>
@@ -107,6 +108,11 @@ namespace AssetProcessor
         return m_jobDetails.m_jobEntry;
     }
 
+    const JobDetails& RCJob::GetJobDetails() const
+    {
+        return m_jobDetails;
+    }
+
     QDateTime RCJob::GetTimeCreated() const
     {
         return m_timeCreated;
@@ -259,6 +265,27 @@ namespace AssetProcessor
         return m_jobDetails.m_priority;
     }
 
+    const AZStd::string& RCJob::GetBuilderName() const
+    {
+        return m_jobDetails.m_assetBuilderDesc.m_name;
+    }
+
+    void RCJob::SetDownstreamWeight(qint64 downstreamPathMs, int dependentCount)
+    {
+        m_downstreamPathMs = downstreamPathMs;
+        m_dependentCount = dependentCount;
+    }
+
+    qint64 RCJob::GetDownstreamPathMs() const
+    {
+        return m_downstreamPathMs;
+    }
+
+    int RCJob::GetDependentCount() const
+    {
+        return m_dependentCount;
+    }
+
     const AZStd::vector<AssetProcessor::JobDependencyInternal>& RCJob::GetJobDependencies()
     {
         return m_jobDetails.m_jobDependencyList;
@@ -520,7 +547,15 @@ namespace AssetProcessor
                 if (!JobCancelListener.IsCancelled())
                 {
                     bool runProcessJob = true;
-                    if (m_jobDetails.m_checkServer)
+                    bool retrievedFromLocalBuildCache = false;
+                    ILocalBuildCacheRequests* localBuildCache = AZ::Interface<ILocalBuildCacheRequests>::Get();
+                    if (localBuildCache && localBuildCache->RetrieveJobResult(builderParams))
+                    {
+                        retrievedFromLocalBuildCache = AfterRetrievingJobResult(builderParams, jobLogTraceListener, result);
+                        runProcessJob = !retrievedFromLocalBuildCache;
+                    }
+
+                    if (runProcessJob && m_jobDetails.m_checkServer)
                     {
                         QFileInfo fileInfo(builderParams.m_processJobRequest.m_sourceFile.c_str());
                         builderParams.m_serverKey = QString("%1_%2_%3_%4").arg(fileInfo.completeBaseName(), builderParams.m_processJobRequest.m_jobDescription.m_jobKey.c_str(), builderParams.m_processJobRequest.m_platformInfo.m_identifier.c_str()).arg(builderParams.m_rcJob->GetOriginalFingerprint());
@@ -577,6 +612,16 @@ namespace AssetProcessor
                         // sending process job command to the builder
                         builderParams.m_assetBuilderDesc.m_processJobFunction(builderParams.m_processJobRequest, result);
                     }
+
+                    if (localBuildCache && !retrievedFromLocalBuildCache && !JobCancelListener.IsCancelled()
+                        && result.m_resultCode == AssetBuilderSDK::ProcessJobResult_Success)
+                    {
+                        auto beforeStoreResult = BeforeStoringJobResult(builderParams, result);
+                        if (beforeStoreResult.IsSuccess())
+                        {
+                            localBuildCache->StoreJobResult(builderParams, beforeStoreResult.GetValue());
+                        }
+                    }
                 }
             }
 
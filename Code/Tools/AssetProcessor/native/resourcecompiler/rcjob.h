@@ -162,6 +162,7 @@ namespace AssetProcessor
         AssetBuilderSDK::ProcessJobResponse& GetProcessJobResponse();
 
         const JobEntry& GetJobEntry() const;
+        const JobDetails& GetJobDetails() const;
 
         void Start();
 
@@ -198,8 +199,16 @@ namespace AssetProcessor
         bool IsCritical() const;
         bool IsAutoFail() const;
         int GetPriority() const;
+        const AZStd::string& GetBuilderName() const;
         const AZStd::vector<JobDependencyInternal>& GetJobDependencies();
 
+        //! Scheduling weights, computed by the RCQueueSortModel from the order dependencies between queued jobs.
+        //! downstreamPathMs is the estimated time of the longest chain of queued jobs waiting on this one to finish,
+        //! dependentCount is the number of queued jobs directly waiting on it.
+        void SetDownstreamWeight(qint64 downstreamPathMs, int dependentCount);
+        qint64 GetDownstreamPathMs() const;
+        int GetDependentCount() const;
+
     protected:
         //! DoWork ensure that the job is ready for being processing and than makes the actual builder call   
         virtual void DoWork(AssetBuilderSDK::ProcessJobResponse& result, BuilderParams& builderParams, AssetUtilities::QuitListener& listener);
@@ -213,6 +222,9 @@ namespace AssetProcessor
 
         int m_JobEscalation = AssetProcessor::JobEscalation::Default; // Escalation indicates how important the job is and how soon it needs processing, the greater the number the greater the escalation  
 
+        qint64 m_downstreamPathMs = 0;
+        int m_dependentCount = 0;
+
         QDateTime m_timeCreated;
         QDateTime m_timeLaunched;
         QDateTime m_timeCompleted;
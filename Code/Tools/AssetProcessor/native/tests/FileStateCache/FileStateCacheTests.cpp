@@ -9,6 +9,8 @@
 #include "FileStateCacheTests.h"
 #include <native/utilities/assetUtils.h>
 #include <native/unittests/UnitTestRunner.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzFramework/IO/LocalFileIO.h>
 
 namespace UnitTests
 {
@@ -164,4 +166,80 @@ namespace UnitTests
         CheckForFile(R"(c:\some\test\file.txt)", true);
         CheckForFile(R"(c:/some/test/file.txt)", true);
     }
+
+    class FileStateCacheHashTests
+        : public FileStateCacheTests
+    {
+    public:
+        void SetUp() override
+        {
+            // hashing goes through FileIO, which needs the system allocator
+            if (!AZ::AllocatorInstance<AZ::SystemAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+                m_ownsSystemAllocator = true;
+            }
+
+            if (AZ::IO::FileIOBase::GetInstance() == nullptr)
+            {
+                m_localFileIO = aznew AZ::IO::LocalFileIO();
+                AZ::IO::FileIOBase::SetInstance(m_localFileIO);
+            }
+
+            AssetUtilities::SetUseFileHashOverride(true, true);
+            FileStateCacheTests::SetUp();
+        }
+
+        void TearDown() override
+        {
+            FileStateCacheTests::TearDown();
+            AssetUtilities::SetUseFileHashOverride(false, false);
+
+            if (m_localFileIO)
+            {
+                AZ::IO::FileIOBase::SetInstance(nullptr);
+                delete m_localFileIO;
+                m_localFileIO = nullptr;
+            }
+
+            if (m_ownsSystemAllocator)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+                m_ownsSystemAllocator = false;
+            }
+        }
+
+    protected:
+        AZ::IO::FileIOBase* m_localFileIO = nullptr;
+        bool m_ownsSystemAllocator = false;
+    };
+
+    TEST_F(FileStateCacheHashTests, WarmUpHashes_MatchesDirectHash)
+    {
+        QStringList testPaths;
+        for (int fileIndex = 0; fileIndex < 64; ++fileIndex)
+        {
+            QString testPath = m_temporarySourceDir.absoluteFilePath(QString("test%1.txt").arg(fileIndex));
+            ASSERT_TRUE(UnitTestUtils::CreateDummyFile(testPath, QString("contents of file %1").arg(fileIndex)));
+            m_fileStateCache->AddFile(testPath);
+            testPaths.push_back(testPath);
+        }
+
+        // files unknown to the cache are ignored
+        testPaths.push_back(m_temporarySourceDir.absoluteFilePath("missing.txt"));
+
+        auto* fileStateInterface = AZ::Interface<IFileStateRequests>::Get();
+        ASSERT_NE(fileStateInterface, nullptr);
+        fileStateInterface->WarmUpHashes(testPaths);
+
+        for (int fileIndex = 0; fileIndex < 64; ++fileIndex)
+        {
+            IFileStateRequests::FileHash cachedHash = 0;
+            ASSERT_TRUE(fileStateInterface->GetHash(testPaths[fileIndex], &cachedHash));
+            EXPECT_EQ(cachedHash, AssetUtilities::GetFileHash(testPaths[fileIndex].toUtf8().constData(), true));
+        }
+
+        IFileStateRequests::FileHash missingHash = 0;
+        EXPECT_FALSE(fileStateInterface->GetHash(testPaths.back(), &missingHash));
+    }
 }
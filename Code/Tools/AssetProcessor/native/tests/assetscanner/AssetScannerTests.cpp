@@ -8,6 +8,7 @@
 
 #include <native/tests/assetscanner/AssetScannerTests.h>
 #include <native/AssetManager/assetScanner.h>
+#include <native/AssetManager/AssetScanJournal.h>
 
 namespace AssetProcessor
 {
@@ -154,4 +155,74 @@ namespace AssetProcessor
         EXPECT_FALSE(m_files.contains(tempDir.filePath("subfolder2/aaa/basefile.txt")));
         EXPECT_EQ(m_folders.size(), 0);
     }
+
+    TEST_F(AssetScannerTest, AssetScannerJournal_Rescan_FindsSameAndAddedFiles)
+    {
+        QTemporaryDir journalDir;
+        QDir tempDir(m_tempDir.path());
+        const QString journalPath = QDir(journalDir.path()).absoluteFilePath("AssetScanJournal.dat");
+        m_assetScanner.get()->SetScanJournalPath(journalPath);
+        // the fixture's folders were just created, they would not be recorded in the journal with the default window
+        m_assetScanner.get()->SetRacyModTimeWindowMs(0);
+
+        m_assetScanner.get()->StartScan();
+        ASSERT_TRUE(BlockUntilScanComplete(5000));
+        EXPECT_EQ(m_files.size(), 4);
+        EXPECT_EQ(m_folders.size(), 1);
+        EXPECT_EQ(m_assetScanner.get()->GetDirectoriesFromJournalCount(), 0);
+
+        // the root, subfolder1, subfolder2 and subfolder2/aaa
+        AssetScanJournal journal;
+        ASSERT_TRUE(journal.Load(journalPath));
+        EXPECT_EQ(journal.GetDirectoryCount(), 4);
+
+        // the second scan reads the journal written by the first one
+        QSet<QString> firstScanFiles = m_files;
+        m_files.clear();
+        m_folders.clear();
+        m_scanComplete = false;
+        m_assetScanner.get()->StartScan();
+        ASSERT_TRUE(BlockUntilScanComplete(5000));
+        EXPECT_EQ(m_files, firstScanFiles);
+        EXPECT_EQ(m_folders.size(), 1);
+        EXPECT_EQ(m_assetScanner.get()->GetDirectoriesFromJournalCount(), 4);
+
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(tempDir.absoluteFilePath("subfolder2/aaa/newfile.txt")));
+        m_files.clear();
+        m_folders.clear();
+        m_scanComplete = false;
+        m_assetScanner.get()->StartScan();
+        ASSERT_TRUE(BlockUntilScanComplete(5000));
+        EXPECT_EQ(m_files.size(), 5);
+        EXPECT_TRUE(m_files.contains(tempDir.absoluteFilePath("subfolder2/aaa/newfile.txt")));
+        // only the folder the file was added to is listed again
+        EXPECT_EQ(m_assetScanner.get()->GetDirectoriesFromJournalCount(), 3);
+    }
+
+    TEST_F(AssetScannerTest, AssetScanJournal_SaveAndLoad_RoundTrips)
+    {
+        QTemporaryDir journalDir;
+        const QString journalPath = QDir(journalDir.path()).absoluteFilePath("AssetScanJournal.dat");
+
+        AssetScanJournal journal;
+        AssetScanJournal::Directory directory;
+        directory.m_modTimeMs = 1234;
+        directory.m_entries.push_back({ "file.txt", false });
+        directory.m_entries.push_back({ "folder", true });
+        journal.SetDirectory("/some/folder", AZStd::move(directory));
+        ASSERT_TRUE(journal.Save(journalPath));
+
+        AssetScanJournal loadedJournal;
+        ASSERT_TRUE(loadedJournal.Load(journalPath));
+        EXPECT_EQ(loadedJournal.GetDirectoryCount(), 1);
+        EXPECT_EQ(loadedJournal.FindUnchangedDirectory("/some/folder", 1235), nullptr);
+
+        const AssetScanJournal::Directory* loadedDirectory = loadedJournal.FindUnchangedDirectory("/some/folder", 1234);
+        ASSERT_NE(loadedDirectory, nullptr);
+        ASSERT_EQ(loadedDirectory->m_entries.size(), 2);
+        EXPECT_EQ(loadedDirectory->m_entries[0].m_name, "file.txt");
+        EXPECT_FALSE(loadedDirectory->m_entries[0].m_isDirectory);
+        EXPECT_EQ(loadedDirectory->m_entries[1].m_name, "folder");
+        EXPECT_TRUE(loadedDirectory->m_entries[1].m_isDirectory);
+    }
 }
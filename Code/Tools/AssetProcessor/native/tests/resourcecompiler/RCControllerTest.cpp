@@ -243,3 +243,125 @@ TEST_F(RCcontrollerTest_Simple, DISABLED_SameJobIsCompletedMultipleTimes_Complet
     ASSERT_EQ(m_errorAbsorber->m_numAssertsAbsorbed, 4); // Expected that there are 4 errors related to the files not existing on disk.  Error message: GenerateFingerprint was called but no input files were requested for fingerprinting.
     ASSERT_EQ(m_errorAbsorber->m_numErrorsAbsorbed, 0);
 }
+
+class RCcontrollerTest_Scheduling
+    : public RCcontrollerTest
+{
+public:
+    void SetUp() override
+    {
+        RCcontrollerTest::SetUp();
+        m_rcJobListModel.reset(new AssetProcessor::RCJobListModel());
+        m_rcQueueSortModel.reset(new AssetProcessor::RCQueueSortModel());
+        m_rcQueueSortModel->AttachToModel(m_rcJobListModel.get());
+    }
+
+    void TearDown() override
+    {
+        m_rcQueueSortModel->AttachToModel(nullptr);
+        m_rcQueueSortModel.reset();
+        m_rcJobListModel.reset();
+        RCcontrollerTest::TearDown();
+    }
+
+    AssetProcessor::RCJob* AddPendingJob(const char* sourceName, AZ::s64 jobRunKey, int priority, const char* orderDependencySourceName = nullptr)
+    {
+        using namespace AssetProcessor;
+
+        RCJob* job = new RCJob(m_rcJobListModel.get());
+        JobDetails jobDetails;
+        jobDetails.m_jobEntry.m_pathRelativeToWatchFolder = jobDetails.m_jobEntry.m_databaseSourceName = sourceName;
+        jobDetails.m_jobEntry.m_platformInfo = { "pc", { "desktop", "renderer" } };
+        jobDetails.m_jobEntry.m_jobKey = "Compile Stuff";
+        jobDetails.m_jobEntry.m_jobRunKey = jobRunKey;
+        jobDetails.m_assetBuilderDesc.m_name = "Test Builder";
+        jobDetails.m_priority = priority;
+        if (orderDependencySourceName)
+        {
+            AssetBuilderSDK::SourceFileDependency sourceFileDependency(orderDependencySourceName, AZ::Uuid::CreateNull());
+            jobDetails.m_jobDependencyList.push_back(JobDependencyInternal(
+                AssetBuilderSDK::JobDependency("Compile Stuff", "pc", AssetBuilderSDK::JobDependencyType::Order, sourceFileDependency)));
+        }
+        job->SetState(RCJob::JobState::pending);
+        job->Init(jobDetails);
+        m_rcQueueSortModel->AddJobIdEntry(job);
+        m_rcJobListModel->addNewJob(job);
+        return job;
+    }
+
+    AZStd::unique_ptr<AssetProcessor::RCJobListModel> m_rcJobListModel;
+    AZStd::unique_ptr<AssetProcessor::RCQueueSortModel> m_rcQueueSortModel;
+};
+
+TEST_F(RCcontrollerTest_Scheduling, GetNextPendingJob_HeadOfDependencyChain_StartsBeforeHigherPriorityJobs)
+{
+    using namespace AssetProcessor;
+
+    // c waits on b which waits on a, so a gates the longest path even though the lone job has the higher priority.
+    RCJob* loneJob = AddPendingJob("lone.txt", 1, 100);
+    RCJob* chainHead = AddPendingJob("a.txt", 2, 0);
+    RCJob* chainMiddle = AddPendingJob("b.txt", 3, 0, "a.txt");
+    AddPendingJob("c.txt", 4, 0, "b.txt");
+
+    EXPECT_EQ(m_rcQueueSortModel->GetNextPendingJob(), chainHead);
+    EXPECT_EQ(chainHead->GetDependentCount(), 1);
+    EXPECT_GT(chainHead->GetDownstreamPathMs(), chainMiddle->GetDownstreamPathMs());
+    EXPECT_EQ(loneJob->GetDownstreamPathMs(), 0);
+}
+
+TEST_F(RCcontrollerTest_Scheduling, GetNextPendingJob_JobHeldBackByAdmission_ReturnsNextReadyJob)
+{
+    using namespace AssetProcessor;
+
+    RCJob* firstJob = AddPendingJob("first.txt", 1, 100);
+    RCJob* secondJob = AddPendingJob("second.txt", 2, 0);
+
+    auto rejectFirstJob = [firstJob](const RCJob* rcJob)
+    {
+        return rcJob != firstJob;
+    };
+    EXPECT_EQ(m_rcQueueSortModel->GetNextPendingJob(), firstJob);
+    EXPECT_EQ(m_rcQueueSortModel->GetNextPendingJob(rejectFirstJob), secondJob);
+}
+
+TEST_F(RCcontrollerTest_Scheduling, GetNextPendingJob_JobHeldBackRepeatedly_ReservesCapacityForIt)
+{
+    using namespace AssetProcessor;
+
+    RCJob* runningJob = AddPendingJob("running.txt", 1, 200);
+    RCJob* largeJob = AddPendingJob("large.txt", 2, 100);
+    for (int smallJobIndex = 0; smallJobIndex < 20; ++smallJobIndex)
+    {
+        AddPendingJob(AZStd::string::format("small%d.txt", smallJobIndex).c_str(), 3 + smallJobIndex, 0);
+    }
+
+    // like a memory budget which only has room for the large job when nothing else runs
+    auto canStartJob = [this, largeJob](const RCJob* rcJob)
+    {
+        return rcJob != largeJob || m_rcJobListModel->jobsInFlight() == 0;
+    };
+
+    ASSERT_EQ(m_rcQueueSortModel->GetNextPendingJob(canStartJob), runningJob);
+    m_rcJobListModel->markAsProcessing(runningJob);
+    m_rcJobListModel->markAsStarted(runningJob);
+
+    // the small jobs go ahead of the large job for a while, then no new job starts until it fits
+    AZStd::vector<RCJob*> startedJobs = { runningJob };
+    RCJob* nextJob = m_rcQueueSortModel->GetNextPendingJob(canStartJob);
+    while (nextJob)
+    {
+        EXPECT_NE(nextJob, largeJob);
+        m_rcJobListModel->markAsProcessing(nextJob);
+        m_rcJobListModel->markAsStarted(nextJob);
+        startedJobs.push_back(nextJob);
+        ASSERT_LT(startedJobs.size(), 20u);
+        nextJob = m_rcQueueSortModel->GetNextPendingJob(canStartJob);
+    }
+    EXPECT_GT(startedJobs.size(), 1u);
+
+    for (RCJob* startedJob : startedJobs)
+    {
+        m_rcJobListModel->markAsCompleted(startedJob);
+    }
+    EXPECT_EQ(m_rcQueueSortModel->GetNextPendingJob(canStartJob), largeJob);
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/tests/AssetProcessorTest.h>
+#include <native/utilities/LocalBuildCache.h>
+#include <native/unittests/UnitTestRunner.h>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+namespace UnitTests
+{
+    using namespace AssetProcessor;
+
+    class LocalBuildCacheTests
+        : public AssetProcessorTest
+    {
+    protected:
+        void SetUp() override
+        {
+            AssetProcessorTest::SetUp();
+            m_root = QDir(m_temporaryDir.path());
+            m_cacheFolder = m_root.absoluteFilePath("LocalBuildCache");
+            m_jobFolder = m_root.absoluteFilePath("job");
+            m_sourceFolder = m_root.absoluteFilePath("source");
+            m_targetFolder = m_root.absoluteFilePath("target");
+        }
+
+        QString ReadFile(const QString& path)
+        {
+            QFile file(path);
+            if (!file.open(QIODevice::ReadOnly))
+            {
+                return QString();
+            }
+            return QString::fromUtf8(file.readAll());
+        }
+
+        QTemporaryDir m_temporaryDir;
+        QDir m_root;
+        QString m_cacheFolder;
+        QString m_jobFolder;
+        QString m_sourceFolder;
+        QString m_targetFolder;
+    };
+
+    TEST_F(LocalBuildCacheTests, StoreAndRetrieve_RestoresJobOutputs)
+    {
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(QDir(m_jobFolder).absoluteFilePath("product.bin"), "product"));
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(QDir(m_jobFolder).absoluteFilePath("subfolder/product2.bin"), "product2"));
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(QDir(m_sourceFolder).absoluteFilePath("copied.txt"), "copied"));
+
+        LocalBuildCache cache(m_cacheFolder, 1024 * 1024);
+        EXPECT_EQ(AZ::Interface<ILocalBuildCacheRequests>::Get(), &cache);
+        ASSERT_TRUE(cache.Store("job1", m_jobFolder, m_sourceFolder, { "copied.txt" }));
+        ASSERT_TRUE(cache.Retrieve("job1", m_targetFolder));
+
+        QDir targetDir(m_targetFolder);
+        EXPECT_EQ(ReadFile(targetDir.absoluteFilePath("product.bin")), "product");
+        EXPECT_EQ(ReadFile(targetDir.absoluteFilePath("subfolder/product2.bin")), "product2");
+        EXPECT_EQ(ReadFile(targetDir.absoluteFilePath("copied.txt")), "copied");
+
+        LocalBuildCacheStatistics statistics = cache.GetStatistics();
+        EXPECT_EQ(statistics.m_hits, 1);
+        EXPECT_EQ(statistics.m_stores, 1);
+        EXPECT_EQ(statistics.m_filesMaterialized, 3);
+    }
+
+    TEST_F(LocalBuildCacheTests, Retrieve_MaterializedFileModified_StoredObjectUnchanged)
+    {
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(QDir(m_jobFolder).absoluteFilePath("product.bin"), "product"));
+
+        LocalBuildCache cache(m_cacheFolder, 1024 * 1024);
+        ASSERT_TRUE(cache.Store("job1", m_jobFolder, m_sourceFolder, {}));
+        ASSERT_TRUE(cache.Retrieve("job1", m_targetFolder));
+
+        // The product is moved into the asset cache, where it may be modified in place
+        const QString productPath = QDir(m_targetFolder).absoluteFilePath("product.bin");
+        QFile productFile(productPath);
+        ASSERT_TRUE(productFile.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        productFile.write("modified");
+        productFile.close();
+
+        const QString otherTargetFolder = m_root.absoluteFilePath("target2");
+        ASSERT_TRUE(cache.Retrieve("job1", otherTargetFolder));
+        EXPECT_EQ(ReadFile(QDir(otherTargetFolder).absoluteFilePath("product.bin")), "product");
+    }
+
+    TEST_F(LocalBuildCacheTests, ComputeInputName_SameContentNewModificationTime_SameName)
+    {
+        const QString inputPath = QDir(m_sourceFolder).absoluteFilePath("input.txt");
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(inputPath, "input"));
+        const QString inputName = LocalBuildCache::ComputeInputName(inputPath);
+        EXPECT_FALSE(inputName.isEmpty());
+
+        // A branch switch rewrites the file with the same content
+        QFile inputFile(inputPath);
+        ASSERT_TRUE(inputFile.open(QIODevice::ReadWrite));
+        ASSERT_TRUE(inputFile.setFileTime(QDateTime::currentDateTimeUtc().addSecs(60), QFileDevice::FileModificationTime));
+        inputFile.close();
+        EXPECT_EQ(LocalBuildCache::ComputeInputName(inputPath), inputName);
+
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(inputPath, "changed"));
+        EXPECT_NE(LocalBuildCache::ComputeInputName(inputPath), inputName);
+    }
+
+    TEST_F(LocalBuildCacheTests, Retrieve_UnknownJob_IsMiss)
+    {
+        LocalBuildCache cache(m_cacheFolder, 1024 * 1024);
+        EXPECT_FALSE(cache.Retrieve("unknown", m_targetFolder));
+        EXPECT_EQ(cache.GetStatistics().m_misses, 1);
+        EXPECT_FALSE(QDir(m_targetFolder).exists());
+    }
+
+    TEST_F(LocalBuildCacheTests, Retrieve_MaterializeFails_LeavesNoJobFiles)
+    {
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(QDir(m_jobFolder).absoluteFilePath("product.bin"), "product"));
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(QDir(m_jobFolder).absoluteFilePath("other/product2.bin"), "product2"));
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(QDir(m_jobFolder).absoluteFilePath("subfolder/product3.bin"), "product3"));
+
+        LocalBuildCache cache(m_cacheFolder, 1024 * 1024);
+        ASSERT_TRUE(cache.Store("job1", m_jobFolder, m_sourceFolder, {}));
+
+        // A file where the job expects a folder makes materializing product3.bin fail.
+        QDir targetDir(m_targetFolder);
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(targetDir.absoluteFilePath("subfolder"), "not a folder"));
+
+        EXPECT_FALSE(cache.Retrieve("job1", m_targetFolder));
+        EXPECT_EQ(cache.GetStatistics().m_misses, 1);
+        EXPECT_FALSE(QFile::exists(targetDir.absoluteFilePath("product.bin")));
+        EXPECT_FALSE(QDir(targetDir.absoluteFilePath("other")).exists());
+        EXPECT_EQ(ReadFile(targetDir.absoluteFilePath("subfolder")), "not a folder");
+    }
+
+    TEST_F(LocalBuildCacheTests, Store_IdenticalContent_IsDeduplicated)
+    {
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(QDir(m_jobFolder).absoluteFilePath("a.bin"), "same content"));
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(QDir(m_jobFolder).absoluteFilePath("b.bin"), "same content"));
+
+        LocalBuildCache cache(m_cacheFolder, 1024 * 1024);
+        ASSERT_TRUE(cache.Store("job1", m_jobFolder, m_sourceFolder, {}));
+        ASSERT_TRUE(cache.Store("job2", m_jobFolder, m_sourceFolder, {}));
+
+        const AZ::u64 contentSize = strlen("same content");
+        LocalBuildCacheStatistics statistics = cache.GetStatistics();
+        EXPECT_EQ(statistics.m_bytesStored, contentSize);
+        EXPECT_EQ(statistics.m_bytesDeduplicated, contentSize * 3);
+        EXPECT_EQ(statistics.m_currentSize, contentSize);
+    }
+
+    TEST_F(LocalBuildCacheTests, Store_OverBudget_EvictsJobsUntilUnderBudget)
+    {
+        const QString firstJobFolder = m_root.absoluteFilePath("job1");
+        const QString secondJobFolder = m_root.absoluteFilePath("job2");
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(QDir(firstJobFolder).absoluteFilePath("product.bin"), QString(64, 'a')));
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(QDir(secondJobFolder).absoluteFilePath("product.bin"), QString(64, 'b')));
+
+        // only one of the two products fits in the budget, storing the second evicts the first
+        LocalBuildCache cache(m_cacheFolder, 100);
+        ASSERT_TRUE(cache.Store("job1", firstJobFolder, m_sourceFolder, {}));
+        ASSERT_TRUE(cache.Store("job2", secondJobFolder, m_sourceFolder, {}));
+
+        LocalBuildCacheStatistics statistics = cache.GetStatistics();
+        EXPECT_EQ(statistics.m_evictedJobs, 1);
+        EXPECT_EQ(statistics.m_evictedBytes, 64);
+        EXPECT_EQ(statistics.m_currentSize, 64);
+        EXPECT_FALSE(cache.Retrieve("job1", m_targetFolder));
+        EXPECT_TRUE(cache.Retrieve("job2", m_targetFolder));
+        EXPECT_EQ(ReadFile(QDir(m_targetFolder).absoluteFilePath("product.bin")), QString(64, 'b'));
+    }
+
+    TEST_F(LocalBuildCacheTests, Constructor_ExistingCache_ReportsCurrentSize)
+    {
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(QDir(m_jobFolder).absoluteFilePath("product.bin"), "product"));
+        {
+            LocalBuildCache cache(m_cacheFolder, 1024 * 1024);
+            ASSERT_TRUE(cache.Store("job1", m_jobFolder, m_sourceFolder, {}));
+        }
+
+        LocalBuildCache reopenedCache(m_cacheFolder, 1024 * 1024);
+        EXPECT_EQ(reopenedCache.GetStatistics().m_currentSize, strlen("product"));
+        EXPECT_TRUE(reopenedCache.Retrieve("job1", m_targetFolder));
+    }
+}
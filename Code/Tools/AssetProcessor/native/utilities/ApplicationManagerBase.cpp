@@ -22,10 +22,14 @@
 #include <native/FileProcessor/FileProcessor.h>
 #include <native/utilities/ApplicationServer.h>
 #include <native/utilities/AssetServerHandler.h>
+#include <native/utilities/LocalBuildCache.h>
 #include <native/InternalBuilders/SettingsRegistryBuilder.h>
 #include <AzToolsFramework/Application/Ticker.h>
 #include <AzToolsFramework/ToolsFileUtils/ToolsFileUtils.h>
 
+#include <AssetProcessor_Traits_Platform.h>
+
+#include <cinttypes>
 #include <iostream>
 
 #include <QCoreApplication>
@@ -280,6 +284,7 @@ void ApplicationManagerBase::InitAssetCatalog()
 void ApplicationManagerBase::InitRCController()
 {
     m_rcController = new AssetProcessor::RCController(m_platformConfiguration->GetMinJobs(), m_platformConfiguration->GetMaxJobs());
+    m_rcController->SetJobLimits(m_platformConfiguration->GetJobMemoryBudgetMB(), m_platformConfiguration->GetBuilderJobLimits());
 
     QObject::connect(m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::AssetToProcess, m_rcController, &AssetProcessor::RCController::JobSubmitted);
     QObject::connect(m_rcController, &AssetProcessor::RCController::FileCompiled, m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::AssetProcessed, Qt::UniqueConnection);
@@ -305,6 +310,15 @@ void ApplicationManagerBase::InitAssetScanner()
     using namespace AssetProcessor;
     m_assetScanner = new AssetScanner(m_platformConfiguration);
 
+    if constexpr (ASSETPROCESSOR_TRAIT_USE_SCAN_JOURNAL)
+    {
+        QDir projectCacheRoot;
+        if (AssetUtilities::ComputeProjectCacheRoot(projectCacheRoot))
+        {
+            m_assetScanner->SetScanJournalPath(projectCacheRoot.absoluteFilePath("AssetScanJournal.dat"));
+        }
+    }
+
     // asset processor manager
     QObject::connect(m_assetScanner, &AssetScanner::AssetScanningStatusChanged, m_assetProcessorManager, &AssetProcessorManager::OnAssetScannerStatusChange);
     QObject::connect(m_assetScanner, &AssetScanner::FilesFound,                 m_assetProcessorManager, &AssetProcessorManager::AssessFilesFromScanner);
@@ -750,6 +764,7 @@ void ApplicationManagerBase::Destroy()
     DestroyConnectionManager();
     DestroyAssetServerHandler();
     DestroyRCController();
+    DestroyLocalBuildCache();
     DestroyAssetScanner();
     DestroyFileMonitor();
     ShutDownAssetDatabase();
@@ -793,6 +808,24 @@ bool ApplicationManagerBase::Run()
     AZ_Printf(AssetProcessor::ConsoleChannel, "Number of Warnings Reported: %d.\n", m_warningCount);
     AZ_Printf(AssetProcessor::ConsoleChannel, "Number of Errors Reported: %d.\n", m_errorCount);
     AZ_Printf(AssetProcessor::ConsoleChannel, "Total Assets Processing Time: %fs\n", allAssetsProcessingTimer.elapsed() / 1000.0f);
+    if (m_rcController)
+    {
+        const AssetProcessor::RCController::CriticalPath& criticalPath = m_rcController->GetCriticalPath();
+        AZ_Printf(AssetProcessor::ConsoleChannel, "Critical Path: %d jobs, Estimated: %fs, Actual: %fs\n",
+            criticalPath.m_jobCount, criticalPath.m_estimatedMs / 1000.0f, criticalPath.m_actualMs / 1000.0f);
+    }
+    if (m_localBuildCache)
+    {
+        const AssetProcessor::LocalBuildCacheStatistics statistics = m_localBuildCache->GetStatistics();
+        const double megabyte = 1024.0 * 1024.0;
+        AZ_Printf(AssetProcessor::ConsoleChannel, "Local Build Cache Hits: %" PRIu64 ", Misses: %" PRIu64 ", Stored Jobs: %" PRIu64 ".\n",
+            statistics.m_hits, statistics.m_misses, statistics.m_stores);
+        AZ_Printf(AssetProcessor::ConsoleChannel, "Local Build Cache Stored: %.2f MB, Deduplicated: %.2f MB, Materialized: %.2f MB (%" PRIu64 " files).\n",
+            statistics.m_bytesStored / megabyte, statistics.m_bytesDeduplicated / megabyte, statistics.m_bytesMaterialized / megabyte,
+            statistics.m_filesMaterialized);
+        AZ_Printf(AssetProcessor::ConsoleChannel, "Local Build Cache Size: %.2f MB, Evicted: %" PRIu64 " jobs (%.2f MB).\n",
+            statistics.m_currentSize / megabyte, statistics.m_evictedJobs, statistics.m_evictedBytes / megabyte);
+    }
     AZ_Printf(AssetProcessor::ConsoleChannel, "Asset Processor Batch Processing Completed.\n");
 
     RemoveOldTempFolders();
@@ -1167,6 +1200,16 @@ void ApplicationManagerBase::DestroyAssetServerHandler()
     m_assetServerHandler = nullptr;
 }
 
+void ApplicationManagerBase::InitLocalBuildCache()
+{
+    m_localBuildCache = AssetProcessor::LocalBuildCache::CreateFromSettings();
+}
+
+void ApplicationManagerBase::DestroyLocalBuildCache()
+{
+    m_localBuildCache.reset();
+}
+
 // IMPLEMENTATION OF -------------- AzToolsFramework::AssetDatabase::AssetDatabaseRequests::Bus::Listener
 bool ApplicationManagerBase::GetAssetDatabaseLocation(AZStd::string& location)
 {
@@ -1251,6 +1294,7 @@ bool ApplicationManagerBase::Activate()
     InitFileMonitor();
     InitAssetScanner();
     InitAssetServerHandler();
+    InitLocalBuildCache();
     InitRCController();
 
     InitConnectionManager();
@@ -40,6 +40,7 @@ namespace AssetProcessor
     class FileStateBase;
     class FileStateCache;
     class InternalAssetBuilderInfo;
+    class LocalBuildCache;
     class PlatformConfiguration;
     class RCController;
     class SettingsRegistryBuilder;
@@ -156,6 +157,8 @@ protected:
     void ShutDownAssetDatabase();
     void InitAssetServerHandler();
     void DestroyAssetServerHandler();
+    void InitLocalBuildCache();
+    void DestroyLocalBuildCache();
     void InitFileProcessor();
     void ShutDownFileProcessor();
     virtual void InitSourceControl() = 0;
@@ -210,6 +213,8 @@ protected:
 
     AZStd::unique_ptr<AssetProcessor::FileStateBase> m_fileStateCache;
 
+    AZStd::unique_ptr<AssetProcessor::LocalBuildCache> m_localBuildCache;
+
     AZStd::unique_ptr<AssetProcessor::FileProcessor> m_fileProcessor;
 
     AZStd::unique_ptr<AssetProcessor::BuilderConfigurationManager> m_builderConfig;
@@ -0,0 +1,648 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/LocalBuildCache.h>
+#include <native/AssetManager/FileStateCache.h>
+#include <native/utilities/AssetUtilEBusHelper.h>
+#include <native/utilities/assetUtils.h>
+#include <native/utilities/PlatformConfiguration.h>
+#include <native/resourcecompiler/rcjob.h>
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/sort.h>
+#include <xxhash/xxhash.h>
+
+#include <QDateTime>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QRandomGenerator>
+#include <QTextStream>
+
+namespace AssetProcessor
+{
+    namespace LocalBuildCacheInternal
+    {
+        static const char* ObjectsFolderName = "objects";
+        static const char* JobsFolderName = "jobs";
+        static const char* ManifestExtension = ".manifest";
+        static const char* ManifestHeader = "LocalBuildCache 1";
+        static constexpr qint64 HashBufferSize = 64 * 1024;
+        static constexpr AZ::u64 DefaultMaxSizeInMB = 20 * 1024;
+        //! Eviction brings the cache down to this percentage of the budget, so that it does not run again on every store.
+        static constexpr AZ::u64 EvictionLowWatermarkPercent = 80;
+
+        QString FormatContentName(AZ::u64 hash, AZ::u64 size)
+        {
+            return QString("%1-%2").arg(hash, 16, 16, QChar('0')).arg(size, 0, 16);
+        }
+
+        //! Objects are named <hash>-<size>, so their size is known without touching the disk.
+        AZ::u64 GetObjectSize(const QString& objectName)
+        {
+            int separator = objectName.lastIndexOf('-');
+            if (separator < 0)
+            {
+                return 0;
+            }
+            bool converted = false;
+            AZ::u64 size = objectName.mid(separator + 1).toULongLong(&converted, 16);
+            return converted ? size : 0;
+        }
+
+        QString NormalizeRelativePath(QString relativePath)
+        {
+            relativePath = QDir::fromNativeSeparators(relativePath);
+            while (relativePath.startsWith('/'))
+            {
+                relativePath.remove(0, 1);
+            }
+            return QDir::cleanPath(relativePath);
+        }
+    }
+
+    AZStd::unique_ptr<LocalBuildCache> LocalBuildCache::CreateFromSettings()
+    {
+        auto settingsRegistry = AZ::SettingsRegistry::Get();
+        if (!settingsRegistry)
+        {
+            return nullptr;
+        }
+
+        const auto localBuildCacheKey = AZ::SettingsRegistryInterface::FixedValueString(AssetProcessor::AssetProcessorSettingsKey) + "/LocalBuildCache";
+
+        bool enabled = false;
+        settingsRegistry->Get(enabled, localBuildCacheKey + "/enabled");
+        if (!enabled)
+        {
+            return nullptr;
+        }
+
+        AZStd::string cacheFolder;
+        if (!settingsRegistry->Get(cacheFolder, localBuildCacheKey + "/path") || cacheFolder.empty())
+        {
+            QDir projectCacheRoot;
+            if (!AssetUtilities::ComputeProjectCacheRoot(projectCacheRoot))
+            {
+                AZ_Warning(AssetProcessor::ConsoleChannel, false, "Local build cache is enabled but the project cache root could not be computed. The local build cache is disabled.\n");
+                return nullptr;
+            }
+            cacheFolder = projectCacheRoot.absoluteFilePath("LocalBuildCache").toUtf8().constData();
+        }
+
+        AZ::u64 maxSizeInMB = LocalBuildCacheInternal::DefaultMaxSizeInMB;
+        settingsRegistry->Get(maxSizeInMB, localBuildCacheKey + "/maxSizeMB");
+
+        AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Local build cache: %s (budget %" PRIu64 " MB)\n", cacheFolder.c_str(), maxSizeInMB);
+        return AZStd::make_unique<LocalBuildCache>(QString::fromUtf8(cacheFolder.c_str()), maxSizeInMB * 1024 * 1024);
+    }
+
+    LocalBuildCache::LocalBuildCache(const QString& cacheFolder, AZ::u64 maxSizeInBytes)
+        : m_cacheFolder(QDir::cleanPath(cacheFolder))
+        , m_maxSizeInBytes(maxSizeInBytes)
+    {
+        QDir cacheDir(m_cacheFolder);
+        cacheDir.mkpath(LocalBuildCacheInternal::ObjectsFolderName);
+        cacheDir.mkpath(LocalBuildCacheInternal::JobsFolderName);
+
+        ComputeCurrentSize();
+
+        AZ::Interface<ILocalBuildCacheRequests>::Register(this);
+    }
+
+    LocalBuildCache::~LocalBuildCache()
+    {
+        AZ::Interface<ILocalBuildCacheRequests>::Unregister(this);
+    }
+
+    QString LocalBuildCache::ComputeJobKey(const BuilderParams& builderParams)
+    {
+        const JobDetails& jobDetails = builderParams.m_rcJob->GetJobDetails();
+        const JobEntry& jobEntry = jobDetails.m_jobEntry;
+        const AssetBuilderSDK::JobDescriptor& jobDescriptor = builderParams.m_processJobRequest.m_jobDescription;
+
+        // The job identity, the builder version and the parameters of the job, as covered by its fingerprint
+        AZStd::string keyString = AZStd::string::format("%s|%s|%s|%s|%s",
+            jobEntry.m_databaseSourceName.toUtf8().constData(),
+            jobEntry.m_platformInfo.m_identifier.c_str(),
+            jobEntry.m_jobKey.toUtf8().constData(),
+            jobEntry.m_builderGuid.ToString<AZStd::string>().c_str(),
+            jobDetails.m_extraInformationForFingerprinting.c_str());
+
+        // job parameters are stored in an unordered map, sort them so the key is stable
+        AZStd::vector<AZStd::pair<AZ::u32, AZStd::string>> jobParameters(jobDescriptor.m_jobParameters.begin(), jobDescriptor.m_jobParameters.end());
+        AZStd::sort(jobParameters.begin(), jobParameters.end());
+        for (const auto& jobParameter : jobParameters)
+        {
+            keyString.append(AZStd::string::format("|%u=%s", jobParameter.first, jobParameter.second.c_str()));
+        }
+
+        // The fingerprint covers the modification times of the input files, which a branch switch changes even when it restores
+        // the same content, so key on the content of the inputs instead.
+        for (const auto& fingerprintFile : jobDetails.m_fingerprintFiles)
+        {
+            const QString inputName = ComputeInputName(QString::fromUtf8(fingerprintFile.first.c_str()));
+            keyString.append(AZStd::string::format("|%s:%s", inputName.isEmpty() ? "-" : inputName.toUtf8().constData(), fingerprintFile.second.c_str()));
+        }
+
+        // Jobs this one depends on are keyed by the key computed for them when they were processed, the fingerprint of the ones
+        // which were up to date is stable as their inputs have not changed.
+        for (const JobDependencyInternal& jobDependencyInternal : jobDetails.m_jobDependencyList)
+        {
+            if (jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce)
+            {
+                continue;
+            }
+            const JobDesc jobDesc(jobDependencyInternal.m_jobDependency.m_sourceFile.m_sourceFileDependencyPath,
+                jobDependencyInternal.m_jobDependency.m_jobKey, jobDependencyInternal.m_jobDependency.m_platformIdentifier);
+            for (const AZ::Uuid& builderUuid : jobDependencyInternal.m_builderUuidList)
+            {
+                const JobIndentifier jobIdentifier(jobDesc, builderUuid);
+                QString dependencyKey;
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(m_jobKeysMutex);
+                    auto jobKeyIter = m_jobKeys.find(jobIdentifier);
+                    if (jobKeyIter != m_jobKeys.end())
+                    {
+                        dependencyKey = jobKeyIter->second;
+                    }
+                }
+                if (dependencyKey.isEmpty())
+                {
+                    AZ::u32 dependentJobFingerprint = 0;
+                    ProcessingJobInfoBus::BroadcastResult(dependentJobFingerprint, &ProcessingJobInfoBusTraits::GetJobFingerprint, jobIdentifier);
+                    dependencyKey = QString::number(dependentJobFingerprint);
+                }
+                keyString.append(AZStd::string::format("|%s", dependencyKey.toUtf8().constData()));
+            }
+        }
+
+        AZ::Sha1 sha;
+        sha.ProcessBytes(keyString.data(), keyString.size());
+        AZ::u32 digest[5];
+        sha.GetDigest(digest);
+
+        QString jobKey;
+        for (AZ::u32 digestPart : digest)
+        {
+            jobKey.append(QString("%1").arg(digestPart, 8, 16, QChar('0')));
+        }
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_jobKeysMutex);
+            m_jobKeys[JobIndentifier(JobDesc(jobEntry.m_databaseSourceName.toUtf8().constData(), jobEntry.m_jobKey.toUtf8().constData(),
+                jobEntry.m_platformInfo.m_identifier), jobEntry.m_builderGuid)] = jobKey;
+        }
+        return jobKey;
+    }
+
+    bool LocalBuildCache::RetrieveJobResult(const BuilderParams& builderParams)
+    {
+        const QString jobKey = ComputeJobKey(builderParams);
+        if (!Retrieve(jobKey, QString::fromUtf8(builderParams.m_processJobRequest.m_tempDirPath.c_str())))
+        {
+            return false;
+        }
+
+        AZ_TracePrintf(AssetProcessor::DebugChannel, "Retrieved job (%s, %s, %s) with fingerprint (%u) from the local build cache.\n",
+            builderParams.m_rcJob->GetJobEntry().m_pathRelativeToWatchFolder.toUtf8().data(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+            builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_rcJob->GetOriginalFingerprint());
+        return true;
+    }
+
+    bool LocalBuildCache::StoreJobResult(const BuilderParams& builderParams, const AZStd::vector<AZStd::string>& sourceFileList)
+    {
+        QFileInfo sourceFile(builderParams.m_rcJob->GetJobEntry().GetAbsoluteSourcePath());
+        const QString jobKey = ComputeJobKey(builderParams);
+        bool success = Store(jobKey, QString::fromUtf8(builderParams.m_processJobRequest.m_tempDirPath.c_str()), sourceFile.absolutePath(), sourceFileList);
+
+        AZ_Warning(AssetProcessor::DebugChannel, success, "Unable to store job (%s, %s, %s) with fingerprint (%u) in the local build cache.\n",
+            builderParams.m_rcJob->GetJobEntry().m_pathRelativeToWatchFolder.toUtf8().data(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+            builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_rcJob->GetOriginalFingerprint());
+        return success;
+    }
+
+    LocalBuildCacheStatistics LocalBuildCache::GetStatistics() const
+    {
+        LocalBuildCacheStatistics statistics;
+        statistics.m_hits = m_hits;
+        statistics.m_misses = m_misses;
+        statistics.m_stores = m_stores;
+        statistics.m_bytesStored = m_bytesStored;
+        statistics.m_bytesDeduplicated = m_bytesDeduplicated;
+        statistics.m_bytesMaterialized = m_bytesMaterialized;
+        statistics.m_filesMaterialized = m_filesMaterialized;
+        statistics.m_evictedJobs = m_evictedJobs;
+        statistics.m_evictedBytes = m_evictedBytes;
+        statistics.m_currentSize = m_currentSize;
+        return statistics;
+    }
+
+    bool LocalBuildCache::Store(const QString& jobKey, const QString& jobOutputFolder, const QString& sourceFolder, const AZStd::vector<AZStd::string>& sourceFileList)
+    {
+        AZStd::vector<ManifestEntry> entries;
+        QDir outputDir(jobOutputFolder);
+
+        QDirIterator outputIterator(jobOutputFolder, QDir::Files | QDir::Hidden | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+        while (outputIterator.hasNext())
+        {
+            const QString absoluteFilePath = outputIterator.next();
+            ManifestEntry entry;
+            entry.m_relativePath = LocalBuildCacheInternal::NormalizeRelativePath(outputDir.relativeFilePath(absoluteFilePath));
+            if (!AddObject(absoluteFilePath, entry.m_objectName))
+            {
+                return false;
+            }
+            entries.push_back(entry);
+        }
+
+        // Products copied from next to the source file never went through the temp folder, they are materialized
+        // back into the temp folder at the same relative path, which is where the stored job response expects them.
+        QDir sourceDir(sourceFolder);
+        for (const AZStd::string& sourceFile : sourceFileList)
+        {
+            ManifestEntry entry;
+            entry.m_relativePath = LocalBuildCacheInternal::NormalizeRelativePath(QString::fromUtf8(sourceFile.c_str()));
+            if (!AddObject(sourceDir.absoluteFilePath(entry.m_relativePath), entry.m_objectName))
+            {
+                return false;
+            }
+            entries.push_back(entry);
+        }
+
+        if (!WriteManifest(GetManifestPath(jobKey), entries))
+        {
+            return false;
+        }
+
+        ++m_stores;
+
+        if (m_currentSize > m_maxSizeInBytes)
+        {
+            // The job just stored is the most recently used, keep it even when a tie in modification times sorts it first
+            EvictToSize(m_maxSizeInBytes * LocalBuildCacheInternal::EvictionLowWatermarkPercent / 100, jobKey);
+        }
+        return true;
+    }
+
+    bool LocalBuildCache::Retrieve(const QString& jobKey, const QString& targetFolder)
+    {
+        const QString manifestPath = GetManifestPath(jobKey);
+        AZStd::vector<ManifestEntry> entries;
+        if (!ReadManifest(manifestPath, entries))
+        {
+            ++m_misses;
+            return false;
+        }
+
+        // Validate the whole job before touching the target folder, objects may have been evicted since the manifest was written.
+        for (const ManifestEntry& entry : entries)
+        {
+            if (!QFile::exists(GetObjectPath(entry.m_objectName)))
+            {
+                AZ_TracePrintf(AssetProcessor::DebugChannel, "Local build cache entry %s references missing object %s, discarding it.\n",
+                    jobKey.toUtf8().constData(), entry.m_objectName.toUtf8().constData());
+                QFile::remove(manifestPath);
+                ++m_misses;
+                return false;
+            }
+        }
+
+        QDir targetDir(targetFolder);
+        const bool targetFolderExisted = targetDir.exists();
+        QStringList materializedPaths;
+        for (const ManifestEntry& entry : entries)
+        {
+            const QString targetPath = targetDir.absoluteFilePath(entry.m_relativePath);
+            materializedPaths.append(targetPath);
+            if (!MaterializeObject(entry.m_objectName, targetPath))
+            {
+                // The job is processed in the target folder after a miss, so none of this job's files can be left there.
+                RemoveMaterializedFiles(targetFolder, targetFolderExisted, materializedPaths);
+                ++m_misses;
+                return false;
+            }
+        }
+
+        // The modification time of the manifest is what the LRU eviction orders by.
+        QFile manifestFile(manifestPath);
+        if (manifestFile.open(QIODevice::ReadWrite))
+        {
+            manifestFile.setFileTime(QDateTime::currentDateTimeUtc(), QFileDevice::FileModificationTime);
+        }
+
+        ++m_hits;
+        return true;
+    }
+
+    void LocalBuildCache::EvictToSize(AZ::u64 maxSizeInBytes, const QString& keepJobKey)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_evictionMutex);
+        if (m_currentSize <= maxSizeInBytes)
+        {
+            return;
+        }
+
+        struct ManifestInfo
+        {
+            QString m_path;
+            QDateTime m_lastUsed;
+            AZStd::vector<ManifestEntry> m_entries;
+        };
+
+        AZStd::vector<ManifestInfo> manifests;
+        QHash<QString, int> objectReferenceCounts;
+
+        QDir jobsDir(QDir(m_cacheFolder).absoluteFilePath(LocalBuildCacheInternal::JobsFolderName));
+        const QFileInfoList manifestFiles = jobsDir.entryInfoList({ QString("*") + LocalBuildCacheInternal::ManifestExtension }, QDir::Files);
+        manifests.reserve(manifestFiles.size());
+        for (const QFileInfo& manifestFile : manifestFiles)
+        {
+            ManifestInfo info;
+            info.m_path = manifestFile.absoluteFilePath();
+            info.m_lastUsed = manifestFile.lastModified();
+            if (!ReadManifest(info.m_path, info.m_entries))
+            {
+                continue;
+            }
+            for (const ManifestEntry& entry : info.m_entries)
+            {
+                ++objectReferenceCounts[entry.m_objectName];
+            }
+
+            // The kept job still references its objects, so it is counted but never evicted
+            if (manifestFile.completeBaseName() != keepJobKey)
+            {
+                manifests.push_back(AZStd::move(info));
+            }
+        }
+
+        AZStd::sort(manifests.begin(), manifests.end(), [](const ManifestInfo& lhs, const ManifestInfo& rhs)
+        {
+            return lhs.m_lastUsed < rhs.m_lastUsed;
+        });
+
+        for (const ManifestInfo& manifest : manifests)
+        {
+            if (m_currentSize <= maxSizeInBytes)
+            {
+                break;
+            }
+
+            QFile::remove(manifest.m_path);
+            ++m_evictedJobs;
+
+            for (const ManifestEntry& entry : manifest.m_entries)
+            {
+                auto referenceCount = objectReferenceCounts.find(entry.m_objectName);
+                if (referenceCount == objectReferenceCounts.end() || --referenceCount.value() > 0)
+                {
+                    continue;
+                }
+                objectReferenceCounts.erase(referenceCount);
+
+                if (QFile::remove(GetObjectPath(entry.m_objectName)))
+                {
+                    const AZ::u64 objectSize = LocalBuildCacheInternal::GetObjectSize(entry.m_objectName);
+                    m_currentSize -= AZStd::min<AZ::u64>(objectSize, m_currentSize);
+                    m_evictedBytes += objectSize;
+                }
+            }
+        }
+    }
+
+    QString LocalBuildCache::ComputeObjectName(const QString& absoluteFilePath)
+    {
+        QFile file(absoluteFilePath);
+        if (!file.open(QIODevice::ReadOnly))
+        {
+            return QString();
+        }
+
+        XXH64_state_t* state = XXH64_createState();
+        if (!state)
+        {
+            return QString();
+        }
+        XXH64_reset(state, 0);
+
+        char buffer[LocalBuildCacheInternal::HashBufferSize];
+        qint64 totalBytesRead = 0;
+        qint64 bytesRead = 0;
+        while ((bytesRead = file.read(buffer, sizeof(buffer))) > 0)
+        {
+            XXH64_update(state, buffer, bytesRead);
+            totalBytesRead += bytesRead;
+        }
+        const AZ::u64 hash = XXH64_digest(state);
+        XXH64_freeState(state);
+
+        if (bytesRead < 0)
+        {
+            return QString();
+        }
+
+        return LocalBuildCacheInternal::FormatContentName(hash, static_cast<AZ::u64>(totalBytesRead));
+    }
+
+    QString LocalBuildCache::ComputeInputName(const QString& absoluteFilePath)
+    {
+        // The file state cache hashes files when file hashing is enabled, only read the file here when it has no hash
+        IFileStateRequests* fileStateInterface = AZ::Interface<IFileStateRequests>::Get();
+        FileStateInfo fileStateInfo;
+        IFileStateRequests::FileHash hash = 0;
+        if (fileStateInterface && fileStateInterface->GetFileInfo(absoluteFilePath, &fileStateInfo)
+            && fileStateInterface->GetHash(absoluteFilePath, &hash) && (hash != 0))
+        {
+            return LocalBuildCacheInternal::FormatContentName(hash, static_cast<AZ::u64>(fileStateInfo.m_fileSize));
+        }
+        return ComputeObjectName(absoluteFilePath);
+    }
+
+    QString LocalBuildCache::GetManifestPath(const QString& jobKey) const
+    {
+        return QString("%1/%2/%3%4").arg(m_cacheFolder, LocalBuildCacheInternal::JobsFolderName, jobKey, LocalBuildCacheInternal::ManifestExtension);
+    }
+
+    QString LocalBuildCache::GetObjectPath(const QString& objectName) const
+    {
+        // fan out over 256 folders to keep directory sizes reasonable
+        return QString("%1/%2/%3/%4").arg(m_cacheFolder, LocalBuildCacheInternal::ObjectsFolderName, objectName.left(2), objectName);
+    }
+
+    bool LocalBuildCache::ReadManifest(const QString& manifestPath, AZStd::vector<ManifestEntry>& entries) const
+    {
+        QFile manifestFile(manifestPath);
+        if (!manifestFile.open(QIODevice::ReadOnly | QIODevice::Text))
+        {
+            return false;
+        }
+
+        QTextStream stream(&manifestFile);
+        stream.setCodec("UTF-8");
+        if (stream.readLine() != LocalBuildCacheInternal::ManifestHeader)
+        {
+            return false;
+        }
+
+        while (!stream.atEnd())
+        {
+            const QString line = stream.readLine();
+            const int separator = line.indexOf('\t');
+            if (separator <= 0)
+            {
+                return false;
+            }
+            entries.push_back({ line.left(separator), line.mid(separator + 1) });
+        }
+        return true;
+    }
+
+    bool LocalBuildCache::WriteManifest(const QString& manifestPath, const AZStd::vector<ManifestEntry>& entries) const
+    {
+        // write to a unique file first and rename it, so readers never see a partially written manifest
+        const QString stagingPath = QString("%1.%2.tmp").arg(manifestPath).arg(QRandomGenerator::global()->generate64(), 0, 16);
+        {
+            QFile manifestFile(stagingPath);
+            if (!manifestFile.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+            {
+                return false;
+            }
+
+            QTextStream stream(&manifestFile);
+            stream.setCodec("UTF-8");
+            stream << LocalBuildCacheInternal::ManifestHeader << "\n";
+            for (const ManifestEntry& entry : entries)
+            {
+                stream << entry.m_objectName << "\t" << entry.m_relativePath << "\n";
+            }
+            stream.flush();
+            if (stream.status() != QTextStream::Ok)
+            {
+                manifestFile.close();
+                QFile::remove(stagingPath);
+                return false;
+            }
+        }
+
+        QFile::remove(manifestPath);
+        if (!QFile::rename(stagingPath, manifestPath))
+        {
+            QFile::remove(stagingPath);
+            return false;
+        }
+        return true;
+    }
+
+    bool LocalBuildCache::AddObject(const QString& absoluteFilePath, QString& objectName)
+    {
+        objectName = ComputeObjectName(absoluteFilePath);
+        if (objectName.isEmpty())
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Local build cache could not read %s.\n", absoluteFilePath.toUtf8().constData());
+            return false;
+        }
+
+        const AZ::u64 objectSize = LocalBuildCacheInternal::GetObjectSize(objectName);
+        const QString objectPath = GetObjectPath(objectName);
+        if (QFile::exists(objectPath))
+        {
+            m_bytesDeduplicated += objectSize;
+            return true;
+        }
+
+        QDir().mkpath(QFileInfo(objectPath).absolutePath());
+
+        // Several jobs can produce the same content concurrently, stage the copy under a unique name and rename it into place.
+        const QString stagingPath = QString("%1.%2.tmp").arg(objectPath).arg(QRandomGenerator::global()->generate64(), 0, 16);
+        if (!QFile::copy(absoluteFilePath, stagingPath))
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Local build cache could not copy %s to %s.\n", absoluteFilePath.toUtf8().constData(), stagingPath.toUtf8().constData());
+            return false;
+        }
+
+        if (!QFile::rename(stagingPath, objectPath))
+        {
+            QFile::remove(stagingPath);
+            if (!QFile::exists(objectPath))
+            {
+                return false;
+            }
+            // another job stored the same content first
+            m_bytesDeduplicated += objectSize;
+            return true;
+        }
+
+        m_currentSize += objectSize;
+        m_bytesStored += objectSize;
+        return true;
+    }
+
+    void LocalBuildCache::RemoveMaterializedFiles(const QString& targetFolder, bool targetFolderExisted, const QStringList& materializedPaths)
+    {
+        if (!targetFolderExisted)
+        {
+            QDir(targetFolder).removeRecursively();
+            return;
+        }
+
+        const QString targetFolderPath = QDir(targetFolder).absolutePath();
+        for (const QString& materializedPath : materializedPaths)
+        {
+            QFile::remove(materializedPath);
+
+            // Remove the subfolders created for the file, rmdir leaves the ones which still have other files.
+            QDir parentDir = QFileInfo(materializedPath).absoluteDir();
+            while (parentDir.absolutePath().startsWith(targetFolderPath + '/') && QDir().rmdir(parentDir.absolutePath()))
+            {
+                parentDir.cdUp();
+            }
+        }
+    }
+
+    bool LocalBuildCache::MaterializeObject(const QString& objectName, const QString& targetPath)
+    {
+        const QString objectPath = GetObjectPath(objectName);
+        QDir().mkpath(QFileInfo(targetPath).absolutePath());
+        QFile::remove(targetPath);
+
+        // Products are moved from the job folder into the asset cache, where tools may modify them in place, so they must never
+        // share storage with the object store as a hard link would.
+        if (!QFile::copy(objectPath, targetPath))
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Local build cache could not materialize %s at %s.\n", objectPath.toUtf8().constData(), targetPath.toUtf8().constData());
+            return false;
+        }
+
+        ++m_filesMaterialized;
+        m_bytesMaterialized += LocalBuildCacheInternal::GetObjectSize(objectName);
+        return true;
+    }
+
+    void LocalBuildCache::ComputeCurrentSize()
+    {
+        AZ::u64 currentSize = 0;
+        QDirIterator objectIterator(QDir(m_cacheFolder).absoluteFilePath(LocalBuildCacheInternal::ObjectsFolderName), QDir::Files, QDirIterator::Subdirectories);
+        while (objectIterator.hasNext())
+        {
+            objectIterator.next();
+            const QString fileName = objectIterator.fileName();
+            if (fileName.endsWith(".tmp"))
+            {
+                // left over from an interrupted store
+                QFile::remove(objectIterator.filePath());
+                continue;
+            }
+            currentSize += LocalBuildCacheInternal::GetObjectSize(fileName);
+        }
+        m_currentSize = currentSize;
+    }
+} // namespace AssetProcessor
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <native/assetprocessor.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <QString>
+#include <QStringList>
+
+namespace AssetProcessor
+{
+    struct BuilderParams;
+
+    //! Snapshot of the local build cache counters, reported in the batch summary.
+    struct LocalBuildCacheStatistics
+    {
+        AZ::u64 m_hits = 0;
+        AZ::u64 m_misses = 0;
+        AZ::u64 m_stores = 0;
+        AZ::u64 m_bytesStored = 0;         //!< bytes of new content written to the object store
+        AZ::u64 m_bytesDeduplicated = 0;   //!< bytes that were already present in the object store when storing
+        AZ::u64 m_bytesMaterialized = 0;   //!< bytes placed into job folders on a cache hit
+        AZ::u64 m_filesMaterialized = 0;   //!< files copied into job folders on a cache hit
+        AZ::u64 m_evictedJobs = 0;
+        AZ::u64 m_evictedBytes = 0;
+        AZ::u64 m_currentSize = 0;
+    };
+
+    struct ILocalBuildCacheRequests
+    {
+        AZ_RTTI(ILocalBuildCacheRequests, "{6C1A9E7F-3A55-4F0B-9A8D-0E2C4B7D51A3}");
+
+        ILocalBuildCacheRequests() = default;
+        virtual ~ILocalBuildCacheRequests() = default;
+
+        //! Materializes the stored outputs of a job with the same fingerprint into the temp folder of the job.
+        //! Returns false on a cache miss, in which case the temp folder is left untouched.
+        virtual bool RetrieveJobResult(const BuilderParams& builderParams) = 0;
+        //! Stores the contents of the temp folder of the job, plus any product that was copied from next to the source file,
+        //! under the fingerprint of the job.
+        virtual bool StoreJobResult(const BuilderParams& builderParams, const AZStd::vector<AZStd::string>& sourceFileList) = 0;
+        virtual LocalBuildCacheStatistics GetStatistics() const = 0;
+
+        AZ_DISABLE_COPY_MOVE(ILocalBuildCacheRequests);
+    };
+
+    //! LocalBuildCache is a content-addressed cache of job outputs on the local machine.
+    //! Jobs are keyed by the builder version and parameters plus the content of every input file and job dependency,
+    //! rather than by their fingerprint, which covers modification times. Switching back to a previously built branch
+    //! touches every file it changes, yet reuses the outputs instead of processing the sources again.
+    //! Outputs are materialized as copies, so the products moved into the asset cache never share storage with the cache.
+    //! Layout of the cache folder:
+    //!   objects/<xx>/<content hash>-<size>   deduplicated file contents
+    //!   jobs/<job key>.manifest              list of (object, path relative to the job temp folder)
+    //! Least recently used manifests are evicted once the object store grows past the configured budget, followed by
+    //! any object no longer referenced by a manifest.
+    class LocalBuildCache final
+        : public ILocalBuildCacheRequests
+    {
+    public:
+        //! Creates the cache described by the settings registry, or returns nullptr when it is disabled.
+        static AZStd::unique_ptr<LocalBuildCache> CreateFromSettings();
+
+        LocalBuildCache(const QString& cacheFolder, AZ::u64 maxSizeInBytes);
+        ~LocalBuildCache() override;
+
+        //! Computes the key a job is stored under, and remembers it as the key of the job for the jobs depending on it.
+        QString ComputeJobKey(const BuilderParams& builderParams);
+
+        // ILocalBuildCacheRequests overrides
+        bool RetrieveJobResult(const BuilderParams& builderParams) override;
+        bool StoreJobResult(const BuilderParams& builderParams, const AZStd::vector<AZStd::string>& sourceFileList) override;
+        LocalBuildCacheStatistics GetStatistics() const override;
+
+        //! Stores every file under jobOutputFolder, plus sourceFileList (relative to sourceFolder), as the job jobKey.
+        bool Store(const QString& jobKey, const QString& jobOutputFolder, const QString& sourceFolder, const AZStd::vector<AZStd::string>& sourceFileList);
+        //! Materializes the job jobKey into targetFolder.  Returns false if the job is unknown or any of its objects is missing,
+        //! in which case none of the job's files are left in targetFolder.
+        bool Retrieve(const QString& jobKey, const QString& targetFolder);
+        //! Evicts least recently used jobs, other than keepJobKey, until the object store is below maxSizeInBytes.
+        void EvictToSize(AZ::u64 maxSizeInBytes, const QString& keepJobKey = QString());
+
+        //! Content address of a file, or an empty string if it could not be read.
+        static QString ComputeObjectName(const QString& absoluteFilePath);
+        //! Content address of an input file, using the hash held by the file state cache when it has one.
+        static QString ComputeInputName(const QString& absoluteFilePath);
+
+    private:
+        struct ManifestEntry
+        {
+            QString m_objectName;
+            QString m_relativePath;
+        };
+
+        QString GetManifestPath(const QString& jobKey) const;
+        QString GetObjectPath(const QString& objectName) const;
+        bool ReadManifest(const QString& manifestPath, AZStd::vector<ManifestEntry>& entries) const;
+        bool WriteManifest(const QString& manifestPath, const AZStd::vector<ManifestEntry>& entries) const;
+        //! Adds the file to the object store if its content is not already there.
+        bool AddObject(const QString& absoluteFilePath, QString& objectName);
+        //! Places a copy of the object at targetPath.
+        bool MaterializeObject(const QString& objectName, const QString& targetPath);
+        //! Undoes a partial Retrieve(), removing the materialized files and the folders created for them.
+        void RemoveMaterializedFiles(const QString& targetFolder, bool targetFolderExisted, const QStringList& materializedPaths);
+        void ComputeCurrentSize();
+
+        QString m_cacheFolder;
+        AZ::u64 m_maxSizeInBytes = 0;
+
+        AZStd::mutex m_evictionMutex;
+
+        //! Keys of the jobs computed so far, which jobs depending on them key on instead of their fingerprint
+        AZStd::mutex m_jobKeysMutex;
+        AZStd::unordered_map<JobIndentifier, QString> m_jobKeys;
+        AZStd::atomic<AZ::u64> m_currentSize{ 0 };
+
+        AZStd::atomic<AZ::u64> m_hits{ 0 };
+        AZStd::atomic<AZ::u64> m_misses{ 0 };
+        AZStd::atomic<AZ::u64> m_stores{ 0 };
+        AZStd::atomic<AZ::u64> m_bytesStored{ 0 };
+        AZStd::atomic<AZ::u64> m_bytesDeduplicated{ 0 };
+        AZStd::atomic<AZ::u64> m_bytesMaterialized{ 0 };
+        AZStd::atomic<AZ::u64> m_filesMaterialized{ 0 };
+        AZStd::atomic<AZ::u64> m_evictedJobs{ 0 };
+        AZStd::atomic<AZ::u64> m_evictedBytes{ 0 };
+    };
+} // namespace AssetProcessor
@@ -95,6 +95,30 @@ namespace AssetProcessor
         AZStd::stack<AZStd::string> m_platformIdentifierStack;
     };
 
+    //! Reads the Jobs/Builders section, where each builder name maps to an object of limits
+    struct BuilderJobLimitsVisitor
+        : AZ::SettingsRegistryInterface::Visitor
+    {
+        using AZ::SettingsRegistryInterface::Visitor::Visit;
+        void Visit(AZStd::string_view path, AZStd::string_view valueName, AZ::SettingsRegistryInterface::Type, AZ::s64 value) override
+        {
+            // the path is ".../Builders/<builder name>/<valueName>"
+            AZStd::string_view builderPath = path.substr(0, path.size() - valueName.size() - 1);
+            AZStd::string builderName{ builderPath.substr(builderPath.rfind('/') + 1) };
+
+            if (valueName == "maxConcurrentJobs")
+            {
+                m_builderJobLimits[builderName].m_maxConcurrentJobs = aznumeric_cast<int>(AZStd::max<AZ::s64>(value, 0));
+            }
+            else if (valueName == "memoryMB")
+            {
+                m_builderJobLimits[builderName].m_memoryMB = aznumeric_cast<AZ::u64>(AZStd::max<AZ::s64>(value, 0));
+            }
+        }
+
+        AZStd::unordered_map<AZStd::string, BuilderJobLimits> m_builderJobLimits;
+    };
+
     struct MetaDataTypesVisitor
         : AZ::SettingsRegistryInterface::Visitor
     {
@@ -1020,6 +1044,19 @@ namespace AssetProcessor
             m_maxJobs = aznumeric_cast<int>(jobCount);
         }
 
+        AZ::s64 memoryBudgetMB = 0;
+        if (settingsRegistry->Get(memoryBudgetMB, AZ::SettingsRegistryInterface::FixedValueString(AssetProcessorSettingsKey) + "/Jobs/memoryBudgetMB"))
+        {
+            m_jobMemoryBudgetMB = aznumeric_cast<AZ::u64>(AZStd::max<AZ::s64>(memoryBudgetMB, 0));
+        }
+
+        BuilderJobLimitsVisitor builderJobLimitsVisitor;
+        settingsRegistry->Visit(builderJobLimitsVisitor, AZ::SettingsRegistryInterface::FixedValueString(AssetProcessorSettingsKey) + "/Jobs/Builders");
+        for (auto& builderJobLimits : builderJobLimitsVisitor.m_builderJobLimits)
+        {
+            m_builderJobLimits[builderJobLimits.first] = builderJobLimits.second;
+        }
+
         if (!skipScanFolders)
         {
             ScanFolderVisitor visitor;
@@ -1505,6 +1542,16 @@ namespace AssetProcessor
         return m_maxJobs;
     }
 
+    AZ::u64 PlatformConfiguration::GetJobMemoryBudgetMB() const
+    {
+        return m_jobMemoryBudgetMB;
+    }
+
+    const AZStd::unordered_map<AZStd::string, BuilderJobLimits>& PlatformConfiguration::GetBuilderJobLimits() const
+    {
+        return m_builderJobLimits;
+    }
+
     void PlatformConfiguration::AddGemScanFolders(const AZStd::vector<AzFramework::GemInfo>& gemInfoList)
     {
         int gemOrder = g_gemStartingOrder;
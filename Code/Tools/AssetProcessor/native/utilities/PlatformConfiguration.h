@@ -19,9 +19,11 @@
 #include <QSet>
 
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/string/string.h>
 #include <native/utilities/assetUtils.h>
 #include <native/AssetManager/assetScanFolderInfo.h>
+#include <native/resourcecompiler/RCCommon.h>
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
 #include <AzToolsFramework/Asset/AssetUtils.h>
 #endif
@@ -225,6 +227,11 @@ namespace AssetProcessor
         int GetMinJobs() const;
         int GetMaxJobs() const;
 
+        //! Gets the cap on the summed memory of the jobs running at once, 0 means no cap
+        AZ::u64 GetJobMemoryBudgetMB() const;
+        //! Gets the resource limits of the builders that have some, by builder name
+        const AZStd::unordered_map<AZStd::string, BuilderJobLimits>& GetBuilderJobLimits() const;
+
         //! Return how many scan folders there are
         int GetScanFolderCount() const;
 
@@ -341,6 +348,8 @@ namespace AssetProcessor
 
         int m_minJobs = 1;
         int m_maxJobs = 3;
+        AZ::u64 m_jobMemoryBudgetMB = 0;
+        AZStd::unordered_map<AZStd::string, BuilderJobLimits> m_builderJobLimits;
 
         // used only during file read, keeps the total running list of all the enabled platforms from all config files and command lines
         AZStd::vector<AZStd::string> m_tempEnabledPlatforms;
@@ -11,6 +11,7 @@
 #include <Processing/ImageFlags.h>
 #include <Processing/ImageObjectImpl.h>
 #include <Processing/ImageToProcess.h>
+#include <Processing/ParallelRows.h>
 #include <Processing/PixelFormatInfo.h>
 
 #include <Compressors/Compressor.h>
@@ -143,23 +144,31 @@ namespace ImageProcessingAtom
         uint32 dstPixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(dstFmt)->bitsPerBlock / 8;
 
         const uint32 dwMips = dstImage->GetMipCount();
-        float r, g, b, a;
         for (uint32 dwMip = 0; dwMip < dwMips; ++dwMip)
         {
-            uint8* srcPixelBuf;
+            uint8* srcMipBuf;
             uint32 srcPitch;
-            srcImage->GetImagePointer(dwMip, srcPixelBuf, srcPitch);
-            uint8* dstPixelBuf;
+            srcImage->GetImagePointer(dwMip, srcMipBuf, srcPitch);
+            uint8* dstMipBuf;
             uint32 dstPitch;
-            dstImage->GetImagePointer(dwMip, dstPixelBuf, dstPitch);
+            dstImage->GetImagePointer(dwMip, dstMipBuf, dstPitch);
 
-            const uint32 pixelCount = srcImage->GetPixelCount(dwMip);
+            const uint32 width = srcImage->GetWidth(dwMip);
 
-            for (uint32 i = 0; i < pixelCount; ++i, srcPixelBuf += srcPixelBytes, dstPixelBuf += dstPixelBytes)
+            //the pixel operations are stateless, so large mips are converted in parallel jobs
+            ForEachRowRange(srcImage->GetHeight(dwMip), width, [&](uint32 rowBegin, uint32 rowEnd)
             {
-                srcOp->GetRGBA(srcPixelBuf, r, g, b, a);
-                dstOp->SetRGBA(dstPixelBuf, r, g, b, a);
-            }
+                const uint32 pixelBegin = rowBegin * width;
+                const uint32 pixelEnd = rowEnd * width;
+                const uint8* srcPixelBuf = srcMipBuf + pixelBegin * srcPixelBytes;
+                uint8* dstPixelBuf = dstMipBuf + pixelBegin * dstPixelBytes;
+                float r, g, b, a;
+                for (uint32 i = pixelBegin; i < pixelEnd; ++i, srcPixelBuf += srcPixelBytes, dstPixelBuf += dstPixelBytes)
+                {
+                    srcOp->GetRGBA(srcPixelBuf, r, g, b, a);
+                    dstOp->SetRGBA(dstPixelBuf, r, g, b, a);
+                }
+            });
         }
 
         m_img = dstImage;
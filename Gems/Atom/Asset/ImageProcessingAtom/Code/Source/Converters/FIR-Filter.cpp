@@ -8,11 +8,13 @@
 
 #include <ImageProcessing_precompiled.h>
 
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/base.h>
 #include <Atom/ImageProcessing/ImageObject.h>
 #include <Processing/ImageConvert.h>
 #include <Processing/ImageToProcess.h>
+#include <Processing/ParallelRows.h>
 
 #include <Converters/FIR-Windows.h>
 #include <Converters/FIR-Weights.h>
@@ -207,21 +209,10 @@ namespace ImageProcessingAtom
     /* #################################################################################################################### \
      */
     #define filterTVariables(filterVxNNum, dtyp, wtyp, reps)                                                                                                                                   \
-        /* addition of c-pointers already takes care of datatype-sizes */                                                                                                                      \
-        const signed long int dy = /*parm->mirror ? -1 :*/ 1;                                                                                                                                  \
-        const unsigned int stridei = parm->incols  * 1 * 1;                                                                                                                                    \
-        const unsigned int stridet = parm->subcols * 1 * 1;                                                                                                                                    \
-        const unsigned int strideo = parm->outcols * 1 * 1;                                                                                                                                    \
-        /* offset and shift calculations still require the unmodified values */                                                                                                                \
-        const unsigned int strideiraw = parm->incols;                                                                                                                                          \
-        const unsigned int stridetraw = parm->subcols;                                                                                                                                         \
-        const unsigned int strideoraw = parm->outcols;                                                                                                                                         \
-                                                                                                                                                                                               \
         class Plane2D<dtyp> tmp(tmpcols, tmprows, 4);                                                                                                                                          \
         dtyp*** t = (dtyp***)tmp;                                                                                                                                                              \
-        int srcPos, dstPos;                                                                                                                                                                    \
-        bool plusminush = false; const bool of = true;                                                                                                                                         \
-        bool plusminusv = false; const bool nc = false;                                                                                                                                        \
+        bool plusminush = false;                                                                                                                                                               \
+        bool plusminusv = false;                                                                                                                                                               \
         FilterWeights<wtyp>* fwh = calculateFilterWeights<wtyp>(parm->resample.colrem, parm->caged ? 0 : 0 - parm->region.subtop, parm->caged ? srccols : parm->subrows - parm->region.subtop, \
             parm->resample.colquo,               0,               dstcols, reps, parm->resample.colblur, parm->resample.wf, parm->resample.operation != eWindowEvaluation_Sum, plusminush);    \
         FilterWeights<wtyp>* fwv = calculateFilterWeights<wtyp>(parm->resample.rowrem, parm->caged ? 0 : 0 - parm->region.intop, parm->caged ? srcrows : parm->inrows  - parm->region.intop,   \
@@ -752,7 +743,206 @@ namespace ImageProcessingAtom
     }
 
     /* #################################################################################################################### \
-     * multi-threadable if needed
+     * reading rows, writing cols (xy-flip)
+     *
+     * make srccol x    inrow -> dstrow x srccol
+     *
+     * we are reading vertical, and writing horizontal
+     * in effect we can use fast parallel-reads, but need
+     * slow interleaved-writes
+     * as reads are slower (ask+receive) than writes (send)
+     * this should even be gracefully fast
+     */
+    #define filterRowInit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
+        allTInitFixedOutPlaneReferences(cstZero, srcOffs, -, o, t);
+
+    #define filterRowNext(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip)                                                 \
+        /* every in/out-put may swap */                                                                                         \
+        allCInitSwappableInPlaneReferences(parm->region.inleft, srcOffs, parm->region.intop, fw.first, parm->inrows, i, false); \
+        /* because the filter moves back and forth, we always have to reposition from 0 */                                      \
+        allCAdvPMULInStreamPointer(srcSkip##raw, fw.first, i);
+
+    #define filterRowFetch(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
+        /* vertical stride, horizontal fetch */                                  \
+        getCxNFromStreamSwapped(srcSkip, i);                                     \
+        getCxNFromStream(srcSkip, i);                                            \
+        getCxNFromPlane(1);                                                      \
+                                                                                 \
+        /*srcPos++;*/
+
+    #define filterRowStore(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip)         \
+        /* because the filter moves back and forth, we always have to reposition to 0 */ \
+        allCAdvNMULInStreamPointer(srcSkip##raw, fw.last, i);                            \
+                                                                                         \
+        /* horizontal stride, vertical store */                                          \
+        putTxNToPlane(1);                                                                \
+                                                                                         \
+        /*dstPos++;*/
+
+    #define filterRowExit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
+        allCAdvPADDInStreamPointer(orderedNum, i);
+
+    /* filters the source columns [tmprowBegin, tmprowEnd) into the rows of the temporary planes
+     */
+    template<int operation>
+    static void FilterTemporaryRows(const float* i, float*** t, FilterWeights<signed short>* fwv, const struct prcparm* parm,
+        const unsigned int tmprowBegin, const unsigned int tmprowEnd, const unsigned int dstrows)
+    {
+        const unsigned int stridei    = parm->incols;
+        const unsigned int strideiraw = parm->incols;
+        const unsigned int cstZero = 0;
+        int srcPos, dstPos;
+
+        /* every column advances the stream by one pixel */
+        allCAdvPADDInStreamPointer(tmprowBegin, i);
+
+        for (unsigned int tmprow = tmprowBegin; tmprow < tmprowEnd; tmprow += orderedNum)
+        {
+            /* the source size and the temporary stride aren't used by the row operations */
+            filterVer(tmprow, 0, stridei,
+                tmprow, dstrows, 0, filterRowInit, filterRowNext, filterRowFetch, filterRowStore, filterRowExit, operation, true);
+        }
+    }
+
+    /* same as FilterTemporaryRows<eWindowEvaluation_Sum>, but accumulates all four channels of a tap at once
+     */
+    static void FilterTemporaryRowsSum(const float* i, float*** t, const FilterWeights<signed short>* fwv, const struct prcparm* parm,
+        const unsigned int tmprowBegin, const unsigned int tmprowEnd, const unsigned int dstrows)
+    {
+        using AZ::Simd::Vec4;
+
+        const ptrdiff_t stride = static_cast<ptrdiff_t>(parm->incols) * 4;
+        const Vec4::FloatType scale = Vec4::Splat(1.0f / 32768.0f);
+
+        for (unsigned int tmprow = tmprowBegin; tmprow < tmprowEnd; ++tmprow)
+        {
+            const float* column = i + static_cast<ptrdiff_t>(tmprow) * 4;
+
+            for (unsigned int dstPos = 0; dstPos < dstrows; ++dstPos)
+            {
+                const FilterWeights<signed short>& fw = fwv[dstPos];
+                const signed short* w = fw.weights;
+                const float* src = column + fw.first * stride;
+
+                /* build result using sign inverted weights [32767,-32768] */
+                Vec4::FloatType res = Vec4::ZeroFloat();
+                int srcPos = fw.first;
+                do
+                {
+                    res = Vec4::Sub(res, Vec4::Mul(Vec4::LoadUnaligned(src), Vec4::Splat(static_cast<float>(*w++))));
+                    src += stride;
+                } while (++srcPos < fw.last);
+
+                /* the temporary planes are separate per channel */
+                alignas(16) float value[4];
+                Vec4::StoreAligned(value, Vec4::Mul(res, scale));
+                t[0][tmprow][dstPos] = value[0];
+                t[1][tmprow][dstPos] = value[1];
+                t[2][tmprow][dstPos] = value[2];
+                t[3][tmprow][dstPos] = value[3];
+            }
+        }
+    }
+
+    /* #################################################################################################################### \
+     * reading rows, writing cols (xy-flip)
+     *
+     * make dstrow x srccol -> outcol x dstrow
+     *
+     * we are reading vertical, and writing horizontal
+     * in effect we can use fast parallel-reads, but need
+     * slow interleaved-writes
+     * as reads are slower (ask+receive) than writes (send)
+     * this should even be gracefully fast
+     */
+    #define filterColInit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
+        allCInitSwappableOutPlaneReferences(parm->region.outleft, cstZero, parm->region.outtop, srcOffs, parm->outrows, o, false);
+
+    #define filterColNext(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
+        /* every in/out-put may swap */                                         \
+        allTInitFixedInPlaneReferences(srcOffs, parm->region.subtop + fw.first, -, i, t);
+
+    #define filterColFetch(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
+        /* vertical stride, horizontal fetch */                                  \
+        getTxNFromPlane(1);                                                      \
+                                                                                 \
+        /*srcPos++;*/
+
+    #define filterColStore(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
+        comcpyCCheckHiLo();                                                      \
+        comcpyCCoVar();                                                          \
+        comcpyCHistogram();                                                      \
+                                                                                 \
+        /* horizontal stride, vertical store */                                  \
+        putCxNToStreamSwapped(dstSkip, o);                                       \
+        putCxNToStream(dstSkip, o);                                              \
+        putCxNToPlane(1);                                                        \
+                                                                                 \
+        /*dstPos++;*/
+
+    #define filterColExit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
+        allCAdvSSUBOutStreamPointer(dstSkip##raw, orderedShift, dstPos, o);
+
+    /* filters the temporary planes into the output rows [dstrowBegin, dstrowEnd)
+     */
+    template<int operation>
+    static void FilterOutputRows(float* o, float*** t, FilterWeights<signed short>* fwh, const struct prcparm* parm,
+        const unsigned int dstrowBegin, const unsigned int dstrowEnd, const unsigned int dstcols)
+    {
+        const signed long int dy = 1;
+        const unsigned int strideo    = parm->outcols;
+        const unsigned int strideoraw = parm->outcols;
+        const unsigned int cstZero = 0;
+        int srcPos, dstPos;
+
+        /* every row advances the stream by one output row */
+        allF4AdvPMULStreamPointer(dstrowBegin, strideoraw, o);
+
+        for (unsigned int dstrow = dstrowBegin; dstrow < dstrowEnd; dstrow += orderedNum)
+        {
+            /* the source size and the temporary stride aren't used by the column operations */
+            filterHor(dstrow, 0, 0,
+                dstrow, dstcols, strideo, filterColInit, filterColNext, filterColFetch, filterColStore, filterColExit, operation, true);
+        }
+    }
+
+    /* same as FilterOutputRows<eWindowEvaluation_Sum>, but accumulates all four channels of a tap at once
+     */
+    static void FilterOutputRowsSum(float* o, float*** t, const FilterWeights<signed short>* fwh, const struct prcparm* parm,
+        const unsigned int dstrowBegin, const unsigned int dstrowEnd, const unsigned int dstcols)
+    {
+        using AZ::Simd::Vec4;
+
+        const Vec4::FloatType scale = Vec4::Splat(1.0f / 32768.0f);
+
+        for (unsigned int dstrow = dstrowBegin; dstrow < dstrowEnd; ++dstrow)
+        {
+            float* out = o + static_cast<ptrdiff_t>(dstrow) * parm->outcols * 4;
+
+            for (unsigned int dstPos = 0; dstPos < dstcols; ++dstPos)
+            {
+                const FilterWeights<signed short>& fw = fwh[dstPos];
+                const signed short* w = fw.weights;
+                int row = parm->region.subtop + fw.first;
+
+                /* build result using sign inverted weights [32767,-32768] */
+                Vec4::FloatType res = Vec4::ZeroFloat();
+                int srcPos = fw.first;
+                do
+                {
+                    const Vec4::FloatType value = Vec4::LoadImmediate(t[0][row][dstrow], t[1][row][dstrow], t[2][row][dstrow], t[3][row][dstrow]);
+                    res = Vec4::Sub(res, Vec4::Mul(value, Vec4::Splat(static_cast<float>(*w++))));
+                    ++row;
+                } while (++srcPos < fw.last);
+
+                Vec4::StoreUnaligned(out, Vec4::Mul(res, scale));
+                out += 4;
+            }
+        }
+    }
+
+    /* #################################################################################################################### \
+     * both passes process independent rows, so large images are split across jobs
      */
     static void RunAlgorithm(const float* i, float* o, struct prcparm* parm)
     {
@@ -761,7 +951,6 @@ namespace ImageProcessingAtom
         const unsigned int srccols = parm->docols * parm->resample.colrem / parm->resample.colquo;
         const unsigned int dstrows = parm->dorows;
         const unsigned int dstcols = parm->docols;
-        const unsigned int cstZero = 0;
 
         /* temporary buffer region */
         parm->subrows        = srccols;
@@ -810,81 +999,24 @@ namespace ImageProcessingAtom
 
         filterTInitLoop();
 
-        /* --------------------------------------------------------------------------------------------
-         * reading rows, writing cols (xy-flip)
-         *
-         * make srccol x    inrow -> dstrow x srccol
-         *
-         * we are reading vertical, and writing horizontal
-         * in effect we can use fast parallel-reads, but need
-         * slow interleaved-writes
-         * as reads are slower (ask+receive) than writes (send)
-         * this should even be gracefully fast
-         */
+        /* 1st resampling: source columns into temporary rows */
         allCAdvADDMInStreamPointer(parm->region.inleft, parm->region.intop, parm->incols, i);
 
-    #define filterRowInit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        allTInitFixedOutPlaneReferences(cstZero, srcOffs, -, o, t);
-
-    #define filterRowNext(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip)                                                 \
-        /* every in/out-put may swap */                                                                                         \
-        allCInitSwappableInPlaneReferences(parm->region.inleft, srcOffs, parm->region.intop, fw.first, parm->inrows, i, false); \
-        /* because the filter moves back and forth, we always have to reposition from 0 */                                      \
-        allCAdvPMULInStreamPointer(srcSkip##raw, fw.first, i);
-
-    #define filterRowFetch(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        /* vertical stride, horizontal fetch */                                  \
-        getCxNFromStreamSwapped(srcSkip, i);                                     \
-        getCxNFromStream(srcSkip, i);                                            \
-        getCxNFromPlane(1);                                                      \
-                                                                                 \
-        /*srcPos++;*/
-
-    #define filterRowStore(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip)         \
-        /* because the filter moves back and forth, we always have to reposition to 0 */ \
-        allCAdvNMULInStreamPointer(srcSkip##raw, fw.last, i);                            \
-                                                                                         \
-        /* horizontal stride, vertical store */                                          \
-        putTxNToPlane(1);                                                                \
-                                                                                         \
-        /*dstPos++;*/
-
-    #define filterRowExit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        allCAdvPADDInStreamPointer(orderedNum, i);
-
-        if (parm->resample.operation == eWindowEvaluation_Sum)
+        ForEachRowRange(tmprows, dstrows, [&](AZ::u32 tmprowBegin, AZ::u32 tmprowEnd)
         {
-            loopEnter(tmprow, tmprows, orderedNum);
-
+            if (parm->resample.operation == eWindowEvaluation_Sum)
             {
-                filterVer(tmprow, srcrows, stridei,
-                    tmprow, dstrows, stridet, filterRowInit, filterRowNext, filterRowFetch, filterRowStore, filterRowExit, eWindowEvaluation_Sum, of);
+                FilterTemporaryRowsSum(i, t, fwv, parm, tmprowBegin, tmprowEnd, dstrows);
             }
-
-            loopLeave(tmprow, tmprows, orderedNum);
-        }
-        else if (parm->resample.operation == eWindowEvaluation_Max)
-        {
-            loopEnter(tmprow, tmprows, orderedNum);
-
+            else if (parm->resample.operation == eWindowEvaluation_Max)
             {
-                filterVer(tmprow, srcrows, stridei,
-                    tmprow, dstrows, stridet, filterRowInit, filterRowNext, filterRowFetch, filterRowStore, filterRowExit, eWindowEvaluation_Max, of);
+                FilterTemporaryRows<eWindowEvaluation_Max>(i, t, fwv, parm, tmprowBegin, tmprowEnd, dstrows);
             }
-
-            loopLeave(tmprow, tmprows, orderedNum);
-        }
-        else if (parm->resample.operation == eWindowEvaluation_Min)
-        {
-            loopEnter(tmprow, tmprows, orderedNum);
-
+            else if (parm->resample.operation == eWindowEvaluation_Min)
             {
-                filterVer(tmprow, srcrows, stridei,
-                    tmprow, dstrows, stridet, filterRowInit, filterRowNext, filterRowFetch, filterRowStore, filterRowExit, eWindowEvaluation_Min, of);
+                FilterTemporaryRows<eWindowEvaluation_Min>(i, t, fwv, parm, tmprowBegin, tmprowEnd, dstrows);
             }
-
-            loopLeave(tmprow, tmprows, orderedNum);
-        }
+        });
 
         /* 1st resampling end
          * --------------------------------------------------------------------------------------------
@@ -904,80 +1036,24 @@ namespace ImageProcessingAtom
         covarTInitLoop();
         histoTInitLoop();
 
-        /* --------------------------------------------------------------------------------------------
-         * reading rows, writing cols (xy-flip)
-         *
-         * make dstrow x srccol -> outcol x dstrow
-         *
-         * we are reading vertical, and writing horizontal
-         * in effect we can use fast parallel-reads, but need
-         * slow interleaved-writes
-         * as reads are slower (ask+receive) than writes (send)
-         * this should even be gracefully fast
-         */
+        /* 2nd resampling: temporary columns into output rows, all temporary rows are complete at this point */
         allCAdvADDMOutStreamPointer(parm->region.outleft, parm->region.outtop, parm->outcols, o);
 
-    #define filterColInit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        allCInitSwappableOutPlaneReferences(parm->region.outleft, cstZero, parm->region.outtop, srcOffs, parm->outrows, o, false);
-
-    #define filterColNext(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        /* every in/out-put may swap */                                         \
-        allTInitFixedInPlaneReferences(srcOffs, parm->region.subtop + fw.first, -, i, t);
-
-    #define filterColFetch(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        /* vertical stride, horizontal fetch */                                  \
-        getTxNFromPlane(1);                                                      \
-                                                                                 \
-        /*srcPos++;*/
-
-    #define filterColStore(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        comcpyCCheckHiLo();                                                      \
-        comcpyCCoVar();                                                          \
-        comcpyCHistogram();                                                      \
-                                                                                 \
-        /* horizontal stride, vertical store */                                  \
-        putCxNToStreamSwapped(dstSkip, o);                                       \
-        putCxNToStream(dstSkip, o);                                              \
-        putCxNToPlane(1);                                                        \
-                                                                                 \
-        /*dstPos++;*/
-
-    #define filterColExit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        allCAdvSSUBOutStreamPointer(dstSkip##raw, orderedShift, dstPos, o);
-
-        if (parm->resample.operation == eWindowEvaluation_Sum)
+        ForEachRowRange(dstrows, dstcols, [&](AZ::u32 dstrowBegin, AZ::u32 dstrowEnd)
         {
-            loopEnter(dstrow, dstrows, orderedNum);
-
+            if (parm->resample.operation == eWindowEvaluation_Sum)
             {
-                filterHor(dstrow, srccols, stridet,
-                    dstrow, dstcols, strideo, filterColInit, filterColNext, filterColFetch, filterColStore, filterColExit, eWindowEvaluation_Sum, of);
+                FilterOutputRowsSum(o, t, fwh, parm, dstrowBegin, dstrowEnd, dstcols);
             }
-
-            loopLeave(dstrow, dstrows, orderedNum);
-        }
-        else if (parm->resample.operation == eWindowEvaluation_Max)
-        {
-            loopEnter(dstrow, dstrows, orderedNum);
-
+            else if (parm->resample.operation == eWindowEvaluation_Max)
             {
-                filterHor(dstrow, srccols, stridet,
-                    dstrow, dstcols, strideo, filterColInit, filterColNext, filterColFetch, filterColStore, filterColExit, eWindowEvaluation_Max, of);
+                FilterOutputRows<eWindowEvaluation_Max>(o, t, fwh, parm, dstrowBegin, dstrowEnd, dstcols);
             }
-
-            loopLeave(dstrow, dstrows, orderedNum);
-        }
-        else if (parm->resample.operation == eWindowEvaluation_Min)
-        {
-            loopEnter(dstrow, dstrows, orderedNum);
-
+            else if (parm->resample.operation == eWindowEvaluation_Min)
             {
-                filterHor(dstrow, srccols, stridet,
-                    dstrow, dstcols, strideo, filterColInit, filterColNext, filterColFetch, filterColStore, filterColExit, eWindowEvaluation_Min, of);
+                FilterOutputRows<eWindowEvaluation_Min>(o, t, fwh, parm, dstrowBegin, dstrowEnd, dstcols);
             }
-
-            loopLeave(dstrow, dstrows, orderedNum);
-        }
+        });
 
         /* 2nd resampling end
          * --------------------------------------------------------------------------------------------
@@ -999,81 +1075,6 @@ namespace ImageProcessingAtom
         filterCCleanUp(orderedNum);
     }
 
-    // TODO: not working yet, debug and enable
-    //static void SplitAlgorithm(const void* i, void* o, struct prcparm* templ, int threads = 8)
-    //{
-    //    struct prcparm fraction[32];
-    //    int t, istart = 0, sstart = 0, ostart = 0;
-    //    const bool scaler = true;
-
-    //    int theight = 0;
-
-    //    /* prepare data to be emitted to the threads */
-    //    for (t = 0; t < threads; t++)
-    //    {
-    //        fraction[t] = *templ;
-
-    //        /* adjust the processing-region according to the available threads */
-    //        {
-    //#undef  split       /* only prefix-threads need aligned transpose (for not trashing suffix-thread data) */
-    //#define split(rows) !scaler                                         \
-    //    ? ((rows * (t + 1)) / threads) & (~(t != threads - 1 ? 15 : 0)) \
-    //    : ((rows * (t + 1)) / threads) & (~0)
-
-    //            /* area covered */
-    //            const int  inrows = (fraction[t].regional ? fraction[t].region.inrows  : fraction[t].inrows);
-    //            const int  incols = (fraction[t].regional ? fraction[t].region.incols  : fraction[t].incols);
-    //            const int subrows = (fraction[t].regional ? fraction[t].region.subrows : fraction[t].subrows);
-    //            const int subcols = (fraction[t].regional ? fraction[t].region.subcols : fraction[t].subcols);
-    //            const int outrows = (fraction[t].regional ? fraction[t].region.outrows : fraction[t].outrows);
-    //            const int outcols = (fraction[t].regional ? fraction[t].region.outcols : fraction[t].outcols);
-
-    //            /* splitting blocks */
-    //            const int istop = split(inrows), sstop = split(subrows), ostop = split(outrows);
-    //            const int irows = istop - istart, srows = sstop - sstart, orows = ostop - ostart;
-    //            const int icols = incols, scols = subcols, ocols = outcols;
-
-    //            AZ_Assert(irows > 0, "%s: Expect row count to be above zero!", __FUNCTION__);
-    //            AZ_Assert(orows > 0, "%s: Expect row count to be above zero!", __FUNCTION__);
-    //            AZ_Assert(icols > 0, "%s: Expect column count to be above zero!", __FUNCTION__);
-    //            AZ_Assert(ocols > 0, "%s: Expect column count to be above zero!", __FUNCTION__);
-
-    //            /* now we are regional */
-    //            fraction[t].regional       = true;
-
-    //            /* take previous regionality into account */
-    //            fraction[t].region.intop += istart;
-    //            fraction[t].region.subtop += sstart;
-    //            fraction[t].region.outtop += ostart;
-    //            fraction[t].region.inrows = irows;
-    //            fraction[t].region.subrows = srows;
-    //            fraction[t].region.outrows = orows;
-
-    //            /* take previous regionality into account */
-    //            fraction[t].region.inleft += 0;
-    //            fraction[t].region.subleft += 0;
-    //            fraction[t].region.outleft += 0;
-    //            fraction[t].region.incols  = icols;
-    //            fraction[t].region.subcols  = scols;
-    //            fraction[t].region.outcols  = ocols;
-
-    //            /* advance block */
-    //            istart = istop;
-    //            sstart = sstop;
-    //            ostart = ostop;
-
-    //            /* check */
-    //            theight += irows;
-    //        }
-
-    //        // the algorithm supports "i" and "o" pointing to the same memory
-    //        CheckBoundaries((float*)i, (float*)o, &fraction[t]);
-    //        RunAlgorithm((float*)i, (float*)o, &fraction[t]);
-    //    }
-
-    //    AZ_Assert(theight >= (templ->regional ? templ->region.inrows : templ->inrows), "%s: Invalid height!", __FUNCTION__);
-    //}
-
     /* #################################################################################################################### \
      */
     void FilterImage(int filterIndex, int filterOp, float blurH, float blurV, const IImageObjectPtr srcImg, int srcMip,
@@ -1233,9 +1234,6 @@ namespace ImageProcessingAtom
                 break;
             }
 
-            // TODO: not working yet, debug and enable
-            //      SplitAlgorithm(pSrcMem, pDestMem, &parm);
-
             // the algorithm supports "pSrcMem" and "pDestMem" pointing to the same memory
             CheckBoundaries((float*)pSrcMem, (float*)pDestMem, &parm);
             RunAlgorithm((float*)pSrcMem, (float*)pDestMem, &parm);
@@ -11,6 +11,7 @@
 #include <Processing/ImageToProcess.h>
 #include <Processing/PixelFormatInfo.h>
 #include <Processing/ImageFlags.h>
+#include <Processing/ParallelRows.h>
 #include <Atom/ImageProcessing/PixelFormats.h>
 
 #include <Converters/FIR-Weights.h>
@@ -26,6 +27,7 @@ namespace ImageProcessingAtom
     // then the original function is called.
     // Otherwise, a value from the table (linearly interpolated)
     // is returned.
+    // The table is filled on construction, so it can be read from several jobs at once.
     template <int TABLE_SIZE>
     class FunctionLookupTable
     {
@@ -35,11 +37,11 @@ namespace ImageProcessingAtom
             , m_xMin(xMin)
             , m_fMaxDiff(maxAllowedDifference)
         {
+            Initialize();
         }
 
-        void Initialize() const
+        void Initialize()
         {
-            m_initialized = true;
             AZ_Assert(m_xMin >= 0.0f, "wrong initial data for m_xMin");
             for (int i = 0; i <= TABLE_SIZE; ++i)
             {
@@ -60,11 +62,6 @@ namespace ImageProcessingAtom
 
             const int i = int(f);
 
-            if (!m_initialized)
-            {
-                Initialize();
-            }
-
             if (i >= TABLE_SIZE)
             {
                 return m_table[TABLE_SIZE];
@@ -114,8 +111,7 @@ namespace ImageProcessingAtom
     private:
         float(* m_fn)(float x);
         float m_xMin;
-        mutable float m_table[TABLE_SIZE + 1];
-        mutable bool m_initialized = false;
+        float m_table[TABLE_SIZE + 1];
         float m_fMaxDiff = 0.0f;
     };
 
@@ -165,30 +161,54 @@ namespace ImageProcessingAtom
         uint32 dstPixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(dstFmt)->bitsPerBlock / 8;
 
         const uint32 dwMips = dstImage->GetMipCount();
-        float r, g, b, a;
         for (uint32 dwMip = 0; dwMip < dwMips; ++dwMip)
         {
-            uint8* srcPixelBuf;
+            uint8* srcMipBuf;
             uint32 srcPitch;
-            srcImage->GetImagePointer(dwMip, srcPixelBuf, srcPitch);
-            uint8* dstPixelBuf;
+            srcImage->GetImagePointer(dwMip, srcMipBuf, srcPitch);
+            uint8* dstMipBuf;
             uint32 dstPitch;
-            dstImage->GetImagePointer(dwMip, dstPixelBuf, dstPitch);
+            dstImage->GetImagePointer(dwMip, dstMipBuf, dstPitch);
 
-            const uint32 pixelCount = srcImage->GetPixelCount(dwMip);
+            const uint32 width = srcImage->GetWidth(dwMip);
 
-            for (uint32 i = 0; i < pixelCount; ++i, srcPixelBuf += srcPixelBytes, dstPixelBuf += dstPixelBytes)
+            //the rows are independent, so large mips are converted in parallel jobs
+            ForEachRowRange(srcImage->GetHeight(dwMip), width, [&](uint32 rowBegin, uint32 rowEnd)
             {
-                srcOp->GetRGBA(srcPixelBuf, r, g, b, a);
-                if (bDeGamma)
+                const uint32 pixelBegin = rowBegin * width;
+                const uint32 pixelEnd = rowEnd * width;
+
+                //float sources don't need to go through the pixel operations
+                if (srcFmt == ePixelFormat_R32G32B32A32F)
                 {
-                    r = s_lutGammaToLinear.compute(r);
-                    g = s_lutGammaToLinear.compute(g);
-                    b = s_lutGammaToLinear.compute(b);
+                    const float* srcPixel = reinterpret_cast<const float*>(srcMipBuf) + pixelBegin * 4;
+                    float* dstPixel = reinterpret_cast<float*>(dstMipBuf) + pixelBegin * 4;
+                    for (uint32 i = pixelBegin; i < pixelEnd; ++i, srcPixel += 4, dstPixel += 4)
+                    {
+                        dstPixel[0] = s_lutGammaToLinear.compute(srcPixel[0]);
+                        dstPixel[1] = s_lutGammaToLinear.compute(srcPixel[1]);
+                        dstPixel[2] = s_lutGammaToLinear.compute(srcPixel[2]);
+                        dstPixel[3] = srcPixel[3];
+                    }
+                    return;
                 }
 
-                dstOp->SetRGBA(dstPixelBuf, r, g, b, a);
-            }
+                const uint8* srcPixelBuf = srcMipBuf + pixelBegin * srcPixelBytes;
+                uint8* dstPixelBuf = dstMipBuf + pixelBegin * dstPixelBytes;
+                float r, g, b, a;
+                for (uint32 i = pixelBegin; i < pixelEnd; ++i, srcPixelBuf += srcPixelBytes, dstPixelBuf += dstPixelBytes)
+                {
+                    srcOp->GetRGBA(srcPixelBuf, r, g, b, a);
+                    if (bDeGamma)
+                    {
+                        r = s_lutGammaToLinear.compute(r);
+                        g = s_lutGammaToLinear.compute(g);
+                        b = s_lutGammaToLinear.compute(b);
+                    }
+
+                    dstOp->SetRGBA(dstPixelBuf, r, g, b, a);
+                }
+            });
         }
 
         m_img = dstImage;
@@ -226,26 +246,33 @@ namespace ImageProcessingAtom
         uint32 pixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(srcFmt)->bitsPerBlock / 8;
 
         const uint32 dwMips = srcImage->GetMipCount();
-        float r, g, b, a;
         for (uint32 dwMip = 0; dwMip < dwMips; ++dwMip)
         {
-            uint8* srcPixelBuf;
+            uint8* srcMipBuf;
             uint32 srcPitch;
-            srcImage->GetImagePointer(dwMip, srcPixelBuf, srcPitch);
-            uint8* dstPixelBuf;
+            srcImage->GetImagePointer(dwMip, srcMipBuf, srcPitch);
+            uint8* dstMipBuf;
             uint32 dstPitch;
-            dstImage->GetImagePointer(dwMip, dstPixelBuf, dstPitch);
+            dstImage->GetImagePointer(dwMip, dstMipBuf, dstPitch);
 
-            const uint32 pixelCount = srcImage->GetPixelCount(dwMip);
+            const uint32 width = srcImage->GetWidth(dwMip);
 
-            for (uint32 i = 0; i < pixelCount; ++i, srcPixelBuf += pixelBytes, dstPixelBuf += pixelBytes)
+            ForEachRowRange(srcImage->GetHeight(dwMip), width, [&](uint32 rowBegin, uint32 rowEnd)
             {
-                pixelOp->GetRGBA(srcPixelBuf, r, g, b, a);
-                r = s_lutLinearToGamma.compute(r);
-                g = s_lutLinearToGamma.compute(g);
-                b = s_lutLinearToGamma.compute(b);
-                pixelOp->SetRGBA(dstPixelBuf, r, g, b, a);
-            }
+                const uint32 pixelBegin = rowBegin * width;
+                const uint32 pixelEnd = rowEnd * width;
+                const uint8* srcPixelBuf = srcMipBuf + pixelBegin * pixelBytes;
+                uint8* dstPixelBuf = dstMipBuf + pixelBegin * pixelBytes;
+                float r, g, b, a;
+                for (uint32 i = pixelBegin; i < pixelEnd; ++i, srcPixelBuf += pixelBytes, dstPixelBuf += pixelBytes)
+                {
+                    pixelOp->GetRGBA(srcPixelBuf, r, g, b, a);
+                    r = s_lutLinearToGamma.compute(r);
+                    g = s_lutLinearToGamma.compute(g);
+                    b = s_lutLinearToGamma.compute(b);
+                    pixelOp->SetRGBA(dstPixelBuf, r, g, b, a);
+                }
+            });
         }
 
         m_img = dstImage;
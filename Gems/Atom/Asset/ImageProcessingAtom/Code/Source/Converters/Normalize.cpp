@@ -11,6 +11,10 @@
 
 #include <Processing/ImageObjectImpl.h>
 #include <Processing/ImageFlags.h>
+#include <Processing/ParallelRows.h>
+
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/parallel/mutex.h>
 
 
 namespace ImageProcessingAtom
@@ -80,8 +84,10 @@ namespace ImageProcessingAtom
         GetExtent(dwWidth, dwHeight, dwMips);
 
         // find image's range, can be negative
-        float cMinColor[4] = { FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX };
-        float cMaxColor[4] = { -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        using AZ::Simd::Vec4;
+        Vec4::FloatType vMinColor = Vec4::Splat(FLT_MAX);
+        Vec4::FloatType vMaxColor = Vec4::Splat(-FLT_MAX);
+        AZStd::mutex rangeMutex;
 
         for (uint32 dwMip = 0; dwMip < dwMips; ++dwMip)
         {
@@ -89,28 +95,36 @@ namespace ImageProcessingAtom
             uint32 dwSrcPitch;
             GetImagePointer(dwMip, pSrcMem, dwSrcPitch);
 
-            dwHeight = GetHeight(dwMip);
             dwWidth = GetWidth(dwMip);
-            for (uint32 dwY = 0; dwY < dwHeight; ++dwY)
+            ForEachRowRange(GetHeight(dwMip), dwWidth, [&](uint32 rowBegin, uint32 rowEnd)
             {
-                const float* pSrcPix = (float*)&pSrcMem[dwY * dwSrcPitch];
-                for (uint32 dwX = 0; dwX < dwWidth; ++dwX)
+                // each job reduces its own rows, then merges once
+                Vec4::FloatType vRowsMin = Vec4::Splat(FLT_MAX);
+                Vec4::FloatType vRowsMax = Vec4::Splat(-FLT_MAX);
+                for (uint32 dwY = rowBegin; dwY < rowEnd; ++dwY)
                 {
-                    cMinColor[0] = AZ::GetMin(cMinColor[0], pSrcPix[0]);
-                    cMinColor[1] = AZ::GetMin(cMinColor[1], pSrcPix[1]);
-                    cMinColor[2] = AZ::GetMin(cMinColor[2], pSrcPix[2]);
-                    cMinColor[3] = AZ::GetMin(cMinColor[3], pSrcPix[3]);
-
-                    cMaxColor[0] = AZ::GetMax(cMaxColor[0], pSrcPix[0]);
-                    cMaxColor[1] = AZ::GetMax(cMaxColor[1], pSrcPix[1]);
-                    cMaxColor[2] = AZ::GetMax(cMaxColor[2], pSrcPix[2]);
-                    cMaxColor[3] = AZ::GetMax(cMaxColor[3], pSrcPix[3]);
-
-                    pSrcPix += 4;
+                    const float* pSrcPix = (float*)&pSrcMem[dwY * dwSrcPitch];
+                    for (uint32 dwX = 0; dwX < dwWidth; ++dwX)
+                    {
+                        const Vec4::FloatType vPix = Vec4::LoadUnaligned(pSrcPix);
+                        vRowsMin = Vec4::Min(vRowsMin, vPix);
+                        vRowsMax = Vec4::Max(vRowsMax, vPix);
+
+                        pSrcPix += 4;
+                    }
                 }
-            }
+
+                AZStd::lock_guard<AZStd::mutex> lock(rangeMutex);
+                vMinColor = Vec4::Min(vMinColor, vRowsMin);
+                vMaxColor = Vec4::Max(vMaxColor, vRowsMax);
+            });
         }
 
+        float cMinColor[4];
+        float cMaxColor[4];
+        Vec4::StoreUnaligned(cMinColor, vMinColor);
+        Vec4::StoreUnaligned(cMaxColor, vMaxColor);
+
         if (bMaintainBlack)
         {
             cMinColor[0] = AZ::GetMin(0.f, cMinColor[0]);
@@ -220,20 +234,22 @@ namespace ImageProcessingAtom
             uint32 dwSrcPitch;
             GetImagePointer(dwMip, pSrcMem, dwSrcPitch);
 
-            dwHeight = GetHeight(dwMip);
             dwWidth = GetWidth(dwMip);
-            for (uint32 dwY = 0; dwY < dwHeight; ++dwY)
+            ForEachRowRange(GetHeight(dwMip), dwWidth, [&](uint32 rowBegin, uint32 rowEnd)
             {
-                AZ::Vector4* pSrcPix = (AZ::Vector4*)&pSrcMem[dwY * dwSrcPitch];
-                for (uint32 dwX = 0; dwX < dwWidth; ++dwX)
+                for (uint32 dwY = rowBegin; dwY < rowEnd; ++dwY)
                 {
-                    *pSrcPix = *pSrcPix - vMin;
-                    *pSrcPix = *pSrcPix / cScale;
-                    *pSrcPix = *pSrcPix * cUprValue;
-
-                    pSrcPix++;
+                    AZ::Vector4* pSrcPix = (AZ::Vector4*)&pSrcMem[dwY * dwSrcPitch];
+                    for (uint32 dwX = 0; dwX < dwWidth; ++dwX)
+                    {
+                        *pSrcPix = *pSrcPix - vMin;
+                        *pSrcPix = *pSrcPix / cScale;
+                        *pSrcPix = *pSrcPix * cUprValue;
+
+                        pSrcPix++;
+                    }
                 }
-            }
+            });
         }
 
         // set up a range
@@ -291,20 +307,22 @@ namespace ImageProcessingAtom
             uint32 dwSrcPitch;
             GetImagePointer(dwMip, pSrcMem, dwSrcPitch);
 
-            dwHeight = GetHeight(dwMip);
             dwWidth = GetWidth(dwMip);
-            for (uint32 dwY = 0; dwY < dwHeight; ++dwY)
+            ForEachRowRange(GetHeight(dwMip), dwWidth, [&](uint32 rowBegin, uint32 rowEnd)
             {
-                AZ::Vector4* pSrcPix = (AZ::Vector4*)&pSrcMem[dwY * dwSrcPitch];
-                for (uint32 dwX = 0; dwX < dwWidth; ++dwX)
+                for (uint32 dwY = rowBegin; dwY < rowEnd; ++dwY)
                 {
-                    *pSrcPix = *pSrcPix / cUprValue;
-                    *pSrcPix = *pSrcPix * cScale;
-                    *pSrcPix = *pSrcPix + cMinColor.GetAsVector4();
-
-                    pSrcPix++;
+                    AZ::Vector4* pSrcPix = (AZ::Vector4*)&pSrcMem[dwY * dwSrcPitch];
+                    for (uint32 dwX = 0; dwX < dwWidth; ++dwX)
+                    {
+                        *pSrcPix = *pSrcPix / cUprValue;
+                        *pSrcPix = *pSrcPix * cScale;
+                        *pSrcPix = *pSrcPix + cMinColor.GetAsVector4();
+
+                        pSrcPix++;
+                    }
                 }
-            }
+            });
         }
 
         // set up a range
@@ -327,26 +345,31 @@ namespace ImageProcessingAtom
         uint32 lastMip = AZ::GetMin(firstMip + maxMipCount, GetMipCount());
         for (uint32 mip = firstMip; mip < lastMip; ++mip)
         {
-            const uint32 pixelCount = GetPixelCount(mip);
+            const uint32 width = GetWidth(mip);
             uint8* imageMem;
             uint32 pitch;
             GetImagePointer(mip, imageMem, pitch);
-            float* pPixels = (float*)imageMem;
 
-            for (uint32 i = 0; i < pixelCount; ++i, pPixels += 4)
+            ForEachRowRange(GetHeight(mip), width, [&](uint32 rowBegin, uint32 rowEnd)
             {
-                AZ::Vector3 vNormal = AZ::Vector3(pPixels[0] * 2.0f - 1.0f, pPixels[1] * 2.0f - 1.0f, pPixels[2] * 2.0f - 1.0f);
-
-                // TODO: every opposing vector addition produces the zero-vector for
-                // normals on the entire sphere, in that case the forward vector [0,0,1]
-                // isn't necessarily right and we should look at the adjacent normals
-                // for a direction
-                vNormal.NormalizeSafe();
-
-                pPixels[0] = vNormal.GetX() * 0.5f + 0.5f;
-                pPixels[1] = vNormal.GetY() * 0.5f + 0.5f;
-                pPixels[2] = vNormal.GetZ() * 0.5f + 0.5f;
-            }
+                float* pPixels = (float*)(imageMem + rowBegin * pitch);
+                const uint32 pixelCount = (rowEnd - rowBegin) * width;
+
+                for (uint32 i = 0; i < pixelCount; ++i, pPixels += 4)
+                {
+                    AZ::Vector3 vNormal = AZ::Vector3(pPixels[0] * 2.0f - 1.0f, pPixels[1] * 2.0f - 1.0f, pPixels[2] * 2.0f - 1.0f);
+
+                    // TODO: every opposing vector addition produces the zero-vector for
+                    // normals on the entire sphere, in that case the forward vector [0,0,1]
+                    // isn't necessarily right and we should look at the adjacent normals
+                    // for a direction
+                    vNormal.NormalizeSafe();
+
+                    pPixels[0] = vNormal.GetX() * 0.5f + 0.5f;
+                    pPixels[1] = vNormal.GetY() * 0.5f + 0.5f;
+                    pPixels[2] = vNormal.GetZ() * 0.5f + 0.5f;
+                }
+            });
         }
     }
 
@@ -359,22 +382,28 @@ namespace ImageProcessingAtom
             return;
         }
 
+        using AZ::Simd::Vec4;
+        const Vec4::FloatType vScale = scale.GetSimdValue();
+        const Vec4::FloatType vBias = bias.GetSimdValue();
+
         const uint32 lastMip = AZ::GetMin(firstMip + maxMipCount, GetMipCount());
         for (uint32 mip = firstMip; mip < lastMip; ++mip)
         {
-            const uint32 pixelCount = GetPixelCount(mip);
+            const uint32 width = GetWidth(mip);
             uint8* imageMem;
             uint32 pitch;
             GetImagePointer(mip, imageMem, pitch);
-            float* pPixels = (float*)imageMem;
 
-            for (uint32 i = 0; i < pixelCount; ++i, pPixels += 4)
+            ForEachRowRange(GetHeight(mip), width, [&](uint32 rowBegin, uint32 rowEnd)
             {
-                pPixels[0] = pPixels[0] * scale.GetX() + bias.GetX();
-                pPixels[1] = pPixels[1] * scale.GetY() + bias.GetY();
-                pPixels[2] = pPixels[2] * scale.GetZ() + bias.GetZ();
-                pPixels[3] = pPixels[3] * scale.GetW() + bias.GetW();
-            }
+                float* pPixels = (float*)(imageMem + rowBegin * pitch);
+                const uint32 pixelCount = (rowEnd - rowBegin) * width;
+
+                for (uint32 i = 0; i < pixelCount; ++i, pPixels += 4)
+                {
+                    Vec4::StoreUnaligned(pPixels, Vec4::Madd(Vec4::LoadUnaligned(pPixels), vScale, vBias));
+                }
+            });
         }
     }
 
@@ -387,22 +416,28 @@ namespace ImageProcessingAtom
             return;
         }
 
+        using AZ::Simd::Vec4;
+        const Vec4::FloatType vMin = min.GetSimdValue();
+        const Vec4::FloatType vMax = max.GetSimdValue();
+
         const uint32 lastMip = AZ::GetMin(firstMip + maxMipCount, GetMipCount());
         for (uint32 mip = firstMip; mip < lastMip; ++mip)
         {
-            const uint32 pixelCount = GetPixelCount(mip);
+            const uint32 width = GetWidth(mip);
             uint8* imageMem;
             uint32 pitch;
             GetImagePointer(mip, imageMem, pitch);
-            float* pPixels = (float*)imageMem;
 
-            for (uint32 i = 0; i < pixelCount; ++i, pPixels += 4)
+            ForEachRowRange(GetHeight(mip), width, [&](uint32 rowBegin, uint32 rowEnd)
             {
-                pPixels[0] = AZ::GetClamp(pPixels[0], float(min.GetX()), float(max.GetX()));
-                pPixels[1] = AZ::GetClamp(pPixels[1], float(min.GetY()), float(max.GetY()));
-                pPixels[2] = AZ::GetClamp(pPixels[2], float(min.GetZ()), float(max.GetZ()));
-                pPixels[3] = AZ::GetClamp(pPixels[3], float(min.GetW()), float(max.GetW()));
-            }
+                float* pPixels = (float*)(imageMem + rowBegin * pitch);
+                const uint32 pixelCount = (rowEnd - rowBegin) * width;
+
+                for (uint32 i = 0; i < pixelCount; ++i, pPixels += 4)
+                {
+                    Vec4::StoreUnaligned(pPixels, Vec4::Clamp(Vec4::LoadUnaligned(pPixels), vMin, vMax));
+                }
+            });
         }
     }
 } //namespace ImageProcessingAtom
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/algorithm.h>
+
+namespace ImageProcessingAtom
+{
+    //the smallest number of pixels worth a job. Smaller images, like the tail of a mip chain, run on the calling thread
+    static constexpr AZ::u64 ParallelRowsPixelsPerJobMin = 16 * 1024;
+
+    //the number of jobs per worker thread, so a worker which finishes early can pick up more rows
+    static constexpr AZ::u64 ParallelRowsJobsPerWorker = 4;
+
+    //Calls function(rowBegin, rowEnd) for ranges of rows covering [0, rowCount), and returns once all rows are processed.
+    //The ranges run in parallel jobs when a global job context exists and the image is large enough, so the function must
+    //only write to the rows it was given.
+    template<class Function>
+    void ForEachRowRange(AZ::u32 rowCount, AZ::u32 pixelsPerRow, const Function& function)
+    {
+        AZ::u64 jobCount = 1;
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (jobContext)
+        {
+            const AZ::u64 workerCount = jobContext->GetJobManager().GetNumWorkerThreads();
+            const AZ::u64 pixelCount = static_cast<AZ::u64>(rowCount) * pixelsPerRow;
+            jobCount = AZStd::min<AZ::u64>(AZStd::min(pixelCount / ParallelRowsPixelsPerJobMin, workerCount * ParallelRowsJobsPerWorker), rowCount);
+        }
+
+        if (jobCount <= 1)
+        {
+            function(0u, rowCount);
+            return;
+        }
+
+        const AZ::u32 rowsPerJob = static_cast<AZ::u32>((rowCount + jobCount - 1) / jobCount);
+        AZ::JobCompletion jobCompletion;
+        for (AZ::u32 rowBegin = 0; rowBegin < rowCount; rowBegin += rowsPerJob)
+        {
+            const AZ::u32 rowEnd = AZStd::min(rowBegin + rowsPerJob, rowCount);
+            AZ::Job* job = AZ::CreateJobFunction([&function, rowBegin, rowEnd]()
+                {
+                    function(rowBegin, rowEnd);
+                }, true, jobContext);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+}// namespace ImageProcessingAtom
@@ -15,6 +15,9 @@
 
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Asset/AssetManagerComponent.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Math/Random.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/RTTI/ReflectionManager.h>
@@ -126,6 +129,8 @@ namespace UnitTest
         AZStd::unique_ptr<AZ::JsonRegistrationContext> m_jsonRegistrationContext;
         AZStd::unique_ptr<AZ::JsonSystemComponent> m_jsonSystemComponent;
         AZStd::vector<AZStd::unique_ptr<AZ::Data::AssetHandler>> m_assetHandlers;
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
         AZStd::string m_gemFolder;
 
         void SetUp() override
@@ -139,6 +144,17 @@ namespace UnitTest
             AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
             AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
 
+            // large images are filtered and converted in parallel jobs
+            AZ::JobManagerDesc jobManagerDesc;
+            const uint32_t workerCount = AZStd::max(4u, AZStd::thread::hardware_concurrency());
+            for (uint32_t i = 0; i < workerCount; ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+
             // AssetManager required to generate image assets
             AZ::Data::AssetManager::Descriptor desc;
             AZ::Data::AssetManager::Create(desc);
@@ -210,6 +226,10 @@ namespace UnitTest
 
             AZ::Data::AssetManager::Destroy();
 
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext = nullptr;
+            m_jobManager = nullptr;
+
             AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
             AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
 
@@ -317,6 +337,27 @@ namespace UnitTest
             }
         }
 
+        //helper function to create a RGBA32F image filled with random values in [0, 1]
+        static IImageObjectPtr CreateNoiseImage(AZ::u32 width, AZ::u32 height, AZ::u32 mipCount, AZ::u64 seed)
+        {
+            IImageObjectPtr image(IImageObject::CreateImage(width, height, mipCount, ePixelFormat_R32G32B32A32F));
+
+            AZ::SimpleLcgRandom random(seed);
+            for (uint32 mip = 0; mip < image->GetMipCount(); mip++)
+            {
+                uint8* imageBuf;
+                uint32 pitch;
+                image->GetImagePointer(mip, imageBuf, pitch);
+                float* pixels = reinterpret_cast<float*>(imageBuf);
+                const uint32 valueCount = image->GetPixelCount(mip) * 4;
+                for (uint32 i = 0; i < valueCount; i++)
+                {
+                    pixels[i] = random.GetRandomFloat();
+                }
+            }
+            return image;
+        }
+
         static bool GetComparisonResult(IImageObjectPtr image1, IImageObjectPtr image2, QString& output)
         {
             bool isImageLoaded = true;
@@ -911,6 +952,98 @@ namespace UnitTest
         }
     }
 
+    TEST_F(ImageProcessingTest, FilterImage_ImageSplitAcrossJobs_MatchesSingleThreadedResult)
+    {
+        const uint32 width = 512;
+        const uint32 height = 384;
+        const uint32 mipCount = 4;
+        IImageObjectPtr srcImage = CreateNoiseImage(width, height, 1, 1234);
+
+        const MipGenType filters[] = { MipGenType::box, MipGenType::kaiserSinc };
+        const MipGenEvalType evalTypes[] = { MipGenEvalType::sum, MipGenEvalType::max, MipGenEvalType::min };
+
+        for (MipGenType filter : filters)
+        {
+            for (MipGenEvalType evalType : evalTypes)
+            {
+                IImageObjectPtr jobsImage(IImageObject::CreateImage(width, height, mipCount, ePixelFormat_R32G32B32A32F));
+                IImageObjectPtr serialImage(IImageObject::CreateImage(width, height, mipCount, ePixelFormat_R32G32B32A32F));
+
+                for (uint32 mip = 0; mip < mipCount; mip++)
+                {
+                    FilterImage(filter, evalType, 0, 0, srcImage, 0, jobsImage, mip, nullptr, nullptr);
+                }
+
+                //without a job context every image is filtered on the calling thread
+                AZ::JobContext::SetGlobalContext(nullptr);
+                for (uint32 mip = 0; mip < mipCount; mip++)
+                {
+                    FilterImage(filter, evalType, 0, 0, srcImage, 0, serialImage, mip, nullptr, nullptr);
+                }
+                AZ::JobContext::SetGlobalContext(m_jobContext.get());
+
+                EXPECT_TRUE(jobsImage->CompareImage(serialImage));
+            }
+        }
+    }
+
+    TEST_F(ImageProcessingTest, ScaleAndClampChannels_ImageSplitAcrossJobs_MatchesPerChannelResult)
+    {
+        IImageObjectPtr image = CreateNoiseImage(512, 512, 2, 5678);
+        IImageObjectPtr srcImage(image->Clone());
+
+        const float scale[4] = { 2.0f, -1.0f, 0.5f, 1.0f };
+        const float bias[4] = { -0.5f, 0.25f, 0.0f, 0.1f };
+        image->ScaleAndBiasChannels(0, 2, AZ::Vector4::CreateFromFloat4(scale), AZ::Vector4::CreateFromFloat4(bias));
+        image->ClampChannels(0, 2, AZ::Vector4(0.0f), AZ::Vector4(1.0f));
+
+        uint32 mismatchCount = 0;
+        for (uint32 mip = 0; mip < image->GetMipCount(); mip++)
+        {
+            uint8* srcBuf;
+            uint8* dstBuf;
+            uint32 pitch;
+            srcImage->GetImagePointer(mip, srcBuf, pitch);
+            image->GetImagePointer(mip, dstBuf, pitch);
+            const float* srcValues = reinterpret_cast<const float*>(srcBuf);
+            const float* dstValues = reinterpret_cast<const float*>(dstBuf);
+
+            const uint32 valueCount = image->GetPixelCount(mip) * 4;
+            for (uint32 i = 0; i < valueCount; i++)
+            {
+                const float expected = AZ::GetClamp(srcValues[i] * scale[i % 4] + bias[i % 4], 0.0f, 1.0f);
+                mismatchCount += AZ::IsClose(dstValues[i], expected, 1e-6f) ? 0 : 1;
+            }
+        }
+        EXPECT_EQ(mismatchCount, 0u);
+    }
+
+    TEST_F(ImageProcessingTest, GammaRoundTrip_ImageSplitAcrossJobs_RestoresOriginalValues)
+    {
+        IImageObjectPtr srcImage = CreateNoiseImage(512, 512, 1, 9012);
+
+        ImageToProcess imageToProcess(IImageObjectPtr(srcImage->Clone()));
+        imageToProcess.GammaToLinearRGBA32F(true);
+        imageToProcess.LinearToGamma();
+
+        uint8* srcBuf;
+        uint8* dstBuf;
+        uint32 pitch;
+        srcImage->GetImagePointer(0, srcBuf, pitch);
+        imageToProcess.Get()->GetImagePointer(0, dstBuf, pitch);
+        const float* srcValues = reinterpret_cast<const float*>(srcBuf);
+        const float* dstValues = reinterpret_cast<const float*>(dstBuf);
+
+        //the lookup tables interpolate linearly, so the round trip isn't exact
+        uint32 mismatchCount = 0;
+        const uint32 valueCount = srcImage->GetPixelCount(0) * 4;
+        for (uint32 i = 0; i < valueCount; i++)
+        {
+            mismatchCount += AZ::IsClose(dstValues[i], srcValues[i], 1e-3f) ? 0 : 1;
+        }
+        EXPECT_EQ(mismatchCount, 0u);
+    }
+
     TEST_F(ImageProcessingTest, TestColorSpaceConversion)
     {
         IImageObjectPtr srcImage(LoadImageFromFile(m_imagFileNameMap[Image_GreyScale_Png]));
@@ -1111,6 +1244,96 @@ namespace UnitTest
 
 } // UnitTest
 
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Processes a square RGBA32F image the size of the benchmark argument, with a job manager using every core.
+    class BM_ImageProcessing
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            AZ::JobManagerDesc desc;
+            for (uint32_t i = 0; i < AZStd::thread::hardware_concurrency(); ++i)
+            {
+                desc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(desc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+
+            m_size = static_cast<uint32>(state.range(0));
+            m_image = IImageObjectPtr(IImageObject::CreateImage(m_size, m_size, 2, ePixelFormat_R32G32B32A32F));
+
+            AZ::SimpleLcgRandom random(1234);
+            uint8* imageBuf;
+            uint32 pitch;
+            m_image->GetImagePointer(0, imageBuf, pitch);
+            float* pixels = reinterpret_cast<float*>(imageBuf);
+            const uint32 valueCount = m_image->GetPixelCount(0) * 4;
+            for (uint32 i = 0; i < valueCount; ++i)
+            {
+                pixels[i] = random.GetRandomFloat();
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_image = nullptr;
+            CPixelFormats::DestroyInstance();
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext = nullptr;
+            m_jobManager = nullptr;
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        uint32 m_size = 0;
+        IImageObjectPtr m_image;
+
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+    };
+
+    BENCHMARK_DEFINE_F(BM_ImageProcessing, FilterMip)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            FilterImage(MipGenType::kaiserSinc, MipGenEvalType::sum, 0, 0, m_image, 0, m_image, 1, nullptr, nullptr);
+        }
+        state.SetItemsProcessed(state.iterations() * m_size * m_size);
+    }
+
+    BENCHMARK_DEFINE_F(BM_ImageProcessing, GammaToLinear)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            ImageToProcess imageToProcess(m_image);
+            imageToProcess.GammaToLinearRGBA32F(true);
+        }
+        state.SetItemsProcessed(state.iterations() * m_size * m_size);
+    }
+
+    BENCHMARK_DEFINE_F(BM_ImageProcessing, ScaleAndClampChannels)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            m_image->ScaleAndBiasChannels(0, 1, AZ::Vector4(0.5f), AZ::Vector4(0.25f));
+            m_image->ClampChannels(0, 1, AZ::Vector4(0.0f), AZ::Vector4(1.0f));
+        }
+        state.SetItemsProcessed(state.iterations() * m_size * m_size);
+    }
+
+    BENCHMARK_REGISTER_F(BM_ImageProcessing, FilterMip)->Arg(2048)->Arg(4096)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(BM_ImageProcessing, GammaToLinear)->Arg(2048)->Arg(4096)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(BM_ImageProcessing, ScaleAndClampChannels)->Arg(2048)->Arg(4096)->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
 
 
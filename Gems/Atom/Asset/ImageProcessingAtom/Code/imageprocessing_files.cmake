@@ -51,6 +51,7 @@ set(FILES
     Source/Processing/ImagePreview.cpp
     Source/Processing/ImagePreview.h
     Source/Processing/ImageToProcess.h
+    Source/Processing/ParallelRows.h
     Source/Processing/PixelFormatInfo.cpp
     Source/Processing/PixelFormatInfo.h
     Source/Processing/Utils.cpp
@@ -6,6 +6,8 @@
 #include <ImageProcessing_precompiled.h>
 #include "CCubeMapProcessor.h"
 
+#include <Processing/ParallelRows.h>
+
 #include <AzCore/std/bind/bind.h>
 #include <AzCore/std/string/string.h>
 
@@ -1730,10 +1732,14 @@ namespace ImageProcessingAtom
        m_ThreadProgress[0].m_CurrentFace = 0;
        
        //Filter the top mip level (initial filtering used for diffuse or blurred specular lighting )
-       FilterCubeSurfaces(m_InputSurface[0], m_OutputSurface[0], a_BaseFilterAngle, a_FilterType, a_bUseSolidAngle, 
-            0,  //start at face 0 
-            5,  //end at face 5
-            0); //thread 0 is processing
+       //faces only read the source cube map and the lookup tables, so they are filtered in parallel jobs.
+       //each job processes faces [faceBegin, faceEnd) and reports progress in the entry of faceBegin
+       const int32 topMipSize = m_OutputSurface[0][0].m_Width;
+       ImageProcessingAtom::ForEachRowRange(6, topMipSize * topMipSize, [&](AZ::u32 faceBegin, AZ::u32 faceEnd)
+       {
+          FilterCubeSurfaces(m_InputSurface[0], m_OutputSurface[0], a_BaseFilterAngle, a_FilterType, a_bUseSolidAngle,
+               static_cast<int32>(faceBegin), static_cast<int32>(faceEnd) - 1, static_cast<int32>(faceBegin));
+       });
 
        m_ThreadProgress[0].m_CurrentMipLevel = 1;
        m_ThreadProgress[0].m_CurrentRow = 0;
@@ -1752,14 +1758,14 @@ namespace ImageProcessingAtom
           m_ThreadProgress[0].m_CurrentRow = 0;
           m_ThreadProgress[0].m_CurrentFace = 0;
 
+          const int32 mipSize = m_OutputSurface[i+1][0].m_Width;
+
           if (a_FilterType == CP_FILTER_TYPE_GGX)
           {
-            FilterCubeSurfacesGGX(i + 1,
-              a_SampleCountGGX,
-              0,  //start at face 0 
-              5,  //end at face 5
-              0   //thread 0 is processing
-              );
+            ImageProcessingAtom::ForEachRowRange(6, mipSize * mipSize, [&](AZ::u32 faceBegin, AZ::u32 faceEnd)
+            {
+              FilterCubeSurfacesGGX(i + 1, a_SampleCountGGX, static_cast<int32>(faceBegin), static_cast<int32>(faceEnd) - 1, static_cast<int32>(faceBegin));
+            });
           }
           else
           {
@@ -1785,11 +1791,11 @@ namespace ImageProcessingAtom
             PrecomputeFilterLookupTables(a_FilterType, srcCubeImage->m_Width, coneAngle);
 
             //filter cube surfaces
-            FilterCubeSurfaces(srcCubeImage, m_OutputSurface[i+1], coneAngle, a_FilterType, a_bUseSolidAngle,
-              0,  //start at face 0 
-              5,  //end at face 5
-              0,  //thread 0 is processing
-              specPow);
+            ImageProcessingAtom::ForEachRowRange(6, mipSize * mipSize, [&](AZ::u32 faceBegin, AZ::u32 faceEnd)
+            {
+              FilterCubeSurfaces(srcCubeImage, m_OutputSurface[i+1], coneAngle, a_FilterType, a_bUseSolidAngle,
+                static_cast<int32>(faceBegin), static_cast<int32>(faceEnd) - 1, static_cast<int32>(faceBegin), specPow);
+            });
           }
 
           m_ThreadProgress[0].m_CurrentMipLevel = i+2;
@@ -109,6 +109,9 @@
 //maximum number of threads running for cubemap processor is 2
 #define CP_MAX_FILTER_THREADS 2
 
+//the faces of each mip level are filtered in separate jobs, and each job reports progress in the entry of its first face
+#define CP_MAX_FILTER_PROGRESS 6
+
 //initial number of filtering threads for cubemap processor
 #define CP_INITIAL_NUM_FILTER_THREADS 1
 
@@ -206,7 +209,7 @@ namespace ImageProcessingAtom
         AZStd::thread       m_ThreadHandle[CP_MAX_FILTER_THREADS];
 
         AZ::u32            m_ThreadID[CP_MAX_FILTER_THREADS];
-        SFilterProgress  m_ThreadProgress[CP_MAX_FILTER_THREADS];
+        SFilterProgress  m_ThreadProgress[CP_MAX_FILTER_PROGRESS];
         WCHAR             m_ProgressString[CP_MAX_PROGRESS_STRING];
 
         //filtering parameters last used for filtering
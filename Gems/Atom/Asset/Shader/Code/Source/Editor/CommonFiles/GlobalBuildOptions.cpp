@@ -27,7 +27,8 @@ namespace AZ
                 serializeContext->Class<GlobalBuildOptions>()
                     ->Version(1)
                     ->Field("PreprocessorOptions", &GlobalBuildOptions::m_preprocessorSettings)
-                    ->Field("ShaderCompilerArguments", &GlobalBuildOptions::m_compilerArguments);
+                    ->Field("ShaderCompilerArguments", &GlobalBuildOptions::m_compilerArguments)
+                    ->Field("ByteCodeCacheFolder", &GlobalBuildOptions::m_byteCodeCacheFolder);
             }
         }
 
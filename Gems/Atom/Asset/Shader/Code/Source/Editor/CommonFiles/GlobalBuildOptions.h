@@ -27,6 +27,10 @@ namespace AZ
 
             //! command line arguments related to warnings, optimizations, matrices order and others.
             RHI::ShaderCompilerArguments m_compilerArguments;
+
+            //! folder of the cache which shares compiled shader functions between variants and builds, see ShaderByteCodeCache.
+            //! relative to the project user folder. empty disables the cache.
+            AZStd::string m_byteCodeCacheFolder;
         };
 
         //! Reads the global options used when compiling shaders. The options are defined in <GameProject>/Config/shader_global_build_options.json
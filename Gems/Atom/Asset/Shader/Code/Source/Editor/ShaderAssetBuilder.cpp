@@ -257,6 +257,7 @@ namespace AZ
             AZStd::string azslFolderPath;
             AzFramework::StringFunc::Path::GetFolderPath(azslFullPath.c_str(), azslFolderPath);
             GlobalBuildOptions buildOptions = ReadBuildOptions(ShaderAssetBuilderName, azslFolderPath.c_str());
+            const ShaderByteCodeCache byteCodeCache(buildOptions.m_byteCodeCacheFolder);
 
             // Request the list of valid shader platform interfaces for the target platform.
             AZStd::vector<RHI::ShaderPlatformInterface*> platformInterfaces = ShaderBuilderUtility::DiscoverEnabledShaderPlatformInterfaces(
@@ -592,7 +593,8 @@ namespace AZ
                         variantAssetId,
                         superVariantAzslinStemName,
                         hlslFullPath,
-                        hlslSourceCode};
+                        hlslSourceCode,
+                        byteCodeCache};
 
 
                     AZStd::optional<RHI::ShaderPlatformInterface::ByProducts> outputByproducts;
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <ShaderByteCodeCache.h>
+
+#include <CommonFiles/Preprocessor.h>
+
+#include <AzFramework/StringFunc/StringFunc.h>
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    namespace ShaderBuilder
+    {
+        static constexpr char ShaderByteCodeCacheName[] = "ShaderByteCodeCache";
+
+        namespace
+        {
+            // Increase when the format of the entries, or what goes into the key, changes.
+            // Entries from another version are never found, because the version is part of the key.
+            constexpr uint32_t CacheVersion = 2;
+
+            constexpr uint32_t EntryMagic = 0x42535A41; // "AZSB"
+
+            struct EntryHeader
+            {
+                uint32_t m_magic = EntryMagic;
+                uint32_t m_version = CacheVersion;
+                uint32_t m_stageType = 0;
+                uint32_t m_dynamicBranchCount = 0;
+                uint64_t m_byteCodeSize = 0;
+                uint64_t m_sourceCodeSize = 0;
+                uint64_t m_entryFunctionNameSize = 0;
+            };
+        }
+
+        ShaderByteCodeCache::ShaderByteCodeCache(const AZStd::string& cacheFolder)
+        {
+            if (cacheFolder.empty())
+            {
+                return;
+            }
+
+            if (AzFramework::StringFunc::Path::IsRelative(cacheFolder.c_str()))
+            {
+                AZ::IO::Path projectUserPath;
+                auto settingsRegistry = AZ::SettingsRegistry::Get();
+                if (!settingsRegistry || !settingsRegistry->Get(projectUserPath.Native(), AZ::SettingsRegistryMergeUtils::FilePathKey_ProjectUserPath))
+                {
+                    AZ_Warning(ShaderByteCodeCacheName, false, "The project user folder is unknown, the shader bytecode cache [%s] is disabled.", cacheFolder.c_str());
+                    return;
+                }
+                m_cacheFolder = (projectUserPath / cacheFolder).LexicallyNormal().Native();
+            }
+            else
+            {
+                m_cacheFolder = cacheFolder;
+            }
+        }
+
+        bool ShaderByteCodeCache::IsEnabled() const
+        {
+            return !m_cacheFolder.empty();
+        }
+
+        bool ShaderByteCodeCache::CanCacheCompilation(
+            const RHI::ShaderPlatformInterface& shaderPlatformInterface, const RHI::ShaderCompilerArguments& shaderCompilerArguments)
+        {
+            // Platforms which need the pipeline layout compile with state that isn't part of the key.
+            // Without the compiler version, entries written by a different compiler couldn't be told apart.
+            return !shaderPlatformInterface.VariantCompilationRequiresSrgLayoutData() &&
+                !shaderPlatformInterface.BuildHasDebugInfo(shaderCompilerArguments) &&
+                !shaderPlatformInterface.GetCompilerVersion().empty();
+        }
+
+        bool ShaderByteCodeCache::PreprocessSource(const AZStd::string& hlslSourcePath, AZStd::string& preprocessedHlsl)
+        {
+            PreprocessorData output;
+            if (!PreprocessFile(hlslSourcePath, output, PreprocessorOptions{}, true))
+            {
+                AZ_TracePrintf(ShaderByteCodeCacheName, "Failed to preprocess [%s], compiling without the cache: %s", hlslSourcePath.c_str(), output.diagnostics.c_str());
+                return false;
+            }
+
+            // The line directives carry the path of the file, which is different for every job.
+            AZStd::string forwardSlashPath = hlslSourcePath;
+            AZStd::replace(forwardSlashPath.begin(), forwardSlashPath.end(), '\\', '/');
+            AzFramework::StringFunc::Replace(output.code, hlslSourcePath.c_str(), "", true);
+            AzFramework::StringFunc::Replace(output.code, forwardSlashPath.c_str(), "", true);
+
+            preprocessedHlsl = AZStd::move(output.code);
+            return true;
+        }
+
+        AZStd::string ShaderByteCodeCache::MakeKey(
+            AZStd::string_view apiName,
+            AZStd::string_view platformIdentifier,
+            AZStd::string_view compilerVersion,
+            const RHI::ShaderCompilerArguments& shaderCompilerArguments,
+            AZStd::string_view entryFunctionName,
+            RHI::ShaderHardwareStage shaderStage,
+            AZStd::string_view preprocessedHlsl)
+        {
+            AZStd::string keySource = AZStd::string::format(
+                "version=%u\napi=%.*s\nplatform=%.*s\ncompiler=%.*s\nentry=%.*s\nstage=%u\ndxc=%s\n",
+                CacheVersion,
+                aznumeric_cast<int>(apiName.size()), apiName.data(),
+                aznumeric_cast<int>(platformIdentifier.size()), platformIdentifier.data(),
+                aznumeric_cast<int>(compilerVersion.size()), compilerVersion.data(),
+                aznumeric_cast<int>(entryFunctionName.size()), entryFunctionName.data(),
+                static_cast<uint32_t>(shaderStage),
+                shaderCompilerArguments.MakeAdditionalDxcCommandLineString().c_str());
+            keySource += preprocessedHlsl;
+
+            return Uuid::CreateData(keySource.data(), keySource.size()).ToString<AZStd::string>(false, false);
+        }
+
+        AZStd::string ShaderByteCodeCache::GetEntryPath(AZStd::string_view apiName, const AZStd::string& key) const
+        {
+            // Spread the entries over subfolders, since a project can have hundreds of thousands of them.
+            return AZStd::string::format(
+                "%s/%.*s/%s/%s.bin", m_cacheFolder.c_str(), aznumeric_cast<int>(apiName.size()), apiName.data(), key.substr(0, 2).c_str(), key.c_str());
+        }
+
+        bool ShaderByteCodeCache::Load(AZStd::string_view apiName, const AZStd::string& key, RHI::ShaderPlatformInterface::StageDescriptor& descriptor) const
+        {
+            if (!IsEnabled())
+            {
+                return false;
+            }
+
+            const AZStd::string entryPath = GetEntryPath(apiName, key);
+            const uint64_t entrySize = AZ::IO::SystemFile::Length(entryPath.c_str());
+            if (entrySize < sizeof(EntryHeader))
+            {
+                return false;
+            }
+
+            AZStd::vector<uint8_t> entry(entrySize);
+            if (AZ::IO::SystemFile::Read(entryPath.c_str(), entry.data(), entry.size()) != entry.size())
+            {
+                return false;
+            }
+
+            EntryHeader header;
+            memcpy(&header, entry.data(), sizeof(header));
+            if (header.m_magic != EntryMagic || header.m_version != CacheVersion ||
+                entrySize != sizeof(EntryHeader) + header.m_byteCodeSize + header.m_sourceCodeSize + header.m_entryFunctionNameSize)
+            {
+                AZ_Warning(ShaderByteCodeCacheName, false, "Ignoring the invalid shader bytecode cache entry [%s].", entryPath.c_str());
+                return false;
+            }
+
+            const uint8_t* data = entry.data() + sizeof(EntryHeader);
+            descriptor.m_stageType = static_cast<RHI::ShaderHardwareStage>(header.m_stageType);
+            descriptor.m_byteCode.assign(data, data + header.m_byteCodeSize);
+            data += header.m_byteCodeSize;
+            descriptor.m_sourceCode.assign(data, data + header.m_sourceCodeSize);
+            data += header.m_sourceCodeSize;
+            descriptor.m_entryFunctionName.assign(reinterpret_cast<const char*>(data), header.m_entryFunctionNameSize);
+            descriptor.m_byProducts.m_dynamicBranchCount = header.m_dynamicBranchCount;
+            return true;
+        }
+
+        void ShaderByteCodeCache::Store(AZStd::string_view apiName, const AZStd::string& key, const RHI::ShaderPlatformInterface::StageDescriptor& descriptor) const
+        {
+            if (!IsEnabled())
+            {
+                return;
+            }
+
+            EntryHeader header;
+            header.m_stageType = static_cast<uint32_t>(descriptor.m_stageType);
+            header.m_dynamicBranchCount = descriptor.m_byProducts.m_dynamicBranchCount;
+            header.m_byteCodeSize = descriptor.m_byteCode.size();
+            header.m_sourceCodeSize = descriptor.m_sourceCode.size();
+            header.m_entryFunctionNameSize = descriptor.m_entryFunctionName.size();
+
+            // Other builders may be reading or writing the same entry, so it's written under a unique name and then
+            // renamed, which never exposes a partially written entry.
+            const AZStd::string entryPath = GetEntryPath(apiName, key);
+            const AZStd::string tempEntryPath = entryPath + "." + Uuid::CreateRandom().ToString<AZStd::string>(false, false) + ".tmp";
+
+            AZ::IO::SystemFile file;
+            if (!file.Open(tempEntryPath.c_str(),
+                AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+            {
+                AZ_Warning(ShaderByteCodeCacheName, false, "Failed to create the shader bytecode cache entry [%s].", tempEntryPath.c_str());
+                return;
+            }
+
+            bool written = file.Write(&header, sizeof(header)) == sizeof(header);
+            written = written && file.Write(descriptor.m_byteCode.data(), header.m_byteCodeSize) == header.m_byteCodeSize;
+            written = written && file.Write(descriptor.m_sourceCode.data(), header.m_sourceCodeSize) == header.m_sourceCodeSize;
+            written = written && file.Write(descriptor.m_entryFunctionName.data(), header.m_entryFunctionNameSize) == header.m_entryFunctionNameSize;
+            file.Close();
+
+            if (!written || !AZ::IO::SystemFile::Rename(tempEntryPath.c_str(), entryPath.c_str(), true))
+            {
+                AZ_Warning(ShaderByteCodeCacheName, false, "Failed to write the shader bytecode cache entry [%s].", entryPath.c_str());
+                AZ::IO::SystemFile::Delete(tempEntryPath.c_str());
+            }
+        }
+    } // ShaderBuilder
+} // AZ
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI.Edit/ShaderCompilerArguments.h>
+#include <Atom/RHI.Edit/ShaderPlatformInterface.h>
+
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    namespace ShaderBuilder
+    {
+        //! A content addressed cache of compiled shader functions.
+        //! Many shader variants resolve to the same HLSL once their option values are folded by the preprocessor,
+        //! and the same variant is compiled again by every rebuild of its shader. The cache stores the output of
+        //! ShaderPlatformInterface::CompilePlatformInternal() in a file named after the hash of the preprocessed HLSL,
+        //! the entry point, the stage, the compiler arguments and the compiler version, so identical inputs are only
+        //! compiled once, across variants, supervariants, builder processes and, when the folder is shared, machines.
+        class ShaderByteCodeCache final
+        {
+        public:
+            //! @param cacheFolder The root folder of the cache. Relative paths are relative to the project user folder.
+            //!        An empty string disables the cache.
+            explicit ShaderByteCodeCache(const AZStd::string& cacheFolder);
+
+            bool IsEnabled() const;
+
+            //! Returns whether functions compiled by @shaderPlatformInterface can be cached. They can't when the compilation
+            //! depends on more than the HLSL and the compiler arguments, when it produces debug information byproducts,
+            //! or when the version of the compiler is unknown.
+            static bool CanCacheCompilation(
+                const RHI::ShaderPlatformInterface& shaderPlatformInterface, const RHI::ShaderCompilerArguments& shaderCompilerArguments);
+
+            //! Runs the preprocessor on the HLSL file which is about to be compiled, and removes the path of the file from
+            //! the result, so the same code preprocessed in different job folders gets the same key.
+            //! @return false if the file couldn't be preprocessed, in which case it should be compiled without the cache.
+            static bool PreprocessSource(const AZStd::string& hlslSourcePath, AZStd::string& preprocessedHlsl);
+
+            //! Returns the hash which identifies the compilation of one shader function.
+            static AZStd::string MakeKey(
+                AZStd::string_view apiName,
+                AZStd::string_view platformIdentifier,
+                AZStd::string_view compilerVersion,
+                const RHI::ShaderCompilerArguments& shaderCompilerArguments,
+                AZStd::string_view entryFunctionName,
+                RHI::ShaderHardwareStage shaderStage,
+                AZStd::string_view preprocessedHlsl);
+
+            //! Loads the function compiled for @key into @descriptor. Returns false if the cache has no valid entry for @key.
+            bool Load(AZStd::string_view apiName, const AZStd::string& key, RHI::ShaderPlatformInterface::StageDescriptor& descriptor) const;
+
+            //! Stores the function compiled for @key. Failing to store is not an error, the function is compiled again next time.
+            void Store(AZStd::string_view apiName, const AZStd::string& key, const RHI::ShaderPlatformInterface::StageDescriptor& descriptor) const;
+
+        private:
+            AZStd::string GetEntryPath(AZStd::string_view apiName, const AZStd::string& key) const;
+
+            AZStd::string m_cacheFolder;
+        };
+    } // ShaderBuilder
+} // AZ
@@ -781,6 +781,7 @@ namespace AZ
             auto supervariantList = ShaderBuilderUtility::GetSupervariantListFromShaderSourceData(shaderSourceDescriptor);
 
             GlobalBuildOptions buildOptions = ReadBuildOptions(ShaderVariantAssetBuilderName);
+            const ShaderByteCodeCache byteCodeCache(buildOptions.m_byteCodeCacheFolder);
             // At this moment We have global build options that should be merged with the build options that are common
             // to all the supervariants of this shader.
             buildOptions.m_compilerArguments.Merge(shaderSourceDescriptor.m_compiler);
@@ -920,7 +921,8 @@ namespace AZ
                         shaderEntryPoints,
                         Uuid::CreateRandom(),
                         shaderStemNamePrefix,
-                        hlslSourcePath, hlslCode
+                        hlslSourcePath, hlslCode,
+                        byteCodeCache
                     };
 
                     AZStd::optional<RHI::ShaderPlatformInterface::ByProducts> outputByproducts;
@@ -1102,6 +1104,13 @@ namespace AZ
                 shaderOptions.IsFullySpecified());
             variantCreator.SetBuildTimestamp(creationContext.m_assetBuildTimestamp);
 
+            // The variant is preprocessed once, its entry points are looked up in the cache with the same code.
+            const AZ::Name apiName = creationContext.m_shaderPlatformInterface.GetAPIName();
+            AZStd::string preprocessedHlsl;
+            const bool useByteCodeCache = creationContext.m_byteCodeCache.IsEnabled() &&
+                ShaderByteCodeCache::CanCacheCompilation(creationContext.m_shaderPlatformInterface, creationContext.m_shaderCompilerArguments) &&
+                ShaderByteCodeCache::PreprocessSource(variantShaderSourcePath, preprocessedHlsl);
+
             const AZStd::unordered_map<AZStd::string, RPI::ShaderStageType>& shaderEntryPoints = creationContext.m_shaderEntryPoints;
             for (const auto& shaderEntryPoint : shaderEntryPoints)
             {
@@ -1113,15 +1122,36 @@ namespace AZ
 
                 auto assetBuilderShaderType = ShaderBuilderUtility::ToAssetBuilderShaderType(shaderStageType);
 
-                // Compile HLSL to the platform specific shader.
                 RHI::ShaderPlatformInterface::StageDescriptor descriptor;
-                bool shaderWasCompiled = creationContext.m_shaderPlatformInterface.CompilePlatformInternal(
-                    creationContext.m_platformInfo, variantShaderSourcePath, shaderEntryName, assetBuilderShaderType,
-                    creationContext.m_tempDirPath, descriptor, creationContext.m_shaderCompilerArguments);
+                AZStd::string byteCodeCacheKey;
+                if (useByteCodeCache)
+                {
+                    byteCodeCacheKey = ShaderByteCodeCache::MakeKey(
+                        apiName.GetStringView(), creationContext.m_platformInfo.m_identifier,
+                        creationContext.m_shaderPlatformInterface.GetCompilerVersion(), creationContext.m_shaderCompilerArguments,
+                        shaderEntryName, assetBuilderShaderType, preprocessedHlsl);
+                }
 
-                if (!shaderWasCompiled)
+                if (useByteCodeCache && creationContext.m_byteCodeCache.Load(apiName.GetStringView(), byteCodeCacheKey, descriptor))
+                {
+                    AZ_TracePrintf(ShaderVariantAssetBuilderName, "Reusing the cached shader function %s", byteCodeCacheKey.c_str());
+                }
+                else
                 {
-                    return AZ::Failure(AZStd::string::format("Could not compile the shader function %s", shaderEntryName.c_str()));
+                    // Compile HLSL to the platform specific shader.
+                    bool shaderWasCompiled = creationContext.m_shaderPlatformInterface.CompilePlatformInternal(
+                        creationContext.m_platformInfo, variantShaderSourcePath, shaderEntryName, assetBuilderShaderType,
+                        creationContext.m_tempDirPath, descriptor, creationContext.m_shaderCompilerArguments);
+
+                    if (!shaderWasCompiled)
+                    {
+                        return AZ::Failure(AZStd::string::format("Could not compile the shader function %s", shaderEntryName.c_str()));
+                    }
+
+                    if (useByteCodeCache)
+                    {
+                        creationContext.m_byteCodeCache.Store(apiName.GetStringView(), byteCodeCacheKey, descriptor);
+                    }
                 }
                 // bubble up the byproducts to the caller by moving them to the context.
                 outputByproducts.emplace(AZStd::move(descriptor.m_byProducts));
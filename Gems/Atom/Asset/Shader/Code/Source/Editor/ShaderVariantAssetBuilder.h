@@ -18,6 +18,7 @@
 #include <Atom/RPI.Edit/Shader/ShaderVariantListSourceData.h>
 
 #include "ShaderBuilderUtility.h"
+#include "ShaderByteCodeCache.h"
 
 namespace AZ
 {
@@ -46,6 +47,8 @@ namespace AZ
             const AZStd::string& m_shaderStemNamePrefix; //<shaderName>-<supervariantName>
             const AZStd::string& m_hlslSourcePath;
             const AZStd::string& m_hlslSourceContent;
+            //! Shares compiled shader functions with other variants and builds which compile the same code.
+            const ShaderByteCodeCache& m_byteCodeCache;
         };
 
         class ShaderVariantAssetBuilder
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <ShaderByteCodeCache.h>
+
+#include "Common/ShaderBuilderTestFixture.h"
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    class ShaderByteCodeCacheTests : public ShaderBuilderTestFixture
+    {
+    protected:
+        static constexpr char ApiName[] = "dx12";
+        static constexpr char PlatformIdentifier[] = "pc";
+        static constexpr char CompilerVersion[] = "dxcompiler.dll: 1.6 - 1.6.2106.5 (7c9c6fb7)";
+        static constexpr char EntryName[] = "MainPS";
+        static constexpr char Hlsl[] = "float4 MainPS() : SV_Target0 { return float4(1, 0, 0, 1); }\n";
+
+        AZStd::string MakeKey(AZStd::string_view hlsl, const RHI::ShaderCompilerArguments& arguments = {}) const
+        {
+            return ShaderBuilder::ShaderByteCodeCache::MakeKey(
+                ApiName, PlatformIdentifier, CompilerVersion, arguments, EntryName, RHI::ShaderHardwareStage::Fragment, hlsl);
+        }
+
+        static RHI::ShaderPlatformInterface::StageDescriptor MakeDescriptor()
+        {
+            RHI::ShaderPlatformInterface::StageDescriptor descriptor;
+            descriptor.m_stageType = RHI::ShaderHardwareStage::Fragment;
+            descriptor.m_byteCode = { 'D', 'X', 'B', 'C', 1, 2, 3, 4 };
+            descriptor.m_entryFunctionName = EntryName;
+            descriptor.m_byProducts.m_dynamicBranchCount = 3;
+            return descriptor;
+        }
+    };
+
+    TEST_F(ShaderByteCodeCacheTests, MakeKey_SameInputs_SameKey)
+    {
+        EXPECT_EQ(MakeKey(Hlsl), MakeKey(Hlsl));
+    }
+
+    TEST_F(ShaderByteCodeCacheTests, MakeKey_DifferentInputs_DifferentKeys)
+    {
+        const AZStd::string key = MakeKey(Hlsl);
+
+        EXPECT_NE(key, MakeKey("float4 MainPS() : SV_Target0 { return float4(0, 1, 0, 1); }\n"));
+
+        RHI::ShaderCompilerArguments arguments;
+        arguments.m_dxcDisableOptimizations = true;
+        EXPECT_NE(key, MakeKey(Hlsl, arguments));
+
+        EXPECT_NE(key, ShaderBuilder::ShaderByteCodeCache::MakeKey(
+            "vulkan", PlatformIdentifier, CompilerVersion, {}, EntryName, RHI::ShaderHardwareStage::Fragment, Hlsl));
+        EXPECT_NE(key, ShaderBuilder::ShaderByteCodeCache::MakeKey(
+            ApiName, PlatformIdentifier, "dxcompiler.dll: 1.7 - 1.7.2212.1 (71f2766b)", {}, EntryName, RHI::ShaderHardwareStage::Fragment, Hlsl));
+        EXPECT_NE(key, ShaderBuilder::ShaderByteCodeCache::MakeKey(
+            ApiName, PlatformIdentifier, CompilerVersion, {}, "MainVS", RHI::ShaderHardwareStage::Fragment, Hlsl));
+        EXPECT_NE(key, ShaderBuilder::ShaderByteCodeCache::MakeKey(
+            ApiName, PlatformIdentifier, CompilerVersion, {}, EntryName, RHI::ShaderHardwareStage::Compute, Hlsl));
+    }
+
+    TEST_F(ShaderByteCodeCacheTests, Load_StoredEntry_RestoresDescriptor)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const ShaderBuilder::ShaderByteCodeCache cache(tempDirectory.GetDirectory());
+        ASSERT_TRUE(cache.IsEnabled());
+
+        const AZStd::string key = MakeKey(Hlsl);
+        RHI::ShaderPlatformInterface::StageDescriptor descriptor;
+        EXPECT_FALSE(cache.Load(ApiName, key, descriptor));
+
+        const RHI::ShaderPlatformInterface::StageDescriptor storedDescriptor = MakeDescriptor();
+        cache.Store(ApiName, key, storedDescriptor);
+
+        ASSERT_TRUE(cache.Load(ApiName, key, descriptor));
+        EXPECT_EQ(storedDescriptor.m_stageType, descriptor.m_stageType);
+        EXPECT_EQ(storedDescriptor.m_byteCode, descriptor.m_byteCode);
+        EXPECT_EQ(storedDescriptor.m_sourceCode, descriptor.m_sourceCode);
+        EXPECT_EQ(storedDescriptor.m_entryFunctionName, descriptor.m_entryFunctionName);
+        EXPECT_EQ(storedDescriptor.m_byProducts.m_dynamicBranchCount, descriptor.m_byProducts.m_dynamicBranchCount);
+
+        EXPECT_FALSE(cache.Load("vulkan", key, descriptor));
+    }
+
+    TEST_F(ShaderByteCodeCacheTests, Load_TruncatedEntry_IsAMiss)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const ShaderBuilder::ShaderByteCodeCache cache(tempDirectory.GetDirectory());
+
+        const AZStd::string key = MakeKey(Hlsl);
+        cache.Store(ApiName, key, MakeDescriptor());
+
+        // Truncate the entry, as if the builder writing it had been killed.
+        const AZStd::string entryPath = AZStd::string::format("%s/%s/%s/%s.bin", tempDirectory.GetDirectory(), ApiName, key.substr(0, 2).c_str(), key.c_str());
+        const AZ::u64 entrySize = AZ::IO::SystemFile::Length(entryPath.c_str());
+        ASSERT_GT(entrySize, 0);
+        AZStd::vector<uint8_t> entry(entrySize);
+        AZ::IO::SystemFile::Read(entryPath.c_str(), entry.data());
+        AZ::IO::SystemFile file;
+        ASSERT_TRUE(file.Open(entryPath.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY));
+        file.Write(entry.data(), entry.size() - 1);
+        file.Close();
+
+        RHI::ShaderPlatformInterface::StageDescriptor descriptor;
+        EXPECT_FALSE(cache.Load(ApiName, key, descriptor));
+    }
+
+    TEST_F(ShaderByteCodeCacheTests, EmptyFolder_CacheIsDisabled)
+    {
+        const ShaderBuilder::ShaderByteCodeCache cache("");
+        EXPECT_FALSE(cache.IsEnabled());
+
+        const AZStd::string key = MakeKey(Hlsl);
+        cache.Store(ApiName, key, MakeDescriptor());
+
+        RHI::ShaderPlatformInterface::StageDescriptor descriptor;
+        EXPECT_FALSE(cache.Load(ApiName, key, descriptor));
+    }
+} // namespace UnitTest
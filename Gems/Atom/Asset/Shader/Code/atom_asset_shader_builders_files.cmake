@@ -22,6 +22,8 @@ set(FILES
     Source/Editor/ShaderAssetBuilder.h
     Source/Editor/ShaderBuilderUtility.cpp
     Source/Editor/ShaderBuilderUtility.h
+    Source/Editor/ShaderByteCodeCache.cpp
+    Source/Editor/ShaderByteCodeCache.h
     Source/Editor/ShaderPlatformInterfaceRequest.h
     Source/Editor/AzslCompiler.cpp
     Source/Editor/AzslCompiler.h
@@ -9,5 +9,6 @@
 set(FILES
     Tests/Common/ShaderBuilderTestFixture.h
     Tests/Common/ShaderBuilderTestFixture.cpp
+    Tests/ShaderByteCodeCacheTests.cpp
     Tests/SupervariantCmdArgumentTests.cpp
 )
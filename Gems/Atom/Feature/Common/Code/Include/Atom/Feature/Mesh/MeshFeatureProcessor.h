@@ -9,7 +9,9 @@
 #pragma once
 
 #include <Atom/Feature/Mesh/MeshFeatureProcessorInterface.h>
+#include <Atom/Feature/Mesh/MeshInstanceManager.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/MeshDrawPacket.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
 #include <Atom/Feature/Material/MaterialAssignment.h>
@@ -66,7 +68,10 @@ namespace AZ
             void SetLodOverride(RPI::Cullable::LodOverride lodOverride);
             RPI::Cullable::LodOverride GetLodOverride();
             void UpdateDrawPackets(bool forceUpdate = false);
-            void BuildCullable();
+            void BuildCullable(bool allowInstancing);
+            void ReleaseInstanceGroups();
+            void AddStreamingImages(const Data::Instance<RPI::Material>& material, float uvDensity, RPI::Cullable::LodData::Lod& lod);
+            bool CanUseInstancing() const;
             void UpdateCullBounds(const TransformServiceFeatureProcessor* transformService);
             void UpdateObjectSrg();
             bool MaterialRequiresForwardPassIblSpecular(Data::Instance<RPI::Material> material) const;
@@ -91,6 +96,16 @@ namespace AZ
 
             TransformServiceFeatureProcessorInterface::ObjectId m_objectId;
 
+            //! Draws the mesh instanced together with identical meshes, see BuildCullable()
+            MeshInstanceManager* m_instanceManager = nullptr;
+            AZStd::vector<uint32_t> m_instanceGroupIds;
+
+            //! Keeps the streaming images of the cullable's lods alive, see BuildCullable()
+            AZStd::vector<Data::Instance<RPI::StreamingImage>> m_streamingImages;
+
+            //! The uv density of each mesh of each lod, per unit of length in model space, see RPI::ModelLodUtils::ApproxUvDensity()
+            AZStd::fixed_vector<AZStd::vector<float>, RPI::ModelLodAsset::LodCountMax> m_uvDensitiesByLod;
+
             Aabb m_aabb = Aabb::CreateNull();
 
             bool m_cullBoundsNeedsUpdate = false;
@@ -99,6 +114,7 @@ namespace AZ
             bool m_excludeFromReflectionCubeMaps = false;
             bool m_visible = true;
             bool m_hasForwardPassIblSpecularMaterial = false;
+            bool m_hasExternalObjectSrgData = false;
         };
 
         //! This feature processor handles static and dynamic non-skinned meshes.
@@ -121,6 +137,8 @@ namespace AZ
             void Deactivate() override;
             //! Updates GPU buffers with latest data from render proxies
             void Simulate(const FeatureProcessor::SimulatePacket& packet) override;
+            //! Adds the instanced draws of the visible meshes to the views
+            void OnEndCulling(const FeatureProcessor::RenderPacket& packet) override;
 
             // RPI::SceneNotificationBus overrides ...
             void OnBeginPrepareRender() override;
@@ -184,7 +202,9 @@ namespace AZ
             TransformServiceFeatureProcessor* m_transformService;
             RayTracingFeatureProcessor* m_rayTracingFeatureProcessor = nullptr;
             AZ::RPI::ShaderSystemInterface::GlobalShaderOptionUpdatedEvent::Handler m_handleGlobalShaderOptionUpdate;
+            MeshInstanceManager m_instanceManager;
             bool m_forceRebuildDrawPackets = false;
+            bool m_meshInstancingEnabled = false;
         };
     } // namespace Render
 } // namespace AZ
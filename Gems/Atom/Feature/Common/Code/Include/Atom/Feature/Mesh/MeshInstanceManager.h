@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI/DrawPacket.h>
+#include <Atom/RHI/ThreadLocalContext.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class Material;
+        class ModelLod;
+    }
+
+    namespace Render
+    {
+        //! Draws the visible instances of meshes that share a model lod, mesh and material with a single instanced draw per view.
+        //!
+        //! Meshes put their draw packets in instance groups rather than adding them to views directly. Culling reports the visible
+        //! instances of each group to the manager, then once culling is done the object ids of the instances are written to a
+        //! buffer shared by all groups, and an instanced copy of one of the instances' draw packets is added to the view. The copy
+        //! binds an ObjectSrg pointing the shaders to the instances' object ids, see ObjectSrg::GetObjectId().
+        class MeshInstanceManager final
+            : public RPI::CullableInstanceCollector
+        {
+        public:
+            //! Draw packets with the same key only differ by their ObjectSrg.
+            struct InstanceGroupKey
+            {
+                const RPI::ModelLod* m_modelLod = nullptr;
+                size_t m_meshIndex = 0;
+                const RPI::Material* m_material = nullptr;
+                RHI::DrawItemSortKey m_sortKey = 0;
+
+                bool operator==(const InstanceGroupKey& rhs) const;
+            };
+
+            //! An instance of an instance group that passed culling in a view.
+            struct VisibleInstance
+            {
+                RPI::View* m_view = nullptr;
+                const RHI::DrawPacket* m_drawPacket = nullptr;
+                uint32_t m_instanceGroupId = 0;
+                uint32_t m_instanceId = 0;
+                float m_depth = 0.0f;
+            };
+
+            //! A run of the sorted visible instances of one instance group in one view, drawn with a single draw.
+            struct InstancedDraw
+            {
+                size_t m_firstInstance = 0;
+                uint32_t m_instanceCount = 0;
+                uint32_t m_instanceOffset = 0; //!< Offset of the instances' object ids, only set if m_instanceCount > 1
+            };
+
+            MeshInstanceManager() = default;
+            ~MeshInstanceManager() override = default;
+
+            //! Returns whether meshes using an ObjectSrg may be drawn instanced. Only ObjectSrgs providing the instancing inputs
+            //! of Atom/Features/PBR/DefaultObjectSrg.azsli qualify, and every shader using them must call SetMeshInstanceId().
+            static bool SupportsInstancing(const RPI::ShaderResourceGroup& objectSrg);
+
+            //! Sorts visible instances by view, instance group and depth, and splits them into one draw per view and group.
+            //! @param visibleInstances     the visible instances, sorted in place
+            //! @param outInstancedDraws    receives the draws, referring to the sorted visible instances
+            //! @param outInstanceObjectIds receives the object ids of the instances of every draw with more than one instance
+            static void BuildInstancedDraws(AZStd::vector<VisibleInstance>& visibleInstances, AZStd::vector<InstancedDraw>& outInstancedDraws, AZStd::vector<uint32_t>& outInstanceObjectIds);
+
+            //! Returns the id of the instance group for a key, creating the group if needed. Threadsafe.
+            //! @param key                  the key of the draw packet joining the group
+            //! @param objectSrgShaderAsset the shader asset the draw packet's ObjectSrg was created from
+            //! @param objectSrgName        the name of the draw packet's ObjectSrg layout
+            uint32_t AcquireInstanceGroup(const InstanceGroupKey& key, const Data::Asset<RPI::ShaderAsset>& objectSrgShaderAsset, const Name& objectSrgName);
+
+            //! Releases a reference to an instance group returned by AcquireInstanceGroup(). Threadsafe.
+            void ReleaseInstanceGroup(uint32_t instanceGroupId);
+
+            //! Returns the number of instance groups that are referenced by at least one draw packet.
+            size_t GetInstanceGroupCount() const;
+
+            //! Adds the draws of every visible instance reported since the last call to the views.
+            //! Must be called once culling has completed, before the views' draw lists are finalized.
+            void SubmitVisibleInstances();
+
+            //! Releases the GPU resources of the manager.
+            void Reset();
+
+            // RPI::CullableInstanceCollector overrides...
+            void AddVisibleInstance(RPI::View& view, const RHI::DrawPacket* drawPacket, uint32_t instanceGroupId, uint32_t instanceId, const Vector3& position) override;
+
+        private:
+            struct InstanceGroupKeyHasher
+            {
+                size_t operator()(const InstanceGroupKey& key) const;
+            };
+
+            struct InstanceGroup
+            {
+                InstanceGroupKey m_key;
+                uint32_t m_refCount = 0;
+
+                Data::Asset<RPI::ShaderAsset> m_objectSrgShaderAsset;
+                Name m_objectSrgName;
+                RHI::ShaderInputConstantIndex m_instanceCountIndex;
+                RHI::ShaderInputConstantIndex m_instanceOffsetIndex;
+                RHI::ShaderInputBufferIndex m_instanceObjectIdsIndex;
+
+                //! ObjectSrgs of the group's instanced draws, reused every frame
+                AZStd::vector<Data::Instance<RPI::ShaderResourceGroup>> m_objectSrgs;
+                size_t m_objectSrgsUsed = 0;
+            };
+
+            Data::Instance<RPI::ShaderResourceGroup> AcquireObjectSrg(InstanceGroup& instanceGroup);
+            void UpdateInstanceObjectIdBuffer();
+            static const RHI::DrawPacket* BuildInstancedDrawPacket(const RHI::DrawPacket& drawPacket, const RHI::ShaderResourceGroup& objectSrg, uint32_t instanceCount);
+
+            mutable AZStd::mutex m_instanceGroupMutex;
+            AZStd::vector<InstanceGroup> m_instanceGroups; //!< Indexed by instance group id
+            AZStd::vector<uint32_t> m_freeInstanceGroupIds;
+            AZStd::unordered_map<InstanceGroupKey, uint32_t, InstanceGroupKeyHasher> m_instanceGroupIds;
+
+            RHI::ThreadLocalContext<AZStd::vector<VisibleInstance>> m_threadVisibleInstances;
+            AZStd::vector<VisibleInstance> m_visibleInstances;
+            AZStd::vector<InstancedDraw> m_instancedDraws;
+
+            AZStd::vector<uint32_t> m_instanceObjectIds;
+            Data::Instance<RPI::Buffer> m_instanceObjectIdBuffer;
+
+            //! Instanced draw packets of the current frame, released once the next frame's culling has completed
+            AZStd::vector<RHI::ConstPtr<RHI::DrawPacket>> m_instancedDrawPackets;
+        };
+    } // namespace Render
+} // namespace AZ
@@ -36,6 +36,10 @@ namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(bool, r_meshInstancing, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Draws the visible meshes that share a model and material with a single instanced draw per view. "
+            "The shaders of the meshes' materials must support instancing, see DefaultObjectSrg.azsli.");
+
         void MeshFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -69,6 +73,7 @@ namespace AZ
             AZ_Warning("MeshFeatureProcessor", m_meshData.size() == 0,
                 "Deactivaing the MeshFeatureProcessor, but there are still outstanding mesh handles.\n"
             );
+            m_instanceManager.Reset();
             m_transformService = nullptr;
             m_forceRebuildDrawPackets = false;
         }
@@ -81,6 +86,13 @@ namespace AZ
 
             AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
 
+            if (m_meshInstancingEnabled != r_meshInstancing)
+            {
+                // Cullables are rebuilt along with the draw packets, moving meshes in or out of their instance groups
+                m_meshInstancingEnabled = r_meshInstancing;
+                m_forceRebuildDrawPackets = true;
+            }
+
             const auto iteratorRanges = m_meshData.GetParallelRanges();
             AZ::JobCompletion jobCompletion;
             for (const auto& iteratorRange : iteratorRanges)
@@ -113,7 +125,7 @@ namespace AZ
 
                         if (meshDataIter->m_cullableNeedsRebuild)
                         {
-                            meshDataIter->BuildCullable();
+                            meshDataIter->BuildCullable(m_meshInstancingEnabled);
                         }
                     }
                 };
@@ -135,6 +147,14 @@ namespace AZ
             }
         }
 
+        void MeshFeatureProcessor::OnEndCulling([[maybe_unused]] const FeatureProcessor::RenderPacket& packet)
+        {
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+            AZ_ATOM_PROFILE_FUNCTION("RPI", "MeshFeatureProcessor: OnEndCulling");
+
+            m_instanceManager.SubmitVisibleInstances();
+        }
+
         void MeshFeatureProcessor::OnBeginPrepareRender()
         {
             m_meshDataChecker.soft_lock();
@@ -158,6 +178,7 @@ namespace AZ
             meshDataHandle->m_scene = GetParentScene();
             meshDataHandle->m_materialAssignments = materials;
             meshDataHandle->m_objectId = m_transformService->ReserveObjectId();
+            meshDataHandle->m_instanceManager = &m_instanceManager;
             meshDataHandle->m_originalModelAsset = descriptor.m_modelAsset;
             meshDataHandle->m_meshLoader = AZStd::make_unique<MeshDataInstance::MeshLoader>(descriptor.m_modelAsset, &*meshDataHandle);
 
@@ -225,6 +246,13 @@ namespace AZ
             if (meshHandle.IsValid())
             {
                 meshHandle->m_objectSrgNeedsUpdate = true;
+
+                // Instanced draws don't bind the mesh's own ObjectSrg, so it can't be instanced once its ObjectSrg is customized
+                if (!meshHandle->m_hasExternalObjectSrgData)
+                {
+                    meshHandle->m_hasExternalObjectSrgData = true;
+                    meshHandle->m_cullableNeedsRebuild = !meshHandle->m_instanceGroupIds.empty();
+                }
             }
         }
 
@@ -570,6 +598,7 @@ namespace AZ
         void MeshDataInstance::DeInit()
         {
             m_scene->GetCullingScene()->UnregisterCullable(m_cullable);
+            ReleaseInstanceGroups();
 
             // remove from ray tracing
             RayTracingFeatureProcessor* rayTracingFeatureProcessor = m_scene->GetFeatureProcessor<RayTracingFeatureProcessor>();
@@ -580,6 +609,8 @@ namespace AZ
 
             m_meshLoader.reset();
             m_drawPacketListsByLod.clear();
+            m_streamingImages.clear();
+            m_uvDensitiesByLod.clear();
             m_materialAssignments.clear();
             m_shaderResourceGroup = {};
             m_model = {};
@@ -624,6 +655,17 @@ namespace AZ
 
             m_aabb = model->GetModelAsset()->GetAabb();
 
+            // Computed once here since it walks every triangle, rather than each time the cullable is rebuilt
+            m_uvDensitiesByLod.clear();
+            for (const auto& modelLodAsset : modelAsset->GetLodAssets())
+            {
+                AZStd::vector<float>& uvDensities = m_uvDensitiesByLod.emplace_back();
+                for (const RPI::ModelLodAsset::Mesh& mesh : modelLodAsset->GetMeshes())
+                {
+                    uvDensities.push_back(RPI::ModelLodUtils::ApproxUvDensity(mesh));
+                }
+            }
+
             m_cullableNeedsRebuild = true;
             m_cullBoundsNeedsUpdate = true;
             m_objectSrgNeedsUpdate = true;
@@ -1016,7 +1058,7 @@ namespace AZ
             }
         }
 
-        void MeshDataInstance::BuildCullable()
+        void MeshDataInstance::BuildCullable(bool allowInstancing)
         {
             AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
             AZ_Assert(m_cullableNeedsRebuild, "This function only needs to be called if the cullable to be rebuilt");
@@ -1025,6 +1067,12 @@ namespace AZ
             RPI::Cullable::CullData& cullData = m_cullable.m_cullData;
             RPI::Cullable::LodData& lodData = m_cullable.m_lodData;
 
+            // The draw packets may have changed, so rejoin the instance groups from scratch
+            ReleaseInstanceGroups();
+            const bool useInstancing = allowInstancing && CanUseInstancing();
+            lodData.m_instanceCollector = useInstancing ? m_instanceManager : nullptr;
+            lodData.m_instanceId = m_objectId.GetIndex();
+
             const Aabb& localAabb = m_aabb;
             lodData.m_lodSelectionRadius = 0.5f*localAabb.GetExtents().GetMaxElement();
 
@@ -1034,6 +1082,7 @@ namespace AZ
 
             lodData.m_lods.resize(modelLodCount);
             cullData.m_drawListMask.reset();
+            m_streamingImages.clear();
 
             const size_t lodCount = lodAssets.size();
             for (size_t lodIndex = 0; lodIndex < lodCount; ++lodIndex)
@@ -1065,16 +1114,46 @@ namespace AZ
                 }
 
                 lod.m_drawPackets.clear();
-                for (const RPI::MeshDrawPacket& meshDrawPacket : m_drawPacketListsByLod[lodIndex])
+                lod.m_instancedDrawPackets.clear();
+                lod.m_streamingImages.clear();
+                for (RPI::MeshDrawPacket& meshDrawPacket : m_drawPacketListsByLod[lodIndex])
                 {
                     const RHI::DrawPacket* rhiDrawPacket = meshDrawPacket.GetRHIDrawPacket();
 
                     if (rhiDrawPacket)
                     {
+                        // The images repeat this many times across the lod selection diameter. Without uvs, assume they are mapped once.
+                        const AZStd::vector<float>& uvDensities = m_uvDensitiesByLod[lodIndex];
+                        const size_t meshIndex = meshDrawPacket.GetModelLodMeshIndex();
+                        const float uvDensity = meshIndex < uvDensities.size() && uvDensities[meshIndex] > 0.0f
+                            ? uvDensities[meshIndex] * 2.0f * lodData.m_lodSelectionRadius
+                            : 1.0f;
+                        AddStreamingImages(meshDrawPacket.GetMaterial(), uvDensity, lod);
+
                         //OR-together all the drawListMasks (so we know which views to cull against)
                         cullData.m_drawListMask |= rhiDrawPacket->GetDrawListMask();
 
-                        lod.m_drawPackets.push_back(rhiDrawPacket);
+                        if (useInstancing)
+                        {
+                            const Data::Instance<RPI::Material> material = meshDrawPacket.GetMaterial();
+
+                            MeshInstanceManager::InstanceGroupKey key;
+                            key.m_modelLod = meshDrawPacket.GetModelLod();
+                            key.m_meshIndex = meshDrawPacket.GetModelLodMeshIndex();
+                            key.m_material = material.get();
+                            key.m_sortKey = m_sortKey;
+
+                            RPI::Cullable::LodData::InstancedDrawPacket& instancedDrawPacket = lod.m_instancedDrawPackets.emplace_back();
+                            instancedDrawPacket.m_drawPacket = rhiDrawPacket;
+                            instancedDrawPacket.m_instanceGroupId = m_instanceManager->AcquireInstanceGroup(key,
+                                material->GetAsset()->GetMaterialTypeAsset()->GetShaderAssetForObjectSrg(),
+                                material->GetAsset()->GetObjectSrgLayout()->GetName());
+                            m_instanceGroupIds.push_back(instancedDrawPacket.m_instanceGroupId);
+                        }
+                        else
+                        {
+                            lod.m_drawPackets.push_back(rhiDrawPacket);
+                        }
                     }
                 }
             }
@@ -1095,6 +1174,84 @@ namespace AZ
             m_cullBoundsNeedsUpdate = true;
         }
 
+        void MeshDataInstance::AddStreamingImages(const Data::Instance<RPI::Material>& material, float uvDensity, RPI::Cullable::LodData::Lod& lod)
+        {
+            if (!material)
+            {
+                return;
+            }
+
+            for (const RPI::MaterialPropertyValue& propertyValue : material->GetPropertyValues())
+            {
+                if (!propertyValue.Is<Data::Instance<RPI::Image>>())
+                {
+                    continue;
+                }
+
+                RPI::StreamingImage* streamingImage = azrtti_cast<RPI::StreamingImage*>(propertyValue.GetValue<Data::Instance<RPI::Image>>().get());
+                if (!streamingImage)
+                {
+                    continue;
+                }
+
+                const auto isSameImage = [streamingImage](const RPI::Cullable::LodData::StreamingImageUsage& usage)
+                {
+                    return usage.m_image == streamingImage;
+                };
+                auto usage = AZStd::find_if(lod.m_streamingImages.begin(), lod.m_streamingImages.end(), isSameImage);
+                if (usage != lod.m_streamingImages.end())
+                {
+                    // An image shared by several meshes needs the detail of the most densely mapped one
+                    usage->m_uvDensity = AZStd::max(usage->m_uvDensity, uvDensity);
+                    continue;
+                }
+
+                RPI::Cullable::LodData::StreamingImageUsage& newUsage = lod.m_streamingImages.emplace_back();
+                newUsage.m_image = streamingImage;
+                newUsage.m_uvDensity = uvDensity;
+
+                const auto isHeld = [streamingImage](const Data::Instance<RPI::StreamingImage>& heldImage)
+                {
+                    return heldImage.get() == streamingImage;
+                };
+                if (AZStd::find_if(m_streamingImages.begin(), m_streamingImages.end(), isHeld) == m_streamingImages.end())
+                {
+                    m_streamingImages.emplace_back(streamingImage);
+                }
+            }
+        }
+
+        void MeshDataInstance::ReleaseInstanceGroups()
+        {
+            for (uint32_t instanceGroupId : m_instanceGroupIds)
+            {
+                m_instanceManager->ReleaseInstanceGroup(instanceGroupId);
+            }
+            m_instanceGroupIds.clear();
+        }
+
+        bool MeshDataInstance::CanUseInstancing() const
+        {
+            // Instanced draws bind an ObjectSrg of their own, so meshes relying on per-object data other than their
+            // object id, such as their reflection probe or data set through GetObjectSrg(), are drawn individually.
+            if (!m_instanceManager || !m_shaderResourceGroup || m_hasExternalObjectSrgData ||
+                m_descriptor.m_useForwardPassIblSpecular || m_hasForwardPassIblSpecularMaterial)
+            {
+                return false;
+            }
+
+            // The UV stream mapping is part of the draw packet but not of the instance group key
+            for (const auto& materialAssignment : m_materialAssignments)
+            {
+                if (!materialAssignment.second.m_matModUvOverrides.empty())
+                {
+                    return false;
+                }
+            }
+
+            return MeshInstanceManager::SupportsInstancing(*m_shaderResourceGroup);
+        }
+
         void MeshDataInstance::UpdateCullBounds(const TransformServiceFeatureProcessor* transformService)
         {
             AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/Feature/Mesh/MeshInstanceManager.h>
+
+#include <Atom/RHI/CpuProfiler.h>
+#include <Atom/RHI/DrawPacketBuilder.h>
+#include <Atom/RHI.Reflect/Bits.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <AzCore/Debug/EventTrace.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        namespace MeshInstanceManagerInternal
+        {
+            static const char* InstanceCountName = "m_instanceCount";
+            static const char* InstanceOffsetName = "m_instanceOffset";
+            static const char* InstanceObjectIdsName = "m_instanceObjectIds";
+        }
+
+        bool MeshInstanceManager::InstanceGroupKey::operator==(const InstanceGroupKey& rhs) const
+        {
+            return m_modelLod == rhs.m_modelLod &&
+                m_meshIndex == rhs.m_meshIndex &&
+                m_material == rhs.m_material &&
+                m_sortKey == rhs.m_sortKey;
+        }
+
+        size_t MeshInstanceManager::InstanceGroupKeyHasher::operator()(const InstanceGroupKey& key) const
+        {
+            size_t seed = 0;
+            AZStd::hash_combine(seed, key.m_modelLod, key.m_meshIndex, key.m_material, key.m_sortKey);
+            return seed;
+        }
+
+        bool MeshInstanceManager::SupportsInstancing(const RPI::ShaderResourceGroup& objectSrg)
+        {
+            return objectSrg.FindShaderInputBufferIndex(Name(MeshInstanceManagerInternal::InstanceObjectIdsName)).IsValid();
+        }
+
+        uint32_t MeshInstanceManager::AcquireInstanceGroup(const InstanceGroupKey& key, const Data::Asset<RPI::ShaderAsset>& objectSrgShaderAsset, const Name& objectSrgName)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_instanceGroupMutex);
+
+            auto groupIdIter = m_instanceGroupIds.find(key);
+            if (groupIdIter != m_instanceGroupIds.end())
+            {
+                ++m_instanceGroups[groupIdIter->second].m_refCount;
+                return groupIdIter->second;
+            }
+
+            uint32_t instanceGroupId = 0;
+            if (!m_freeInstanceGroupIds.empty())
+            {
+                instanceGroupId = m_freeInstanceGroupIds.back();
+                m_freeInstanceGroupIds.pop_back();
+            }
+            else
+            {
+                instanceGroupId = aznumeric_cast<uint32_t>(m_instanceGroups.size());
+                m_instanceGroups.emplace_back();
+            }
+
+            InstanceGroup& instanceGroup = m_instanceGroups[instanceGroupId];
+            instanceGroup.m_key = key;
+            instanceGroup.m_refCount = 1;
+            instanceGroup.m_objectSrgShaderAsset = objectSrgShaderAsset;
+            instanceGroup.m_objectSrgName = objectSrgName;
+            m_instanceGroupIds.emplace(key, instanceGroupId);
+            return instanceGroupId;
+        }
+
+        void MeshInstanceManager::ReleaseInstanceGroup(uint32_t instanceGroupId)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_instanceGroupMutex);
+
+            InstanceGroup& instanceGroup = m_instanceGroups[instanceGroupId];
+            AZ_Assert(instanceGroup.m_refCount > 0, "Releasing an instance group that has no references");
+            if (--instanceGroup.m_refCount == 0)
+            {
+                m_instanceGroupIds.erase(instanceGroup.m_key);
+                instanceGroup = InstanceGroup();
+                m_freeInstanceGroupIds.push_back(instanceGroupId);
+            }
+        }
+
+        size_t MeshInstanceManager::GetInstanceGroupCount() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_instanceGroupMutex);
+            return m_instanceGroupIds.size();
+        }
+
+        void MeshInstanceManager::AddVisibleInstance(RPI::View& view, const RHI::DrawPacket* drawPacket, uint32_t instanceGroupId, uint32_t instanceId, const Vector3& position)
+        {
+            // Same depth as View::AddDrawPacket() would sort the instance's own draw packet with
+            const Matrix4x4& viewToWorld = view.GetViewToWorldMatrix();
+            const float depth = (position - viewToWorld.GetTranslation()).Dot(-viewToWorld.GetBasisZAsVector3());
+
+            VisibleInstance& visibleInstance = m_threadVisibleInstances.GetStorage().emplace_back();
+            visibleInstance.m_view = &view;
+            visibleInstance.m_drawPacket = drawPacket;
+            visibleInstance.m_instanceGroupId = instanceGroupId;
+            visibleInstance.m_instanceId = instanceId;
+            visibleInstance.m_depth = depth;
+        }
+
+        void MeshInstanceManager::SubmitVisibleInstances()
+        {
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+            AZ_ATOM_PROFILE_FUNCTION("RPI", "MeshInstanceManager: SubmitVisibleInstances");
+
+            // The draw lists of the previous frame have been submitted by now
+            m_instancedDrawPackets.clear();
+            m_instancedDraws.clear();
+            m_instanceObjectIds.clear();
+            m_visibleInstances.clear();
+
+            m_threadVisibleInstances.ForEach([this](AZStd::vector<VisibleInstance>& visibleInstances)
+            {
+                m_visibleInstances.insert(m_visibleInstances.end(), visibleInstances.begin(), visibleInstances.end());
+                visibleInstances.clear();
+            });
+
+            if (m_visibleInstances.empty())
+            {
+                return;
+            }
+
+            BuildInstancedDraws(m_visibleInstances, m_instancedDraws, m_instanceObjectIds);
+
+            // Nothing to gain from instancing a single draw
+            for (const InstancedDraw& instancedDraw : m_instancedDraws)
+            {
+                if (instancedDraw.m_instanceCount == 1)
+                {
+                    const VisibleInstance& visibleInstance = m_visibleInstances[instancedDraw.m_firstInstance];
+                    visibleInstance.m_view->AddDrawPacket(visibleInstance.m_drawPacket, visibleInstance.m_depth);
+                }
+            }
+
+            if (m_instanceObjectIds.empty())
+            {
+                return;
+            }
+
+            UpdateInstanceObjectIdBuffer();
+
+            for (InstanceGroup& instanceGroup : m_instanceGroups)
+            {
+                instanceGroup.m_objectSrgsUsed = 0;
+            }
+
+            for (const InstancedDraw& instancedDraw : m_instancedDraws)
+            {
+                if (instancedDraw.m_instanceCount == 1)
+                {
+                    continue;
+                }
+
+                const VisibleInstance& firstInstance = m_visibleInstances[instancedDraw.m_firstInstance];
+                InstanceGroup& instanceGroup = m_instanceGroups[firstInstance.m_instanceGroupId];
+
+                Data::Instance<RPI::ShaderResourceGroup> objectSrg = AcquireObjectSrg(instanceGroup);
+                const RHI::DrawPacket* instancedDrawPacket = nullptr;
+                if (objectSrg)
+                {
+                    objectSrg->SetConstant(instanceGroup.m_instanceCountIndex, instancedDraw.m_instanceCount);
+                    objectSrg->SetConstant(instanceGroup.m_instanceOffsetIndex, instancedDraw.m_instanceOffset);
+                    objectSrg->SetBufferView(instanceGroup.m_instanceObjectIdsIndex, m_instanceObjectIdBuffer->GetBufferView());
+                    objectSrg->Compile();
+
+                    instancedDrawPacket = BuildInstancedDrawPacket(*firstInstance.m_drawPacket, *objectSrg->GetRHIShaderResourceGroup(), instancedDraw.m_instanceCount);
+                }
+
+                if (instancedDrawPacket)
+                {
+                    m_instancedDrawPackets.emplace_back(instancedDrawPacket);
+                    firstInstance.m_view->AddDrawPacket(instancedDrawPacket, firstInstance.m_depth);
+                }
+                else
+                {
+                    // Fall back to drawing the instances one by one
+                    for (uint32_t index = 0; index < instancedDraw.m_instanceCount; ++index)
+                    {
+                        const VisibleInstance& visibleInstance = m_visibleInstances[instancedDraw.m_firstInstance + index];
+                        visibleInstance.m_view->AddDrawPacket(visibleInstance.m_drawPacket, visibleInstance.m_depth);
+                    }
+                }
+            }
+        }
+
+        void MeshInstanceManager::BuildInstancedDraws(
+            AZStd::vector<VisibleInstance>& visibleInstances, AZStd::vector<InstancedDraw>& outInstancedDraws, AZStd::vector<uint32_t>& outInstanceObjectIds)
+        {
+            // Group the instances of each view, front to back so the instanced draws keep the benefit of early depth rejection.
+            // Sorting by id as well keeps the result independent of the order the culling jobs reported the instances in.
+            AZStd::sort(visibleInstances.begin(), visibleInstances.end(), [](const VisibleInstance& lhs, const VisibleInstance& rhs)
+            {
+                if (lhs.m_view != rhs.m_view)
+                {
+                    return lhs.m_view < rhs.m_view;
+                }
+                if (lhs.m_instanceGroupId != rhs.m_instanceGroupId)
+                {
+                    return lhs.m_instanceGroupId < rhs.m_instanceGroupId;
+                }
+                if (lhs.m_depth != rhs.m_depth)
+                {
+                    return lhs.m_depth < rhs.m_depth;
+                }
+                return lhs.m_instanceId < rhs.m_instanceId;
+            });
+
+            for (size_t first = 0; first < visibleInstances.size();)
+            {
+                const VisibleInstance& firstInstance = visibleInstances[first];
+
+                size_t end = first + 1;
+                while (end < visibleInstances.size() &&
+                    visibleInstances[end].m_view == firstInstance.m_view &&
+                    visibleInstances[end].m_instanceGroupId == firstInstance.m_instanceGroupId)
+                {
+                    ++end;
+                }
+
+                InstancedDraw& instancedDraw = outInstancedDraws.emplace_back();
+                instancedDraw.m_firstInstance = first;
+                instancedDraw.m_instanceCount = aznumeric_cast<uint32_t>(end - first);
+                if (instancedDraw.m_instanceCount > 1)
+                {
+                    instancedDraw.m_instanceOffset = aznumeric_cast<uint32_t>(outInstanceObjectIds.size());
+                    for (size_t index = first; index < end; ++index)
+                    {
+                        outInstanceObjectIds.push_back(visibleInstances[index].m_instanceId);
+                    }
+                }
+                first = end;
+            }
+        }
+
+        void MeshInstanceManager::Reset()
+        {
+            m_threadVisibleInstances.Clear();
+            m_visibleInstances.clear();
+            m_instancedDraws.clear();
+            m_instancedDrawPackets.clear();
+            m_instanceObjectIds.clear();
+            m_instanceObjectIdBuffer = nullptr;
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_instanceGroupMutex);
+            for (InstanceGroup& instanceGroup : m_instanceGroups)
+            {
+                instanceGroup.m_objectSrgs.clear();
+                instanceGroup.m_objectSrgsUsed = 0;
+            }
+        }
+
+        Data::Instance<RPI::ShaderResourceGroup> MeshInstanceManager::AcquireObjectSrg(InstanceGroup& instanceGroup)
+        {
+            using namespace MeshInstanceManagerInternal;
+
+            if (instanceGroup.m_objectSrgsUsed < instanceGroup.m_objectSrgs.size())
+            {
+                return instanceGroup.m_objectSrgs[instanceGroup.m_objectSrgsUsed++];
+            }
+
+            Data::Instance<RPI::ShaderResourceGroup> objectSrg = RPI::ShaderResourceGroup::Create(instanceGroup.m_objectSrgShaderAsset, instanceGroup.m_objectSrgName);
+            if (!objectSrg)
+            {
+                AZ_Warning("MeshInstanceManager", false, "Failed to create the ObjectSrg of an instanced draw");
+                return nullptr;
+            }
+
+            if (instanceGroup.m_objectSrgs.empty())
+            {
+                instanceGroup.m_instanceCountIndex = objectSrg->FindShaderInputConstantIndex(Name(InstanceCountName));
+                instanceGroup.m_instanceOffsetIndex = objectSrg->FindShaderInputConstantIndex(Name(InstanceOffsetName));
+                instanceGroup.m_instanceObjectIdsIndex = objectSrg->FindShaderInputBufferIndex(Name(InstanceObjectIdsName));
+            }
+
+            instanceGroup.m_objectSrgs.push_back(objectSrg);
+            instanceGroup.m_objectSrgsUsed = instanceGroup.m_objectSrgs.size();
+            return objectSrg;
+        }
+
+        void MeshInstanceManager::UpdateInstanceObjectIdBuffer()
+        {
+            const uint32_t elementCount = RHI::NextPowerOfTwo(GetMax<uint32_t>(1, aznumeric_cast<uint32_t>(m_instanceObjectIds.size())));
+            const uint32_t byteCount = elementCount * sizeof(uint32_t);
+
+            // Create or resize, growing by powers of two
+            if (!m_instanceObjectIdBuffer)
+            {
+                RPI::CommonBufferDescriptor desc;
+                desc.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+                desc.m_bufferName = "m_instanceObjectIds";
+                desc.m_byteCount = byteCount;
+                desc.m_elementSize = sizeof(uint32_t);
+
+                m_instanceObjectIdBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+            }
+            else if (byteCount > m_instanceObjectIdBuffer->GetBufferSize())
+            {
+                m_instanceObjectIdBuffer->Resize(byteCount);
+            }
+
+            m_instanceObjectIdBuffer->UpdateData(m_instanceObjectIds.data(), m_instanceObjectIds.size() * sizeof(uint32_t));
+        }
+
+        const RHI::DrawPacket* MeshInstanceManager::BuildInstancedDrawPacket(const RHI::DrawPacket& drawPacket, const RHI::ShaderResourceGroup& objectSrg, uint32_t instanceCount)
+        {
+            const size_t drawItemCount = drawPacket.GetDrawItemCount();
+            if (drawItemCount == 0)
+            {
+                return nullptr;
+            }
+
+            // All the items of a draw packet share its draw arguments, index buffer and shader resource groups.
+            // Mesh draw packets don't use root constants, scissors or viewports.
+            const RHI::DrawItem& firstItem = *drawPacket.GetDrawItem(0).m_item;
+
+            RHI::DrawArguments drawArguments = firstItem.m_arguments;
+            switch (drawArguments.m_type)
+            {
+            case RHI::DrawType::Indexed:
+                drawArguments.m_indexed.m_instanceCount = instanceCount;
+                break;
+            case RHI::DrawType::Linear:
+                drawArguments.m_linear.m_instanceCount = instanceCount;
+                break;
+            default:
+                return nullptr;
+            }
+
+            RHI::DrawPacketBuilder drawPacketBuilder;
+            drawPacketBuilder.Begin(nullptr);
+            drawPacketBuilder.SetDrawArguments(drawArguments);
+            if (firstItem.m_indexBufferView)
+            {
+                drawPacketBuilder.SetIndexBufferView(*firstItem.m_indexBufferView);
+            }
+            drawPacketBuilder.SetDrawFilterMask(drawPacket.GetDrawFilterMask());
+
+            // Swap the instance's ObjectSrg for the one of the instanced draw
+            for (uint32_t srgIndex = 0; srgIndex < firstItem.m_shaderResourceGroupCount; ++srgIndex)
+            {
+                const RHI::ShaderResourceGroup* shaderResourceGroup = firstItem.m_shaderResourceGroups[srgIndex];
+                if (shaderResourceGroup->GetBindingSlot() == objectSrg.GetBindingSlot())
+                {
+                    shaderResourceGroup = &objectSrg;
+                }
+                drawPacketBuilder.AddShaderResourceGroup(shaderResourceGroup);
+            }
+
+            for (size_t itemIndex = 0; itemIndex < drawItemCount; ++itemIndex)
+            {
+                const RHI::DrawItemProperties drawItemProperties = drawPacket.GetDrawItem(itemIndex);
+                const RHI::DrawItem& drawItem = *drawItemProperties.m_item;
+
+                RHI::DrawPacketBuilder::DrawRequest drawRequest;
+                drawRequest.m_listTag = drawPacket.GetDrawListTag(itemIndex);
+                drawRequest.m_stencilRef = drawItem.m_stencilRef;
+                drawRequest.m_streamBufferViews = AZStd::array_view<RHI::StreamBufferView>(drawItem.m_streamBufferViews, drawItem.m_streamBufferViewCount);
+                drawRequest.m_uniqueShaderResourceGroup = drawItem.m_uniqueShaderResourceGroup;
+                drawRequest.m_pipelineState = drawItem.m_pipelineState;
+                drawRequest.m_sortKey = drawItemProperties.m_sortKey;
+                drawRequest.m_drawFilterMask = drawItemProperties.m_drawFilterMask;
+                drawPacketBuilder.AddDrawItem(drawRequest);
+            }
+
+            return drawPacketBuilder.End();
+        }
+    } // namespace Render
+} // namespace AZ
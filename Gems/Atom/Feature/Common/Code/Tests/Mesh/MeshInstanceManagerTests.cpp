@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <Atom/Feature/Mesh/MeshInstanceManager.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    class MeshInstanceManagerTests
+        : public UnitTest::AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            UnitTest::AllocatorsTestFixture::SetUp();
+            NameDictionary::Create();
+            m_instanceManager = AZStd::make_unique<MeshInstanceManager>();
+        }
+
+        void TearDown() override
+        {
+            m_instanceManager.reset();
+            NameDictionary::Destroy();
+            UnitTest::AllocatorsTestFixture::TearDown();
+        }
+
+        // The manager only hashes and compares these pointers, so the tests use placeholder addresses
+        static MeshInstanceManager::InstanceGroupKey MakeKey(uintptr_t modelLod, size_t meshIndex, uintptr_t material, RHI::DrawItemSortKey sortKey = 0)
+        {
+            MeshInstanceManager::InstanceGroupKey key;
+            key.m_modelLod = reinterpret_cast<const RPI::ModelLod*>(modelLod);
+            key.m_meshIndex = meshIndex;
+            key.m_material = reinterpret_cast<const RPI::Material*>(material);
+            key.m_sortKey = sortKey;
+            return key;
+        }
+
+        static MeshInstanceManager::VisibleInstance MakeVisibleInstance(uintptr_t view, uint32_t instanceGroupId, uint32_t instanceId, float depth)
+        {
+            MeshInstanceManager::VisibleInstance visibleInstance;
+            visibleInstance.m_view = reinterpret_cast<RPI::View*>(view);
+            visibleInstance.m_instanceGroupId = instanceGroupId;
+            visibleInstance.m_instanceId = instanceId;
+            visibleInstance.m_depth = depth;
+            return visibleInstance;
+        }
+
+        uint32_t Acquire(const MeshInstanceManager::InstanceGroupKey& key)
+        {
+            return m_instanceManager->AcquireInstanceGroup(key, {}, Name("ObjectSrg"));
+        }
+
+        AZStd::unique_ptr<MeshInstanceManager> m_instanceManager;
+    };
+
+    TEST_F(MeshInstanceManagerTests, AcquireInstanceGroup_SameKey_SharesGroup)
+    {
+        const uint32_t first = Acquire(MakeKey(0x1000, 0, 0x2000));
+        const uint32_t second = Acquire(MakeKey(0x1000, 0, 0x2000));
+        EXPECT_EQ(first, second);
+        EXPECT_EQ(1u, m_instanceManager->GetInstanceGroupCount());
+    }
+
+    TEST_F(MeshInstanceManagerTests, AcquireInstanceGroup_KeysDifferInAnyMember_SeparateGroups)
+    {
+        AZStd::unordered_set<uint32_t> instanceGroupIds;
+        instanceGroupIds.insert(Acquire(MakeKey(0x1000, 0, 0x2000, 0)));
+        instanceGroupIds.insert(Acquire(MakeKey(0x1100, 0, 0x2000, 0))); // Model lod
+        instanceGroupIds.insert(Acquire(MakeKey(0x1000, 1, 0x2000, 0))); // Mesh index
+        instanceGroupIds.insert(Acquire(MakeKey(0x1000, 0, 0x2100, 0))); // Material
+        instanceGroupIds.insert(Acquire(MakeKey(0x1000, 0, 0x2000, 1))); // Sort key
+        EXPECT_EQ(5u, instanceGroupIds.size());
+        EXPECT_EQ(5u, m_instanceManager->GetInstanceGroupCount());
+    }
+
+    TEST_F(MeshInstanceManagerTests, ReleaseInstanceGroup_LastReference_GroupRemovedAndIdReused)
+    {
+        const MeshInstanceManager::InstanceGroupKey key = MakeKey(0x1000, 0, 0x2000);
+        const uint32_t instanceGroupId = Acquire(key);
+        EXPECT_EQ(instanceGroupId, Acquire(key));
+
+        // The group stays alive while any draw packet still references it
+        m_instanceManager->ReleaseInstanceGroup(instanceGroupId);
+        EXPECT_EQ(1u, m_instanceManager->GetInstanceGroupCount());
+        m_instanceManager->ReleaseInstanceGroup(instanceGroupId);
+        EXPECT_EQ(0u, m_instanceManager->GetInstanceGroupCount());
+
+        // A new key takes over the freed id rather than growing the group list
+        EXPECT_EQ(instanceGroupId, Acquire(MakeKey(0x1100, 0, 0x2000)));
+    }
+
+    TEST_F(MeshInstanceManagerTests, AcquireAndReleaseInstanceGroup_MeshesAddedAndRemoved_GroupsMatchReferencedKeys)
+    {
+        constexpr uint32_t KeyCount = 32;
+        constexpr uint32_t OperationCount = 5000;
+        SimpleLcgRandom random(1234);
+
+        AZStd::vector<uint32_t> refCounts(KeyCount, 0);
+        AZStd::unordered_map<uint32_t, uint32_t> keyGroupIds;
+        for (uint32_t operation = 0; operation < OperationCount; ++operation)
+        {
+            const uint32_t keyIndex = random.GetRandom() % KeyCount;
+            const MeshInstanceManager::InstanceGroupKey key = MakeKey(0x1000 + keyIndex % 4, keyIndex / 4, 0x2000);
+            if (refCounts[keyIndex] > 0 && random.GetRandom() % 2 == 0)
+            {
+                m_instanceManager->ReleaseInstanceGroup(keyGroupIds[keyIndex]);
+                if (--refCounts[keyIndex] == 0)
+                {
+                    keyGroupIds.erase(keyIndex);
+                }
+            }
+            else
+            {
+                const uint32_t instanceGroupId = Acquire(key);
+                if (refCounts[keyIndex]++ > 0)
+                {
+                    // A key keeps its group for as long as it is referenced
+                    EXPECT_EQ(keyGroupIds[keyIndex], instanceGroupId);
+                }
+                keyGroupIds[keyIndex] = instanceGroupId;
+            }
+
+            EXPECT_EQ(keyGroupIds.size(), m_instanceManager->GetInstanceGroupCount());
+        }
+
+        // No two referenced keys share a group, and the freed ids were reused
+        AZStd::unordered_set<uint32_t> instanceGroupIds;
+        for (const auto& keyGroupId : keyGroupIds)
+        {
+            EXPECT_TRUE(instanceGroupIds.insert(keyGroupId.second).second);
+            EXPECT_LT(keyGroupId.second, KeyCount);
+        }
+    }
+
+    TEST_F(MeshInstanceManagerTests, BuildInstancedDraws_SeveralViewsAndGroups_OneDrawPerViewAndGroup)
+    {
+        // Reported out of order, the way the culling jobs of several views would
+        AZStd::vector<MeshInstanceManager::VisibleInstance> visibleInstances;
+        visibleInstances.push_back(MakeVisibleInstance(0x20, 0, 10, 5.0f));
+        visibleInstances.push_back(MakeVisibleInstance(0x10, 1, 20, 3.0f));
+        visibleInstances.push_back(MakeVisibleInstance(0x10, 0, 11, 2.0f));
+        visibleInstances.push_back(MakeVisibleInstance(0x10, 0, 12, 1.0f));
+        visibleInstances.push_back(MakeVisibleInstance(0x20, 0, 11, 4.0f));
+        visibleInstances.push_back(MakeVisibleInstance(0x10, 0, 10, 2.0f));
+
+        AZStd::vector<MeshInstanceManager::InstancedDraw> instancedDraws;
+        AZStd::vector<uint32_t> instanceObjectIds;
+        MeshInstanceManager::BuildInstancedDraws(visibleInstances, instancedDraws, instanceObjectIds);
+
+        ASSERT_EQ(3u, instancedDraws.size());
+
+        // First view, group 0: front to back, with equal depths ordered by id
+        EXPECT_EQ(0u, instancedDraws[0].m_firstInstance);
+        EXPECT_EQ(3u, instancedDraws[0].m_instanceCount);
+        EXPECT_EQ(0u, instancedDraws[0].m_instanceOffset);
+
+        // First view, group 1: a single instance draws with its own draw packet, so it has no object ids
+        EXPECT_EQ(3u, instancedDraws[1].m_firstInstance);
+        EXPECT_EQ(1u, instancedDraws[1].m_instanceCount);
+        EXPECT_EQ(20u, visibleInstances[instancedDraws[1].m_firstInstance].m_instanceId);
+
+        // Second view, group 0
+        EXPECT_EQ(4u, instancedDraws[2].m_firstInstance);
+        EXPECT_EQ(2u, instancedDraws[2].m_instanceCount);
+        EXPECT_EQ(3u, instancedDraws[2].m_instanceOffset);
+
+        const AZStd::vector<uint32_t> expectedObjectIds = { 12, 10, 11, 11, 10 };
+        EXPECT_EQ(expectedObjectIds, instanceObjectIds);
+    }
+
+    TEST_F(MeshInstanceManagerTests, BuildInstancedDraws_RandomInstances_OffsetsAndCountsCoverEveryInstance)
+    {
+        constexpr uint32_t InstanceCount = 1000;
+        SimpleLcgRandom random(5678);
+
+        AZStd::vector<MeshInstanceManager::VisibleInstance> visibleInstances;
+        for (uint32_t instanceId = 0; instanceId < InstanceCount; ++instanceId)
+        {
+            visibleInstances.push_back(MakeVisibleInstance(0x10 * (1 + random.GetRandom() % 3), random.GetRandom() % 20, instanceId, random.GetRandomFloat()));
+        }
+
+        AZStd::vector<MeshInstanceManager::InstancedDraw> instancedDraws;
+        AZStd::vector<uint32_t> instanceObjectIds;
+        MeshInstanceManager::BuildInstancedDraws(visibleInstances, instancedDraws, instanceObjectIds);
+
+        // The draws cover the sorted instances back to back, and the object ids of each instanced draw are packed in order
+        size_t nextInstance = 0;
+        uint32_t nextOffset = 0;
+        uint32_t drawnInstanceCount = 0;
+        for (const MeshInstanceManager::InstancedDraw& instancedDraw : instancedDraws)
+        {
+            EXPECT_EQ(nextInstance, instancedDraw.m_firstInstance);
+            ASSERT_GT(instancedDraw.m_instanceCount, 0u);
+
+            const MeshInstanceManager::VisibleInstance& firstInstance = visibleInstances[instancedDraw.m_firstInstance];
+            for (uint32_t index = 0; index < instancedDraw.m_instanceCount; ++index)
+            {
+                const MeshInstanceManager::VisibleInstance& visibleInstance = visibleInstances[instancedDraw.m_firstInstance + index];
+                EXPECT_EQ(firstInstance.m_view, visibleInstance.m_view);
+                EXPECT_EQ(firstInstance.m_instanceGroupId, visibleInstance.m_instanceGroupId);
+                if (instancedDraw.m_instanceCount > 1)
+                {
+                    EXPECT_EQ(visibleInstance.m_instanceId, instanceObjectIds[instancedDraw.m_instanceOffset + index]);
+                }
+            }
+
+            if (instancedDraw.m_instanceCount > 1)
+            {
+                EXPECT_EQ(nextOffset, instancedDraw.m_instanceOffset);
+                nextOffset += instancedDraw.m_instanceCount;
+            }
+            nextInstance += instancedDraw.m_instanceCount;
+            drawnInstanceCount += instancedDraw.m_instanceCount;
+        }
+        EXPECT_EQ(InstanceCount, drawnInstanceCount);
+        EXPECT_EQ(nextOffset, instanceObjectIds.size());
+    }
+}
@@ -152,6 +152,10 @@ namespace AZ
             //! build SRG Layout data which will be useful when compiling MetalISL to Metal byte code.
             virtual bool VariantCompilationRequiresSrgLayoutData() const { return false; }
 
+            //! Returns the version of the compiler CompilePlatformInternal() runs. Shader builders use it to tell apart functions
+            //! compiled from the same source and arguments by different compilers. Empty if the version is unknown.
+            virtual AZStd::string GetCompilerVersion() const { return {}; }
+
             //! See AZ::RHI::Factory::GetAPIUniqueIndex() for details.
             //! See AZ::RHI::Limits::APIType::PerPlatformApiUniqueIndexMax.
             uint32_t GetAPIUniqueIndex() const { return m_apiUniqueIndex; }
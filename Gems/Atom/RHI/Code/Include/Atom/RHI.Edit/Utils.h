@@ -83,6 +83,10 @@ namespace AZ
                                    const AZStd::string& shaderSourcePathForDebug,
                                    const char* toolNameForLog);
 
+        //! Runs a shader compiler executable with parameters that make it print its version, and returns what it printed.
+        //! Returns an empty string if the executable couldn't be run.
+        AZStd::string GetShaderCompilerVersion(const AZStd::string& executablePath, const AZStd::string& versionParameters);
+
         //! Reports error messages to AZ_Error and/or AZ_Warning, given a text blob that potentially contains many lines of errors and warnings.
         //! @param window  Debug window name used for AZ Trace functions
         //! @param errorMessages  String that may contain many lines of errors and warnings
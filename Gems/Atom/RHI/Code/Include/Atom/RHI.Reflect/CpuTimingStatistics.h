@@ -39,6 +39,13 @@ namespace AZ
             //! The amount of time spent presenting (vsync can affect this).
             AZStd::sys_time_t m_presentDuration{};
 
+            //! The number of shader resource groups compiled this frame.
+            uint32_t m_shaderResourceGroupCompileCount = 0;
+
+            //! The number of queued shader resource groups that skipped compilation this frame, because
+            //! their data did not change since they were last compiled.
+            uint32_t m_shaderResourceGroupSkipCount = 0;
+
             void Reset()
             {
                 m_queueStatistics.clear();
@@ -44,6 +44,8 @@ namespace AZ
         /// Uniformly partitions the draw list and returns the sub-list denoted by the provided index.
         DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount);
 
+        /// Sorts the draw list by sort key and depth in the order given by the sort type. Draw items with equal sort key
+        /// and depth are grouped by pipeline state. Long lists are radix sorted, in parallel jobs when the job system is available.
         void SortDrawList(DrawList& drawList, DrawListSortType sortType);
     }
 }
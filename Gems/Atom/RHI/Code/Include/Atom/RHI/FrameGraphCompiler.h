@@ -8,10 +8,14 @@
 #pragma once
 
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
+#include <Atom/RHI.Reflect/TransientAttachmentStatistics.h>
 #include <Atom/RHI/Object.h>
 #include <Atom/RHI/ObjectCache.h>
 #include <Atom/RHI/ImageView.h>
 #include <Atom/RHI/BufferView.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/Utils/TypeHash.h>
 
 namespace AZ
 {
@@ -99,6 +103,15 @@ namespace AZ
          * kept inside the compiler. The cache is big enough to avoid having to re-create views every frame, but
          * bounded in order to release entries old views.
          *
+         *      == Topology Cache ==
+         *
+         * Pass structure rarely changes between frames, so the compiler hashes the topology of the graph (scopes,
+         * queue classes, producer / consumer edges, and the usage chain of every attachment). When the hash matches
+         * the previous frame, the queue-centric graph, the transient attachment lifetimes, the sorted allocation
+         * commands and the memory hint of the transient pool are replayed instead of recomputed. Resources are
+         * still acquired from the transient attachment pool every frame, and the platform compile still runs in
+         * full, since the resources bound to the attachments can differ from one frame to the next.
+         *
          *      == Platform-Specific Compilation ==
          *
          * Finally, the compiler calls into the platform-specific compile method, which hands control over to the
@@ -162,6 +175,15 @@ namespace AZ
 
             void CompileResourceViews(const FrameGraphAttachmentDatabase& attachmentDatabase);
 
+            /// Hashes everything the platform-independent compile phases depend on.
+            HashValue64 ComputeTopologyHash(const FrameGraphCompileRequest& request) const;
+
+            /// Records the queue-centric scope graph, so it can be replayed while the topology is unchanged.
+            void CacheQueueCentricScopeGraph(const FrameGraph& frameGraph);
+
+            /// Restores the queue classes and cross-queue links recorded by CacheQueueCentricScopeGraph.
+            void ApplyCachedQueueCentricScopeGraph(FrameGraph& frameGraph) const;
+
             //Returns the resource from local cache if it exists within it or create one if it doesn't and add it to the cache
             ImageView* GetImageViewFromLocalCache(Image* image, const ImageViewDescriptor& imageViewDescriptor);
             BufferView* GetBufferViewFromLocalCache(Buffer* buffer, const BufferViewDescriptor& bufferViewDescriptor);
@@ -171,6 +193,34 @@ namespace AZ
             ObjectCache<ImageView> m_imageViewCache;
             ObjectCache<BufferView> m_bufferViewCache;
 
+            /// The compiled queue placement and links of a scope, stored as scope indices.
+            struct CompiledScope
+            {
+                HardwareQueueClass m_hardwareQueueClass = HardwareQueueClass::Graphics;
+                AZStd::array<uint32_t, HardwareQueueClassCount> m_producerIndicesByQueue;
+                AZStd::array<uint32_t, HardwareQueueClassCount> m_consumerIndicesByQueue;
+            };
+
+            /// The compiled lifetime of a transient attachment, stored as scope indices.
+            struct CompiledTransientLifetime
+            {
+                uint32_t m_firstScopeIndex = 0;
+                uint32_t m_lastScopeIndex = 0;
+            };
+
+            /// The platform-independent compile results of the last frame graph, keyed by its topology hash.
+            struct CompiledTopology
+            {
+                HashValue64 m_hash = HashValue64{ 0 };
+                AZStd::vector<CompiledScope> m_scopes;
+                AZStd::vector<CompiledTransientLifetime> m_transientBufferLifetimes;
+                AZStd::vector<CompiledTransientLifetime> m_transientImageLifetimes;
+                AZStd::vector<uint32_t> m_transientCommands;
+                AZStd::optional<TransientAttachmentStatistics::MemoryUsage> m_transientMemoryUsage;
+            };
+
+            CompiledTopology m_compiledTopology;
+            bool m_isTopologyUnchanged = false;
         };
     }
 }
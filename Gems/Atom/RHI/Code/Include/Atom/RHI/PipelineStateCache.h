@@ -10,7 +10,9 @@
 #include <Atom/RHI/PipelineState.h>
 #include <Atom/RHI/PipelineLibrary.h>
 #include <Atom/RHI/ThreadLocalContext.h>
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/std/containers/bitset.h>
+#include <AzCore/std/time.h>
 #include <AzCore/Utils/TypeHash.h>
 
 namespace UnitTest
@@ -22,6 +24,35 @@ namespace AZ
 {
     namespace RHI
     {
+        /**
+         * Statistics of pipeline state cache requests. The cache gathers them across all threads and
+         * publishes the totals of each frame when it is compacted.
+         */
+        struct PipelineStateCacheStatistics
+        {
+            /// The number of acquires which found the pipeline state in the cache, including ones still compiling on another thread.
+            uint32_t m_hitCount = 0;
+
+            /// The number of acquires which compiled the pipeline state on the calling thread.
+            uint32_t m_missCount = 0;
+
+            /// The number of pipeline states compiled ahead of use by PrecompilePipelineState.
+            uint32_t m_precompileCount = 0;
+
+            /// The time spent compiling pipeline states, for both misses and precompiles.
+            AZStd::sys_time_t m_compileDuration = 0;
+
+            void Reset()
+            {
+                *this = {};
+            }
+
+            double GetCompileDurationMilliseconds() const
+            {
+                return (m_compileDuration * 1000) / aznumeric_cast<double>(AZStd::GetTimeTicksPerSecond());
+            }
+        };
+
         /**
          * Problem: High-level rendering code works in 'materials', 'shaders', and 'models', but the RHI works in
          * 'pipeline states'. Therefore, a translation process must exist to resolve a shader variation (plus runtime
@@ -90,6 +121,9 @@ namespace AZ
          *      // Create library instance.
          *      RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary(serializedData); // Initial data loaded from disk.
          *
+         *      // In a background job. Compiles pipeline states known to be needed before they are requested.
+         *      pipelineStateCache->PrecompilePipelineState(libraryHandle, descriptor);
+         *
          *      // In jobs. Lots and lots of requests.
          *      const RHI::PipelineState* pipelineState = pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor);
          *
@@ -139,16 +173,33 @@ namespace AZ
              * It is permitted to take a strong reference to the returned pointer, but is not necessary as long as the reference
              * is discarded on a library reset / release event. The cache will store a reference internally. If a strong reference
              * is held externally, the instance will remain valid even after the cache is reset / destroyed.
+             *
+             * If wasCompiled is provided, it is set to whether the pipeline state was compiled by this call, which
+             * callers may use to record the pipeline states their content needs.
+             */
+            const PipelineState* AcquirePipelineState(PipelineLibraryHandle library, const PipelineStateDescriptor& descriptor, bool* wasCompiled = nullptr);
+
+            /**
+             * Compiles a pipeline state ahead of its first acquire, and adds it to the cache once it is fully compiled. Unlike
+             * AcquirePipelineState, the cache is not locked against library resets and compaction while compiling, so this may
+             * be called from a long running background job across frames. Returns true if a pipeline state was added to the cache,
+             * or false if the library handle is invalid, the pipeline state was already cached, or the library was reset meanwhile.
+             *
+             * If an acquire requests the same pipeline state while it is precompiling, the acquire compiles it as well and the
+             * precompiled instance is discarded.
              */
-            const PipelineState* AcquirePipelineState(PipelineLibraryHandle library, const PipelineStateDescriptor& descriptor);
+            bool PrecompilePipelineState(PipelineLibraryHandle library, const PipelineStateDescriptor& descriptor);
 
             /**
              * This method merges the global pending cache into the global read-only cache and clears all thread-local caches.
              * This reduces the total memory footprint of the caches and optimizes subsequent fetches. This method should be called
-             * once per frame.
+             * once per frame. It also gathers the statistics of the requests made since the last call.
              */
             void Compact();
 
+            /// Returns the statistics of the requests made between the last two calls to Compact, across all libraries.
+            const PipelineStateCacheStatistics& GetStatistics() const;
+
         private:
             PipelineStateCache(Device& device);
 
@@ -198,6 +249,13 @@ namespace AZ
                 // Tracks the number of pipeline states actively being compiled across all threads.
                 AZStd::atomic_uint32_t m_pendingCompileCount = {0};
 
+                // Incremented when the library is reset, so precompiles can detect a reset that happened while they compiled.
+                uint32_t m_resetCount = 0;
+
+                // Serializes precompiles with the merge of the thread libraries, since precompiles use
+                // their thread library without holding the cache lock.
+                mutable AZStd::mutex m_precompileMutex;
+
                 // Used to prime the thread libraries.
                 ConstPtr<PipelineLibraryData> m_serializedData;
             };
@@ -216,6 +274,9 @@ namespace AZ
                  * and uses the initial serialized data passed in at creation time.
                  */
                 Ptr<PipelineLibrary> m_library;
+
+                // The statistics of requests made on this thread since the last compaction.
+                PipelineStateCacheStatistics m_statistics;
             };
 
             /**
@@ -231,12 +292,19 @@ namespace AZ
             /// Helper function which inserts an entry into the set. Returns true if the entry was inserted, or false is a duplicate entry existed.
             static bool InsertPipelineState(PipelineStateSet& pipelineStateSet, PipelineStateEntry pipelineStateEntry);
 
+            /// Lazily initializes the thread-local pipeline library of a library entry.
+            void InitThreadLibrary(const GlobalLibraryEntry& globalLibraryEntry, ThreadLibraryEntry& threadLibraryEntry);
+
             /// Performs a pipeline state compilation on the global cache using the thread-local pipeline library.
             ConstPtr<PipelineState> CompilePipelineState(
                 GlobalLibraryEntry& globalLibraryEntry,
                 ThreadLibraryEntry& threadLibraryEntry,
                 const PipelineStateDescriptor& pipelineStateDescriptor,
-                PipelineStateHash pipelineStateHash);
+                PipelineStateHash pipelineStateHash,
+                bool& wasCompiled);
+
+            /// Initializes a pipeline state from the descriptor using the pipeline library, which may be null.
+            ResultCode InitPipelineState(PipelineState& pipelineState, const PipelineStateDescriptor& descriptor, PipelineLibrary* pipelineLibrary);
 
             /// Resets the library without validating the handle or taking a lock.
             void ResetLibraryImpl(PipelineLibraryHandle handle);
@@ -253,6 +321,9 @@ namespace AZ
             /// The set of library entries. The RHI::PipelineLibraryHandle maps into this array.
             GlobalLibrarySet m_globalLibrarySet;
 
+            /// The statistics gathered by the last call to Compact.
+            PipelineStateCacheStatistics m_statistics;
+
             /// Tracks whether the library at the bit index is active.
             AZStd::bitset<LibraryCountMax> m_globalLibraryActiveBits;
 
@@ -66,6 +66,9 @@ namespace AZ
 
             // Gates the Compile() function so that the SRG is only queued once.
             bool m_isQueuedForCompile = false;
+
+            // The hash of the data last compiled by the pool. Queued compiles of identical data are skipped.
+            HashValue64 m_compiledDataHash = HashValue64{ 0 };
         };
     }
 }
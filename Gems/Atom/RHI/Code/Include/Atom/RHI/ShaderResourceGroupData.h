@@ -12,6 +12,7 @@
 #include <Atom/RHI/ImageView.h>
 #include <Atom/RHI/Buffer.h>
 #include <Atom/RHI/BufferView.h>
+#include <AzCore/Utils/TypeHash.h>
 
 namespace AZ
 {
@@ -176,6 +177,10 @@ namespace AZ
             //! Returns the shader resource layout for this group.
             const ShaderResourceGroupLayout* GetLayout() const;
 
+            //! Returns a hash of the bound data. Views are hashed by identity and by the version of their
+            //! resource, so the hash changes when a bound resource is invalidated.
+            HashValue64 GetHash(HashValue64 seed = HashValue64{ 0 }) const;
+
         private:
             static const ConstPtr<ImageView> s_nullImageView;
             static const ConstPtr<BufferView> s_nullBufferView;
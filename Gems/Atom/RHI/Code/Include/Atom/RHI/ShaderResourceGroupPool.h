@@ -13,6 +13,7 @@
 #include <Atom/RHI/ShaderResourceGroupInvalidateRegistry.h>
 #include <Atom/RHI/ResourcePool.h>
 
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/containers/concurrent_vector.h>
 
 namespace AZ
@@ -61,6 +62,13 @@ namespace AZ
 
             //////////////////////////////////////////////////////////////////////////
 
+            //! Returns the number of groups compiled by the last CompileGroups{Begin, End} region.
+            uint32_t GetCompiledGroupCount() const;
+
+            //! Returns the number of queued groups skipped by the last CompileGroups{Begin, End} region,
+            //! because their data matched the data they were last compiled with.
+            uint32_t GetSkippedGroupCount() const;
+
             //! Returns whether layout in this pool has constants.
             bool HasConstants() const;
 
@@ -128,6 +136,10 @@ namespace AZ
             mutable AZStd::shared_mutex m_groupsToCompileMutex;
             AZStd::vector<ShaderResourceGroup*> m_groupsToCompile;
 
+            // Compile counts of the last CompileGroups{Begin, End} region, updated from the compile jobs.
+            AZStd::atomic_uint32_t m_compiledGroupCount{ 0 };
+            AZStd::atomic_uint32_t m_skippedGroupCount{ 0 };
+
             AZStd::mutex m_invalidateRegistryMutex;
             ShaderResourceGroupInvalidateRegistry m_invalidateRegistry;
         };
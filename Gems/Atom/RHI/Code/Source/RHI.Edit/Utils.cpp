@@ -221,12 +221,9 @@ namespace AZ
             return combinedFile;
         }
 
-        bool ExecuteShaderCompiler(const AZStd::string& executablePath,
-                                   const AZStd::string& parameters,
-                                   const AZStd::string& shaderSourcePathForDebug,
-                                   const char* toolNameForLog)
+        //! Makes a path relative to the executable folder absolute, and checks that the executable exists.
+        static bool GetShaderCompilerAbsolutePath(const AZStd::string& executablePath, AZStd::string& executableAbsolutePath)
         {
-            AZStd::string executableAbsolutePath;
             if (AzFramework::StringFunc::Path::IsRelative(executablePath.c_str()))
             {
                 static const char* executableFolder = nullptr;
@@ -253,6 +250,20 @@ namespace AZ
                 return false;
             }
 
+            return true;
+        }
+
+        bool ExecuteShaderCompiler(const AZStd::string& executablePath,
+                                   const AZStd::string& parameters,
+                                   const AZStd::string& shaderSourcePathForDebug,
+                                   const char* toolNameForLog)
+        {
+            AZStd::string executableAbsolutePath;
+            if (!GetShaderCompilerAbsolutePath(executablePath, executableAbsolutePath))
+            {
+                return false;
+            }
+
             AzFramework::ProcessLauncher::ProcessLaunchInfo processLaunchInfo;
             processLaunchInfo.m_commandlineParameters = AZStd::string::format("\"%s\" %s", executableAbsolutePath.c_str(), parameters.c_str());
             processLaunchInfo.m_showWindow = true;
@@ -367,6 +378,27 @@ namespace AZ
             return true;
         }
 
+        AZStd::string GetShaderCompilerVersion(const AZStd::string& executablePath, const AZStd::string& versionParameters)
+        {
+            AZStd::string version;
+            AZStd::string executableAbsolutePath;
+            if (GetShaderCompilerAbsolutePath(executablePath, executableAbsolutePath))
+            {
+                AzFramework::ProcessLauncher::ProcessLaunchInfo processLaunchInfo;
+                processLaunchInfo.m_commandlineParameters = AZStd::string::format("\"%s\" %s", executableAbsolutePath.c_str(), versionParameters.c_str());
+                processLaunchInfo.m_showWindow = false;
+
+                AzFramework::ProcessOutput processOutput;
+                if (AzFramework::ProcessWatcher::LaunchProcessAndRetrieveOutput(processLaunchInfo, AzFramework::COMMUNICATOR_TYPE_STDINOUT, processOutput))
+                {
+                    version = processOutput.outputResult;
+                }
+                AZ_Warning(ShaderPlatformInterfaceName, !version.empty(), "Failed to get the version of '%s'", executableAbsolutePath.c_str());
+            }
+
+            return version;
+        }
+
         bool ReportErrorMessages([[maybe_unused]] AZStd::string_view window, AZStd::string_view errorMessages)
         {
             // There are more efficient ways to do this, but this approach is simple and gets us moving for now.
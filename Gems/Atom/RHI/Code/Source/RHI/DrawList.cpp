@@ -7,6 +7,10 @@
  */
 #include <Atom/RHI/DrawList.h>
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ
@@ -26,8 +30,251 @@ namespace AZ
             return DrawListView(&drawList[itemOffset], itemCount);
         }
 
+        namespace DrawListInternal
+        {
+            //! Shorter lists are sorted with a comparison sort, which beats the fixed cost of the radix passes.
+            constexpr size_t RadixSortItemCountMin = 1024;
+            //! Minimum number of items each job processes when a radix sort is split across jobs.
+            constexpr size_t ParallelSortItemsPerJobMin = 16384;
+            constexpr size_t ParallelSortJobCountMax = 16;
+
+            constexpr uint32_t RadixBits = 8;
+            constexpr uint32_t RadixBucketCount = 1 << RadixBits;
+            constexpr uint32_t RadixDigitCount = 128 / RadixBits;
+
+            using RadixHistogram = AZStd::array<AZStd::array<uint32_t, RadixBucketCount>, RadixDigitCount>;
+
+            //! A draw item's 128 bit sort key, whose order matches the sort type. Draw items whose sort key and depth
+            //! are equal are ordered by pipeline state, so that draws sharing a pipeline state end up adjacent.
+            struct RadixSortEntry
+            {
+                uint64_t m_keyHigh = 0;
+                uint64_t m_keyLow = 0;
+                uint32_t m_index = 0;
+
+                uint32_t GetDigit(uint32_t digit) const
+                {
+                    const uint64_t word = digit < RadixDigitCount / 2 ? m_keyLow : m_keyHigh;
+                    return static_cast<uint32_t>(word >> ((digit % (RadixDigitCount / 2)) * RadixBits)) & (RadixBucketCount - 1);
+                }
+            };
+
+            //! Maps a sort key to an unsigned integer with the same order.
+            uint64_t GetOrderedSortKey(DrawItemSortKey sortKey)
+            {
+                return static_cast<uint64_t>(sortKey) ^ (uint64_t{1} << 63);
+            }
+
+            //! Maps a depth to an unsigned integer with the same order.
+            uint32_t GetOrderedDepth(float depth)
+            {
+                uint32_t bits;
+                memcpy(&bits, &depth, sizeof(bits));
+                return (bits & 0x80000000) ? ~bits : (bits | 0x80000000);
+            }
+
+            //! Folds the pipeline state pointer to 16 bits, only used to group draw items sharing a pipeline state.
+            uint64_t GetPipelineStateBits(const DrawItem* drawItem)
+            {
+                const uintptr_t pipelineState = drawItem ? reinterpret_cast<uintptr_t>(drawItem->m_pipelineState) : 0;
+                return static_cast<uint64_t>((pipelineState >> 4) ^ (pipelineState >> 20)) & 0xFFFF;
+            }
+
+            RadixSortEntry CreateRadixSortEntry(const DrawItemProperties& drawItem, uint32_t index, DrawListSortType sortType)
+            {
+                const uint64_t sortKey = GetOrderedSortKey(drawItem.m_sortKey);
+                uint64_t depth = GetOrderedDepth(drawItem.m_depth);
+                if (sortType == DrawListSortType::KeyThenReverseDepth || sortType == DrawListSortType::ReverseDepthThenKey)
+                {
+                    depth = ~depth & 0xFFFFFFFF;
+                }
+                const uint64_t pipelineState = GetPipelineStateBits(drawItem.m_item);
+
+                RadixSortEntry entry;
+                entry.m_index = index;
+                if (sortType == DrawListSortType::KeyThenDepth || sortType == DrawListSortType::KeyThenReverseDepth)
+                {
+                    // [sort key : 64][depth : 32][pipeline state : 16][unused : 16]
+                    entry.m_keyHigh = sortKey;
+                    entry.m_keyLow = (depth << 32) | (pipelineState << 16);
+                }
+                else
+                {
+                    // [depth : 32][sort key : 64][pipeline state : 16][unused : 16]
+                    entry.m_keyHigh = (depth << 32) | (sortKey >> 32);
+                    entry.m_keyLow = (sortKey << 32) | (pipelineState << 16);
+                }
+                return entry;
+            }
+
+            //! Invokes a function for each job index, in parallel jobs if there is more than one.
+            template <typename Function>
+            void ForEachJob(size_t jobCount, const Function& function)
+            {
+                if (jobCount == 1)
+                {
+                    function(size_t{0});
+                    return;
+                }
+
+                AZ::JobCompletion jobCompletion;
+                for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+                {
+                    AZ::Job* job = AZ::CreateJobFunction([&function, jobIndex]()
+                        {
+                            function(jobIndex);
+                        }, true, nullptr);
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                }
+                jobCompletion.StartAndWaitForCompletion();
+            }
+
+            size_t GetSortJobCount(size_t itemCount)
+            {
+                AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+                if (!jobContext || itemCount < 2 * ParallelSortItemsPerJobMin)
+                {
+                    return 1;
+                }
+
+                const size_t workerCount = jobContext->GetJobManager().GetNumWorkerThreads();
+                return AZStd::max<size_t>(1, AZStd::min(AZStd::min(itemCount / ParallelSortItemsPerJobMin, workerCount), ParallelSortJobCountMax));
+            }
+
+            //! Sorts a draw list with a least significant digit radix sort. Each pass is split across jobs for long
+            //! lists. Digits that are equal for every draw item are skipped, so in practice only a few passes run.
+            void RadixSortDrawList(DrawList& drawList, DrawListSortType sortType)
+            {
+                const size_t itemCount = drawList.size();
+                const size_t jobCount = GetSortJobCount(itemCount);
+                const size_t itemsPerJob = DivideByMultiple(itemCount, jobCount);
+
+                auto getJobRange = [itemCount, itemsPerJob](size_t jobIndex)
+                {
+                    const size_t begin = AZStd::min(jobIndex * itemsPerJob, itemCount);
+                    return AZStd::make_pair(begin, AZStd::min(begin + itemsPerJob, itemCount));
+                };
+
+                AZStd::vector<RadixSortEntry> entries(itemCount);
+                AZStd::vector<RadixSortEntry> scratchEntries(itemCount);
+                AZStd::vector<RadixHistogram> jobHistograms(jobCount);
+
+                // Build the keys, and count the digits of every key in the same pass
+                ForEachJob(jobCount, [&](size_t jobIndex)
+                    {
+                        RadixHistogram& histogram = jobHistograms[jobIndex];
+                        for (auto& digitHistogram : histogram)
+                        {
+                            digitHistogram.fill(0);
+                        }
+
+                        const auto [begin, end] = getJobRange(jobIndex);
+                        for (size_t index = begin; index < end; ++index)
+                        {
+                            const RadixSortEntry entry = CreateRadixSortEntry(drawList[index], static_cast<uint32_t>(index), sortType);
+                            entries[index] = entry;
+                            for (uint32_t digit = 0; digit < RadixDigitCount; ++digit)
+                            {
+                                ++histogram[digit][entry.GetDigit(digit)];
+                            }
+                        }
+                    });
+
+                bool isReordered = false;
+                for (uint32_t digit = 0; digit < RadixDigitCount; ++digit)
+                {
+                    AZStd::array<uint32_t, RadixBucketCount> bucketCounts = {};
+                    for (const RadixHistogram& histogram : jobHistograms)
+                    {
+                        for (uint32_t bucket = 0; bucket < RadixBucketCount; ++bucket)
+                        {
+                            bucketCounts[bucket] += histogram[digit][bucket];
+                        }
+                    }
+
+                    // Every entry has the same digit, so the pass would leave the order as is
+                    if (AZStd::find(bucketCounts.begin(), bucketCounts.end(), static_cast<uint32_t>(itemCount)) != bucketCounts.end())
+                    {
+                        continue;
+                    }
+
+                    // Each job needs the counts of its own range. The counts gathered while building the keys only hold
+                    // until a pass moves entries between the jobs' ranges.
+                    AZStd::vector<AZStd::array<uint32_t, RadixBucketCount>> jobOffsets(jobCount);
+                    if (jobCount == 1)
+                    {
+                        jobOffsets[0] = bucketCounts;
+                    }
+                    else if (!isReordered)
+                    {
+                        for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+                        {
+                            jobOffsets[jobIndex] = jobHistograms[jobIndex][digit];
+                        }
+                    }
+                    else
+                    {
+                        ForEachJob(jobCount, [&](size_t jobIndex)
+                            {
+                                AZStd::array<uint32_t, RadixBucketCount>& counts = jobOffsets[jobIndex];
+                                counts.fill(0);
+                                const auto [begin, end] = getJobRange(jobIndex);
+                                for (size_t index = begin; index < end; ++index)
+                                {
+                                    ++counts[entries[index].GetDigit(digit)];
+                                }
+                            });
+                    }
+
+                    // Jobs scatter each bucket in job order, which keeps the sort stable
+                    uint32_t offset = 0;
+                    for (uint32_t bucket = 0; bucket < RadixBucketCount; ++bucket)
+                    {
+                        for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+                        {
+                            const uint32_t count = jobOffsets[jobIndex][bucket];
+                            jobOffsets[jobIndex][bucket] = offset;
+                            offset += count;
+                        }
+                    }
+
+                    ForEachJob(jobCount, [&](size_t jobIndex)
+                        {
+                            AZStd::array<uint32_t, RadixBucketCount>& offsets = jobOffsets[jobIndex];
+                            const auto [begin, end] = getJobRange(jobIndex);
+                            for (size_t index = begin; index < end; ++index)
+                            {
+                                const RadixSortEntry& entry = entries[index];
+                                scratchEntries[offsets[entry.GetDigit(digit)]++] = entry;
+                            }
+                        });
+
+                    entries.swap(scratchEntries);
+                    isReordered = true;
+                }
+
+                // Reorder the draw items to match the sorted keys
+                const DrawList unsortedDrawList(drawList.begin(), drawList.end());
+                ForEachJob(jobCount, [&](size_t jobIndex)
+                    {
+                        const auto [begin, end] = getJobRange(jobIndex);
+                        for (size_t index = begin; index < end; ++index)
+                        {
+                            drawList[index] = unsortedDrawList[entries[index].m_index];
+                        }
+                    });
+            }
+        }
+
         void SortDrawList(DrawList& drawList, DrawListSortType sortType)
         {
+            if (drawList.size() >= DrawListInternal::RadixSortItemCountMin)
+            {
+                DrawListInternal::RadixSortDrawList(drawList, sortType);
+                return;
+            }
+
             switch (sortType)
             {
             case DrawListSortType::KeyThenDepth:
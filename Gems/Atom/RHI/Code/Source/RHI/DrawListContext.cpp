@@ -86,15 +86,28 @@ namespace AZ
 
         void DrawListContext::FinalizeLists()
         {
+            AZStd::array<size_t, RHI::Limits::Pipeline::DrawListTagCountMax> itemCounts = {};
+            m_threadListsByTag.ForEach([this, &itemCounts](DrawListsByTag& drawListsByTag)
+            {
+                for (size_t i = 0; i < drawListsByTag.size(); ++i)
+                {
+                    if (m_drawListMask[i])
+                    {
+                        itemCounts[i] += drawListsByTag[i].size();
+                    }
+                }
+            });
+
             for (size_t i = 0; i < m_mergedListsByTag.size(); ++i)
             {
                 if (m_drawListMask[i])
                 {
                     m_mergedListsByTag[i].clear();
+                    m_mergedListsByTag[i].reserve(itemCounts[i]);
                 }
             }
 
-            m_threadListsByTag.ForEach([this](DrawListsByTag& drawListsByTag)
+            m_threadListsByTag.ForEach([this, &itemCounts](DrawListsByTag& drawListsByTag)
             {
                 for (size_t i = 0; i < drawListsByTag.size(); ++i)
                 {
@@ -103,7 +116,15 @@ namespace AZ
                         auto& sourceList = drawListsByTag[i];
                         auto& resultList = m_mergedListsByTag[i];
 
-                        resultList.insert(resultList.end(), sourceList.begin(), sourceList.end());
+                        if (resultList.empty() && sourceList.size() == itemCounts[i])
+                        {
+                            // A single thread filled the list, so take its items rather than copying them
+                            resultList.swap(sourceList);
+                        }
+                        else
+                        {
+                            resultList.insert(resultList.end(), sourceList.begin(), sourceList.end());
+                        }
                         sourceList.clear();
                     }
                 }
@@ -27,6 +27,12 @@ namespace AZ
 {
     namespace RHI
     {
+        namespace
+        {
+            /// Marks a missing producer / consumer in the cached scope graph.
+            const uint32_t InvalidScopeIndex = static_cast<uint32_t>(-1);
+        }
+
         ResultCode FrameGraphCompiler::Init(Device& device)
         {
             if (Validation::IsEnabled())
@@ -62,6 +68,8 @@ namespace AZ
             {
                 m_imageViewCache.Clear();
                 m_bufferViewCache.Clear();
+                m_compiledTopology = {};
+                m_isTopologyUnchanged = false;
 
                 ShutdownInternal();
                 DeviceObject::Shutdown();
@@ -114,6 +122,9 @@ namespace AZ
          *          After acquiring all transient resources, the compiler creates and assigns resource views
          *          to each scope attachment. View ownership is managed by an internal cache.
          *
+         *      If the topology of the graph matches the previously compiled graph, phases 1 and 2 replay the cached
+         *      results instead; only the transient resource acquisition is repeated.
+         *
          *      4) Platform-specific Compilation:
          *
          *          The final phase is to compile the platform specific scopes and hand-off compilation to the platform-specific
@@ -131,8 +142,26 @@ namespace AZ
 
             FrameGraph& frameGraph = *request.m_frameGraph;
 
+            /// Reuse the results of the previous compile if the graph topology did not change.
+            const bool useTopologyCache = !CheckBitsAny(request.m_compileFlags, FrameSchedulerCompileFlags::DisableTopologyCache);
+            const HashValue64 topologyHash = useTopologyCache ? ComputeTopologyHash(request) : HashValue64{ 0 };
+            m_isTopologyUnchanged = useTopologyCache && topologyHash == m_compiledTopology.m_hash;
+            if (!m_isTopologyUnchanged)
+            {
+                m_compiledTopology = {};
+                m_compiledTopology.m_hash = topologyHash;
+            }
+
             /// [Phase 1] Compiles the cross-queue scope graph.
-            CompileQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
+            if (m_isTopologyUnchanged)
+            {
+                ApplyCachedQueueCentricScopeGraph(frameGraph);
+            }
+            else
+            {
+                CompileQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
+                CacheQueueCentricScopeGraph(frameGraph);
+            }
 
             /// [Phase 2] Compile transient attachments across all scopes.
             CompileTransientAttachments(
@@ -158,6 +187,119 @@ namespace AZ
             return CompileInternal(request);
         }
 
+        HashValue64 FrameGraphCompiler::ComputeTopologyHash(const FrameGraphCompileRequest& request) const
+        {
+            AZ_ATOM_PROFILE_FUNCTION("RHI", "FrameGraphCompiler: ComputeTopologyHash");
+
+            const FrameGraph& frameGraph = *request.m_frameGraph;
+            const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+
+            HashValue64 hash = TypeHash64(request.m_compileFlags);
+
+            // The transient memory hint is only valid for the pool it was computed with.
+            hash = TypeHash64(request.m_transientAttachmentPool, hash);
+            if (request.m_transientAttachmentPool)
+            {
+                hash = TypeHash64(request.m_transientAttachmentPool->GetDescriptor().m_heapParameters.m_type, hash);
+            }
+
+            const auto& scopes = frameGraph.GetScopes();
+            hash = TypeHash64(static_cast<uint32_t>(scopes.size()), hash);
+            for (const Scope* scope : scopes)
+            {
+                hash = TypeHash64(scope->GetId().GetHash(), hash);
+                hash = TypeHash64(scope->GetHardwareQueueClass(), hash);
+
+                const auto& consumers = frameGraph.GetConsumers(*scope);
+                hash = TypeHash64(static_cast<uint32_t>(consumers.size()), hash);
+                for (const Scope* consumer : consumers)
+                {
+                    hash = TypeHash64(consumer->GetIndex(), hash);
+                }
+            }
+
+            // The usage chain of each attachment determines its lifetime and the barriers derived by the platform.
+            const auto& attachments = attachmentDatabase.GetAttachments();
+            hash = TypeHash64(static_cast<uint32_t>(attachments.size()), hash);
+            for (const FrameAttachment* attachment : attachments)
+            {
+                hash = TypeHash64(attachment->GetId().GetHash(), hash);
+                hash = TypeHash64(attachment->GetLifetimeType(), hash);
+
+                for (const ScopeAttachment* node = attachment->GetFirstScopeAttachment(); node != nullptr; node = node->GetNext())
+                {
+                    hash = TypeHash64(node->GetScope().GetIndex(), hash);
+                    for (const ScopeAttachmentUsageAndAccess& usageAndAccess : node->GetUsageAndAccess())
+                    {
+                        hash = TypeHash64(usageAndAccess.m_usage, hash);
+                        hash = TypeHash64(usageAndAccess.m_access, hash);
+                    }
+                }
+            }
+
+            // Transient allocation commands refer to attachments by their index in these lists.
+            for (const BufferFrameAttachment* transientBuffer : attachmentDatabase.GetTransientBufferAttachments())
+            {
+                hash = TypeHash64(transientBuffer->GetId().GetHash(), hash);
+                hash = transientBuffer->GetBufferDescriptor().GetHash(hash);
+            }
+
+            for (const ImageFrameAttachment* transientImage : attachmentDatabase.GetTransientImageAttachments())
+            {
+                hash = TypeHash64(transientImage->GetId().GetHash(), hash);
+                hash = TypeHash64(transientImage->GetSupportedQueueMask(), hash);
+                hash = transientImage->GetImageDescriptor().GetHash(hash);
+            }
+
+            return hash;
+        }
+
+        void FrameGraphCompiler::CacheQueueCentricScopeGraph(const FrameGraph& frameGraph)
+        {
+            const auto getScopeIndex = [](const Scope* scope)
+            {
+                return scope ? scope->GetIndex() : InvalidScopeIndex;
+            };
+
+            const auto& scopes = frameGraph.GetScopes();
+            m_compiledTopology.m_scopes.resize(scopes.size());
+            for (size_t scopeIdx = 0; scopeIdx < scopes.size(); ++scopeIdx)
+            {
+                const Scope* scope = scopes[scopeIdx];
+                CompiledScope& compiledScope = m_compiledTopology.m_scopes[scopeIdx];
+                compiledScope.m_hardwareQueueClass = scope->GetHardwareQueueClass();
+                for (uint32_t hardwareQueueClassIdx = 0; hardwareQueueClassIdx < HardwareQueueClassCount; ++hardwareQueueClassIdx)
+                {
+                    compiledScope.m_producerIndicesByQueue[hardwareQueueClassIdx] = getScopeIndex(scope->m_producersByQueue[hardwareQueueClassIdx]);
+                    compiledScope.m_consumerIndicesByQueue[hardwareQueueClassIdx] = getScopeIndex(scope->m_consumersByQueue[hardwareQueueClassIdx]);
+                }
+            }
+        }
+
+        void FrameGraphCompiler::ApplyCachedQueueCentricScopeGraph(FrameGraph& frameGraph) const
+        {
+            AZ_ATOM_PROFILE_FUNCTION("RHI", "FrameGraphCompiler: ApplyCachedQueueCentricScopeGraph");
+
+            const auto& scopes = frameGraph.GetScopes();
+            const auto getScope = [&scopes](uint32_t scopeIndex)
+            {
+                return scopeIndex != InvalidScopeIndex ? scopes[scopeIndex] : nullptr;
+            };
+
+            AZ_Assert(scopes.size() == m_compiledTopology.m_scopes.size(), "Cached scope graph does not match the frame graph.");
+            for (size_t scopeIdx = 0; scopeIdx < scopes.size(); ++scopeIdx)
+            {
+                Scope* scope = scopes[scopeIdx];
+                const CompiledScope& compiledScope = m_compiledTopology.m_scopes[scopeIdx];
+                scope->m_hardwareQueueClass = compiledScope.m_hardwareQueueClass;
+                for (uint32_t hardwareQueueClassIdx = 0; hardwareQueueClassIdx < HardwareQueueClassCount; ++hardwareQueueClassIdx)
+                {
+                    scope->m_producersByQueue[hardwareQueueClassIdx] = getScope(compiledScope.m_producerIndicesByQueue[hardwareQueueClassIdx]);
+                    scope->m_consumersByQueue[hardwareQueueClassIdx] = getScope(compiledScope.m_consumerIndicesByQueue[hardwareQueueClassIdx]);
+                }
+            }
+        }
+
         void FrameGraphCompiler::CompileQueueCentricScopeGraph(
             FrameGraph& frameGraph,
             FrameSchedulerCompileFlags compileFlags)
@@ -482,8 +624,6 @@ namespace AZ
 
             AZ_ATOM_PROFILE_FUNCTION("RHI", "FrameGraphCompiler: CompileTransientAttachments");
 
-            ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
-
             /**
              * Builds a sortable key. It iterates each scope and performs deactivations
              * followed by activations on each attachment.
@@ -508,6 +648,11 @@ namespace AZ
                     m_bits.m_attachmentIndex = attachmentIndex;
                 }
 
+                explicit Command(uint32_t command)
+                {
+                    m_command = command;
+                }
+
                 bool operator < (Command rhs) const
                 {
                     return m_command < rhs.m_command;
@@ -548,49 +693,96 @@ namespace AZ
             AZStd::vector<Command> commands;
             commands.reserve((transientBufferGraphAttachments.size() + transientImageGraphAttachments.size()) * 2);
 
-            if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
+            if (m_isTopologyUnchanged)
             {
-                const uint32_t ScopeIndexFirst = 0;
-                const uint32_t ScopeIndexLast = static_cast<uint32_t>(scopes.size() - 1);
+                // Lifetimes and the sorted command list only depend on the topology, so replay them.
+                for (size_t attachmentIndex = 0; attachmentIndex < transientBufferGraphAttachments.size(); ++attachmentIndex)
+                {
+                    const CompiledTransientLifetime& lifetime = m_compiledTopology.m_transientBufferLifetimes[attachmentIndex];
+                    transientBufferGraphAttachments[attachmentIndex]->m_firstScope = scopes[lifetime.m_firstScopeIndex];
+                    transientBufferGraphAttachments[attachmentIndex]->m_lastScope = scopes[lifetime.m_lastScopeIndex];
+                }
 
-                // Generate commands for each transient buffer: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+                for (size_t attachmentIndex = 0; attachmentIndex < transientImageGraphAttachments.size(); ++attachmentIndex)
                 {
-                    commands.emplace_back(ScopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
-                    commands.emplace_back(ScopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
+                    const CompiledTransientLifetime& lifetime = m_compiledTopology.m_transientImageLifetimes[attachmentIndex];
+                    transientImageGraphAttachments[attachmentIndex]->m_firstScope = scopes[lifetime.m_firstScopeIndex];
+                    transientImageGraphAttachments[attachmentIndex]->m_lastScope = scopes[lifetime.m_lastScopeIndex];
                 }
 
-                // Generate commands for each transient image: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
+                for (uint32_t command : m_compiledTopology.m_transientCommands)
                 {
-                    commands.emplace_back(ScopeIndexFirst, Action::ActivateImage, attachmentIndex);
-                    commands.emplace_back(ScopeIndexLast, Action::DeactivateImage, attachmentIndex);
+                    commands.emplace_back(command);
                 }
             }
             else
             {
-                // Generate commands for each transient buffer: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+                ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
+
+                if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
+                {
+                    const uint32_t ScopeIndexFirst = 0;
+                    const uint32_t ScopeIndexLast = static_cast<uint32_t>(scopes.size() - 1);
+
+                    // Generate commands for each transient buffer: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        commands.emplace_back(ScopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
+                        commands.emplace_back(ScopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
+                    }
+
+                    // Generate commands for each transient image: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        commands.emplace_back(ScopeIndexFirst, Action::ActivateImage, attachmentIndex);
+                        commands.emplace_back(ScopeIndexLast, Action::DeactivateImage, attachmentIndex);
+                    }
+                }
+                else
+                {
+                    // Generate commands for each transient buffer: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        BufferFrameAttachment* transientBuffer = transientBufferGraphAttachments[attachmentIndex];
+                        const uint32_t scopeIndexFirst = transientBuffer->GetFirstScope()->GetIndex();
+                        const uint32_t scopeIndexLast = transientBuffer->GetLastScope()->GetIndex();
+                        commands.emplace_back(scopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
+                        commands.emplace_back(scopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
+                    }
+
+                    // Generate commands for each transient image: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        ImageFrameAttachment* transientImage = transientImageGraphAttachments[attachmentIndex];
+                        const uint32_t scopeIndexFirst = transientImage->GetFirstScope()->GetIndex();
+                        const uint32_t scopeIndexLast = transientImage->GetLastScope()->GetIndex();
+                        commands.emplace_back(scopeIndexFirst, Action::ActivateImage, attachmentIndex);
+                        commands.emplace_back(scopeIndexLast, Action::DeactivateImage, attachmentIndex);
+                    }
+                }
+
+                AZStd::sort(commands.begin(), commands.end());
+
+                m_compiledTopology.m_transientBufferLifetimes.reserve(transientBufferGraphAttachments.size());
+                for (const BufferFrameAttachment* transientBuffer : transientBufferGraphAttachments)
                 {
-                    BufferFrameAttachment* transientBuffer = transientBufferGraphAttachments[attachmentIndex];
-                    const uint32_t scopeIndexFirst = transientBuffer->GetFirstScope()->GetIndex();
-                    const uint32_t scopeIndexLast = transientBuffer->GetLastScope()->GetIndex();
-                    commands.emplace_back(scopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
-                    commands.emplace_back(scopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
+                    m_compiledTopology.m_transientBufferLifetimes.push_back(
+                        CompiledTransientLifetime{ transientBuffer->GetFirstScope()->GetIndex(), transientBuffer->GetLastScope()->GetIndex() });
                 }
 
-                // Generate commands for each transient image: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
+                m_compiledTopology.m_transientImageLifetimes.reserve(transientImageGraphAttachments.size());
+                for (const ImageFrameAttachment* transientImage : transientImageGraphAttachments)
                 {
-                    ImageFrameAttachment* transientImage = transientImageGraphAttachments[attachmentIndex];
-                    const uint32_t scopeIndexFirst = transientImage->GetFirstScope()->GetIndex();
-                    const uint32_t scopeIndexLast = transientImage->GetLastScope()->GetIndex();
-                    commands.emplace_back(scopeIndexFirst, Action::ActivateImage, attachmentIndex);
-                    commands.emplace_back(scopeIndexLast, Action::DeactivateImage, attachmentIndex);
+                    m_compiledTopology.m_transientImageLifetimes.push_back(
+                        CompiledTransientLifetime{ transientImage->GetFirstScope()->GetIndex(), transientImage->GetLastScope()->GetIndex() });
                 }
-            }
 
-            AZStd::sort(commands.begin(), commands.end());
+                m_compiledTopology.m_transientCommands.reserve(commands.size());
+                for (Command command : commands)
+                {
+                    m_compiledTopology.m_transientCommands.push_back(command.m_command);
+                }
+            }
 
             auto processCommands = [&](TransientAttachmentPoolCompileFlags compileFlags, TransientAttachmentStatistics::MemoryUsage* memoryHint = nullptr)
             {
@@ -701,9 +893,18 @@ namespace AZ
             // Check if we need to do two passes (one for calculating the size and the second one for allocating the resources)
             if (transientAttachmentPool.GetDescriptor().m_heapParameters.m_type == HeapAllocationStrategy::MemoryHint)
             {
-                // First pass to calculate size needed.
-                processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
-                memoryUsage = transientAttachmentPool.GetStatistics().m_reservedMemory;
+                if (m_isTopologyUnchanged && m_compiledTopology.m_transientMemoryUsage)
+                {
+                    // The memory needed is the same as for the previously compiled graph.
+                    memoryUsage = m_compiledTopology.m_transientMemoryUsage;
+                }
+                else
+                {
+                    // First pass to calculate size needed.
+                    processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
+                    memoryUsage = transientAttachmentPool.GetStatistics().m_reservedMemory;
+                    m_compiledTopology.m_transientMemoryUsage = memoryUsage;
+                }
             }
 
             // Second pass uses the information about memory usage
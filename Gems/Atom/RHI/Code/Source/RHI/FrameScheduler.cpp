@@ -260,6 +260,15 @@ namespace AZ
 
             const ResourcePoolDatabase& resourcePoolDatabase = m_device->GetResourcePoolDatabase();
 
+            m_cpuTimingStatistics.m_shaderResourceGroupCompileCount = 0;
+            m_cpuTimingStatistics.m_shaderResourceGroupSkipCount = 0;
+
+            const auto accumulateCompileStatistics = [this](const ShaderResourceGroupPool* srgPool)
+            {
+                m_cpuTimingStatistics.m_shaderResourceGroupCompileCount += srgPool->GetCompiledGroupCount();
+                m_cpuTimingStatistics.m_shaderResourceGroupSkipCount += srgPool->GetSkippedGroupCount();
+            };
+
             if (m_compileRequest.m_jobPolicy == JobPolicy::Parallel)
             {
                 const auto compileGroupsBeginFunction = [](ShaderResourceGroupPool* srgPool)
@@ -300,20 +309,22 @@ namespace AZ
 
                 jobCompletion.StartAndWaitForCompletion();
 
-                const auto compileGroupsEndFunction = [](ShaderResourceGroupPool* srgPool)
+                const auto compileGroupsEndFunction = [&accumulateCompileStatistics](ShaderResourceGroupPool* srgPool)
                 {
                     srgPool->CompileGroupsEnd();
+                    accumulateCompileStatistics(srgPool);
                 };
 
                 resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsEndFunction)>(compileGroupsEndFunction);
             }
             else
             {
-                const auto compileAllLambda = [](ShaderResourceGroupPool* srgPool)
+                const auto compileAllLambda = [&accumulateCompileStatistics](ShaderResourceGroupPool* srgPool)
                 {
                     srgPool->CompileGroupsBegin();
                     srgPool->CompileGroupsForInterval(Interval(0, srgPool->GetGroupsToCompileCount()));
                     srgPool->CompileGroupsEnd();
+                    accumulateCompileStatistics(srgPool);
                 };
 
                 resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileAllLambda)>(compileAllLambda);
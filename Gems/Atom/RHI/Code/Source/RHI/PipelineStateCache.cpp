@@ -10,6 +10,7 @@
 #include <Atom/RHI/Factory.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
+#include <AzCore/std/time.h>
 
 namespace AZ
 {
@@ -151,6 +152,7 @@ namespace AZ
             GlobalLibraryEntry& libraryEntry = m_globalLibrarySet[handle.GetIndex()];
 
             AZ_Assert(libraryEntry.m_pendingCompileCount == 0, "Reseting library while compiles are still pending!");
+            ++libraryEntry.m_resetCount;
             libraryEntry.m_readOnlyCache.clear();
             libraryEntry.m_pendingCacheMutex.lock();
             libraryEntry.m_pendingCache.clear();
@@ -168,6 +170,9 @@ namespace AZ
 
             const GlobalLibraryEntry& entry = m_globalLibrarySet[handle.GetIndex()];
 
+            // Precompiles use their thread library without holding the cache lock.
+            AZStd::lock_guard<AZStd::mutex> precompileLock(entry.m_precompileMutex);
+
             /**
              * Each thread has its own PipelineLibrary instance. To produce the final serialized data, we
              * coalesce data from each individual library by merging the thread-local ones into a single
@@ -232,26 +237,39 @@ namespace AZ
                 }
             }
 
-            // If we had compilation events, then the thread-local caches are not empty and need to be cleared.
-            if (hasCompiledPipelineStates)
-            {
-                const size_t libraryCount = m_globalLibrarySet.size();
+            // Gather the statistics of all threads. If we had compilation events, then the thread-local caches
+            // are not empty and need to be cleared as well.
+            const size_t libraryCount = m_globalLibrarySet.size();
+            m_statistics.Reset();
 
-                m_threadLibrarySet.ForEach([this, libraryCount](ThreadLibrarySet& threadLibrarySet)
+            m_threadLibrarySet.ForEach([this, libraryCount, hasCompiledPipelineStates](ThreadLibrarySet& threadLibrarySet)
+            {
+                for (size_t i = 0; i < libraryCount; ++i)
                 {
-                    for (size_t i = 0; i < libraryCount; ++i)
+                    ThreadLibraryEntry& threadLibraryEntry = threadLibrarySet[i];
+
+                    PipelineStateCacheStatistics& threadStatistics = threadLibraryEntry.m_statistics;
+                    m_statistics.m_hitCount += threadStatistics.m_hitCount;
+                    m_statistics.m_missCount += threadStatistics.m_missCount;
+                    m_statistics.m_precompileCount += threadStatistics.m_precompileCount;
+                    m_statistics.m_compileDuration += threadStatistics.m_compileDuration;
+                    threadStatistics.Reset();
+
+                    if (hasCompiledPipelineStates && m_globalLibraryActiveBits[i])
                     {
-                        if (m_globalLibraryActiveBits[i])
-                        {
-                            threadLibrarySet[i].m_threadLocalCache.clear();
-                        }
+                        threadLibraryEntry.m_threadLocalCache.clear();
                     }
-                });
-            }
+                }
+            });
 
             ValidateCacheIntegrity();
         }
 
+        const PipelineStateCacheStatistics& PipelineStateCache::GetStatistics() const
+        {
+            return m_statistics;
+        }
+
         const PipelineState* PipelineStateCache::FindPipelineState(const PipelineStateSet& pipelineStateSet, const PipelineStateDescriptor& descriptor)
         {
             auto pipelineStateIt = pipelineStateSet.find(PipelineStateEntry(descriptor.GetHash(), nullptr, descriptor));
@@ -268,10 +286,32 @@ namespace AZ
             return ret.second;
         }
 
-        const PipelineState* PipelineStateCache::AcquirePipelineState(PipelineLibraryHandle handle, const PipelineStateDescriptor& descriptor)
+        void PipelineStateCache::InitThreadLibrary(const GlobalLibraryEntry& globalLibraryEntry, ThreadLibraryEntry& threadLibraryEntry)
+        {
+            if (!threadLibraryEntry.m_library)
+            {
+                Ptr<PipelineLibrary> pipelineLibrary = Factory::Get().CreatePipelineLibrary();
+                RHI::ResultCode resultCode = pipelineLibrary->Init(*m_device, globalLibraryEntry.m_serializedData.get());
+                if (resultCode != RHI::ResultCode::Success)
+                {
+                    AZ_Warning("PipelineStateCache", false, "Failed to initialize pipeline library. PipelineLibrary usage is disabled.");
+                }
+
+                // We store a valid pointer even if initialization failed, to avoid attempting
+                // to re-create it with every access.
+                threadLibraryEntry.m_library = AZStd::move(pipelineLibrary);
+            }
+        }
+
+        const PipelineState* PipelineStateCache::AcquirePipelineState(PipelineLibraryHandle handle, const PipelineStateDescriptor& descriptor, bool* wasCompiled)
         {
             AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
 
+            if (wasCompiled)
+            {
+                *wasCompiled = false;
+            }
+
             if (handle.IsNull())
             {
                 return nullptr;
@@ -282,20 +322,25 @@ namespace AZ
             GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
             PipelineStateHash pipelineStateHash = descriptor.GetHash();
 
+            // The thread library set is cached in thread-local storage, so fetching it (and counting a hit) is free of contention.
+            ThreadLibrarySet& threadLibrarySet = m_threadLibrarySet.GetStorage();
+            ThreadLibraryEntry& threadLibraryEntry = threadLibrarySet[handle.GetIndex()];
+            PipelineStateCacheStatistics& statistics = threadLibraryEntry.m_statistics;
+
             // Search the read-only cache first.
             if (const PipelineState* pipelineState = FindPipelineState(globalLibraryEntry.m_readOnlyCache, descriptor))
             {
+                ++statistics.m_hitCount;
                 return pipelineState;
             }
 
             // Search the thread-local cache next.
             {
-                ThreadLibrarySet& threadLibrarySet = m_threadLibrarySet.GetStorage();
-                ThreadLibraryEntry& threadLibraryEntry = threadLibrarySet[handle.GetIndex()];
                 PipelineStateSet& threadLocalCache = threadLibraryEntry.m_threadLocalCache;
 
                 if (const PipelineState* pipelineState = FindPipelineState(threadLocalCache, descriptor))
                 {
+                    ++statistics.m_hitCount;
                     return pipelineState;
                 }
 
@@ -303,35 +348,124 @@ namespace AZ
                 // it to the thread-local cache to reduce contention on the pending cache.
                 {
                     // Lazy-init the library on first access.
-                    if (!threadLibraryEntry.m_library)
-                    {
-                        Ptr<PipelineLibrary> pipelineLibrary = Factory::Get().CreatePipelineLibrary();
-                        RHI::ResultCode resultCode = pipelineLibrary->Init(*m_device, globalLibraryEntry.m_serializedData.get());
-                        if (resultCode != RHI::ResultCode::Success)
-                        {
-                            AZ_Warning("PipelineStateCache", false, "Failed to initialize pipeline library. PipelineLibrary usage is disabled.");
-                        }
-
-                        // We store a valid pointer even if initialization failed, to avoid attempting
-                        // to re-create it with every access.
-                        threadLibraryEntry.m_library = AZStd::move(pipelineLibrary);
-                    }
+                    InitThreadLibrary(globalLibraryEntry, threadLibraryEntry);
 
-                    ConstPtr<PipelineState> pipelineState = CompilePipelineState(globalLibraryEntry, threadLibraryEntry, descriptor, pipelineStateHash);
+                    bool compiled = false;
+                    ConstPtr<PipelineState> pipelineState = CompilePipelineState(globalLibraryEntry, threadLibraryEntry, descriptor, pipelineStateHash, compiled);
 
                     [[maybe_unused]] bool success = InsertPipelineState(threadLocalCache, PipelineStateEntry(pipelineStateHash, pipelineState, descriptor));
                     AZ_Assert(success, "PipelineStateEntry already exists in the thread cache.");
 
+                    if (compiled)
+                    {
+                        ++statistics.m_missCount;
+                    }
+                    else
+                    {
+                        ++statistics.m_hitCount;
+                    }
+
+                    if (wasCompiled)
+                    {
+                        *wasCompiled = compiled;
+                    }
+
                     return pipelineState.get();
                 }
             }
         }
 
+        bool PipelineStateCache::PrecompilePipelineState(PipelineLibraryHandle handle, const PipelineStateDescriptor& descriptor)
+        {
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+
+            if (handle.IsNull())
+            {
+                return false;
+            }
+
+            GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
+            PipelineStateHash pipelineStateHash = descriptor.GetHash();
+
+            Ptr<PipelineLibrary> pipelineLibrary;
+            uint32_t resetCount = 0;
+
+            {
+                AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+
+                if (!m_globalLibraryActiveBits[handle.GetIndex()] || FindPipelineState(globalLibraryEntry.m_readOnlyCache, descriptor))
+                {
+                    return false;
+                }
+
+                {
+                    AZStd::lock_guard<AZStd::mutex> pendingLock(globalLibraryEntry.m_pendingCacheMutex);
+                    if (FindPipelineState(globalLibraryEntry.m_pendingCache, descriptor))
+                    {
+                        return false;
+                    }
+                }
+
+                ThreadLibraryEntry& threadLibraryEntry = m_threadLibrarySet.GetStorage()[handle.GetIndex()];
+                InitThreadLibrary(globalLibraryEntry, threadLibraryEntry);
+
+                // Keep a reference, since a reset releases the thread library while we compile.
+                pipelineLibrary = threadLibraryEntry.m_library;
+                resetCount = globalLibraryEntry.m_resetCount;
+            }
+
+            // Compile without holding the cache lock, so a slow compile doesn't stall compaction at the end of the frame.
+            // Since other threads may acquire the pipeline state in the meantime, it is only added to the cache once compiled.
+            Ptr<PipelineState> pipelineState = Factory::Get().CreatePipelineState();
+            ResultCode resultCode = ResultCode::InvalidArgument;
+            const AZStd::sys_time_t compileStartTime = AZStd::GetTimeNowTicks();
+            {
+                AZStd::lock_guard<AZStd::mutex> precompileLock(globalLibraryEntry.m_precompileMutex);
+                resultCode = InitPipelineState(*pipelineState, descriptor, pipelineLibrary->IsInitialized() ? pipelineLibrary.get() : nullptr);
+            }
+            const AZStd::sys_time_t compileDuration = AZStd::GetTimeNowTicks() - compileStartTime;
+
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+
+            PipelineStateCacheStatistics& statistics = m_threadLibrarySet.GetStorage()[handle.GetIndex()].m_statistics;
+            statistics.m_compileDuration += compileDuration;
+
+            if (resultCode != ResultCode::Success)
+            {
+                // Leave it to the first acquire to report the failure.
+                return false;
+            }
+
+            // The library was reset or released while compiling, so the pipeline state may no longer be wanted.
+            if (!m_globalLibraryActiveBits[handle.GetIndex()] || globalLibraryEntry.m_resetCount != resetCount)
+            {
+                return false;
+            }
+
+            // An acquire compiled the pipeline state meanwhile, and it was merged into the read-only cache.
+            if (FindPipelineState(globalLibraryEntry.m_readOnlyCache, descriptor))
+            {
+                return false;
+            }
+
+            {
+                AZStd::lock_guard<AZStd::mutex> pendingLock(globalLibraryEntry.m_pendingCacheMutex);
+                if (!InsertPipelineState(globalLibraryEntry.m_pendingCache, PipelineStateEntry(pipelineStateHash, pipelineState, descriptor)))
+                {
+                    return false;
+                }
+            }
+
+            ++statistics.m_precompileCount;
+            return true;
+        }
+
         ConstPtr<PipelineState> PipelineStateCache::CompilePipelineState(
             GlobalLibraryEntry& globalLibraryEntry,
             ThreadLibraryEntry& threadLibraryEntry,
             const PipelineStateDescriptor& descriptor,
-            PipelineStateHash pipelineStateHash)
+            PipelineStateHash pipelineStateHash,
+            bool& wasCompiled)
         {
             Ptr<PipelineState> pipelineState;
 
@@ -354,7 +488,7 @@ namespace AZ
                 AZ_Assert(success, "PipelineStateEntry already exists in the pending cache.");
             }
 
-            ResultCode resultCode = ResultCode::InvalidArgument;
+            wasCompiled = true;
 
             // Increment the pending compile count on the global entry, which tracks how many pipeline states
             // are currently being compiled across all threads.
@@ -372,23 +506,9 @@ namespace AZ
 
             // We no longer have the lock, but we own compilation of the pipeline state. Use the
             // thread-local library to perform compilation without blocking other threads.
-            switch (descriptor.GetType())
-            {
-            case PipelineStateType::Draw:
-                resultCode = pipelineState->Init(*m_device, static_cast<const PipelineStateDescriptorForDraw&>(descriptor), pipelineLibrary);
-                break;
-
-            case PipelineStateType::Dispatch:
-                resultCode = pipelineState->Init(*m_device, static_cast<const PipelineStateDescriptorForDispatch&>(descriptor), pipelineLibrary);
-                break;
-
-            case PipelineStateType::RayTracing:
-                resultCode = pipelineState->Init(*m_device, static_cast<const PipelineStateDescriptorForRayTracing&>(descriptor), pipelineLibrary);
-                break;
-
-            default:
-                AZ_Assert(false, "Invalid pipeline state descriptor type specified.");
-            }
+            const AZStd::sys_time_t compileStartTime = AZStd::GetTimeNowTicks();
+            ResultCode resultCode = InitPipelineState(*pipelineState, descriptor, pipelineLibrary);
+            threadLibraryEntry.m_statistics.m_compileDuration += AZStd::GetTimeNowTicks() - compileStartTime;
 
             if (Validation::IsEnabled())
             {
@@ -402,6 +522,25 @@ namespace AZ
             return AZStd::move(pipelineState);
         }
 
+        ResultCode PipelineStateCache::InitPipelineState(PipelineState& pipelineState, const PipelineStateDescriptor& descriptor, PipelineLibrary* pipelineLibrary)
+        {
+            switch (descriptor.GetType())
+            {
+            case PipelineStateType::Draw:
+                return pipelineState.Init(*m_device, static_cast<const PipelineStateDescriptorForDraw&>(descriptor), pipelineLibrary);
+
+            case PipelineStateType::Dispatch:
+                return pipelineState.Init(*m_device, static_cast<const PipelineStateDescriptorForDispatch&>(descriptor), pipelineLibrary);
+
+            case PipelineStateType::RayTracing:
+                return pipelineState.Init(*m_device, static_cast<const PipelineStateDescriptorForRayTracing&>(descriptor), pipelineLibrary);
+
+            default:
+                AZ_Assert(false, "Invalid pipeline state descriptor type specified.");
+                return ResultCode::InvalidArgument;
+            }
+        }
+
         PipelineStateCache::PipelineStateEntry::PipelineStateEntry(PipelineStateHash hash, ConstPtr<PipelineState> pipelineState, const PipelineStateDescriptor& descriptor)
             : m_hash{ hash }
             , m_pipelineState{ AZStd::move(pipelineState) }
@@ -335,5 +335,51 @@ namespace AZ
             return m_constantsData.GetConstantData();
         }
 
+        HashValue64 ShaderResourceGroupData::GetHash(HashValue64 seed) const
+        {
+            HashValue64 hash = TypeHash64(m_shaderResourceGroupLayout.get(), seed);
+
+            const auto hashResourceView = [&hash](const ResourceView* resourceView)
+            {
+                hash = TypeHash64(resourceView, hash);
+                if (resourceView)
+                {
+                    hash = TypeHash64(resourceView->GetResource().GetVersion(), hash);
+                }
+            };
+
+            hash = TypeHash64(m_imageViews.size(), hash);
+            for (const ConstPtr<ImageView>& imageView : m_imageViews)
+            {
+                hashResourceView(imageView.get());
+            }
+
+            hash = TypeHash64(m_bufferViews.size(), hash);
+            for (const ConstPtr<BufferView>& bufferView : m_bufferViews)
+            {
+                hashResourceView(bufferView.get());
+            }
+
+            hash = TypeHash64(m_imageViewsUnboundedArray.size(), hash);
+            for (const ConstPtr<ImageView>& imageView : m_imageViewsUnboundedArray)
+            {
+                hashResourceView(imageView.get());
+            }
+
+            hash = TypeHash64(m_bufferViewsUnboundedArray.size(), hash);
+            for (const ConstPtr<BufferView>& bufferView : m_bufferViewsUnboundedArray)
+            {
+                hashResourceView(bufferView.get());
+            }
+
+            for (const SamplerState& samplerState : m_samplers)
+            {
+                hash = samplerState.GetHash(hash);
+            }
+
+            const AZStd::array_view<uint8_t> constantData = m_constantsData.GetConstantData();
+            return TypeHash64(constantData.data(), constantData.size(), hash);
+        }
+
     } // namespace RHI
 } // namespace AZ
@@ -72,6 +72,8 @@ namespace AZ
 
                 // Cache off the binding slot for one less indirection.
                 group.m_bindingSlot = layout->GetBindingSlot();
+
+                group.m_compiledDataHash = HashValue64{ 0 };
             }
             return resultCode;
         }
@@ -105,6 +107,7 @@ namespace AZ
             }
 
             shaderResourceGroup.SetData(ShaderResourceGroupData());
+            shaderResourceGroup.m_compiledDataHash = HashValue64{ 0 };
         }
 
         void ShaderResourceGroupPool::QueueForCompile(ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData)
@@ -123,6 +126,9 @@ namespace AZ
         void ShaderResourceGroupPool::QueueForCompile(ShaderResourceGroup& group)
         {
             AZStd::lock_guard<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
+
+            // A bound resource was invalidated, so the group must recompile even if its data hashes the same.
+            group.m_compiledDataHash = HashValue64{ 0 };
             QueueForCompileNoLock(group);
         }
 
@@ -150,6 +156,7 @@ namespace AZ
             CalculateGroupDataDiff(group, groupData);
             group.SetData(groupData);
             CompileGroupInternal(group, group.GetData());
+            group.m_compiledDataHash = group.GetData().GetHash(TypeHash64(group.GetVersion()));
         }
 
         void ShaderResourceGroupPool::CalculateGroupDataDiff(ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData)
@@ -226,6 +233,8 @@ namespace AZ
             AZ_Assert(m_isCompiling == false, "Already compiling! Deadlock imminent.");
             m_groupsToCompileMutex.lock();
             m_isCompiling = true;
+            m_compiledGroupCount = 0;
+            m_skippedGroupCount = 0;
         }
 
         void ShaderResourceGroupPool::CompileGroupsEnd()
@@ -252,12 +261,36 @@ namespace AZ
                 interval.m_max <= static_cast<uint32_t>(m_groupsToCompile.size()),
                 "You must specify a valid interval for compilation");
 
+            uint32_t compiledGroupCount = 0;
             for (uint32_t i = interval.m_min; i < interval.m_max; ++i)
             {
                 ShaderResourceGroup* group = m_groupsToCompile[i];
-                CompileGroupInternal(*group, group->GetData());
+
+                // Many groups are re-queued every frame with the data they already hold (e.g. static objects),
+                // in which case the compiled data from the previous compile is still valid.
+                const HashValue64 dataHash = group->GetData().GetHash(TypeHash64(group->GetVersion()));
+                if (dataHash != group->m_compiledDataHash)
+                {
+                    CompileGroupInternal(*group, group->GetData());
+                    group->m_compiledDataHash = dataHash;
+                    ++compiledGroupCount;
+                }
+
                 group->m_isQueuedForCompile = false;
             }
+
+            m_compiledGroupCount += compiledGroupCount;
+            m_skippedGroupCount += (interval.m_max - interval.m_min) - compiledGroupCount;
+        }
+
+        uint32_t ShaderResourceGroupPool::GetCompiledGroupCount() const
+        {
+            return m_compiledGroupCount;
+        }
+
+        uint32_t ShaderResourceGroupPool::GetSkippedGroupCount() const
+        {
+            return m_skippedGroupCount;
         }
 
         ResultCode ShaderResourceGroupPool::InitInternal(Device&, const ShaderResourceGroupPoolDescriptor&)
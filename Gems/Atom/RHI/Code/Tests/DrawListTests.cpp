@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "RHITestFixture.h"
+
+#include <Atom/RHI/DrawList.h>
+#include <Atom/RHI/PipelineState.h>
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
+
+#include <Tests/Factory.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    namespace
+    {
+        constexpr RHI::DrawListSortType DrawListSortTypes[] =
+        {
+            RHI::DrawListSortType::KeyThenDepth,
+            RHI::DrawListSortType::KeyThenReverseDepth,
+            RHI::DrawListSortType::DepthThenKey,
+            RHI::DrawListSortType::ReverseDepthThenKey
+        };
+
+        //! Returns whether a is ordered before b by the sort type, ignoring the pipeline state tie-break.
+        bool IsOrderedBefore(const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b, RHI::DrawListSortType sortType)
+        {
+            switch (sortType)
+            {
+            case RHI::DrawListSortType::KeyThenDepth:
+                return a.m_sortKey != b.m_sortKey ? a.m_sortKey < b.m_sortKey : a.m_depth < b.m_depth;
+            case RHI::DrawListSortType::KeyThenReverseDepth:
+                return a.m_sortKey != b.m_sortKey ? a.m_sortKey < b.m_sortKey : a.m_depth > b.m_depth;
+            case RHI::DrawListSortType::DepthThenKey:
+                return a.m_depth != b.m_depth ? a.m_depth < b.m_depth : a.m_sortKey < b.m_sortKey;
+            case RHI::DrawListSortType::ReverseDepthThenKey:
+                return a.m_depth != b.m_depth ? a.m_depth > b.m_depth : a.m_sortKey < b.m_sortKey;
+            }
+            return false;
+        }
+    }
+
+    class DrawListTest
+        : public RHITestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            RHITestFixture::SetUp();
+
+            m_factory.reset(aznew Factory());
+            for (auto& pipelineState : m_pipelineStates)
+            {
+                pipelineState = RHI::Factory::Get().CreatePipelineState();
+            }
+        }
+
+        void TearDown() override
+        {
+            DisableJobs();
+
+            m_drawItems = {};
+            for (auto& pipelineState : m_pipelineStates)
+            {
+                pipelineState = nullptr;
+            }
+            m_factory.reset();
+
+            RHITestFixture::TearDown();
+        }
+
+    protected:
+        //! Creates a job manager, so long draw lists are sorted in parallel jobs.
+        void EnableJobs()
+        {
+            JobManagerDesc desc;
+            const uint32_t workerCount = AZStd::max(4u, AZStd::thread::hardware_concurrency());
+            for (uint32_t i = 0; i < workerCount; ++i)
+            {
+                desc.m_workerThreads.push_back(JobManagerThreadDesc());
+            }
+
+            m_jobManager = AZStd::make_unique<JobManager>(desc);
+            m_jobContext = AZStd::make_unique<JobContext>(*m_jobManager);
+            JobContext::SetGlobalContext(m_jobContext.get());
+        }
+
+        void DisableJobs()
+        {
+            if (m_jobContext)
+            {
+                JobContext::SetGlobalContext(nullptr);
+                m_jobContext = nullptr;
+                m_jobManager = nullptr;
+            }
+        }
+
+        //! Creates a draw list with few distinct sort keys and depths, so that many items tie.
+        RHI::DrawList CreateDrawList(size_t itemCount)
+        {
+            SimpleLcgRandom random(1234);
+
+            m_drawItems.resize(itemCount);
+            RHI::DrawList drawList;
+            drawList.reserve(itemCount);
+            for (size_t i = 0; i < itemCount; ++i)
+            {
+                m_drawItems[i].m_pipelineState = m_pipelineStates[random.GetRandom() % m_pipelineStates.size()].get();
+
+                RHI::DrawItemProperties drawItem(&m_drawItems[i], static_cast<RHI::DrawItemSortKey>(random.GetRandom() % 64) - 32);
+                drawItem.m_depth = static_cast<float>(random.GetRandom() % 128) * 0.25f - 8.0f;
+                drawList.push_back(drawItem);
+            }
+            return drawList;
+        }
+
+        void ValidateSortedDrawList(RHI::DrawList unsortedDrawList, const RHI::DrawList& drawList, RHI::DrawListSortType sortType)
+        {
+            ASSERT_EQ(unsortedDrawList.size(), drawList.size());
+
+            for (size_t i = 1; i < drawList.size(); ++i)
+            {
+                EXPECT_FALSE(IsOrderedBefore(drawList[i], drawList[i - 1], sortType));
+            }
+
+            // The sorted list must hold the same items
+            RHI::DrawList sortedItems = drawList;
+            const auto itemOrder = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+            {
+                return a.m_item < b.m_item;
+            };
+            AZStd::sort(unsortedDrawList.begin(), unsortedDrawList.end(), itemOrder);
+            AZStd::sort(sortedItems.begin(), sortedItems.end(), itemOrder);
+            EXPECT_TRUE(unsortedDrawList == sortedItems);
+        }
+
+        AZStd::unique_ptr<Factory> m_factory;
+        AZStd::array<RHI::Ptr<RHI::PipelineState>, 4> m_pipelineStates;
+        AZStd::vector<RHI::DrawItem> m_drawItems;
+
+        AZStd::unique_ptr<JobManager> m_jobManager;
+        AZStd::unique_ptr<JobContext> m_jobContext;
+    };
+
+    TEST_F(DrawListTest, SortDrawList_ShortList_IsSorted)
+    {
+        for (RHI::DrawListSortType sortType : DrawListSortTypes)
+        {
+            const RHI::DrawList unsortedDrawList = CreateDrawList(100);
+            RHI::DrawList drawList = unsortedDrawList;
+            RHI::SortDrawList(drawList, sortType);
+            ValidateSortedDrawList(unsortedDrawList, drawList, sortType);
+        }
+    }
+
+    TEST_F(DrawListTest, SortDrawList_LongList_IsSorted)
+    {
+        for (RHI::DrawListSortType sortType : DrawListSortTypes)
+        {
+            const RHI::DrawList unsortedDrawList = CreateDrawList(10000);
+            RHI::DrawList drawList = unsortedDrawList;
+            RHI::SortDrawList(drawList, sortType);
+            ValidateSortedDrawList(unsortedDrawList, drawList, sortType);
+        }
+    }
+
+    TEST_F(DrawListTest, SortDrawList_LongListWithJobs_IsSorted)
+    {
+        EnableJobs();
+
+        for (RHI::DrawListSortType sortType : DrawListSortTypes)
+        {
+            const RHI::DrawList unsortedDrawList = CreateDrawList(200000);
+            RHI::DrawList drawList = unsortedDrawList;
+            RHI::SortDrawList(drawList, sortType);
+            ValidateSortedDrawList(unsortedDrawList, drawList, sortType);
+        }
+    }
+
+    TEST_F(DrawListTest, SortDrawList_LongListWithTies_GroupsPipelineStates)
+    {
+        RHI::DrawList drawList = CreateDrawList(10000);
+        for (RHI::DrawItemProperties& drawItem : drawList)
+        {
+            drawItem.m_sortKey = 0;
+            drawItem.m_depth = 0.0f;
+        }
+
+        RHI::SortDrawList(drawList, RHI::DrawListSortType::KeyThenDepth);
+
+        size_t pipelineStateChanges = 0;
+        for (size_t i = 1; i < drawList.size(); ++i)
+        {
+            if (drawList[i].m_item->m_pipelineState != drawList[i - 1].m_item->m_pipelineState)
+            {
+                ++pipelineStateChanges;
+            }
+        }
+        EXPECT_EQ(pipelineStateChanges, m_pipelineStates.size() - 1);
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AZ;
+
+    //! Sorts a draw list the size of a busy frame's shadow cascades and forward pass.
+    class BM_DrawListSort
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t ItemCount = 100000;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+
+            SimpleLcgRandom random(1234);
+            m_drawItems.resize(ItemCount);
+            m_drawList.reserve(ItemCount);
+            for (size_t i = 0; i < ItemCount; ++i)
+            {
+                RHI::DrawItemProperties drawItem(&m_drawItems[i], static_cast<RHI::DrawItemSortKey>(random.GetRandom() % 16));
+                drawItem.m_depth = random.GetRandomFloat() * 1000.0f;
+                m_drawList.push_back(drawItem);
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            DisableJobs();
+
+            m_drawItems = {};
+            m_drawList = {};
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void EnableJobs()
+        {
+            JobManagerDesc desc;
+            for (uint32_t i = 0; i < AZStd::thread::hardware_concurrency(); ++i)
+            {
+                desc.m_workerThreads.push_back(JobManagerThreadDesc());
+            }
+
+            m_jobManager = AZStd::make_unique<JobManager>(desc);
+            m_jobContext = AZStd::make_unique<JobContext>(*m_jobManager);
+            JobContext::SetGlobalContext(m_jobContext.get());
+        }
+
+        void DisableJobs()
+        {
+            if (m_jobContext)
+            {
+                JobContext::SetGlobalContext(nullptr);
+                m_jobContext = nullptr;
+                m_jobManager = nullptr;
+            }
+        }
+
+        AZStd::vector<RHI::DrawItem> m_drawItems;
+        RHI::DrawList m_drawList;
+
+        AZStd::unique_ptr<JobManager> m_jobManager;
+        AZStd::unique_ptr<JobContext> m_jobContext;
+    };
+
+    BENCHMARK_F(BM_DrawListSort, ComparisonSort)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            RHI::DrawList drawList = m_drawList;
+            state.ResumeTiming();
+
+            AZStd::sort(drawList.begin(), drawList.end(), [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+                {
+                    if (a.m_sortKey != b.m_sortKey)
+                    {
+                        return a.m_sortKey < b.m_sortKey;
+                    }
+                    return a.m_depth < b.m_depth;
+                });
+            benchmark::DoNotOptimize(drawList.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ItemCount);
+    }
+
+    BENCHMARK_F(BM_DrawListSort, RadixSort)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            RHI::DrawList drawList = m_drawList;
+            state.ResumeTiming();
+
+            RHI::SortDrawList(drawList, RHI::DrawListSortType::KeyThenDepth);
+            benchmark::DoNotOptimize(drawList.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ItemCount);
+    }
+
+    BENCHMARK_F(BM_DrawListSort, ParallelRadixSort)(benchmark::State& state)
+    {
+        EnableJobs();
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            RHI::DrawList drawList = m_drawList;
+            state.ResumeTiming();
+
+            RHI::SortDrawList(drawList, RHI::DrawListSortType::KeyThenDepth);
+            benchmark::DoNotOptimize(drawList.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ItemCount);
+    }
+}
+#endif
@@ -146,6 +146,14 @@ namespace UnitTest
 
             m_state->m_frameGraphCompiler = RHI::Factory::Get().CreateFrameGraphCompiler();
             m_state->m_frameGraphCompiler->Init(*device);
+
+            {
+                m_state->m_transientAttachmentPool = RHI::Factory::Get().CreateTransientAttachmentPool();
+
+                RHI::TransientAttachmentPoolDescriptor desc;
+                desc.m_heapParameters = RHI::HeapAllocationParameters(RHI::HeapMemoryHintParameters());
+                m_state->m_transientAttachmentPool->Init(*device, desc);
+            }
         }
 
         void TearDown() override
@@ -437,14 +445,156 @@ namespace UnitTest
             }
         }
 
-    private:
+        //! Builds a graph of scopes alternating between the graphics and compute queues. Each scope writes a
+        //! transient buffer, and each graphics scope a transient image, which are read again readerOffset scopes later.
+        void BuildTopologyCacheGraph(RHI::FrameGraph& frameGraph, uint32_t readerOffset, uint32_t scopeCount = TopologyCacheScopeCount)
+        {
+            const auto isComputeScope = [](uint32_t scopeIdx)
+            {
+                return scopeIdx % 3 == 1;
+            };
+
+            RHI::BufferScopeAttachmentDescriptor bufferBindingDesc;
+            bufferBindingDesc.m_bufferViewDescriptor = RHI::BufferViewDescriptor::CreateRaw(0, BufferSize);
+
+            RHI::ImageScopeAttachmentDescriptor imageBindingDesc;
+            imageBindingDesc.m_imageViewDescriptor = RHI::ImageViewDescriptor();
+
+            frameGraph.Begin();
+
+            for (uint32_t scopeIdx = 0; scopeIdx < scopeCount; ++scopeIdx)
+            {
+                frameGraph.BeginScope(*m_state->m_scopes[scopeIdx]);
+                frameGraph.SetHardwareQueueClass(isComputeScope(scopeIdx) ? RHI::HardwareQueueClass::Compute : RHI::HardwareQueueClass::Graphics);
+
+                RHI::FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+
+                const RHI::AttachmentId bufferId{ AZStd::string::format("TB%d", scopeIdx) };
+                attachmentDatabase.CreateTransientBuffer(
+                    RHI::TransientBufferDescriptor{ bufferId, RHI::BufferDescriptor(RHI::BufferBindFlags::ShaderReadWrite, BufferSize) });
+                bufferBindingDesc.m_attachmentId = bufferId;
+                frameGraph.UseShaderAttachment(bufferBindingDesc, RHI::ScopeAttachmentAccess::ReadWrite);
+
+                // Images start their lifetime on the graphics queue, which is the most capable one.
+                if (!isComputeScope(scopeIdx))
+                {
+                    const RHI::AttachmentId imageId{ AZStd::string::format("TI%d", scopeIdx) };
+                    attachmentDatabase.CreateTransientImage(RHI::TransientImageDescriptor{
+                        imageId, RHI::ImageDescriptor::Create2D(RHI::ImageBindFlags::ShaderReadWrite, ImageSize, ImageSize, RHI::Format::R8G8B8A8_UNORM) });
+                    imageBindingDesc.m_attachmentId = imageId;
+                    frameGraph.UseShaderAttachment(imageBindingDesc, RHI::ScopeAttachmentAccess::ReadWrite);
+                }
+
+                if (scopeIdx >= readerOffset)
+                {
+                    const uint32_t producerScopeIdx = scopeIdx - readerOffset;
+                    bufferBindingDesc.m_attachmentId = RHI::AttachmentId{ AZStd::string::format("TB%d", producerScopeIdx) };
+                    frameGraph.UseShaderAttachment(bufferBindingDesc, RHI::ScopeAttachmentAccess::Read);
+
+                    if (!isComputeScope(producerScopeIdx))
+                    {
+                        imageBindingDesc.m_attachmentId = RHI::AttachmentId{ AZStd::string::format("TI%d", producerScopeIdx) };
+                        frameGraph.UseShaderAttachment(imageBindingDesc, RHI::ScopeAttachmentAccess::Read);
+                    }
+                }
+
+                frameGraph.EndScope();
+            }
+
+            frameGraph.End();
+        }
+
+        void CompileTopologyCacheGraph(RHI::FrameGraph& frameGraph, RHI::FrameSchedulerCompileFlags compileFlags)
+        {
+            RHI::FrameGraphCompileRequest request;
+            request.m_frameGraph = &frameGraph;
+            request.m_transientAttachmentPool = m_state->m_transientAttachmentPool.get();
+            request.m_compileFlags = compileFlags;
+            ASSERT_TRUE(m_state->m_frameGraphCompiler->Compile(request).IsSuccess());
+
+            for (const RHI::FrameAttachment* attachment : frameGraph.GetAttachmentDatabase().GetAttachments())
+            {
+                ASSERT_TRUE(attachment->GetResource() != nullptr);
+            }
+        }
+
+        //! Flattens the cross-queue links of each scope and the lifetimes of each transient attachment into scope indices.
+        AZStd::vector<uint32_t> GetCompiledTopology(const RHI::FrameGraph& frameGraph)
+        {
+            const auto getScopeIndex = [](const RHI::Scope* scope)
+            {
+                return scope ? scope->GetIndex() : static_cast<uint32_t>(-1);
+            };
+
+            AZStd::vector<uint32_t> compiledTopology;
+            for (const RHI::Scope* scope : frameGraph.GetScopes())
+            {
+                compiledTopology.push_back(static_cast<uint32_t>(scope->GetHardwareQueueClass()));
+                for (uint32_t hardwareQueueClassIdx = 0; hardwareQueueClassIdx < RHI::HardwareQueueClassCount; ++hardwareQueueClassIdx)
+                {
+                    const RHI::HardwareQueueClass hardwareQueueClass = static_cast<RHI::HardwareQueueClass>(hardwareQueueClassIdx);
+                    compiledTopology.push_back(getScopeIndex(scope->GetProducerByQueue(hardwareQueueClass)));
+                    compiledTopology.push_back(getScopeIndex(scope->GetConsumerByQueue(hardwareQueueClass)));
+                }
+            }
+
+            for (const RHI::FrameAttachment* attachment : frameGraph.GetAttachmentDatabase().GetAttachments())
+            {
+                compiledTopology.push_back(getScopeIndex(attachment->GetFirstScope()));
+                compiledTopology.push_back(getScopeIndex(attachment->GetLastScope()));
+            }
+            return compiledTopology;
+        }
+
+        void TestTopologyCache()
+        {
+            RHI::FrameGraph frameGraph;
+
+            BuildTopologyCacheGraph(frameGraph, 2);
+            CompileTopologyCacheGraph(frameGraph, RHI::FrameSchedulerCompileFlags::None);
+            const AZStd::vector<uint32_t> compiledTopology = GetCompiledTopology(frameGraph);
+
+            // The same graph replays the cached results.
+            for (uint32_t frameIdx = 0; frameIdx < FrameIterationCount; ++frameIdx)
+            {
+                BuildTopologyCacheGraph(frameGraph, 2);
+                CompileTopologyCacheGraph(frameGraph, RHI::FrameSchedulerCompileFlags::None);
+                ASSERT_TRUE(GetCompiledTopology(frameGraph) == compiledTopology);
+            }
+
+            // A full compile produces the same results as the cache.
+            BuildTopologyCacheGraph(frameGraph, 2);
+            CompileTopologyCacheGraph(frameGraph, RHI::FrameSchedulerCompileFlags::DisableTopologyCache);
+            ASSERT_TRUE(GetCompiledTopology(frameGraph) == compiledTopology);
+
+            // Changing the usage chains invalidates the cache.
+            BuildTopologyCacheGraph(frameGraph, 3);
+            CompileTopologyCacheGraph(frameGraph, RHI::FrameSchedulerCompileFlags::None);
+            const AZStd::vector<uint32_t> changedTopology = GetCompiledTopology(frameGraph);
+            ASSERT_FALSE(changedTopology == compiledTopology);
+
+            BuildTopologyCacheGraph(frameGraph, 3);
+            CompileTopologyCacheGraph(frameGraph, RHI::FrameSchedulerCompileFlags::None);
+            ASSERT_TRUE(GetCompiledTopology(frameGraph) == changedTopology);
+
+            // Changing the queue flags invalidates the cache.
+            BuildTopologyCacheGraph(frameGraph, 3);
+            CompileTopologyCacheGraph(frameGraph, RHI::FrameSchedulerCompileFlags::DisableAsyncQueues);
+            for (const RHI::Scope* scope : frameGraph.GetScopes())
+            {
+                ASSERT_TRUE(scope->GetHardwareQueueClass() == RHI::HardwareQueueClass::Graphics);
+            }
+        }
+
         static const uint32_t FrameIterationCount = 32;
         static const uint32_t ImageCount = 256;
         static const uint32_t BufferCount = 256;
         static const uint32_t BufferSize = 64;
         static const uint32_t ImageSize = 16;
         static const uint32_t ScopeCount = 128;
+        static const uint32_t TopologyCacheScopeCount = 8;
 
+    private:
         AZStd::unique_ptr<Factory> m_rootFactory;
 
         struct ImageAttachment
@@ -464,6 +614,7 @@ namespace UnitTest
             RHI::Ptr<RHI::BufferPool> m_bufferPool;
             RHI::Ptr<RHI::ImagePool> m_imagePool;
             RHI::Ptr<RHI::FrameGraphCompiler> m_frameGraphCompiler;
+            RHI::Ptr<RHI::TransientAttachmentPool> m_transientAttachmentPool;
 
             ImageAttachment m_imageAttachments[ImageCount];
             BufferAttachment m_bufferAttachments[BufferCount];
@@ -493,4 +644,64 @@ namespace UnitTest
     {
         TestScopeGraph();
     }
+
+    TEST_F(FrameGraphTests, TestTopologyCache)
+    {
+        TestTopologyCache();
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Sets up the test RHI, whose platform compile does no work, so the benchmark only measures the
+    // platform-independent compile.
+    class FrameGraphEnvironment
+        : public UnitTest::FrameGraphTests
+    {
+    public:
+        void TestBody() override {}
+    };
+
+    //! Compiles a graph with as many scopes as the fixture creates, replaying the topology cache or compiling in full.
+    class BM_FrameGraphCompile
+        : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp([[maybe_unused]] ::benchmark::State& state) override
+        {
+            m_environment.SetUp();
+        }
+
+        void TearDown([[maybe_unused]] ::benchmark::State& state) override
+        {
+            m_environment.TearDown();
+        }
+
+        void CompileFrames(::benchmark::State& state, RHI::FrameSchedulerCompileFlags compileFlags)
+        {
+            RHI::FrameGraph frameGraph;
+            for (auto _ : state)
+            {
+                state.PauseTiming();
+                m_environment.BuildTopologyCacheGraph(frameGraph, 2, UnitTest::FrameGraphTests::ScopeCount);
+                state.ResumeTiming();
+
+                m_environment.CompileTopologyCacheGraph(frameGraph, compileFlags);
+            }
+        }
+
+        FrameGraphEnvironment m_environment;
+    };
+
+    BENCHMARK_F(BM_FrameGraphCompile, TopologyCache)(benchmark::State& state)
+    {
+        CompileFrames(state, RHI::FrameSchedulerCompileFlags::None);
+    }
+
+    BENCHMARK_F(BM_FrameGraphCompile, FullCompile)(benchmark::State& state)
+    {
+        CompileFrames(state, RHI::FrameSchedulerCompileFlags::DisableTopologyCache);
+    }
 }
+#endif
@@ -362,4 +362,135 @@ namespace UnitTest
             }
         }
     }
+
+    TEST_F(PipelineStateTests, PipelineStateCache_Statistics_CountsHitsAndMisses)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(*device);
+        RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary(nullptr);
+
+        const RHI::PipelineStateDescriptorForDraw descriptorA = CreatePipelineStateDescriptor(0);
+        const RHI::PipelineStateDescriptorForDraw descriptorB = CreatePipelineStateDescriptor(1);
+
+        bool wasCompiled = false;
+        const RHI::PipelineState* pipelineStateA = pipelineStateCache->AcquirePipelineState(libraryHandle, descriptorA, &wasCompiled);
+        EXPECT_TRUE(wasCompiled);
+        pipelineStateCache->AcquirePipelineState(libraryHandle, descriptorB, &wasCompiled);
+        EXPECT_TRUE(wasCompiled);
+        EXPECT_EQ(pipelineStateCache->AcquirePipelineState(libraryHandle, descriptorA, &wasCompiled), pipelineStateA);
+        EXPECT_FALSE(wasCompiled);
+
+        pipelineStateCache->Compact();
+        EXPECT_EQ(pipelineStateCache->GetStatistics().m_hitCount, 1);
+        EXPECT_EQ(pipelineStateCache->GetStatistics().m_missCount, 2);
+        EXPECT_EQ(pipelineStateCache->GetStatistics().m_precompileCount, 0);
+
+        // The next frame hits the read-only cache.
+        EXPECT_EQ(pipelineStateCache->AcquirePipelineState(libraryHandle, descriptorA, &wasCompiled), pipelineStateA);
+        EXPECT_FALSE(wasCompiled);
+
+        pipelineStateCache->Compact();
+        EXPECT_EQ(pipelineStateCache->GetStatistics().m_hitCount, 1);
+        EXPECT_EQ(pipelineStateCache->GetStatistics().m_missCount, 0);
+        EXPECT_EQ(pipelineStateCache->GetStatistics().m_compileDuration, 0);
+    }
+
+    TEST_F(PipelineStateTests, PipelineStateCache_Precompile_AcquireReturnsPrecompiledPipelineState)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(*device);
+        RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary(nullptr);
+
+        const RHI::PipelineStateDescriptorForDraw descriptor = CreatePipelineStateDescriptor(0);
+
+        EXPECT_TRUE(pipelineStateCache->PrecompilePipelineState(libraryHandle, descriptor));
+        EXPECT_FALSE(pipelineStateCache->PrecompilePipelineState(libraryHandle, descriptor));
+
+        bool wasCompiled = true;
+        const RHI::PipelineState* pipelineState = pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor, &wasCompiled);
+        ASSERT_NE(pipelineState, nullptr);
+        EXPECT_TRUE(pipelineState->IsInitialized());
+        EXPECT_FALSE(wasCompiled);
+
+        pipelineStateCache->Compact();
+        ValidateCacheIntegrity(pipelineStateCache);
+        EXPECT_EQ(pipelineStateCache->GetStatistics().m_hitCount, 1);
+        EXPECT_EQ(pipelineStateCache->GetStatistics().m_missCount, 0);
+        EXPECT_EQ(pipelineStateCache->GetStatistics().m_precompileCount, 1);
+
+        // Once merged into the read-only cache, the pipeline state isn't precompiled again.
+        EXPECT_FALSE(pipelineStateCache->PrecompilePipelineState(libraryHandle, descriptor));
+        EXPECT_EQ(pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor), pipelineState);
+    }
+
+    TEST_F(PipelineStateTests, PipelineStateCache_Precompile_InvalidLibraryIsIgnored)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(*device);
+
+        EXPECT_FALSE(pipelineStateCache->PrecompilePipelineState({}, CreatePipelineStateDescriptor(0)));
+
+        RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary(nullptr);
+        pipelineStateCache->ReleaseLibrary(libraryHandle);
+        EXPECT_FALSE(pipelineStateCache->PrecompilePipelineState(libraryHandle, CreatePipelineStateDescriptor(0)));
+
+        pipelineStateCache->Compact();
+        ValidateCacheIntegrity(pipelineStateCache);
+    }
+
+    TEST_F(PipelineStateTests, PipelineStateCache_PrecompileThreading_Fuzz_Test)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(*device);
+
+        static const size_t AcquireIterationCountMax = 2000;
+        static const size_t ThreadCountMax = 4;
+        static const size_t PipelineStateCountMax = 128;
+
+        AZStd::vector<RHI::PipelineStateDescriptorForDraw> descriptors;
+        descriptors.reserve(PipelineStateCountMax);
+        for (size_t i = 0; i < PipelineStateCountMax; ++i)
+        {
+            descriptors.push_back(CreatePipelineStateDescriptor(static_cast<uint32_t>(i)));
+        }
+
+        RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary(nullptr);
+
+        // The first thread precompiles every pipeline state while the others acquire them in random order.
+        ThreadTester::Dispatch(ThreadCountMax, [&](size_t threadIndex)
+        {
+            if (threadIndex == 0)
+            {
+                for (const RHI::PipelineStateDescriptorForDraw& descriptor : descriptors)
+                {
+                    pipelineStateCache->PrecompilePipelineState(libraryHandle, descriptor);
+                }
+                return;
+            }
+
+            SimpleLcgRandom random(threadIndex);
+            for (size_t i = 0; i < AcquireIterationCountMax; ++i)
+            {
+                EXPECT_NE(pipelineStateCache->AcquirePipelineState(libraryHandle, descriptors[random.GetRandom() % descriptors.size()]), nullptr);
+            }
+        });
+
+        pipelineStateCache->Compact();
+        ValidateCacheIntegrity(pipelineStateCache);
+
+        const RHI::PipelineStateCacheStatistics& statistics = pipelineStateCache->GetStatistics();
+        EXPECT_EQ(statistics.m_hitCount + statistics.m_missCount, (ThreadCountMax - 1) * AcquireIterationCountMax);
+        EXPECT_LE(statistics.m_missCount + statistics.m_precompileCount, PipelineStateCountMax);
+
+        // Every pipeline state is cached exactly once, and fully compiled.
+        AZStd::unordered_set<const RHI::PipelineState*> pipelineStates;
+        for (const RHI::PipelineStateDescriptorForDraw& descriptor : descriptors)
+        {
+            const RHI::PipelineState* pipelineState = pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor);
+            ASSERT_NE(pipelineState, nullptr);
+            EXPECT_TRUE(pipelineState->IsInitialized());
+            pipelineStates.emplace(pipelineState);
+        }
+        EXPECT_EQ(pipelineStates.size(), PipelineStateCountMax);
+    }
 }
@@ -764,4 +764,60 @@ namespace UnitTest
             EXPECT_NE(otherLayout->GetHash(), layout->GetHash());
         }
     }
+
+    TEST_F(ShaderResourceGroupTests, ShaderResourceGroupPool_CompileUnchangedData_IsSkipped)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+
+        RHI::Ptr<RHI::ShaderResourceGroupPool> srgPool = RHI::Factory::Get().CreateShaderResourceGroupPool();
+        RHI::ShaderResourceGroupPoolDescriptor descriptor;
+        descriptor.m_layout = srgLayout.get();
+        srgPool->Init(*device, descriptor);
+
+        RHI::Ptr<RHI::ShaderResourceGroup> srg = RHI::Factory::Get().CreateShaderResourceGroup();
+        srgPool->InitGroup(*srg);
+
+        RHI::ShaderResourceGroupData srgData(*srgPool);
+        const RHI::ShaderInputConstantIndex floatIndex = srgData.FindShaderInputConstantIndex(Name("m_floatValue"));
+
+        const auto compileGroups = [&srgPool]()
+        {
+            srgPool->CompileGroupsBegin();
+            srgPool->CompileGroupsForInterval(RHI::Interval(0, srgPool->GetGroupsToCompileCount()));
+            srgPool->CompileGroupsEnd();
+        };
+
+        // The first compile always happens.
+        EXPECT_TRUE(srgData.SetConstant(floatIndex, 1.0f));
+        srg->Compile(srgData);
+        compileGroups();
+        EXPECT_EQ(srgPool->GetCompiledGroupCount(), 1);
+        EXPECT_EQ(srgPool->GetSkippedGroupCount(), 0);
+        EXPECT_FALSE(srg->IsQueuedForCompile());
+
+        // Identical data skips the compile.
+        srg->Compile(srgData);
+        compileGroups();
+        EXPECT_EQ(srgPool->GetCompiledGroupCount(), 0);
+        EXPECT_EQ(srgPool->GetSkippedGroupCount(), 1);
+        EXPECT_FALSE(srg->IsQueuedForCompile());
+
+        // Changed data compiles again.
+        const HashValue64 previousHash = srgData.GetHash();
+        EXPECT_TRUE(srgData.SetConstant(floatIndex, 2.0f));
+        EXPECT_NE(srgData.GetHash(), previousHash);
+        srg->Compile(srgData);
+        compileGroups();
+        EXPECT_EQ(srgPool->GetCompiledGroupCount(), 1);
+        EXPECT_EQ(srgPool->GetSkippedGroupCount(), 0);
+
+        // Re-initializing the group discards its compiled data.
+        srg->Shutdown();
+        srgPool->InitGroup(*srg);
+        srg->Compile(srgData);
+        compileGroups();
+        EXPECT_EQ(srgPool->GetCompiledGroupCount(), 1);
+        EXPECT_EQ(srgPool->GetSkippedGroupCount(), 0);
+    }
 }
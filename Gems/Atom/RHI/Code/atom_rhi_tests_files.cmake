@@ -10,6 +10,7 @@ set(FILES
     Tests/RHITestFixture.h
     Tests/AllocatorTests.cpp
     Tests/BufferTests.cpp
+    Tests/DrawListTests.cpp
     Tests/DrawPacketTests.cpp
     Tests/FrameGraphTests.cpp
     Tests/FrameSchedulerTests.cpp
@@ -24,6 +24,7 @@ namespace AZ
     {
         static const char* DX12ApiName = "dx12";
         static const char* DX12ShaderPlatformName = "DX12ShaderPlatform";
+        static const char* DxcRelativePath = "Builders/DirectXShaderCompiler/dxc.exe";
         static const char* PlatformShaderHeader = "Builders/ShaderHeaders/Platform/Windows/DX12/PlatformHeader.hlsli";
         static const char* AzslShaderHeader = "Builders/ShaderHeaders/Platform/Windows/DX12/AzslcHeader.azsli";
 
@@ -204,6 +205,16 @@ namespace AZ
             return AzslShaderHeader;
         }
 
+        AZStd::string ShaderPlatformInterface::GetCompilerVersion() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_compilerVersionMutex);
+            if (!m_compilerVersion)
+            {
+                m_compilerVersion = RHI::GetShaderCompilerVersion(DxcRelativePath, "--version");
+            }
+            return *m_compilerVersion;
+        }
+
         bool ShaderPlatformInterface::CompileHLSLShader(
             const AZStd::string& shaderSourceFile,
             const AZStd::string& tempFolder,
@@ -213,9 +224,6 @@ namespace AZ
             AZStd::vector<uint8_t>& compiledShader,
             ByProducts& byProducts) const
         {
-            // Shader compiler executable
-            static const char* dxcRelativePath = "Builders/DirectXShaderCompiler/dxc.exe";
-
             // NOTE:
             // Running DX12 on PC with DXIL shaders requires modern GPUs and at least Windows 10 Build 1803 or later for Shader Model 6.2
             // https://github.com/Microsoft/DirectXShaderCompiler/wiki/Running-Shaders
@@ -314,7 +322,7 @@ namespace AZ
                                                                  );
 
             // Run Shader Compiler
-            if (!RHI::ExecuteShaderCompiler(dxcRelativePath, dxcCommandOptions, shaderSourceFile, "DXC"))
+            if (!RHI::ExecuteShaderCompiler(DxcRelativePath, dxcCommandOptions, shaderSourceFile, "DXC"))
             {
                 return false;
             }
@@ -10,6 +10,9 @@
 
 #include <Atom/RHI.Edit/ShaderPlatformInterface.h>
 
+#include <AzCore/std/optional.h>
+#include <AzCore/std/parallel/mutex.h>
+
 namespace AZ
 {
     namespace DX12
@@ -55,6 +58,8 @@ namespace AZ
 
             const char* GetAzslHeader(const AssetBuilderSDK::PlatformInfo& platform) const override;
 
+            AZStd::string GetCompilerVersion() const override;
+
         private:
             ShaderPlatformInterface() = delete;
 
@@ -68,6 +73,10 @@ namespace AZ
                 ByProducts& products) const;
 
             const Name m_apiName;
+
+            // dxc is only asked for its version once, since the builders compile many shaders with it
+            mutable AZStd::mutex m_compilerVersionMutex;
+            mutable AZStd::optional<AZStd::string> m_compilerVersion;
         };
     }
 }
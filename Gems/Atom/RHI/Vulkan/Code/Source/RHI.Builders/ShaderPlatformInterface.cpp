@@ -24,6 +24,7 @@ namespace AZ
     namespace Vulkan
     {
         static const char* VulkanShaderPlatformName = "VulkanShaderPlatform";
+        static const char* DxcRelativePath = AZ_TRAIT_ATOM_SHADERBUILDER_DXC;
         static const char* WindowsPlatformShaderHeader = "Builders/ShaderHeaders/Platform/Windows/Vulkan/PlatformHeader.hlsli";
         static const char* AndroidPlatformShaderHeader = "Builders/ShaderHeaders/Platform/Android/Vulkan/PlatformHeader.hlsli";
         static const char* WindowsAzslShaderHeader = "Builders/ShaderHeaders/Platform/Windows/Vulkan/AzslcHeader.azsli";
@@ -124,6 +125,16 @@ namespace AZ
             }
         }
 
+        AZStd::string ShaderPlatformInterface::GetCompilerVersion() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_compilerVersionMutex);
+            if (!m_compilerVersion)
+            {
+                m_compilerVersion = RHI::GetShaderCompilerVersion(DxcRelativePath, "--version");
+            }
+            return *m_compilerVersion;
+        }
+
         // Takes in HLSL source file path and then compiles the HLSL to bytecode and
         // appends it to the AZ::Vulkan::ShaderStageDescriptor inside the provided outputAsset.
         bool ShaderPlatformInterface::CompilePlatformInternal(
@@ -180,9 +191,6 @@ namespace AZ
             const AssetBuilderSDK::PlatformInfo& platform,
             ByProducts& byProducts) const
         {
-            // Shader compiler executable
-            static const char* dxcRelativePath = AZ_TRAIT_ATOM_SHADERBUILDER_DXC;
-
             // -Fo "Output file"
             AZStd::string shaderOutputFile;
             AzFramework::StringFunc::Path::GetFileName(shaderSourceFile.c_str(), shaderOutputFile);
@@ -301,7 +309,7 @@ namespace AZ
             //       therefore, the debug data is probably embedded in the spirv blob.
 
             // Run Shader Compiler
-            if (!RHI::ExecuteShaderCompiler(dxcRelativePath, dxcCommandOptions, shaderSourceFile, "DXC"))
+            if (!RHI::ExecuteShaderCompiler(DxcRelativePath, dxcCommandOptions, shaderSourceFile, "DXC"))
             {
                 return false;
             }
@@ -11,6 +11,9 @@
 #include <Atom/RHI.Edit/ShaderPlatformInterface.h>
 #include <Atom/RHI.Reflect/Vulkan/Base.h>
 
+#include <AzCore/std/optional.h>
+#include <AzCore/std/parallel/mutex.h>
+
 namespace AZ
 {
     namespace Vulkan
@@ -57,6 +60,8 @@ namespace AZ
 
             const char* GetAzslHeader(const AssetBuilderSDK::PlatformInfo& platform) const override;
 
+            AZStd::string GetCompilerVersion() const override;
+
         private:
             ShaderPlatformInterface() = delete;
 
@@ -71,6 +76,10 @@ namespace AZ
                 ByProducts& byProducts) const;
 
             const Name m_apiName{APINameString};
+
+            // dxc is only asked for its version once, since the builders compile many shaders with it
+            mutable AZStd::mutex m_compilerVersionMutex;
+            mutable AZStd::optional<AZStd::string> m_compilerVersion;
         };
     }
 }
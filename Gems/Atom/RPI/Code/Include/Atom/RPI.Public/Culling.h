@@ -47,6 +47,24 @@ namespace AZ
     namespace RPI
     {
         class Scene;
+        class StreamingImage;
+
+        //! Interface for systems that draw the visible instances of several Cullables together, in a single instanced draw,
+        //! rather than adding a DrawPacket to the View for each of them.
+        //! AddVisibleInstance() is called from the culling jobs of every View at once, so implementations must be threadsafe.
+        class CullableInstanceCollector
+        {
+        public:
+            virtual ~CullableInstanceCollector() = default;
+
+            //! Called for each of the instanced DrawPackets of the lod selected for a visible Cullable.
+            //! @param view            the View the Cullable is visible in
+            //! @param drawPacket      the DrawPacket that would draw this instance on its own
+            //! @param instanceGroupId identifies the DrawPackets that may be drawn together in one instanced draw
+            //! @param instanceId      the Cullable's LodData::m_instanceId
+            //! @param position        world space position of the Cullable, for sorting
+            virtual void AddVisibleInstance(View& view, const RHI::DrawPacket* drawPacket, uint32_t instanceGroupId, uint32_t instanceId, const Vector3& position) = 0;
+        };
 
         struct Cullable
         {
@@ -75,15 +93,42 @@ namespace AZ
 
             struct LodData
             {
+                struct InstancedDrawPacket
+                {
+                    const RHI::DrawPacket* m_drawPacket = nullptr;
+                    uint32_t m_instanceGroupId = 0;
+                };
+
+                //! A streaming image sampled by a lod. When the lod is selected, the image is asked for the mip needed at the lod's projected size.
+                struct StreamingImageUsage
+                {
+                    StreamingImage* m_image = nullptr;
+
+                    //! The number of times the image repeats across the lod selection diameter
+                    float m_uvDensity = 1.0f;
+                };
+
                 struct Lod
                 {
                     float m_screenCoverageMin;
                     float m_screenCoverageMax;
                     AZStd::vector<const RHI::DrawPacket*> m_drawPackets;
+
+                    //! DrawPackets that are reported to m_instanceCollector rather than added to the View
+                    AZStd::vector<InstancedDrawPacket> m_instancedDrawPackets;
+
+                    //! Streaming images sampled by the lod's DrawPackets, which must be kept alive by the owner of the Cullable
+                    AZStd::vector<StreamingImageUsage> m_streamingImages;
                 };
 
                 AZStd::vector<Lod> m_lods;
 
+                //! Receives the visible instances of the lods' m_instancedDrawPackets, must be set if any lod has instanced DrawPackets
+                CullableInstanceCollector* m_instanceCollector = nullptr;
+
+                //! Identifies this Cullable to m_instanceCollector
+                uint32_t m_instanceId = 0;
+
                 //! Used for determining which lod(s) to select (usually is smaller than the bounding sphere radius)
                 //! Suggest setting to: 0.5f*localAabb.GetExtents().GetMaxElement()
                 float m_lodSelectionRadius = 1.0f;
@@ -200,6 +245,47 @@ namespace AZ
         //! Selects an lod (based on size-in-screnspace) and adds the appropriate DrawPackets to the view.
         uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view);
 
+        //! Adds the DrawPackets of the lods matching an already computed screen coverage to the view.
+        //! @param approxScreenPercentage the screen coverage of the lod selection sphere, see ModelLodUtils::ApproxScreenPercentage()
+        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view, float approxScreenPercentage);
+
+        //! Bounds of a batch of cullables laid out as parallel arrays, so that culling and lod selection can process
+        //! several cullables at once with SIMD instructions.
+        class CullableBoundsBatch
+        {
+        public:
+            static constexpr uint32_t Capacity = 64;
+
+            CullableBoundsBatch();
+
+            uint32_t GetCount() const { return m_count; }
+            bool IsFull() const { return m_count == Capacity; }
+            void Clear() { m_count = 0; }
+
+            //! Appends the bounds of a cullable to the batch and returns its index, the batch must not be full.
+            //! @param boundingSphere     world space bounding sphere of the cullable
+            //! @param lodSelectionRadius the cullable's LodData::m_lodSelectionRadius
+            uint32_t Add(const Sphere& boundingSphere, float lodSelectionRadius);
+
+            //! Classifies the bounding sphere of every cullable of the batch against a frustum, with the same results as Frustum::IntersectSphere().
+            //! @param outResults receives one result per cullable, must hold at least GetCount() entries
+            void ClassifySpheres(const Frustum& frustum, IntersectResult* outResults) const;
+
+            //! Computes the screen coverage of the lod selection sphere of every cullable of the batch, with the same results as
+            //! ModelLodUtils::ApproxScreenPercentage().
+            //! @param outScreenPercentages receives one value per cullable, must hold at least GetCount() entries
+            void ApproxScreenPercentages(const Vector3& cameraPosition, float yScale, bool isPerspective, float* outScreenPercentages) const;
+
+        private:
+            // Sized to whole SIMD vectors, lanes past m_count hold stale but valid values
+            alignas(16) float m_centerX[Capacity];
+            alignas(16) float m_centerY[Capacity];
+            alignas(16) float m_centerZ[Capacity];
+            alignas(16) float m_radius[Capacity];
+            alignas(16) float m_lodSelectionRadius[Capacity];
+            uint32_t m_count = 0;
+        };
+
         //! Centralized manager for culling-related processing for a given scene.
         //! There is one CullingScene owned by each Scene, so external systems (such as FeatureProcessors) should
         //! access the CullingScene via their parent Scene.
@@ -67,6 +67,11 @@ namespace AZ
             void* m_address = nullptr;
             uint32_t m_size;
 
+            // The buffer this DynamicBuffer was sub-allocated from, which is the ring buffer or one of the overflow buffers,
+            // and the offset of this DynamicBuffer in it.
+            RHI::Buffer* m_rhiBuffer = nullptr;
+            uint32_t m_bufferOffset = 0;
+
             // The allocator which allocated this DyanmicBuffer. 
             DynamicBufferAllocator* m_allocator;
         };
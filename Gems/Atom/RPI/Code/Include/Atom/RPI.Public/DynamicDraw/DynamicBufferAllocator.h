@@ -16,6 +16,9 @@
 #include <Atom/RPI.Public/Base.h>
 #include <Atom/RPI.Public/Buffer/Buffer.h>
 
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
 
 namespace AZ
 {
@@ -23,12 +26,46 @@ namespace AZ
     {
         class DynamicBuffer;
 
+        //! Statistics of the last frame of a DynamicBufferAllocator.
+        struct DynamicBufferAllocatorStatistics
+        {
+            //! The size of the ring buffer, in bytes.
+            uint32_t m_ringBufferSize = 0;
+
+            //! The bytes the frame used in the ring buffer, including the unused ends of the thread chunks and the alignment padding.
+            uint64_t m_ringBufferUsedSize = 0;
+
+            //! The number of chunks threads reserved in the ring buffer to sub-allocate from.
+            uint32_t m_threadChunkCount = 0;
+
+            //! The number of allocations which were reserved in the ring buffer directly, because they were too large for a thread chunk
+            //! or the ring buffer couldn't fit another chunk.
+            uint32_t m_directAllocationCount = 0;
+
+            //! The number of allocations which didn't fit in the ring buffer and were served by the overflow buffers.
+            uint32_t m_overflowAllocationCount = 0;
+
+            //! The bytes allocated from the overflow buffers.
+            uint64_t m_overflowAllocatedSize = 0;
+
+            //! The size of all the overflow buffers, in bytes, including the ones waiting to be reused.
+            uint64_t m_overflowBufferSize = 0;
+
+            //! The number of allocations which failed.
+            uint32_t m_failedAllocationCount = 0;
+        };
+
         //! DynamicBufferAllocator allocates DynamicBuffers within a big pre-allocated buffer by using ring buffer allocation
         //! The addresses of allocated DynamicBuffers would be available after AZ::RHI::Limits::Device::FrameCountMax frames.
         //! Since the allocations are sub-allocations they almost have zero cost with both cpu and gpu.
-        //! Limitation: the allocation may fail if the request buffer size is larger than the ring buffer size or
-        //!     there isn't enough unused memory available within the ring buffer. User may increase the input of Init(ringBufferSize)
-        //!     to increase the ring buffer's size. 
+        //!
+        //! Allocate() may be called from any number of threads without them waiting on each other. Each thread reserves chunks of
+        //! the ring buffer with an atomic operation and sub-allocates small buffers from its chunk without synchronization. Larger
+        //! buffers are reserved in the ring buffer directly.
+        //! When the ring buffer is full, allocations overflow into secondary buffers which are created on demand, and reused
+        //! once the frames which used them are done. Users may increase the input of Init(ringBufferSize) when the statistics show
+        //! the overflow buffers are used every frame.
+        //! FrameEnd() waits for the allocations in progress to finish, and allocations made while it runs wait for the next frame.
         class DynamicBufferAllocator
         {
             AZ_RTTI(AZ::RPI::DynamicBufferAllocator, "{82B047B3-C845-4F77-9852-747E39C53081}");
@@ -38,13 +75,13 @@ namespace AZ
             virtual ~DynamicBufferAllocator() = default;
 
             //! One time initialization
-            //! This operation may be slow since it will allocate large size gpu resource. 
+            //! This operation may be slow since it will allocate large size gpu resource.
             void Init(uint32_t ringBufferSize);
 
             void Shutdown();
 
             //! Allocate a dynamic buffer with specified size and alignment
-            //! It may return nullptr if the input size is larger than ring buffer size or there isn't enough unused memory available within the ring buffer
+            //! It may return nullptr if the ring buffer is full and the overflow buffer couldn't be created.
             RHI::Ptr<DynamicBuffer> Allocate(uint32_t size, uint32_t alignment);
 
             //! Get an IndexBufferView for a DynamicBuffer used as an index buffer
@@ -59,25 +96,73 @@ namespace AZ
             //! Enable/disable buffer allocation warning if allocation fails
             void SetEnableAllocationWarning(bool enable);
 
+            //! Returns the statistics of the last frame, gathered by FrameEnd().
+            const DynamicBufferAllocatorStatistics& GetStatistics() const;
+
         private:
-            // Get buffer's offset;
-            uint32_t GetBufferAddressOffset(RHI::Ptr<DynamicBuffer> dynamicBuffer);
+            RHI::Ptr<DynamicBuffer> AllocateInternal(uint32_t size, uint32_t alignment);
+
+            // A secondary buffer which serves the allocations that don't fit in the ring buffer.
+            struct OverflowBuffer
+            {
+                Data::Instance<Buffer> m_buffer;
+                uint8_t* m_address = nullptr;
+                uint32_t m_size = 0;
+                uint32_t m_position = 0;
+            };
+
+            // Reserves size bytes in the ring buffer, and returns the offset of the reservation from the start of the ring buffer.
+            // Returns false if the ring buffer doesn't have enough unused memory.
+            bool ReserveInRingBuffer(uint32_t size, uint32_t alignment, uint32_t& offset);
+
+            // Allocates from the overflow buffers of the current frame, creating a new overflow buffer if needed.
+            RHI::Ptr<DynamicBuffer> AllocateFromOverflowBuffer(uint32_t size, uint32_t alignment);
+
+            RHI::Ptr<DynamicBuffer> CreateDynamicBuffer(RHI::Buffer* rhiBuffer, uint8_t* bufferStartAddress, uint32_t offset, uint32_t size);
+
+            // Allocations wait for FrameEnd() rather than the other way around, so a steady stream of allocations can't hold back
+            // the end of the frame. The allocations only contend on the counter, they don't wait for each other.
+            AZStd::atomic<uint32_t> m_allocationsInProgress{0};
+            AZStd::atomic_bool m_isEndingFrame{false};
 
+            // Identifies this allocator and its frame in the thread chunks, which are stored per thread.
+            static AZStd::atomic<uint64_t> s_nextAllocatorId;
+            uint64_t m_allocatorId = 0;
+            AZStd::atomic<uint64_t> m_frameCounter{0};
+
+            // The size of the chunks threads reserve in the ring buffer, and the largest allocation served from a chunk.
+            uint32_t m_threadChunkSize = 0;
+            uint32_t m_threadChunkAllocationSizeMax = 0;
+
+            // The positions in the ring buffer are the bytes used since Init(), the offset in the ring buffer is the position modulo its size.
             // The position where the buffer is available.
-            uint32_t m_currentPosition = 0;
-            // The upper bound limit of the allocation of current frame 
-            uint32_t m_endPositionLimit = 0;
-            // The allocated buffer size of current frame
-            uint32_t m_currentAllocatedSize = 0;
+            AZStd::atomic<uint64_t> m_currentPosition{0};
+            // The upper bound limit of the allocation of current frame
+            AZStd::atomic<uint64_t> m_endPositionLimit{0};
 
             uint32_t m_ringBufferSize = 0;
             void* m_ringBufferStartAddress = 0;
             Data::Instance<Buffer> m_ringBuffer;
 
-            // Allocation history which are in use by GPU. 
-            uint32_t m_frameStartPositions[AZ::RHI::Limits::Device::FrameCountMax];
+            // Allocation history which are in use by GPU.
+            uint64_t m_frameStartPositions[AZ::RHI::Limits::Device::FrameCountMax];
             uint32_t m_currentFrame = 0;
 
+            // The overflow buffers used by each frame in flight, and the ones the GPU is done with.
+            AZStd::mutex m_overflowMutex;
+            AZStd::vector<OverflowBuffer> m_overflowBuffers[AZ::RHI::Limits::Device::FrameCountMax];
+            AZStd::vector<OverflowBuffer> m_freeOverflowBuffers;
+            uint32_t m_overflowBufferSizeMin = 0;
+
+            // Counters of the current frame, which FrameEnd() moves to m_statistics.
+            AZStd::atomic<uint32_t> m_threadChunkCount{0};
+            AZStd::atomic<uint32_t> m_directAllocationCount{0};
+            AZStd::atomic<uint32_t> m_failedAllocationCount{0};
+            uint32_t m_overflowAllocationCount = 0;
+            uint64_t m_overflowAllocatedSize = 0;
+
+            DynamicBufferAllocatorStatistics m_statistics;
+
             bool m_enableAllocationWarning = false;
         };
     }
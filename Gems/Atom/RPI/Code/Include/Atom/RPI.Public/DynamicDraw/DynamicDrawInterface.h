@@ -60,8 +60,13 @@ namespace AZ
 
             //! Get a DynamicBuffer from DynamicDrawSystem.
             //! The returned buffer will be invalidated every time the RPISystem's RenderTick is called
+            //! This can be called from any thread. A call made while RenderTick ends the frame waits for it,
+            //! and returns a buffer of the next frame.
             virtual RHI::Ptr<DynamicBuffer> GetDynamicBuffer(uint32_t size, uint32_t alignment = 1) = 0;
 
+            //! Get the statistics of the allocations of DynamicBuffers during the last frame
+            virtual DynamicBufferAllocatorStatistics GetDynamicBufferStatistics() const = 0;
+
             //! Draw a geometry to a scene with a given material
             virtual void DrawGeometry(Data::Instance<Material> material, const GeometryData& geometry, ScenePtr scene) = 0;
 
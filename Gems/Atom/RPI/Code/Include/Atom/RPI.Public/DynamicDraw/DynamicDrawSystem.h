@@ -34,6 +34,7 @@ namespace AZ
             RHI::Ptr<DynamicDrawContext> CreateDynamicDrawContext(Scene* scene) override;
             RHI::Ptr<DynamicDrawContext> CreateDynamicDrawContext(RenderPipeline* pipeline) override;
             RHI::Ptr<DynamicBuffer> GetDynamicBuffer(uint32_t size, uint32_t alignment = 1) override;
+            DynamicBufferAllocatorStatistics GetDynamicBufferStatistics() const override;
             void DrawGeometry(Data::Instance<Material> material, const GeometryData& geometry, ScenePtr scene) override;
             void AddDrawPacket(Scene* scene, AZStd::unique_ptr<const RHI::DrawPacket> drawPacket) override;
 
@@ -44,7 +45,7 @@ namespace AZ
             void FrameEnd();
 
         private:
-            AZStd::mutex m_mutexBufferAlloc;
+            // The allocator excludes its FrameEnd from the allocations itself, so it isn't guarded by a mutex
             AZStd::unique_ptr<DynamicBufferAllocator> m_bufferAlloc;
 
             AZStd::mutex m_mutexDrawContext;
@@ -106,6 +106,13 @@ namespace AZ
             //!  - This may be called in parallel with other feature processors.
             virtual void Render(const RenderPacket&) {}
 
+            //! Called once culling has completed for all the views, before their draw lists are finalized.
+            //! Feature processors may enqueue draw packets built from the results of culling here.
+            //!
+            //!  - This is called every frame, after Render().
+            //!  - This is called on the same thread as PrepareViews(), one feature processor at a time.
+            virtual void OnEndCulling(const RenderPacket&) {}
+
             //! The feature processor may do clean up when the current render frame is finished
             //!  - This is called every RPI::RenderTick.
             virtual void OnRenderEnd() {}
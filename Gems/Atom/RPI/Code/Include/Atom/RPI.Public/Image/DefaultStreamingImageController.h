@@ -14,10 +14,25 @@
 #include <Atom/RPI.Public/Image/StreamingImageContext.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 
+#include <AzCore/std/containers/fixed_vector.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        //! Streams the mips of images based on the target mips requested each update, while keeping the pool under its budget.
+        //!
+        //! Images which receive target mip requests (for example from culling, see StreamingImage::SetTargetMipForProjectedSize)
+        //! are expanded one mip chain per update, in order of visual error per byte: the number of mip levels an image is missing,
+        //! divided by the size of its next mip chain. When an expansion doesn't fit in the budget, images holding more detail than
+        //! they were last requested at are trimmed, least recently used first.
+        //!
+        //! Images which don't receive a request within a grace period after they are attached have all of their mips streamed in,
+        //! and are never trimmed, until they receive their first request. Setting r_streamingImageStreamAllMips treats every image
+        //! this way from the moment it is attached, ignoring requests, which is how the controller behaved before.
+        //!
+        //! Residency is estimated from the image descriptors rather than queried from the device, so the controller behaves the same
+        //! on every RHI, including the Null RHI used by headless runs and the unit tests.
         class DefaultStreamingImageController final
             : public StreamingImageController
         {
@@ -28,6 +43,45 @@ namespace AZ
             static Data::Instance<DefaultStreamingImageController> FindOrCreate(const Data::Asset<DefaultStreamingImageControllerAsset>& asset);
 
         private:
+            // The streaming state the controller tracks for each image.
+            class Context final
+                : public StreamingImageContext
+            {
+            public:
+                AZ_CLASS_ALLOCATOR(Context, AZ::ThreadPoolAllocator, 0);
+
+                // The estimated size of the image, in bytes, when each mip chain is the most detailed one resident.
+                AZStd::fixed_vector<size_t, RHI::Limits::Image::MipCountMax> m_residentSizeInBytes;
+
+                // The timestamp at which the image was attached.
+                size_t m_attachTimestamp = 0;
+
+                // Whether the image received a target mip request since it was attached. Always false while r_streamingImageStreamAllMips is set.
+                bool m_isManaged = false;
+
+                // Whether all mips of an image without requests were queued for expansion.
+                bool m_isExpandedToMostDetailed = false;
+            };
+
+            struct ExpandCandidate
+            {
+                StreamingImage* m_image = nullptr;
+                Context* m_context = nullptr;
+                size_t m_mipChainIndex = 0;
+                size_t m_sizeInBytes = 0;
+                uint16_t m_missingMipCount = 0;
+                float m_visualErrorPerByte = 0.0f;
+            };
+
+            struct TrimCandidate
+            {
+                StreamingImage* m_image = nullptr;
+                size_t m_mipChainIndex = 0;
+                size_t m_sizeInBytes = 0;
+                size_t m_lastAccessTimestamp = 0;
+                bool m_isRequested = false;
+            };
+
             // Standard init for InstanceData subclass
             DefaultStreamingImageController() = default;
             static Data::Instance<DefaultStreamingImageController> CreateInternal(Data::AssetData* assetData);
@@ -39,8 +93,19 @@ namespace AZ
             void UpdateInternal(size_t timestamp, const StreamingImageContextList& contexts) override;
             ///////////////////////////////////////////////////////////////////
 
-            // A work queue for doing initial setup after an image is attached.
-            AZStd::vector<StreamingImageContextPtr> m_recentlyAttachedContexts;
+            // Estimates the size of each mip chain of the image.
+            static void InitResidentSizes(const StreamingImage& image, Context& context);
+
+            // Trims candidates until requiredInBytes more fits in the budget. Returns whether it fits.
+            bool TrimToFit(size_t requiredInBytes);
+
+            // The contexts of all attached images. Contexts of detached images are removed during the update.
+            AZStd::vector<AZStd::intrusive_ptr<Context>> m_imageContexts;
+
+            // Scratch lists rebuilt each update.
+            AZStd::vector<ExpandCandidate> m_expandCandidates;
+            AZStd::vector<TrimCandidate> m_trimCandidates;
+            size_t m_nextTrimCandidate = 0;
         };
     }
 }
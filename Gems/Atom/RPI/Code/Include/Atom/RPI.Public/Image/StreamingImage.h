@@ -13,6 +13,9 @@
 
 #include <Atom/RPI.Reflect/Image/StreamingImageAsset.h>
 
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/std/optional.h>
+
 // Enable streaming image hot reloading
 #define AZ_RPI_STREAMING_IMAGE_HOT_RELOADING
 
@@ -85,6 +88,16 @@ namespace AZ
             //! 
             //! A value of 0 is the most detailed mip level. The value is clamped to the last mip in the chain.
             void SetTargetMip(uint16_t targetMipLevel);
+
+            //! Requests the mip level needed to draw the image on a surface of the given projected size. This is a
+            //! convenience over SetTargetMip for callers which know the screen-space size of the surface, such as culling.
+            //! @param projectedSizeInPixels The size of the surface on screen, in pixels.
+            //! @param uvDensity The number of times the image repeats across the surface.
+            void SetTargetMipForProjectedSize(float projectedSizeInPixels, float uvDensity);
+
+            //! Returns the most detailed mip level worth sampling when an image of imageSize texels is mapped
+            //! uvDensity times across a surface covering projectedSizeInPixels on screen.
+            static uint16_t CalculateTargetMip(uint32_t imageSize, float projectedSizeInPixels, float uvDensity);
             
             const Data::Instance<StreamingImagePool>& GetPool() const;
 
@@ -102,7 +115,8 @@ namespace AZ
 
             //! Queues an expansion operation which fetches mip chain assets from disk. Each time a contiguous range
             //! of mip chains is ready, an expansion is queued on the parent controller.
-            void QueueExpandToMipChainLevel(size_t mipChainLevel);
+            //! @param priority The streamer priority of the fetches. The asset handler's default is used if not set.
+            void QueueExpandToMipChainLevel(size_t mipChainLevel, AZStd::optional<IO::IStreamerTypes::Priority> priority = {});
             
             //! Queues an expansion to the mip chain that is one level higher than the resident mip chain.
             void QueueExpandToNextMipChainLevel();
@@ -115,6 +129,18 @@ namespace AZ
             //! Returns the most detailed mip level currently resident in memory, where a value of 0 is the highest detailed mip.
             uint16_t GetResidentMipLevel();
 
+            //! Returns the number of mip chains in the image.
+            size_t GetMipChainCount() const;
+
+            //! Returns the index of the mip chain holding the provided mip level. The level is clamped to the last mip.
+            size_t GetMipChainIndex(uint16_t mipLevel) const;
+
+            //! Returns the most detailed mip level of the provided mip chain.
+            uint16_t GetMipLevel(size_t mipChainIndex) const;
+
+            //! Returns the most detailed mip chain that is either resident or being fetched.
+            size_t GetStreamingMipChainIndex() const;
+
         private:
             StreamingImage() = default;
 
@@ -140,7 +166,7 @@ namespace AZ
              * streaming request from the asset system, which will take time. Fires an event to the
              * streaming controller when the mip is ready.
              */
-            void FetchMipChainAsset(size_t mipChainIndex);
+            void FetchMipChainAsset(size_t mipChainIndex, AZStd::optional<IO::IStreamerTypes::Priority> priority);
             
             /// Returns whether the mip chain is loaded.
             bool IsMipChainAssetReady(size_t mipChainIndex) const;
@@ -10,7 +10,9 @@
 
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/IO/IStreamerTypes.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/optional.h>
 #include <AzCore/std/parallel/mutex.h>
 
 #include <Atom/RPI.Public/Image/StreamingImageContext.h>
@@ -29,6 +31,34 @@ namespace AZ
     {
         class StreamingImage;
 
+        //! Statistics gathered by the last update of a streaming image controller.
+        struct StreamingImageControllerStatistics
+        {
+            //! The memory budget of the controller's pool, in bytes. 0 means unlimited.
+            size_t m_budgetInBytes = 0;
+
+            //! The estimated size of the resident and in-flight mips of all images, in bytes.
+            size_t m_residentInBytes = 0;
+
+            //! The number of images attached to the controller.
+            uint32_t m_imageCount = 0;
+
+            //! The number of images whose residency is driven by target mip requests.
+            uint32_t m_managedImageCount = 0;
+
+            //! The number of images that were requested at a more detailed mip than they stream.
+            uint32_t m_pendingExpandCount = 0;
+
+            //! The number of expansions queued by the update.
+            uint32_t m_expandCount = 0;
+
+            //! The number of expansions that didn't fit in the budget.
+            uint32_t m_deferredExpandCount = 0;
+
+            //! The number of images trimmed by the update.
+            uint32_t m_trimCount = 0;
+        };
+
         class StreamingImageController
             : public Data::InstanceData
         {
@@ -56,6 +86,9 @@ namespace AZ
             //! Returns a monotonically increasing counter used to track usage of images for streaming.
             size_t GetTimestamp() const;
 
+            //! Returns the statistics gathered by the last update.
+            const StreamingImageControllerStatistics& GetStatistics() const;
+
             //! Called by the streaming image when events occur.
             void OnSetTargetMip(StreamingImage* image, uint16_t targetMipLevel);
             void OnMipChainAssetReady(StreamingImage* image);
@@ -66,9 +99,15 @@ namespace AZ
             StreamingImageController() = default;
 
             //! Wrapped streaming image operations used for derived StreamingImageController classes
-            void QueueExpandToMipChainLevel(StreamingImage* image, size_t mipChainIndex);
+            void QueueExpandToMipChainLevel(StreamingImage* image, size_t mipChainIndex, AZStd::optional<IO::IStreamerTypes::Priority> priority = {});
             void TrimToMipChainLevel(StreamingImage* image, size_t mipChainIndex);
 
+            //! Returns the memory budget of the pool, in bytes. 0 means unlimited.
+            size_t GetPoolBudgetInBytes() const;
+
+            //! Statistics of the last update, filled in by derived classes.
+            StreamingImageControllerStatistics m_statistics;
+
         private:
 
             ///////////////////////////////////////////////////////////////////
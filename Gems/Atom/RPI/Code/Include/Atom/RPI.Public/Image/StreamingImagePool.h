@@ -51,6 +51,9 @@ namespace AZ
 
             const RHI::StreamingImagePool* GetRHIPool() const;
 
+            //! Returns the controller which manages streaming of the pool's images.
+            const StreamingImageController* GetController() const;
+
         private:
             StreamingImagePool() = default;
 
@@ -49,6 +49,8 @@ namespace AZ
             bool SetShaderOption(const Name& shaderOptionName, RPI::ShaderOptionValue value);
 
             Data::Instance<Material> GetMaterial();
+            const ModelLod* GetModelLod() const { return m_modelLod.get(); }
+            size_t GetModelLodMeshIndex() const { return m_modelLodMeshIndex; }
 
         private:
             bool DoUpdate(const Scene& parentScene);
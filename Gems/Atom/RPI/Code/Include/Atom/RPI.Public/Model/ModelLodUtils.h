@@ -10,6 +10,7 @@
 
 #include <Atom/RPI.Public/Model/ModelLod.h>
 
+#include <Atom/RPI.Reflect/Model/ModelLodAsset.h>
 #include <Atom/RPI.Reflect/Model/ModelLodIndex.h>
 
 namespace AZ
@@ -34,6 +35,11 @@ namespace AZ
             //!   2/(top-bottom) for orthogonal frustum.
             //!   We only use the vertical scale for two reasons: speed and for more consistent behavior with ultra-widescreen views
             float ApproxScreenPercentage(const Vector3& center, float radius, const Vector3& cameraPosition, float yScale, bool isPerspective);
+
+            //! Gets the approximate number of times a texture mapped with the mesh's first uv set repeats along one unit of length
+            //! in model space (used to pick the mip levels streaming images need). It is the square root of the mesh's total uv area
+            //! over its total surface area. Returns 0 if the mesh has no uvs, or no area.
+            float ApproxUvDensity(const ModelLodAsset::Mesh& mesh);
         } // namespace ModelLodUtils
     } // namespace RPI
 } // namespace AZ
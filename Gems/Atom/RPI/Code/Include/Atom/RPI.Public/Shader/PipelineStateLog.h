@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI.Reflect/InputStreamLayout.h>
+#include <Atom/RHI.Reflect/RenderAttachmentLayout.h>
+#include <Atom/RHI.Reflect/RenderStates.h>
+
+#include <Atom/RPI.Reflect/Shader/ShaderVariantKey.h>
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/time.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! A pipeline state a shader compiled at runtime, recorded so that later runs can precompile it.
+        //! The shader stage functions and pipeline layout are not stored, they are restored from the shader variant.
+        struct PipelineStateLogEntry
+        {
+            AZ_TYPE_INFO(PipelineStateLogEntry, "{89D811F8-9486-4965-857E-5FD798AF9B78}");
+
+            static void Reflect(ReflectContext* context);
+
+            //! Returns a hash identifying the pipeline state within its shader.
+            HashValue64 GetHash() const;
+
+            //! The shader variant providing the shader stage functions.
+            ShaderVariantStableId m_shaderVariantStableId;
+
+            //! The runtime state of draw pipeline states. Left to defaults for other pipeline state types.
+            RHI::InputStreamLayout m_inputStreamLayout;
+            RHI::RenderAttachmentConfiguration m_renderAttachmentConfiguration;
+            RHI::RenderStates m_renderStates;
+        };
+
+        //! The pipeline states a shader compiled at runtime, in the order they were first needed.
+        //! It is persisted next to the shader's pipeline library and used to precompile the pipeline states on the next run.
+        struct PipelineStateLog
+        {
+            AZ_TYPE_INFO(PipelineStateLog, "{F3B02C44-6165-42F5-892A-A79B405F9579}");
+            AZ_CLASS_ALLOCATOR(PipelineStateLog, SystemAllocator, 0);
+
+            static void Reflect(ReflectContext* context);
+
+            //! The build timestamp of the shader asset the entries were recorded with. Shader variant stable ids may change
+            //! when the shader is rebuilt, so the entries of other builds are discarded.
+            AZStd::sys_time_t m_shaderAssetBuildTimestamp = 0;
+
+            AZStd::vector<PipelineStateLogEntry> m_entries;
+        };
+    } // namespace RPI
+} // namespace AZ
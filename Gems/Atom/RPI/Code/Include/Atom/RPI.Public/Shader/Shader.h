@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <Atom/RPI.Public/Shader/PipelineStateLog.h>
 #include <Atom/RPI.Public/Shader/ShaderVariant.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadNotificationBus.h>
 
@@ -20,6 +21,9 @@
 #include <AtomCore/Instance/InstanceData.h>
 
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/condition_variable.h>
 
 namespace AZ
 {
@@ -49,6 +53,10 @@ namespace AZ
          *
          * Remember that the returned RHI::PipelineState instance lifetime is tied to the Shader lifetime.
          * If you need guarantee lifetime, it is safe to take a reference on the returned pipeline state.
+         *
+         * The shader also records the pipeline states it compiles in a log, which is saved next to the pipeline library.
+         * When the shader is loaded again, a background job precompiles the logged pipeline states in the order they were
+         * first needed, so they are usually ready before they are acquired.
          */
         class Shader final
             : public Data::InstanceData
@@ -155,6 +163,29 @@ namespace AZ
             ConstPtr<RHI::PipelineLibraryData> LoadPipelineLibrary() const;
             void SavePipelineLibrary() const;
 
+            void LoadPipelineStateLog();
+            void SavePipelineStateLog() const;
+
+            //! Adds a pipeline state compiled by AcquirePipelineState() to the pipeline state log.
+            void RecordPipelineState(const RHI::PipelineStateDescriptor& descriptor) const;
+
+            //! Returns the stable id of the loaded variant whose shader stage functions the descriptor uses,
+            //! or an invalid id if the descriptor wasn't configured by a variant of this shader.
+            ShaderVariantStableId FindPipelineStateVariantStableId(const RHI::PipelineStateDescriptor& descriptor) const;
+
+            //! Starts a job precompiling the next queued pipeline state, unless one is already running.
+            //! m_pipelineStateLogMutex must be locked.
+            void StartPrecompileJob();
+
+            //! Job function precompiling the next queued pipeline state.
+            void PrecompileNextPipelineState();
+
+            //! Precompiles a logged pipeline state. Returns false if its shader variant isn't loaded yet.
+            bool PrecompilePipelineState(const PipelineStateLogEntry& entry);
+
+            //! Cancels queued precompiles and waits for the running precompile job to finish.
+            void CancelPrecompile();
+
             ///////////////////////////////////////////////////////////////////
             /// AssetBus overrides
             void OnAssetReloaded(Data::Asset<Data::AssetData> asset) override;
@@ -178,6 +209,9 @@ namespace AZ
             //! Returns the path to the pipeline library cache file.
             AZStd::string GetPipelineLibraryPath() const;
 
+            //! Returns the path to the pipeline state log file.
+            AZStd::string GetPipelineStateLogPath() const;
+
             //! A strong reference to the shader asset.
             Data::Asset<ShaderAsset> m_asset;
 
@@ -195,7 +229,7 @@ namespace AZ
             RHI::PipelineLibraryHandle m_pipelineLibraryHandle;
 
             //! Used for thread safety for FindVariantStableId() and GetVariant().
-            AZStd::shared_mutex m_variantCacheMutex;
+            mutable AZStd::shared_mutex m_variantCacheMutex;
 
             //! The root variant always exist.
             ShaderVariant m_rootVariant;
@@ -206,6 +240,28 @@ namespace AZ
             
             //! DrawListTag associated with this shader.
             RHI::DrawListTag m_drawListTag;
+
+            //! Used for thread safety of the pipeline state log and the precompile queue.
+            mutable AZStd::mutex m_pipelineStateLogMutex;
+
+            //! The pipeline states compiled by this shader, in this run and the previous ones.
+            mutable PipelineStateLog m_pipelineStateLog;
+
+            //! The hashes of the entries in m_pipelineStateLog, to record each pipeline state once.
+            mutable AZStd::unordered_set<uint64_t> m_pipelineStateLogHashes;
+
+            //! Logged pipeline states waiting to be precompiled, in priority order.
+            AZStd::deque<PipelineStateLogEntry> m_precompileQueue;
+
+            //! Logged pipeline states waiting for their shader variant to load before being precompiled.
+            AZStd::unordered_multimap<ShaderVariantStableId, PipelineStateLogEntry> m_deferredPrecompiles;
+
+            //! Whether a precompile job is running, and whether precompiles were cancelled by a shutdown or reload.
+            bool m_precompileJobActive = false;
+            bool m_precompileCancelled = false;
+
+            //! Signaled when the precompile job finishes.
+            AZStd::condition_variable m_precompileJobFinished;
         };
     }
 }
@@ -9,6 +9,7 @@
 #include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
 #include <Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/Scene.h>
@@ -44,6 +45,8 @@ namespace AZ
     {
         AZ_CVAR(bool, r_CullInParallel, true, nullptr, ConsoleFunctorFlags::Null, "");
         AZ_CVAR(uint32_t, r_CullWorkPerBatch, 500, nullptr, ConsoleFunctorFlags::Null, "");
+        AZ_CVAR(float, r_streamingImageReferenceScreenHeight, 1080.0f, nullptr, ConsoleFunctorFlags::Null,
+            "Screen height, in pixels, used to turn the screen coverage of visible lods into the mip levels their streaming images need.");
 
         void DebugDrawWorldCoordinateAxes(AuxGeomDraw* auxGeom)
         {
@@ -306,79 +309,113 @@ namespace AZ
                 uint32_t numDrawPackets = 0;
                 uint32_t numVisibleCullables = 0;
 
-                for (const AzFramework::IVisibilityScene::NodeData& nodeData : m_worklist)
+                const Matrix4x4& viewToClip = m_jobData->m_view->GetViewToClipMatrix();
+                //the [1][1] element of a perspective projection matrix stores cot(FovY/2), see AddLodDataToView()
+                const float yScale = viewToClip.GetElement(1, 1);
+                const bool isPerspective = viewToClip.GetElement(3, 3) == 0.f;
+                const Vector3 cameraPos = m_jobData->m_view->GetViewToWorldMatrix().GetTranslation();
+
+                //Cullables are gathered into batches across nodes, so their bounds can be culled and their lods selected several at a time
+                CullableBoundsBatch batch;
+                AzFramework::VisibilityEntry* batchEntries[CullableBoundsBatch::Capacity];
+                bool batchNeedsCulling[CullableBoundsBatch::Capacity];
+                bool anyNeedsCulling = false;
+
+                auto processBatch = [&]()
                 {
-                    //If a node is entirely contained within the frustum, then we can skip the fine grained culling.
-                    bool nodeIsContainedInFrustum = ShapeIntersection::Contains(m_jobData->m_frustum, nodeData.m_bounds);
+                    const uint32_t batchCount = batch.GetCount();
+                    if (batchCount == 0)
+                    {
+                        return;
+                    }
 
-#ifdef AZ_CULL_PROFILE_VERBOSE
-                    AZ_PROFILE_SCOPE_DYNAMIC(Debug::ProfileCategory::AzRender, "process node (view: %s, skip fine cull: %d",
-                        m_view->GetName().GetCStr(), nodeIsContainedInFrustum ? 1 : 0);
-#endif
+                    IntersectResult intersectResults[CullableBoundsBatch::Capacity];
+                    if (anyNeedsCulling)
+                    {
+                        batch.ClassifySpheres(m_jobData->m_frustum, intersectResults);
+                    }
 
-                    if (nodeIsContainedInFrustum || !m_jobData->m_debugCtx->m_enableFrustumCulling)
+                    uint32_t visibleIndices[CullableBoundsBatch::Capacity];
+                    uint32_t numVisible = 0;
+                    for (uint32_t index = 0; index < batchCount; ++index)
                     {
-                        //Add all objects within this node to the view, without any extra culling
-                        for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
+                        if (batchNeedsCulling[index])
                         {
+                            if (intersectResults[index] == IntersectResult::Exterior)
                             {
-                                if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
-                                {
-                                    Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
+                                continue;
+                            }
 
-                                    if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
-                                        c->m_cullData.m_hideFlags & viewFlags ||
-                                        c->m_cullData.m_scene != m_jobData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
-                                        c->m_isHidden)
-                                    {
-                                        continue;
-                                    }
+                            const Cullable* c = static_cast<const Cullable*>(batchEntries[index]->m_userData);
+                            if (intersectResults[index] == IntersectResult::Overlaps && !ShapeIntersection::Overlaps(m_jobData->m_frustum, c->m_cullData.m_boundingObb))
+                            {
+                                continue;
+                            }
+                        }
 
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-                                    if (TestOcclusionCulling(visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
+                        if (TestOcclusionCulling(batchEntries[index]) != MaskedOcclusionCulling::CullingResult::VISIBLE)
+                        {
+                            continue;
+                        }
 #endif
-                                    {
-                                        numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *m_jobData->m_view);
-                                        ++numVisibleCullables;
-                                        c->m_isVisible = true;
-                                    }
-                                }
-                            }
+                        visibleIndices[numVisible++] = index;
+                    }
+
+                    if (numVisible > 0)
+                    {
+                        float screenPercentages[CullableBoundsBatch::Capacity];
+                        batch.ApproxScreenPercentages(cameraPos, yScale, isPerspective, screenPercentages);
+
+                        for (uint32_t visibleIndex = 0; visibleIndex < numVisible; ++visibleIndex)
+                        {
+                            const uint32_t index = visibleIndices[visibleIndex];
+                            Cullable* c = static_cast<Cullable*>(batchEntries[index]->m_userData);
+                            numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *m_jobData->m_view, screenPercentages[index]);
+                            ++numVisibleCullables;
+                            c->m_isVisible = true;
                         }
                     }
-                    else
+
+                    batch.Clear();
+                    anyNeedsCulling = false;
+                };
+
+                for (const AzFramework::IVisibilityScene::NodeData& nodeData : m_worklist)
+                {
+                    //If a node is entirely contained within the frustum, then we can skip the fine grained culling.
+                    bool nodeIsContainedInFrustum = ShapeIntersection::Contains(m_jobData->m_frustum, nodeData.m_bounds);
+
+#ifdef AZ_CULL_PROFILE_VERBOSE
+                    AZ_PROFILE_SCOPE_DYNAMIC(Debug::ProfileCategory::AzRender, "process node (view: %s, skip fine cull: %d",
+                        m_view->GetName().GetCStr(), nodeIsContainedInFrustum ? 1 : 0);
+#endif
+
+                    //Objects of nodes entirely within the frustum are added to the view without any extra culling
+                    const bool needsCulling = !nodeIsContainedInFrustum && m_jobData->m_debugCtx->m_enableFrustumCulling;
+
+                    for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
                     {
-                        //Do fine-grained culling before adding objects to the view
-                        for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
+                        if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
                         {
-                            if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
+                            const Cullable* c = static_cast<const Cullable*>(visibleEntry->m_userData);
+
+                            if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
+                                c->m_cullData.m_hideFlags & viewFlags ||
+                                c->m_cullData.m_scene != m_jobData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
+                                c->m_isHidden)
                             {
-                                Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
+                                continue;
+                            }
 
-                                if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
-                                    c->m_cullData.m_hideFlags & viewFlags ||
-                                    c->m_cullData.m_scene != m_jobData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
-                                    c->m_isHidden)
-                                {
-                                    continue;
-                                }
+                            const uint32_t index = batch.Add(c->m_cullData.m_boundingSphere, c->m_lodData.m_lodSelectionRadius);
+                            batchEntries[index] = visibleEntry;
+                            batchNeedsCulling[index] = needsCulling;
+                            anyNeedsCulling |= needsCulling;
 
-                                IntersectResult res = ShapeIntersection::Classify(m_jobData->m_frustum, c->m_cullData.m_boundingSphere);
-                                if (res == IntersectResult::Exterior)
-                                {
-                                    continue;
-                                }
-                                else if (res == IntersectResult::Interior || ShapeIntersection::Overlaps(m_jobData->m_frustum, c->m_cullData.m_boundingObb))
-                                {
-#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-                                    if (TestOcclusionCulling(visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
-#endif
-                                    {
-                                        numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *m_jobData->m_view);
-                                        ++numVisibleCullables;
-                                        c->m_isVisible = true;
-                                    }
-                                }
+                            if (batch.IsFull())
+                            {
+                                processBatch();
                             }
                         }
                     }
@@ -436,6 +473,8 @@ namespace AZ
                     }
                 }
 
+                processBatch();
+
                 if (m_jobData->m_debugCtx->m_enableStats)
                 {
                     CullingDebugContext::CullStats& cullStats = m_jobData->m_debugCtx->GetCullStatsForView(m_jobData->m_view);
@@ -658,6 +697,11 @@ namespace AZ
             const float approxScreenPercentage = ModelLodUtils::ApproxScreenPercentage(
                 pos, lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
 
+            return AddLodDataToView(pos, lodData, view, approxScreenPercentage);
+        }
+
+        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view, float approxScreenPercentage)
+        {
             uint32_t numVisibleDrawPackets = 0;
 
             auto addLodToDrawPacket = [&](const Cullable::LodData::Lod& lod)
@@ -670,6 +714,26 @@ namespace AZ
                 {
                     view.AddDrawPacket(drawPacket, pos);
                 }
+
+                if (!lod.m_instancedDrawPackets.empty())
+                {
+                    AZ_Assert(lodData.m_instanceCollector, "Cullable has instanced draw packets but no instance collector");
+                    numVisibleDrawPackets += static_cast<uint32_t>(lod.m_instancedDrawPackets.size());
+                    for (const Cullable::LodData::InstancedDrawPacket& instancedDrawPacket : lod.m_instancedDrawPackets)
+                    {
+                        lodData.m_instanceCollector->AddVisibleInstance(
+                            view, instancedDrawPacket.m_drawPacket, instancedDrawPacket.m_instanceGroupId, lodData.m_instanceId, pos);
+                    }
+                }
+
+                if (!lod.m_streamingImages.empty())
+                {
+                    const float projectedSizeInPixels = approxScreenPercentage * static_cast<float>(r_streamingImageReferenceScreenHeight);
+                    for (const Cullable::LodData::StreamingImageUsage& streamingImage : lod.m_streamingImages)
+                    {
+                        streamingImage.m_image->SetTargetMipForProjectedSize(projectedSizeInPixels, streamingImage.m_uvDensity);
+                    }
+                }
             };
 
             if (lodData.m_lodOverride == Cullable::NoLodOverride)
@@ -691,6 +755,127 @@ namespace AZ
             return numVisibleDrawPackets;
         }
 
+        CullableBoundsBatch::CullableBoundsBatch()
+        {
+            // Lanes past the count are still processed, so start them off with valid values
+            AZStd::fill(AZStd::begin(m_centerX), AZStd::end(m_centerX), 0.0f);
+            AZStd::fill(AZStd::begin(m_centerY), AZStd::end(m_centerY), 0.0f);
+            AZStd::fill(AZStd::begin(m_centerZ), AZStd::end(m_centerZ), 0.0f);
+            AZStd::fill(AZStd::begin(m_radius), AZStd::end(m_radius), 0.0f);
+            AZStd::fill(AZStd::begin(m_lodSelectionRadius), AZStd::end(m_lodSelectionRadius), 0.0f);
+        }
+
+        uint32_t CullableBoundsBatch::Add(const Sphere& boundingSphere, float lodSelectionRadius)
+        {
+            AZ_Assert(m_count < Capacity, "CullableBoundsBatch is full");
+
+            const uint32_t index = m_count++;
+            const Vector3& center = boundingSphere.GetCenter();
+            m_centerX[index] = center.GetX();
+            m_centerY[index] = center.GetY();
+            m_centerZ[index] = center.GetZ();
+            m_radius[index] = boundingSphere.GetRadius();
+            m_lodSelectionRadius[index] = lodSelectionRadius;
+            return index;
+        }
+
+        void CullableBoundsBatch::ClassifySpheres(const Frustum& frustum, IntersectResult* outResults) const
+        {
+#ifdef AZ_CULL_PROFILE_DETAILED
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+#endif
+            using Simd::Vec4;
+
+            Vec4::FloatType planeX[Frustum::PlaneId::MAX];
+            Vec4::FloatType planeY[Frustum::PlaneId::MAX];
+            Vec4::FloatType planeZ[Frustum::PlaneId::MAX];
+            Vec4::FloatType planeW[Frustum::PlaneId::MAX];
+            for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                const Vector4& plane = frustum.GetPlane(planeId).GetPlaneEquationCoefficients();
+                planeX[planeId] = Vec4::Splat(plane.GetX());
+                planeY[planeId] = Vec4::Splat(plane.GetY());
+                planeZ[planeId] = Vec4::Splat(plane.GetZ());
+                planeW[planeId] = Vec4::Splat(plane.GetW());
+            }
+
+            alignas(16) int32_t exterior[4];
+            alignas(16) int32_t overlaps[4];
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+
+            for (uint32_t first = 0; first < m_count; first += 4)
+            {
+                const Vec4::FloatType centerX = Vec4::LoadAligned(&m_centerX[first]);
+                const Vec4::FloatType centerY = Vec4::LoadAligned(&m_centerY[first]);
+                const Vec4::FloatType centerZ = Vec4::LoadAligned(&m_centerZ[first]);
+                const Vec4::FloatType radius = Vec4::LoadAligned(&m_radius[first]);
+                const Vec4::FloatType negativeRadius = Vec4::Sub(zero, radius);
+
+                Vec4::FloatType exteriorMask = zero;
+                Vec4::FloatType overlapsMask = zero;
+                for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+                {
+                    const Vec4::FloatType distance =
+                        Vec4::Madd(centerX, planeX[planeId], Vec4::Madd(centerY, planeY[planeId], Vec4::Madd(centerZ, planeZ[planeId], planeW[planeId])));
+                    exteriorMask = Vec4::Or(exteriorMask, Vec4::CmpLt(distance, negativeRadius));
+                    overlapsMask = Vec4::Or(overlapsMask, Vec4::CmpLt(Vec4::Abs(distance), radius));
+                }
+
+                Vec4::StoreAligned(exterior, Vec4::CastToInt(exteriorMask));
+                Vec4::StoreAligned(overlaps, Vec4::CastToInt(overlapsMask));
+
+                const uint32_t laneCount = AZStd::min(m_count - first, 4u);
+                for (uint32_t lane = 0; lane < laneCount; ++lane)
+                {
+                    outResults[first + lane] = exterior[lane] ? IntersectResult::Exterior
+                        : (overlaps[lane] ? IntersectResult::Overlaps : IntersectResult::Interior);
+                }
+            }
+        }
+
+        void CullableBoundsBatch::ApproxScreenPercentages(const Vector3& cameraPosition, float yScale, bool isPerspective, float* outScreenPercentages) const
+        {
+#ifdef AZ_CULL_PROFILE_DETAILED
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+#endif
+            using Simd::Vec4;
+
+            const Vec4::FloatType cameraX = Vec4::Splat(cameraPosition.GetX());
+            const Vec4::FloatType cameraY = Vec4::Splat(cameraPosition.GetY());
+            const Vec4::FloatType cameraZ = Vec4::Splat(cameraPosition.GetZ());
+            const Vec4::FloatType scale = Vec4::Splat(yScale);
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+
+            alignas(16) float screenPercentages[4];
+
+            for (uint32_t first = 0; first < m_count; first += 4)
+            {
+                // See ModelLodUtils::ApproxScreenPercentage() for the derivation
+                Vec4::FloatType screenPercentage = Vec4::Mul(scale, Vec4::LoadAligned(&m_lodSelectionRadius[first]));
+                if (isPerspective)
+                {
+                    const Vec4::FloatType toCenterX = Vec4::Sub(cameraX, Vec4::LoadAligned(&m_centerX[first]));
+                    const Vec4::FloatType toCenterY = Vec4::Sub(cameraY, Vec4::LoadAligned(&m_centerY[first]));
+                    const Vec4::FloatType toCenterZ = Vec4::Sub(cameraZ, Vec4::LoadAligned(&m_centerZ[first]));
+                    const Vec4::FloatType lengthSq =
+                        Vec4::Madd(toCenterX, toCenterX, Vec4::Madd(toCenterY, toCenterY, Vec4::Mul(toCenterZ, toCenterZ)));
+                    screenPercentage = Vec4::Div(screenPercentage, Vec4::Sqrt(lengthSq));
+                }
+                screenPercentage = Vec4::Min(screenPercentage, one);
+
+                const uint32_t laneCount = AZStd::min(m_count - first, 4u);
+                if (laneCount == 4)
+                {
+                    Vec4::StoreUnaligned(&outScreenPercentages[first], screenPercentage);
+                }
+                else
+                {
+                    Vec4::StoreAligned(screenPercentages, screenPercentage);
+                    AZStd::copy(screenPercentages, screenPercentages + laneCount, &outScreenPercentages[first]);
+                }
+            }
+        }
+
         void CullingScene::Activate(const Scene* parentScene)
         {
             m_parentScene = parentScene;
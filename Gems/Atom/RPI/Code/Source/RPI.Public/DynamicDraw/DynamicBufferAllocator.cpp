@@ -11,10 +11,39 @@
 #include <Atom/RPI.Public/DynamicDraw/DynamicBufferAllocator.h>
 #include <Atom/RPI.Public/DynamicDraw/DynamicBuffer.h>
 
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/exponential_backoff.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        namespace
+        {
+            // The largest chunk a thread reserves in the ring buffer, and the alignment of the chunks.
+            constexpr uint32_t ThreadChunkSizeMax = 64 * 1024;
+            constexpr uint32_t ThreadChunkAlignment = 256;
+
+            // The ring buffer is split in at least this many chunks, so a few threads can't reserve all of it.
+            constexpr uint32_t ThreadChunksPerRingBufferMin = 64;
+
+            // The smallest overflow buffer. Overflow buffers created during the same frame double in size.
+            constexpr uint32_t OverflowBufferSizeMin = 256 * 1024;
+
+            // The part of the ring buffer the current thread sub-allocates from.
+            struct ThreadChunk
+            {
+                uint64_t m_allocatorId = 0;
+                uint64_t m_frameCounter = 0;
+                uint32_t m_position = 0;
+                uint32_t m_end = 0;
+            };
+
+            thread_local ThreadChunk s_threadChunk;
+        }
+
+        AZStd::atomic<uint64_t> DynamicBufferAllocator::s_nextAllocatorId{1};
+
         void DynamicBufferAllocator::Init(uint32_t ringBufferSize)
         {
             if (m_ringBuffer)
@@ -36,31 +65,52 @@ namespace AZ
                 AZ_Assert(false, "Failed to initialize DyanmicBufferAllocator");
                 return;
             }
-            
+
             m_ringBufferSize = ringBufferSize;
             m_ringBufferStartAddress = m_ringBuffer->Map(m_ringBufferSize, 0);
-            
+
+            // Thread chunks are only worth it when the ring buffer is large enough to split among threads.
+            m_threadChunkSize = AZStd::min(ThreadChunkSizeMax, m_ringBufferSize / ThreadChunksPerRingBufferMin) & ~(ThreadChunkAlignment - 1);
+            m_threadChunkAllocationSizeMax = m_threadChunkSize / 4;
+            m_overflowBufferSizeMin = AZStd::max(OverflowBufferSizeMin, m_threadChunkSize);
+
+            // A new id invalidates the thread chunks which were reserved before a Shutdown().
+            m_allocatorId = s_nextAllocatorId.fetch_add(1);
+            m_frameCounter = 0;
+
             m_currentPosition = 0;
-            m_endPositionLimit = 0;
+            m_endPositionLimit = m_ringBufferSize;
             m_currentFrame = 0;
             for (uint32_t frame = 0; frame < AZ::RHI::Limits::Device::FrameCountMax; frame++)
             {
                 m_frameStartPositions[frame] = 0;
             }
+
+            m_statistics = {};
+            m_statistics.m_ringBufferSize = m_ringBufferSize;
         }
 
         void DynamicBufferAllocator::Shutdown()
         {
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_overflowMutex);
+                for (AZStd::vector<OverflowBuffer>& overflowBuffers : m_overflowBuffers)
+                {
+                    overflowBuffers = {};
+                }
+                m_freeOverflowBuffers = {};
+            }
+
             m_ringBuffer->Unmap();
             m_ringBuffer = nullptr;
             m_ringBufferStartAddress = nullptr;
+            m_allocatorId = 0;
         }
 
-        // [GFX TODO][ATOM-13182] Add unit tests for DynamicBufferAllocator's Allocate function 
-        RHI::Ptr<DynamicBuffer> DynamicBufferAllocator::Allocate(uint32_t size, [[maybe_unused]]uint32_t alignment)
+        RHI::Ptr<DynamicBuffer> DynamicBufferAllocator::Allocate(uint32_t size, uint32_t alignment)
         {
+            alignment = AZStd::max(alignment, 1u);
             size = RHI::AlignUp(size, alignment);
-            uint32_t allocatePosition = 0;
 
             //m_ringBufferStartAddress can be null for Null back end
             if (!m_ringBufferStartAddress)
@@ -68,63 +118,183 @@ namespace AZ
                 return nullptr;
             }
 
-            if (size > m_ringBufferSize)
+            // The allocation counts as in progress before it checks for FrameEnd(), which sets the flag before it checks the count,
+            // so at least one of them sees the other.
+            while (true)
             {
-                AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: try to allocate buffer which size is larger than the ring buffer size");
-                return nullptr;
+                m_allocationsInProgress.fetch_add(1);
+                if (!m_isEndingFrame.load())
+                {
+                    break;
+                }
+                m_allocationsInProgress.fetch_sub(1);
+
+                AZStd::exponential_backoff backoff;
+                while (m_isEndingFrame.load(AZStd::memory_order_acquire))
+                {
+                    backoff.wait();
+                }
             }
 
-            // Return if the allocation of current frame has reached limit
-            if (m_endPositionLimit == m_currentPosition && m_currentAllocatedSize > 0)
+            RHI::Ptr<DynamicBuffer> dynamicBuffer = AllocateInternal(size, alignment);
+            m_allocationsInProgress.fetch_sub(1, AZStd::memory_order_release);
+            return dynamicBuffer;
+        }
+
+        RHI::Ptr<DynamicBuffer> DynamicBufferAllocator::AllocateInternal(uint32_t size, uint32_t alignment)
+        {
+            uint8_t* ringBufferStartAddress = static_cast<uint8_t*>(m_ringBufferStartAddress);
+
+            if (m_threadChunkSize > 0 && size <= m_threadChunkAllocationSizeMax)
             {
-                AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: no more buffer is available");
-                return nullptr;
+                // Chunks of the previous frames, or of another allocator, are abandoned.
+                ThreadChunk& chunk = s_threadChunk;
+                const uint64_t frameCounter = m_frameCounter.load(AZStd::memory_order_acquire);
+                if (chunk.m_allocatorId != m_allocatorId || chunk.m_frameCounter != frameCounter)
+                {
+                    chunk = {};
+                    chunk.m_allocatorId = m_allocatorId;
+                    chunk.m_frameCounter = frameCounter;
+                }
+
+                uint32_t offset = RHI::AlignUp(chunk.m_position, alignment);
+                if (chunk.m_end == 0 || offset + size > chunk.m_end)
+                {
+                    uint32_t chunkOffset = 0;
+                    if (ReserveInRingBuffer(m_threadChunkSize, ThreadChunkAlignment, chunkOffset))
+                    {
+                        chunk.m_position = chunkOffset;
+                        chunk.m_end = chunkOffset + m_threadChunkSize;
+                        offset = RHI::AlignUp(chunkOffset, alignment);
+                        m_threadChunkCount.fetch_add(1, AZStd::memory_order_relaxed);
+                    }
+                }
+
+                if (chunk.m_end != 0 && offset + size <= chunk.m_end)
+                {
+                    chunk.m_position = offset + size;
+                    return CreateDynamicBuffer(m_ringBuffer->GetRHIBuffer(), ringBufferStartAddress, offset, size);
+                }
+
+                // The ring buffer can't fit another chunk, but it may still fit the allocation.
             }
 
-            if (m_endPositionLimit > m_currentPosition)
+            uint32_t offset = 0;
+            if (ReserveInRingBuffer(size, alignment, offset))
             {
-                if (m_endPositionLimit - m_currentPosition >= size)
+                m_directAllocationCount.fetch_add(1, AZStd::memory_order_relaxed);
+                return CreateDynamicBuffer(m_ringBuffer->GetRHIBuffer(), ringBufferStartAddress, offset, size);
+            }
+
+            return AllocateFromOverflowBuffer(size, alignment);
+        }
+
+        bool DynamicBufferAllocator::ReserveInRingBuffer(uint32_t size, uint32_t alignment, uint32_t& offset)
+        {
+            if (size > m_ringBufferSize)
+            {
+                return false;
+            }
+
+            // The limit only changes in FrameEnd(), which excludes the allocations.
+            const uint64_t endPositionLimit = m_endPositionLimit.load(AZStd::memory_order_relaxed);
+
+            uint64_t position = m_currentPosition.load(AZStd::memory_order_relaxed);
+            uint64_t allocationPosition = 0;
+            uint64_t nextPosition = 0;
+            do
+            {
+                // Allocations don't wrap around the end of the ring buffer, they skip to its start.
+                const uint64_t ringStartPosition = position - position % m_ringBufferSize;
+                const uint64_t alignedOffset = RHI::AlignUp(position - ringStartPosition, alignment);
+                allocationPosition = alignedOffset + size <= m_ringBufferSize
+                    ? ringStartPosition + alignedOffset
+                    : ringStartPosition + m_ringBufferSize;
+                nextPosition = allocationPosition + size;
+
+                if (nextPosition > endPositionLimit)
                 {
-                    allocatePosition = m_currentPosition;
-                    m_currentPosition += size;
+                    return false;
                 }
-                else
+            } while (!m_currentPosition.compare_exchange_weak(position, nextPosition, AZStd::memory_order_relaxed));
+
+            offset = aznumeric_cast<uint32_t>(allocationPosition % m_ringBufferSize);
+            return true;
+        }
+
+        RHI::Ptr<DynamicBuffer> DynamicBufferAllocator::AllocateFromOverflowBuffer(uint32_t size, uint32_t alignment)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_overflowMutex);
+
+            AZStd::vector<OverflowBuffer>& overflowBuffers = m_overflowBuffers[m_currentFrame];
+            if (!overflowBuffers.empty())
+            {
+                OverflowBuffer& overflowBuffer = overflowBuffers.back();
+                const uint32_t offset = RHI::AlignUp(overflowBuffer.m_position, alignment);
+                if (offset + size <= overflowBuffer.m_size)
                 {
-                    AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%d bytes)", size, m_endPositionLimit - m_currentPosition);
-                    return nullptr;
+                    overflowBuffer.m_position = offset + size;
+                    ++m_overflowAllocationCount;
+                    m_overflowAllocatedSize += size;
+                    return CreateDynamicBuffer(overflowBuffer.m_buffer->GetRHIBuffer(), overflowBuffer.m_address, offset, size);
                 }
             }
+
+            OverflowBuffer overflowBuffer;
+            auto freeOverflowBuffer = AZStd::find_if(m_freeOverflowBuffers.begin(), m_freeOverflowBuffers.end(), [size](const OverflowBuffer& freeBuffer)
+            {
+                return freeBuffer.m_size >= size;
+            });
+            if (freeOverflowBuffer != m_freeOverflowBuffers.end())
+            {
+                overflowBuffer = AZStd::move(*freeOverflowBuffer);
+                m_freeOverflowBuffers.erase(freeOverflowBuffer);
+            }
             else
             {
-                if (m_ringBufferSize - m_currentPosition >= size)
+                uint64_t grownSize = AZStd::max(size, m_overflowBufferSizeMin);
+                if (!overflowBuffers.empty())
                 {
-                    allocatePosition = m_currentPosition;
-                    m_currentPosition += size;
-                    if (m_ringBufferSize == m_currentPosition)
-                    {
-                        m_currentPosition = 0;
-                    }
+                    grownSize = AZStd::max<uint64_t>(grownSize, overflowBuffers.back().m_size * 2ull);
                 }
-                else
+                const uint32_t bufferSize = aznumeric_cast<uint32_t>(AZStd::min<uint64_t>(grownSize, AZStd::max(size, m_ringBufferSize)));
+
+                RPI::CommonBufferDescriptor desc;
+                desc.m_poolType = RPI::CommonBufferPoolType::DynamicInputAssembly;
+                desc.m_bufferName = "DynamicBufferOverflow";
+                desc.m_elementSize = 1;
+                desc.m_byteCount = bufferSize;
+                overflowBuffer.m_buffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+                if (overflowBuffer.m_buffer)
                 {
-                    if (m_endPositionLimit >= size)
-                    {
-                        allocatePosition = 0;
-                        m_currentPosition = size;
-                    }
-                    else
-                    {
-                        AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%d bytes)", size, m_endPositionLimit);
-                        return nullptr;
-                    }
+                    overflowBuffer.m_address = static_cast<uint8_t*>(overflowBuffer.m_buffer->Map(bufferSize, 0));
+                    overflowBuffer.m_size = bufferSize;
+                }
+
+                if (!overflowBuffer.m_address)
+                {
+                    m_failedAllocationCount.fetch_add(1, AZStd::memory_order_relaxed);
+                    AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: failed to create an overflow buffer of %u bytes", bufferSize);
+                    return nullptr;
                 }
             }
 
-            m_currentAllocatedSize += size;
+            AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: the ring buffer (%u bytes) is full, allocating from overflow buffers", m_ringBufferSize);
 
+            overflowBuffer.m_position = size;
+            ++m_overflowAllocationCount;
+            m_overflowAllocatedSize += size;
+            overflowBuffers.push_back(AZStd::move(overflowBuffer));
+            return CreateDynamicBuffer(overflowBuffers.back().m_buffer->GetRHIBuffer(), overflowBuffers.back().m_address, 0, size);
+        }
+
+        RHI::Ptr<DynamicBuffer> DynamicBufferAllocator::CreateDynamicBuffer(RHI::Buffer* rhiBuffer, uint8_t* bufferStartAddress, uint32_t offset, uint32_t size)
+        {
             RHI::Ptr<DynamicBuffer> allocatedBuffer = aznew DynamicBuffer();
-            allocatedBuffer->m_address = (uint8_t*)m_ringBufferStartAddress + allocatePosition;
+            allocatedBuffer->m_address = bufferStartAddress + offset;
             allocatedBuffer->m_size = size;
+            allocatedBuffer->m_rhiBuffer = rhiBuffer;
+            allocatedBuffer->m_bufferOffset = offset;
             allocatedBuffer->m_allocator = this;
             return allocatedBuffer;
         }
@@ -132,8 +302,8 @@ namespace AZ
         RHI::IndexBufferView DynamicBufferAllocator::GetIndexBufferView(RHI::Ptr<DynamicBuffer> dynamicBuffer, RHI::IndexFormat format)
         {
             return RHI::IndexBufferView(
-                *m_ringBuffer->GetRHIBuffer(),
-                GetBufferAddressOffset(dynamicBuffer),
+                *dynamicBuffer->m_rhiBuffer,
+                dynamicBuffer->m_bufferOffset,
                 dynamicBuffer->m_size,
                 format
             );
@@ -142,37 +312,88 @@ namespace AZ
         RHI::StreamBufferView DynamicBufferAllocator::GetStreamBufferView(RHI::Ptr<DynamicBuffer> dynamicBuffer, uint32_t strideByteCount)
         {
             return RHI::StreamBufferView(
-                *m_ringBuffer->GetRHIBuffer(),
-                GetBufferAddressOffset(dynamicBuffer),
+                *dynamicBuffer->m_rhiBuffer,
+                dynamicBuffer->m_bufferOffset,
                 dynamicBuffer->m_size,
                 strideByteCount
             );
         }
 
-        uint32_t DynamicBufferAllocator::GetBufferAddressOffset(RHI::Ptr<DynamicBuffer> dynamicBuffer)
+        void DynamicBufferAllocator::SetEnableAllocationWarning(bool enable)
         {
-            return aznumeric_cast<uint32_t>((uint8_t*)dynamicBuffer->m_address - (uint8_t*)m_ringBufferStartAddress);
+            m_enableAllocationWarning = enable;
         }
 
-        void DynamicBufferAllocator::SetEnableAllocationWarning(bool enable)
+        const DynamicBufferAllocatorStatistics& DynamicBufferAllocator::GetStatistics() const
         {
-            m_enableAllocationWarning = enable;
+            return m_statistics;
         }
 
         void DynamicBufferAllocator::FrameEnd()
         {
-            uint32_t nextFrame = (m_currentFrame + 1) % AZ::RHI::Limits::Device::FrameCountMax;
+            m_isEndingFrame.store(true);
+            AZStd::exponential_backoff backoff;
+            while (m_allocationsInProgress.load() > 0)
+            {
+                backoff.wait();
+            }
+
+            constexpr uint32_t FrameCountMax = AZ::RHI::Limits::Device::FrameCountMax;
+            uint32_t nextFrame = (m_currentFrame + 1) % FrameCountMax;
+
+            const uint64_t currentPosition = m_currentPosition.load(AZStd::memory_order_relaxed);
+            const uint64_t frameStartPosition = m_frameStartPositions[(m_currentFrame + FrameCountMax - 1) % FrameCountMax];
+
+            m_statistics.m_ringBufferSize = m_ringBufferSize;
+            m_statistics.m_ringBufferUsedSize = currentPosition - frameStartPosition;
+            m_statistics.m_threadChunkCount = m_threadChunkCount.exchange(0, AZStd::memory_order_relaxed);
+            m_statistics.m_directAllocationCount = m_directAllocationCount.exchange(0, AZStd::memory_order_relaxed);
+            m_statistics.m_failedAllocationCount = m_failedAllocationCount.exchange(0, AZStd::memory_order_relaxed);
 
             // The saved frame start position will become available since it's old than FrameCountMax. The saved start position of next frame is the new limit
-            m_endPositionLimit = m_frameStartPositions[nextFrame];
+            m_endPositionLimit.store(m_frameStartPositions[nextFrame] + m_ringBufferSize, AZStd::memory_order_relaxed);
 
             // Save start position for current frame
-            m_frameStartPositions[m_currentFrame] = m_currentPosition;
+            m_frameStartPositions[m_currentFrame] = currentPosition;
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_overflowMutex);
 
-            m_currentFrame = nextFrame;
+                m_statistics.m_overflowAllocationCount = m_overflowAllocationCount;
+                m_statistics.m_overflowAllocatedSize = m_overflowAllocatedSize;
+                m_overflowAllocationCount = 0;
+                m_overflowAllocatedSize = 0;
+
+                // Overflow buffers which weren't needed for a whole frame are released, and the ones of the oldest frame become free,
+                // at the same time as its part of the ring buffer.
+                m_freeOverflowBuffers.clear();
+                for (OverflowBuffer& overflowBuffer : m_overflowBuffers[nextFrame])
+                {
+                    overflowBuffer.m_position = 0;
+                    m_freeOverflowBuffers.push_back(AZStd::move(overflowBuffer));
+                }
+                m_overflowBuffers[nextFrame].clear();
+
+                m_statistics.m_overflowBufferSize = 0;
+                for (const AZStd::vector<OverflowBuffer>& overflowBuffers : m_overflowBuffers)
+                {
+                    for (const OverflowBuffer& overflowBuffer : overflowBuffers)
+                    {
+                        m_statistics.m_overflowBufferSize += overflowBuffer.m_size;
+                    }
+                }
+                for (const OverflowBuffer& overflowBuffer : m_freeOverflowBuffers)
+                {
+                    m_statistics.m_overflowBufferSize += overflowBuffer.m_size;
+                }
+
+                m_currentFrame = nextFrame;
+            }
 
-            m_currentAllocatedSize = 0;
+            // Abandon the thread chunks of the frame which ended.
+            m_frameCounter.fetch_add(1, AZStd::memory_order_release);
 
+            m_isEndingFrame.store(false, AZStd::memory_order_release);
         }
     }
 }
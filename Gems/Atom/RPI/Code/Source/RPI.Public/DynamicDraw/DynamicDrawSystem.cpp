@@ -49,10 +49,18 @@ namespace AZ
 
         RHI::Ptr<DynamicBuffer> DynamicDrawSystem::GetDynamicBuffer(uint32_t size, uint32_t alignment)
         {
-            AZStd::lock_guard<AZStd::mutex> lock(m_mutexBufferAlloc);
             return m_bufferAlloc->Allocate(size, alignment);
         }
 
+        DynamicBufferAllocatorStatistics DynamicDrawSystem::GetDynamicBufferStatistics() const
+        {
+            if (m_bufferAlloc)
+            {
+                return m_bufferAlloc->GetStatistics();
+            }
+            return {};
+        }
+
         RHI::Ptr<DynamicDrawContext> DynamicDrawSystem::CreateDynamicDrawContext(Scene* scene)
         {
             if (!scene)
@@ -123,10 +131,7 @@ namespace AZ
 
         void DynamicDrawSystem::FrameEnd()
         {
-            {
-                AZStd::lock_guard<AZStd::mutex> lock(m_mutexBufferAlloc);
-                m_bufferAlloc->FrameEnd();
-            }
+            m_bufferAlloc->FrameEnd();
 
             // Clean up released dynamic draw contexts (which use count is 1)
             {
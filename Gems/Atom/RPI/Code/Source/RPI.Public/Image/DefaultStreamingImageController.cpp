@@ -9,14 +9,29 @@
 #include <Atom/RPI.Public/Image/DefaultStreamingImageController.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 
+#include <Atom/RHI.Reflect/ImageSubresource.h>
+
 #include <AtomCore/Instance/InstanceDatabase.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
 
 namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(uint32_t, r_streamingImageBudgetMb, 0, nullptr, ConsoleFunctorFlags::Null,
+            "Memory budget of each streaming image pool, in megabytes. 0 uses the budget of the pool descriptor.");
+        AZ_CVAR(uint32_t, r_streamingImageMaxExpandsPerUpdate, 20, nullptr, ConsoleFunctorFlags::Null,
+            "The maximum number of mip chain expansions the streaming image controller queues per update.");
+        AZ_CVAR(uint32_t, r_streamingImageRequestGracePeriod, 3, nullptr, ConsoleFunctorFlags::Null,
+            "The number of updates an attached image waits for a target mip request before all of its mips are streamed in.");
+        AZ_CVAR(bool, r_streamingImageStreamAllMips, false, nullptr, ConsoleFunctorFlags::Null,
+            "Ignore target mip requests and stream in every mip of each image as soon as it is attached, like the controller did before "
+            "residency followed the requests.");
+
         Data::Instance<DefaultStreamingImageController> DefaultStreamingImageController::FindOrCreate(const Data::Asset<DefaultStreamingImageControllerAsset>& asset)
         {
             return azrtti_cast<DefaultStreamingImageController*>(
@@ -52,36 +67,201 @@ namespace AZ
 
         StreamingImageContextPtr DefaultStreamingImageController::CreateContextInternal()
         {
-            StreamingImageContextPtr context = aznew StreamingImageContext();
-            m_recentlyAttachedContexts.emplace_back(context);
+            AZStd::intrusive_ptr<Context> context = aznew Context();
+            context->m_attachTimestamp = GetTimestamp();
+            m_imageContexts.emplace_back(context);
             return context;
         }
 
+        void DefaultStreamingImageController::InitResidentSizes(const StreamingImage& image, Context& context)
+        {
+            const RHI::ImageDescriptor& descriptor = image.GetDescriptor();
+            const size_t mipChainCount = image.GetMipChainCount();
+
+            context.m_residentSizeInBytes.resize(mipChainCount);
+
+            // Accumulate from the tail, so each entry holds the size of its mip chain and every less detailed one.
+            size_t residentSizeInBytes = 0;
+            uint16_t mipLevelEnd = descriptor.m_mipLevels;
+            for (size_t mipChainIndex = mipChainCount; mipChainIndex-- > 0;)
+            {
+                const uint16_t mipLevelBegin = image.GetMipLevel(mipChainIndex);
+                for (uint16_t mipLevel = mipLevelBegin; mipLevel < mipLevelEnd; ++mipLevel)
+                {
+                    const RHI::ImageSubresourceLayout layout = RHI::GetImageSubresourceLayout(descriptor, RHI::ImageSubresource(mipLevel, 0));
+                    residentSizeInBytes += static_cast<size_t>(layout.m_bytesPerImage) * layout.m_size.m_depth * descriptor.m_arraySize;
+                }
+                context.m_residentSizeInBytes[mipChainIndex] = residentSizeInBytes;
+                mipLevelEnd = mipLevelBegin;
+            }
+        }
+
+        bool DefaultStreamingImageController::TrimToFit(size_t requiredInBytes)
+        {
+            const size_t budgetInBytes = m_statistics.m_budgetInBytes;
+            if (budgetInBytes == 0)
+            {
+                return true;
+            }
+
+            while (m_statistics.m_residentInBytes + requiredInBytes > budgetInBytes && m_nextTrimCandidate < m_trimCandidates.size())
+            {
+                const TrimCandidate& candidate = m_trimCandidates[m_nextTrimCandidate++];
+                TrimToMipChainLevel(candidate.m_image, candidate.m_mipChainIndex);
+                m_statistics.m_residentInBytes -= candidate.m_sizeInBytes;
+                ++m_statistics.m_trimCount;
+            }
+
+            return m_statistics.m_residentInBytes + requiredInBytes <= budgetInBytes;
+        }
+
         void DefaultStreamingImageController::UpdateInternal(size_t timestamp, const StreamingImageContextList& contexts)
         {
-            AZ_UNUSED(timestamp);
             AZ_UNUSED(contexts);
 
-            const uint32_t maxExpandsCount = 20;
-            uint32_t mipsExpandsPerUpdate = 0;
+            m_statistics = {};
+            m_statistics.m_budgetInBytes = r_streamingImageBudgetMb > 0
+                ? static_cast<size_t>(static_cast<uint32_t>(r_streamingImageBudgetMb)) * 1024 * 1024
+                : GetPoolBudgetInBytes();
 
-            // [GFX TODO] [ATOM-551] Streaming image control of DefaultStreamingImageController
-            // For now we always stream in all the mips. Of course we need to make this smarter at some point.
-            if (!m_recentlyAttachedContexts.empty())
+            m_expandCandidates.clear();
+            m_trimCandidates.clear();
+            m_nextTrimCandidate = 0;
+
+            const bool streamAllMips = r_streamingImageStreamAllMips;
+            const size_t requestGracePeriod = streamAllMips ? 0 : static_cast<uint32_t>(r_streamingImageRequestGracePeriod);
+
+            for (size_t contextIndex = 0; contextIndex < m_imageContexts.size();)
             {
-                for (auto& context : m_recentlyAttachedContexts)
+                Context& context = *m_imageContexts[contextIndex];
+                StreamingImage* image = context.TryGetImage();
+                if (!image)
+                {
+                    // The image was detached; the order of the contexts doesn't matter.
+                    m_imageContexts[contextIndex] = AZStd::move(m_imageContexts.back());
+                    m_imageContexts.pop_back();
+                    continue;
+                }
+                ++contextIndex;
+
+                if (context.m_residentSizeInBytes.empty())
+                {
+                    InitResidentSizes(*image, context);
+                }
+
+                const size_t streamingMipChain = image->GetStreamingMipChainIndex();
+                m_statistics.m_residentInBytes += context.m_residentSizeInBytes[streamingMipChain];
+                ++m_statistics.m_imageCount;
+
+                if (!image->IsStreamable())
+                {
+                    continue;
+                }
+
+                // Targets are reset after each update, so a target is only set if the image was requested since the last one.
+                const uint16_t targetMip = context.GetTargetMip();
+                const bool isRequested = targetMip != RHI::Limits::Image::MipCountMax;
+                context.m_isManaged = !streamAllMips && (context.m_isManaged || isRequested);
+
+                if (context.m_isManaged)
+                {
+                    // Requests may trim the image, so it has to be expanded again if it stops being managed.
+                    context.m_isExpandedToMostDetailed = false;
+                    ++m_statistics.m_managedImageCount;
+
+                    const size_t targetMipChain = isRequested ? image->GetMipChainIndex(targetMip) : image->GetMipChainCount() - 1;
+                    if (targetMipChain < streamingMipChain)
+                    {
+                        // Expand one mip chain at a time, so the most blurry images get their next mips before any image gets all of them.
+                        ExpandCandidate candidate;
+                        candidate.m_image = image;
+                        candidate.m_context = &context;
+                        candidate.m_mipChainIndex = streamingMipChain - 1;
+                        candidate.m_sizeInBytes = context.m_residentSizeInBytes[streamingMipChain - 1] - context.m_residentSizeInBytes[streamingMipChain];
+                        candidate.m_missingMipCount = static_cast<uint16_t>(image->GetMipLevel(streamingMipChain) - targetMip);
+                        candidate.m_visualErrorPerByte = candidate.m_missingMipCount / static_cast<float>(AZStd::max<size_t>(candidate.m_sizeInBytes, 1));
+                        m_expandCandidates.push_back(candidate);
+                        ++m_statistics.m_pendingExpandCount;
+                    }
+                    else if (targetMipChain > streamingMipChain)
+                    {
+                        TrimCandidate candidate;
+                        candidate.m_image = image;
+                        candidate.m_mipChainIndex = targetMipChain;
+                        candidate.m_sizeInBytes = context.m_residentSizeInBytes[streamingMipChain] - context.m_residentSizeInBytes[targetMipChain];
+                        candidate.m_lastAccessTimestamp = context.GetLastAccessTimestamp();
+                        candidate.m_isRequested = isRequested;
+                        m_trimCandidates.push_back(candidate);
+                    }
+                }
+                else if (!context.m_isExpandedToMostDetailed && timestamp - context.m_attachTimestamp >= requestGracePeriod)
                 {
-                    if (StreamingImage* image = context->TryGetImage())
+                    if (streamingMipChain == 0)
                     {
-                        QueueExpandToMipChainLevel(image, 0);
-                        mipsExpandsPerUpdate++;
-                        if (mipsExpandsPerUpdate >= maxExpandsCount)
-                        {
-                            break;
-                        }
+                        context.m_isExpandedToMostDetailed = true;
+                        continue;
                     }
+
+                    // Images nobody requests, such as UI textures, are streamed in fully. They go ahead of requested images,
+                    // since nothing else will ever ask for them.
+                    ExpandCandidate candidate;
+                    candidate.m_image = image;
+                    candidate.m_context = &context;
+                    candidate.m_mipChainIndex = 0;
+                    candidate.m_sizeInBytes = context.m_residentSizeInBytes[0] - context.m_residentSizeInBytes[streamingMipChain];
+                    candidate.m_visualErrorPerByte = AZStd::numeric_limits<float>::max();
+                    m_expandCandidates.push_back(candidate);
                 }
-                m_recentlyAttachedContexts.erase(m_recentlyAttachedContexts.begin(), m_recentlyAttachedContexts.begin() + mipsExpandsPerUpdate);
+            }
+
+            AZStd::sort(m_expandCandidates.begin(), m_expandCandidates.end(), [](const ExpandCandidate& lhs, const ExpandCandidate& rhs)
+            {
+                return lhs.m_visualErrorPerByte > rhs.m_visualErrorPerByte;
+            });
+
+            // Trim images which weren't requested before images which were, least recently used first.
+            AZStd::sort(m_trimCandidates.begin(), m_trimCandidates.end(), [](const TrimCandidate& lhs, const TrimCandidate& rhs)
+            {
+                if (lhs.m_isRequested != rhs.m_isRequested)
+                {
+                    return !lhs.m_isRequested;
+                }
+                return lhs.m_lastAccessTimestamp < rhs.m_lastAccessTimestamp;
+            });
+
+            TrimToFit(0);
+
+            const uint32_t maxExpandCount = static_cast<uint32_t>(r_streamingImageMaxExpandsPerUpdate);
+            for (const ExpandCandidate& candidate : m_expandCandidates)
+            {
+                if (m_statistics.m_expandCount >= maxExpandCount)
+                {
+                    break;
+                }
+
+                if (!TrimToFit(candidate.m_sizeInBytes))
+                {
+                    // A cheaper expansion further down the list may still fit.
+                    ++m_statistics.m_deferredExpandCount;
+                    continue;
+                }
+
+                if (candidate.m_context->m_isManaged)
+                {
+                    // Ask the streamer to hurry for images missing several mips, since those are visibly blurry.
+                    const IO::IStreamerTypes::Priority priority = candidate.m_missingMipCount > 1
+                        ? IO::IStreamerTypes::s_priorityHigh
+                        : IO::IStreamerTypes::s_priorityMedium;
+                    QueueExpandToMipChainLevel(candidate.m_image, candidate.m_mipChainIndex, priority);
+                }
+                else
+                {
+                    QueueExpandToMipChainLevel(candidate.m_image, candidate.m_mipChainIndex);
+                    candidate.m_context->m_isExpandedToMostDetailed = true;
+                }
+
+                m_statistics.m_residentInBytes += candidate.m_sizeInBytes;
+                ++m_statistics.m_expandCount;
             }
         }
     }
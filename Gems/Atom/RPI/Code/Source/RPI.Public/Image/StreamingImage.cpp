@@ -17,6 +17,7 @@
 #include <Atom/RHI/Factory.h>
 
 #include <AzCore/Debug/EventTrace.h>
+#include <AzCore/Math/MathUtils.h>
 #include <AtomCore/Instance/InstanceDatabase.h>
 
 // Enable this define to debug output streaming image initialization and expanding process.
@@ -245,11 +246,55 @@ namespace AZ
             }
         }
         
+        void StreamingImage::SetTargetMipForProjectedSize(float projectedSizeInPixels, float uvDensity)
+        {
+            if (m_streamingController)
+            {
+                const RHI::Size& imageSize = m_imageAsset->GetImageDescriptor().m_size;
+                const uint16_t targetMipLevel = CalculateTargetMip(AZStd::max(imageSize.m_width, imageSize.m_height), projectedSizeInPixels, uvDensity);
+                m_streamingController->OnSetTargetMip(this, targetMipLevel);
+            }
+        }
+
+        uint16_t StreamingImage::CalculateTargetMip(uint32_t imageSize, float projectedSizeInPixels, float uvDensity)
+        {
+            // The surface samples one texel per pixel at the mip where the image size matches the number of texels on screen.
+            const float texelsOnScreen = projectedSizeInPixels * uvDensity;
+            if (texelsOnScreen <= 1.0f)
+            {
+                return RHI::Limits::Image::MipCountMax - 1;
+            }
+
+            const float mipLevel = floorf(log2f(static_cast<float>(imageSize) / texelsOnScreen));
+            return static_cast<uint16_t>(AZ::GetClamp(mipLevel, 0.0f, static_cast<float>(RHI::Limits::Image::MipCountMax - 1)));
+        }
+
         uint16_t StreamingImage::GetResidentMipLevel()
         {
             return m_image->GetResidentMipLevel();
         }
 
+        size_t StreamingImage::GetMipChainCount() const
+        {
+            return m_mipChains.size();
+        }
+
+        size_t StreamingImage::GetMipChainIndex(uint16_t mipLevel) const
+        {
+            const uint16_t lastMipLevel = static_cast<uint16_t>(m_imageAsset->GetImageDescriptor().m_mipLevels - 1);
+            return m_imageAsset->GetMipChainIndex(AZStd::min(mipLevel, lastMipLevel));
+        }
+
+        uint16_t StreamingImage::GetMipLevel(size_t mipChainIndex) const
+        {
+            return static_cast<uint16_t>(m_imageAsset->GetMipLevel(mipChainIndex));
+        }
+
+        size_t StreamingImage::GetStreamingMipChainIndex() const
+        {
+            return m_state.m_streamingTarget;
+        }
+
         RHI::ResultCode StreamingImage::TrimToMipChainLevel(size_t mipChainIndex)
         {
             AZ_Assert(mipChainIndex < m_mipChains.size(), "Exceeded number of mip chains.");
@@ -280,7 +325,7 @@ namespace AZ
             return resultCode;
         }
 
-        void StreamingImage::QueueExpandToMipChainLevel(size_t mipChainIndex)
+        void StreamingImage::QueueExpandToMipChainLevel(size_t mipChainIndex, AZStd::optional<IO::IStreamerTypes::Priority> priority)
         {
             AZ_Assert(IsStreamable(), "Only streamable StreamingImage's mip chain can be expanded");
             AZ_Assert(mipChainIndex < m_mipChains.size(), "Exceeded number of mip chains.");
@@ -295,7 +340,7 @@ namespace AZ
                 // Iterate through to the end chain and queue loading operations on the mip assets.
                 for (size_t i = mipChainBegin; i != mipChainEnd; --i)
                 {
-                    FetchMipChainAsset(i);
+                    FetchMipChainAsset(i, priority);
                 }
 
                 m_state.m_streamingTarget = static_cast<uint16_t>(mipChainIndex);
@@ -382,7 +427,7 @@ namespace AZ
             }
         }
 
-        void StreamingImage::FetchMipChainAsset(size_t mipChainIndex)
+        void StreamingImage::FetchMipChainAsset(size_t mipChainIndex, AZStd::optional<IO::IStreamerTypes::Priority> priority)
         {
             AZ_Assert(mipChainIndex < m_mipChains.size(), "Exceeded total number of mip chains.");
 
@@ -402,7 +447,9 @@ namespace AZ
                 Data::AssetBus::MultiHandler::BusConnect(mipChainAsset.GetId());
 
                 // And we request that the asset be loaded in case it isn't already.
-                mipChainAsset.QueueLoad();
+                Data::AssetLoadParameters loadParams;
+                loadParams.m_priority = priority;
+                mipChainAsset.QueueLoad(loadParams);
 
 #ifdef AZ_RPI_STREAMING_IMAGE_DEBUG_LOG
                 AZ_TracePrintf("StreamingImage", "Fetch mip chain asset [%s]\n", mipChainAsset.GetHint().c_str());
@@ -12,6 +12,8 @@
 
 #include <AtomCore/Instance/InstanceDatabase.h>
 
+#include <Atom/RHI/StreamingImagePool.h>
+
 #include <AzCore/Debug/EventTrace.h>
 #include <AzCore/Jobs/Job.h>
 
@@ -123,6 +125,11 @@ namespace AZ
             return m_timestamp;
         }
 
+        const StreamingImageControllerStatistics& StreamingImageController::GetStatistics() const
+        {
+            return m_statistics;
+        }
+
         void StreamingImageController::OnSetTargetMip(StreamingImage* image, uint16_t mipLevelTarget)
         {
             StreamingImageContext* context = image->m_streamingContext.get();
@@ -162,9 +169,9 @@ namespace AZ
             }
         }
 
-        void StreamingImageController::QueueExpandToMipChainLevel(StreamingImage* image, size_t mipChainIndex)
+        void StreamingImageController::QueueExpandToMipChainLevel(StreamingImage* image, size_t mipChainIndex, AZStd::optional<IO::IStreamerTypes::Priority> priority)
         {
-            image->QueueExpandToMipChainLevel(mipChainIndex);
+            image->QueueExpandToMipChainLevel(mipChainIndex, priority);
         }
 
         void StreamingImageController::TrimToMipChainLevel(StreamingImage* image, size_t mipChainIndex)
@@ -172,6 +179,11 @@ namespace AZ
             image->TrimToMipChainLevel(mipChainIndex);
         }
 
+        size_t StreamingImageController::GetPoolBudgetInBytes() const
+        {
+            return m_pool ? m_pool->GetDescriptor().m_budgetInBytes : 0;
+        }
+
         StreamingImageContextPtr StreamingImageController::CreateContextInternal()
         {
             return aznew StreamingImageContext();
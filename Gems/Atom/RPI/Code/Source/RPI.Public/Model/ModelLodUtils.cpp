@@ -133,6 +133,64 @@ namespace AZ
                     return approxScreenPercentage;
                 }
             }
+
+            float ApproxUvDensity(const ModelLodAsset::Mesh& mesh)
+            {
+                AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+
+                static const Name PositionSemanticName{ "POSITION" };
+                static const Name UvSemanticName{ "UV" };
+
+                const BufferAssetView* uvBufferAssetView = mesh.GetSemanticBufferAssetView(UvSemanticName);
+                const BufferAssetView* positionBufferAssetView = mesh.GetSemanticBufferAssetView(PositionSemanticName);
+                if (!uvBufferAssetView || !positionBufferAssetView ||
+                    uvBufferAssetView->GetBufferViewDescriptor().m_elementSize != sizeof(float) * 2 ||
+                    positionBufferAssetView->GetBufferViewDescriptor().m_elementSize != sizeof(float) * 3 ||
+                    mesh.GetIndexBufferAssetView().GetBufferViewDescriptor().m_elementSize != sizeof(uint32_t))
+                {
+                    return 0.0f;
+                }
+
+                const AZStd::array_view<float> uvs = mesh.GetSemanticBufferTyped<float>(UvSemanticName);
+                const AZStd::array_view<float> positions = mesh.GetSemanticBufferTyped<float>(PositionSemanticName);
+                const AZStd::array_view<uint32_t> indices = mesh.GetIndexBufferTyped<uint32_t>();
+                const size_t vertexCount = AZStd::min(uvs.size() / 2, positions.size() / 3);
+
+                // Twice the areas, which cancels out in the ratio
+                float uvArea = 0.0f;
+                float surfaceArea = 0.0f;
+                for (size_t index = 0; index + 2 < indices.size(); index += 3)
+                {
+                    const uint32_t vertices[3] = { indices[index], indices[index + 1], indices[index + 2] };
+                    if (vertices[0] >= vertexCount || vertices[1] >= vertexCount || vertices[2] >= vertexCount)
+                    {
+                        continue;
+                    }
+
+                    const auto getPosition = [&positions](uint32_t vertex)
+                    {
+                        return Vector3(positions[vertex * 3], positions[vertex * 3 + 1], positions[vertex * 3 + 2]);
+                    };
+                    const auto getUv = [&uvs](uint32_t vertex)
+                    {
+                        return Vector2(uvs[vertex * 2], uvs[vertex * 2 + 1]);
+                    };
+
+                    const Vector3 position0 = getPosition(vertices[0]);
+                    surfaceArea += (getPosition(vertices[1]) - position0).Cross(getPosition(vertices[2]) - position0).GetLength();
+
+                    const Vector2 uv0 = getUv(vertices[0]);
+                    const Vector2 uvEdge1 = getUv(vertices[1]) - uv0;
+                    const Vector2 uvEdge2 = getUv(vertices[2]) - uv0;
+                    uvArea += fabsf(uvEdge1.GetX() * uvEdge2.GetY() - uvEdge1.GetY() * uvEdge2.GetX());
+                }
+
+                if (surfaceArea <= 0.0f || uvArea <= 0.0f)
+                {
+                    return 0.0f;
+                }
+                return sqrtf(uvArea / surfaceArea);
+            }
         } // namespace ModelLodUtils
     } // namespace RPI
 } // namespace AZ
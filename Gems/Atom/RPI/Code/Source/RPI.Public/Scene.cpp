@@ -522,6 +522,12 @@ namespace AZ
 
                 m_cullingScene->EndCulling();
 
+                // Let feature processors add draw packets built from the results of culling
+                for (auto& fp : m_featureProcessors)
+                {
+                    fp->OnEndCulling(m_renderPacket);
+                }
+
                 // Add dynamic draw data for all the views
                 if (m_dynamicDrawSystem)
                 {
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <Atom/RPI.Public/Shader/PipelineStateLog.h>
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Utils/TypeHash.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        void PipelineStateLogEntry::Reflect(ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<PipelineStateLogEntry>()
+                    ->Version(1)
+                    ->Field("ShaderVariantStableId", &PipelineStateLogEntry::m_shaderVariantStableId)
+                    ->Field("InputStreamLayout", &PipelineStateLogEntry::m_inputStreamLayout)
+                    ->Field("RenderAttachmentConfiguration", &PipelineStateLogEntry::m_renderAttachmentConfiguration)
+                    ->Field("RenderStates", &PipelineStateLogEntry::m_renderStates)
+                    ;
+            }
+        }
+
+        HashValue64 PipelineStateLogEntry::GetHash() const
+        {
+            HashValue64 seed = TypeHash64(m_shaderVariantStableId.GetIndex());
+            seed = TypeHash64(m_inputStreamLayout.GetHash(), seed);
+            seed = TypeHash64(m_renderAttachmentConfiguration.GetHash(), seed);
+            return m_renderStates.GetHash(seed);
+        }
+
+        void PipelineStateLog::Reflect(ReflectContext* context)
+        {
+            PipelineStateLogEntry::Reflect(context);
+
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<PipelineStateLog>()
+                    ->Version(1)
+                    ->Field("ShaderAssetBuildTimestamp", &PipelineStateLog::m_shaderAssetBuildTimestamp)
+                    ->Field("Entries", &PipelineStateLog::m_entries)
+                    ;
+            }
+        }
+    } // namespace RPI
+} // namespace AZ
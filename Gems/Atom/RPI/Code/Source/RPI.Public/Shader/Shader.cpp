@@ -7,6 +7,7 @@
  */
 #include <Atom/RPI.Public/Shader/Shader.h>
 
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/SystemFile.h>
 
 #include <Atom/RHI/RHISystemInterface.h>
@@ -17,6 +18,9 @@
 #include <AtomCore/Instance/InstanceDatabase.h>
 
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadDebugTracker.h>
 
@@ -24,6 +28,9 @@ namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool, r_precompilePipelineStates, true, nullptr, ConsoleFunctorFlags::Null,
+            "Precompile the pipeline states recorded by previous runs in background jobs when shaders are loaded.");
+
         Data::Instance<Shader> Shader::FindOrCreate(const Data::Asset<ShaderAsset>& shaderAsset, const Name& supervariantName)
         {
             auto anySupervariantName = AZStd::any(supervariantName);
@@ -81,6 +88,9 @@ namespace AZ
             ShaderReloadNotificationBus::Handler::BusDisconnect();
             ShaderVariantFinderNotificationBus::Handler::BusDisconnect();
 
+            // Precompiles refer to the variants of the previous asset.
+            CancelPrecompile();
+
             RHI::RHISystemInterface* rhiSystem = RHI::RHISystemInterface::Get();
             RHI::DrawListTagRegistry* drawListTagRegistry = rhiSystem->GetDrawListTagRegistry();
 
@@ -112,6 +122,16 @@ namespace AZ
 
                 m_pipelineLibraryHandle = pipelineLibraryHandle;
                 m_pipelineStateCache = pipelineStateCache;
+
+                LoadPipelineStateLog();
+            }
+            else
+            {
+                // The variants were rebuilt, so the entries recorded so far may refer to other variants.
+                AZStd::lock_guard<AZStd::mutex> lock(m_pipelineStateLogMutex);
+                m_pipelineStateLog.m_shaderAssetBuildTimestamp = shaderAsset.GetShaderAssetBuildTimestamp();
+                m_pipelineStateLog.m_entries.clear();
+                m_pipelineStateLogHashes.clear();
             }
 
             const Name& drawListName = shaderAsset.GetDrawListName();
@@ -128,6 +148,12 @@ namespace AZ
             Data::AssetBus::Handler::BusConnect(m_asset.GetId());
             ShaderReloadNotificationBus::Handler::BusConnect(m_asset.GetId());
 
+            // Start precompiling the pipeline states logged by the previous runs, now that the shader is ready to provide the variants.
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_pipelineStateLogMutex);
+                StartPrecompileJob();
+            }
+
             return RHI::ResultCode::Success;
         }
 
@@ -137,9 +163,12 @@ namespace AZ
             Data::AssetBus::Handler::BusDisconnect();
             ShaderReloadNotificationBus::Handler::BusDisconnect();
 
+            CancelPrecompile();
+
             if (m_pipelineLibraryHandle.IsValid())
             {
                 SavePipelineLibrary();
+                SavePipelineStateLog();
 
                 m_pipelineStateCache->ReleaseLibrary(m_pipelineLibraryHandle);
                 m_pipelineStateCache = nullptr;
@@ -226,6 +255,22 @@ namespace AZ
                 }
             }
 
+            // Precompile the logged pipeline states that were waiting for this variant.
+            if (!isError)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_pipelineStateLogMutex);
+                auto deferredRange = m_deferredPrecompiles.equal_range(stableId);
+                if (deferredRange.first != deferredRange.second)
+                {
+                    for (auto deferredIt = deferredRange.first; deferredIt != deferredRange.second; ++deferredIt)
+                    {
+                        m_precompileQueue.push_back(AZStd::move(deferredIt->second));
+                    }
+                    m_deferredPrecompiles.erase(deferredRange.first, deferredRange.second);
+                    StartPrecompileJob();
+                }
+            }
+
             // [GFX TODO] It might make more sense to call OnShaderReinitialized here
             ShaderReloadNotificationBus::Event(m_asset.GetId(), &ShaderReloadNotificationBus::Events::OnShaderVariantReinitialized, updatedVariant);
         }
@@ -278,6 +323,209 @@ namespace AZ
             }
         }
 
+        void Shader::LoadPipelineStateLog()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_pipelineStateLogMutex);
+
+            const AZStd::sys_time_t shaderAssetBuildTimestamp = m_asset->GetShaderAssetBuildTimestamp();
+
+            m_pipelineStateLog = {};
+            m_pipelineStateLogHashes.clear();
+            if (IO::FileIOBase::GetInstance())
+            {
+                Utils::LoadObjectFromFileInPlace(GetPipelineStateLogPath(), m_pipelineStateLog);
+            }
+
+            if (m_pipelineStateLog.m_shaderAssetBuildTimestamp != shaderAssetBuildTimestamp)
+            {
+                m_pipelineStateLog.m_shaderAssetBuildTimestamp = shaderAssetBuildTimestamp;
+                m_pipelineStateLog.m_entries.clear();
+            }
+
+            for (const PipelineStateLogEntry& entry : m_pipelineStateLog.m_entries)
+            {
+                m_pipelineStateLogHashes.insert(static_cast<uint64_t>(entry.GetHash()));
+            }
+
+            // The log is in the order the pipeline states were first needed, which is the order they are likely needed again.
+            if (r_precompilePipelineStates)
+            {
+                m_precompileQueue.assign(m_pipelineStateLog.m_entries.begin(), m_pipelineStateLog.m_entries.end());
+            }
+        }
+
+        void Shader::SavePipelineStateLog() const
+        {
+            if (auto* fileIOBase = IO::FileIOBase::GetInstance())
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_pipelineStateLogMutex);
+                if (m_pipelineStateLog.m_entries.empty())
+                {
+                    return;
+                }
+
+                char pipelineStateLogPathResolved[AZ_MAX_PATH_LEN] = { 0 };
+                fileIOBase->ResolvePath(GetPipelineStateLogPath().c_str(), pipelineStateLogPathResolved, AZ_MAX_PATH_LEN);
+                Utils::SaveObjectToFile(pipelineStateLogPathResolved, DataStream::ST_BINARY, &m_pipelineStateLog);
+            }
+        }
+
+        void Shader::RecordPipelineState(const RHI::PipelineStateDescriptor& descriptor) const
+        {
+            PipelineStateLogEntry entry;
+            entry.m_shaderVariantStableId = FindPipelineStateVariantStableId(descriptor);
+            if (!entry.m_shaderVariantStableId.IsValid())
+            {
+                return;
+            }
+
+            if (descriptor.GetType() == RHI::PipelineStateType::Draw)
+            {
+                const auto& descriptorForDraw = static_cast<const RHI::PipelineStateDescriptorForDraw&>(descriptor);
+                entry.m_inputStreamLayout = descriptorForDraw.m_inputStreamLayout;
+                entry.m_renderAttachmentConfiguration = descriptorForDraw.m_renderAttachmentConfiguration;
+                entry.m_renderStates = descriptorForDraw.m_renderStates;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_pipelineStateLogMutex);
+            if (m_pipelineStateLogHashes.insert(static_cast<uint64_t>(entry.GetHash())).second)
+            {
+                m_pipelineStateLog.m_entries.push_back(AZStd::move(entry));
+            }
+        }
+
+        ShaderVariantStableId Shader::FindPipelineStateVariantStableId(const RHI::PipelineStateDescriptor& descriptor) const
+        {
+            // Ray tracing pipeline states are built from several shaders, and aren't logged.
+            const RHI::PipelineStateType pipelineStateType = descriptor.GetType();
+            if (pipelineStateType != RHI::PipelineStateType::Draw && pipelineStateType != RHI::PipelineStateType::Dispatch)
+            {
+                return {};
+            }
+
+            const auto usesStageFunctions = [&descriptor, pipelineStateType](const ShaderVariant& shaderVariant)
+            {
+                const Data::Asset<ShaderVariantAsset>& shaderVariantAsset = shaderVariant.GetShaderVariantAsset();
+                if (pipelineStateType == RHI::PipelineStateType::Draw)
+                {
+                    const auto& descriptorForDraw = static_cast<const RHI::PipelineStateDescriptorForDraw&>(descriptor);
+                    return shaderVariantAsset->GetShaderStageFunction(RHI::ShaderStage::Vertex) == descriptorForDraw.m_vertexFunction.get() &&
+                        shaderVariantAsset->GetShaderStageFunction(RHI::ShaderStage::Fragment) == descriptorForDraw.m_fragmentFunction.get();
+                }
+
+                const auto& descriptorForDispatch = static_cast<const RHI::PipelineStateDescriptorForDispatch&>(descriptor);
+                return shaderVariantAsset->GetShaderStageFunction(RHI::ShaderStage::Compute) == descriptorForDispatch.m_computeFunction.get();
+            };
+
+            if (usesStageFunctions(m_rootVariant))
+            {
+                return m_rootVariant.GetStableId();
+            }
+
+            AZStd::shared_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+            for (const auto& shaderVariant : m_shaderVariants)
+            {
+                if (usesStageFunctions(shaderVariant.second))
+                {
+                    return shaderVariant.first;
+                }
+            }
+            return {};
+        }
+
+        void Shader::StartPrecompileJob()
+        {
+            if (m_precompileJobActive || m_precompileCancelled || m_precompileQueue.empty())
+            {
+                return;
+            }
+
+            JobContext* jobContext = JobContext::GetGlobalContext();
+            if (!jobContext)
+            {
+                return;
+            }
+
+            // Each job precompiles a single pipeline state, so that precompiles don't hold on to a worker thread for long.
+            m_precompileJobActive = true;
+            Job* job = CreateJobFunction([this]() { PrecompileNextPipelineState(); }, true, jobContext);
+            job->Start();
+        }
+
+        void Shader::PrecompileNextPipelineState()
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_pipelineStateLogMutex);
+
+            if (!m_precompileCancelled && !m_precompileQueue.empty())
+            {
+                PipelineStateLogEntry entry = AZStd::move(m_precompileQueue.front());
+                m_precompileQueue.pop_front();
+
+                lock.unlock();
+                const bool isVariantReady = PrecompilePipelineState(entry);
+                lock.lock();
+
+                if (!isVariantReady)
+                {
+                    m_deferredPrecompiles.emplace(entry.m_shaderVariantStableId, AZStd::move(entry));
+                }
+            }
+
+            m_precompileJobActive = false;
+            StartPrecompileJob();
+
+            if (!m_precompileJobActive)
+            {
+                m_precompileJobFinished.notify_all();
+            }
+        }
+
+        bool Shader::PrecompilePipelineState(const PipelineStateLogEntry& entry)
+        {
+            // Requesting the variant also queues its asset to load when it isn't loaded yet.
+            const ShaderVariant& shaderVariant = GetVariant(entry.m_shaderVariantStableId);
+            if (shaderVariant.GetStableId() != entry.m_shaderVariantStableId)
+            {
+                return false;
+            }
+
+            switch (m_pipelineStateType)
+            {
+            case RHI::PipelineStateType::Draw:
+            {
+                RHI::PipelineStateDescriptorForDraw descriptor;
+                shaderVariant.ConfigurePipelineState(descriptor);
+                descriptor.m_inputStreamLayout = entry.m_inputStreamLayout;
+                descriptor.m_renderAttachmentConfiguration = entry.m_renderAttachmentConfiguration;
+                descriptor.m_renderStates = entry.m_renderStates;
+                m_pipelineStateCache->PrecompilePipelineState(m_pipelineLibraryHandle, descriptor);
+                break;
+            }
+            case RHI::PipelineStateType::Dispatch:
+            {
+                RHI::PipelineStateDescriptorForDispatch descriptor;
+                shaderVariant.ConfigurePipelineState(descriptor);
+                m_pipelineStateCache->PrecompilePipelineState(m_pipelineLibraryHandle, descriptor);
+                break;
+            }
+            default:
+                break;
+            }
+            return true;
+        }
+
+        void Shader::CancelPrecompile()
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_pipelineStateLogMutex);
+
+            m_precompileCancelled = true;
+            m_precompileJobFinished.wait(lock, [this]() { return !m_precompileJobActive; });
+
+            m_precompileQueue.clear();
+            m_deferredPrecompiles.clear();
+            m_precompileCancelled = false;
+        }
+
         AZStd::string Shader::GetPipelineLibraryPath() const
         {
             const Data::InstanceId& instanceId = GetId();
@@ -290,6 +538,13 @@ namespace AZ
             return AZStd::string::format("@user@/Atom/PipelineStateCache/%s/%s_%s_%d.bin", platformName.GetCStr(), shaderName.GetCStr(), uuidString.data(), instanceId.m_subId);
         }
 
+        AZStd::string Shader::GetPipelineStateLogPath() const
+        {
+            AZ::IO::Path pipelineStateLogPath(GetPipelineLibraryPath());
+            pipelineStateLogPath.ReplaceExtension("pipelinestates");
+            return pipelineStateLogPath.Native();
+        }
+
         ShaderOptionGroup Shader::CreateShaderOptionGroup() const
         {
             return ShaderOptionGroup(m_asset->GetShaderOptionGroupLayout());
@@ -401,7 +656,13 @@ namespace AZ
 
         const RHI::PipelineState* Shader::AcquirePipelineState(const RHI::PipelineStateDescriptor& descriptor) const
         {
-            return m_pipelineStateCache->AcquirePipelineState(m_pipelineLibraryHandle, descriptor);
+            bool wasCompiled = false;
+            const RHI::PipelineState* pipelineState = m_pipelineStateCache->AcquirePipelineState(m_pipelineLibraryHandle, descriptor, &wasCompiled);
+            if (wasCompiled)
+            {
+                RecordPipelineState(descriptor);
+            }
+            return pipelineState;
         }
 
         const RHI::Ptr<RHI::ShaderResourceGroupLayout>& Shader::FindShaderResourceGroupLayout(const Name& shaderResourceGroupName) const
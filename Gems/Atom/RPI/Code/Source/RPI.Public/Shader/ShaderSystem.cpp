@@ -7,6 +7,7 @@
  */
 
 #include <Atom/RPI.Public/Shader/ShaderSystem.h>
+#include <Atom/RPI.Public/Shader/PipelineStateLog.h>
 #include <Atom/RPI.Public/Shader/Shader.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroupPool.h>
@@ -40,6 +41,7 @@ namespace AZ
             ShaderOutputContract::Reflect(context);
             ShaderVariantAsset::Reflect(context);
             ShaderVariantTreeAsset::Reflect(context);
+            PipelineStateLog::Reflect(context);
             ReflectShaderStageType(context);
             PrecompiledShaderAssetSourceData::Reflect(context);
         }
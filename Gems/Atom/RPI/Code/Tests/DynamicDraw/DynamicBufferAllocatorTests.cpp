@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+
+#include <Atom/RPI.Public/DynamicDraw/DynamicBuffer.h>
+#include <Atom/RPI.Public/DynamicDraw/DynamicBufferAllocator.h>
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/sort.h>
+
+#include <Common/RPITestFixture.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    class DynamicBufferAllocatorTests
+        : public RPITestFixture
+    {
+    protected:
+        struct Allocation
+        {
+            const RHI::Buffer* m_rhiBuffer = nullptr;
+            uint32_t m_offset = 0;
+            uint32_t m_size = 0;
+        };
+
+        static Allocation ToAllocation(DynamicBufferAllocator& allocator, const RHI::Ptr<DynamicBuffer>& dynamicBuffer)
+        {
+            const RHI::StreamBufferView view = allocator.GetStreamBufferView(dynamicBuffer, 1);
+            return Allocation{ view.GetBuffer(), view.GetByteOffset(), view.GetByteCount() };
+        }
+    };
+
+    TEST_F(DynamicBufferAllocatorTests, Allocate_FromManyThreads_AllocationsDontOverlap)
+    {
+        constexpr uint32_t ThreadCount = 8;
+        constexpr uint32_t AllocationsPerThread = 500;
+        constexpr uint32_t Alignment = 16;
+
+        DynamicBufferAllocator allocator;
+        allocator.Init(4 * 1024 * 1024);
+
+        AZStd::vector<Allocation> threadAllocations[ThreadCount];
+        AZStd::vector<AZStd::thread> threads;
+        for (uint32_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back([&allocator, &allocations = threadAllocations[threadIndex], threadIndex]()
+            {
+                SimpleLcgRandom random(threadIndex + 1);
+                for (uint32_t index = 0; index < AllocationsPerThread; ++index)
+                {
+                    const uint32_t size = 16 + random.GetRandom() % 1024;
+                    RHI::Ptr<DynamicBuffer> dynamicBuffer = allocator.Allocate(size, Alignment);
+                    if (dynamicBuffer)
+                    {
+                        // Write the whole allocation, so overlapping allocations would also show up in memory tools.
+                        memset(dynamicBuffer->GetBufferAddress(), threadIndex, dynamicBuffer->GetSize());
+                        allocations.push_back(ToAllocation(allocator, dynamicBuffer));
+                    }
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        AZStd::vector<Allocation> allocations;
+        for (const AZStd::vector<Allocation>& threadAllocation : threadAllocations)
+        {
+            EXPECT_EQ(AllocationsPerThread, threadAllocation.size());
+            allocations.insert(allocations.end(), threadAllocation.begin(), threadAllocation.end());
+        }
+
+        AZStd::sort(allocations.begin(), allocations.end(), [](const Allocation& lhs, const Allocation& rhs)
+        {
+            return lhs.m_rhiBuffer != rhs.m_rhiBuffer ? lhs.m_rhiBuffer < rhs.m_rhiBuffer : lhs.m_offset < rhs.m_offset;
+        });
+        for (size_t index = 0; index < allocations.size(); ++index)
+        {
+            EXPECT_EQ(0u, allocations[index].m_offset % Alignment);
+            if (index > 0 && allocations[index - 1].m_rhiBuffer == allocations[index].m_rhiBuffer)
+            {
+                EXPECT_LE(allocations[index - 1].m_offset + allocations[index - 1].m_size, allocations[index].m_offset);
+            }
+        }
+
+        allocator.FrameEnd();
+        const DynamicBufferAllocatorStatistics& statistics = allocator.GetStatistics();
+        EXPECT_EQ(0u, statistics.m_overflowAllocationCount);
+        EXPECT_EQ(0u, statistics.m_failedAllocationCount);
+        EXPECT_GT(statistics.m_threadChunkCount, 0u);
+
+        allocator.Shutdown();
+    }
+
+    TEST_F(DynamicBufferAllocatorTests, FrameEnd_WhileAllocatingFromManyThreads_EachAllocationCountedInItsFrame)
+    {
+        constexpr uint32_t ThreadCount = 8;
+        constexpr uint32_t AllocationsPerThread = 500;
+        // Too large for the thread chunks, so every allocation moves the ring position by exactly its size.
+        constexpr uint32_t AllocationSize = 32 * 1024;
+
+        DynamicBufferAllocator allocator;
+        allocator.Init(16 * 1024 * 1024);
+
+        AZStd::atomic<uint32_t> runningThreadCount{ThreadCount};
+        AZStd::atomic<uint32_t> failedAllocationCount{0};
+        AZStd::vector<AZStd::thread> threads;
+        for (uint32_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back([&allocator, &runningThreadCount, &failedAllocationCount]()
+            {
+                for (uint32_t index = 0; index < AllocationsPerThread; ++index)
+                {
+                    if (!allocator.Allocate(AllocationSize, 256))
+                    {
+                        failedAllocationCount.fetch_add(1);
+                    }
+                }
+                runningThreadCount.fetch_sub(1);
+            });
+        }
+
+        // An allocation which raced the end of a frame would move the ring position of one frame but be counted in the other.
+        uint32_t frameCount = 0;
+        uint32_t allocationCount = 0;
+        auto endFrame = [&]()
+        {
+            allocator.FrameEnd();
+            const DynamicBufferAllocatorStatistics& statistics = allocator.GetStatistics();
+            EXPECT_EQ(uint64_t{statistics.m_directAllocationCount} * AllocationSize, statistics.m_ringBufferUsedSize);
+            allocationCount += statistics.m_directAllocationCount + statistics.m_overflowAllocationCount;
+            ++frameCount;
+        };
+        while (runningThreadCount > 0)
+        {
+            endFrame();
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        endFrame();
+
+        EXPECT_EQ(0u, failedAllocationCount);
+        EXPECT_EQ(ThreadCount * AllocationsPerThread, allocationCount);
+        EXPECT_GT(frameCount, 1u);
+
+        allocator.Shutdown();
+    }
+
+    TEST_F(DynamicBufferAllocatorTests, Allocate_RingBufferFull_AllocatesFromOverflowBuffer)
+    {
+        constexpr uint32_t RingBufferSize = 64 * 1024;
+
+        DynamicBufferAllocator allocator;
+        allocator.Init(RingBufferSize);
+
+        RHI::Ptr<DynamicBuffer> first = allocator.Allocate(48 * 1024, 256);
+        RHI::Ptr<DynamicBuffer> second = allocator.Allocate(32 * 1024, 256);
+        ASSERT_TRUE(first);
+        ASSERT_TRUE(second);
+        EXPECT_NE(ToAllocation(allocator, first).m_rhiBuffer, ToAllocation(allocator, second).m_rhiBuffer);
+
+        allocator.FrameEnd();
+        const DynamicBufferAllocatorStatistics& statistics = allocator.GetStatistics();
+        EXPECT_EQ(RingBufferSize, statistics.m_ringBufferSize);
+        EXPECT_EQ(1u, statistics.m_overflowAllocationCount);
+        EXPECT_EQ(32u * 1024, statistics.m_overflowAllocatedSize);
+        EXPECT_GE(statistics.m_overflowBufferSize, 32u * 1024);
+        EXPECT_EQ(0u, statistics.m_failedAllocationCount);
+
+        allocator.Shutdown();
+    }
+
+    TEST_F(DynamicBufferAllocatorTests, FrameEnd_ManyFrames_ReusesRingBuffer)
+    {
+        constexpr uint32_t RingBufferSize = 64 * 1024;
+        constexpr uint32_t AllocationSize = 16 * 1024;
+
+        DynamicBufferAllocator allocator;
+        allocator.Init(RingBufferSize);
+
+        bool wrapped = false;
+        uint32_t lastOffset = 0;
+        for (uint32_t frame = 0; frame < 10; ++frame)
+        {
+            RHI::Ptr<DynamicBuffer> dynamicBuffer = allocator.Allocate(AllocationSize, 256);
+            ASSERT_TRUE(dynamicBuffer);
+            const uint32_t offset = ToAllocation(allocator, dynamicBuffer).m_offset;
+            wrapped = wrapped || offset < lastOffset;
+            lastOffset = offset;
+
+            allocator.FrameEnd();
+            EXPECT_EQ(0u, allocator.GetStatistics().m_overflowAllocationCount);
+            EXPECT_EQ(AllocationSize, allocator.GetStatistics().m_ringBufferUsedSize);
+        }
+        EXPECT_TRUE(wrapped);
+
+        allocator.Shutdown();
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    // Sets up the RPI, so the benchmark allocates from a ring buffer created by the buffer system.
+    class DynamicBufferAllocatorEnvironment
+        : public UnitTest::RPITestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            RPITestFixture::SetUp();
+        }
+
+        void TearDown() override
+        {
+            RPITestFixture::TearDown();
+        }
+
+        void TestBody() override {}
+    };
+
+    //! Measures contention on DynamicBufferAllocator::Allocate(). Each iteration is one frame in which state.range(0) jobs make
+    //! AllocationsPerJob allocations each, followed by the FrameEnd() that retires them.
+    class BM_DynamicBufferAllocator
+        : public ::benchmark::Fixture
+    {
+    public:
+        static constexpr uint32_t RingBufferSize = 16 * 1024 * 1024;
+        static constexpr uint32_t AllocationsPerJob = 1024;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            m_environment.SetUp();
+            m_allocator = AZStd::make_unique<DynamicBufferAllocator>();
+            m_allocator->Init(RingBufferSize);
+            m_jobCount = aznumeric_cast<uint32_t>(state.range(0));
+        }
+
+        void TearDown([[maybe_unused]] ::benchmark::State& state) override
+        {
+            m_allocator->Shutdown();
+            m_allocator.reset();
+            m_environment.TearDown();
+        }
+
+        // Runs one frame of allocations, calling allocate() from m_jobCount jobs.
+        template<typename AllocateFunction>
+        void AllocateFrame(AllocateFunction allocate)
+        {
+            JobCompletion jobCompletion;
+            for (uint32_t jobIndex = 0; jobIndex < m_jobCount; ++jobIndex)
+            {
+                Job* job = CreateJobFunction([&allocate, jobIndex]()
+                {
+                    for (uint32_t index = 0; index < AllocationsPerJob; ++index)
+                    {
+                        // Sizes of a few vertices up to a few hundred, as used by the auxiliary geometry and the UI.
+                        const uint32_t size = 64 + ((jobIndex * 7919 + index * 104729) % 448);
+                        RHI::Ptr<DynamicBuffer> dynamicBuffer = allocate(size, 16);
+                        benchmark::DoNotOptimize(dynamicBuffer.get());
+                    }
+                }, true);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+
+            m_allocator->FrameEnd();
+        }
+
+        DynamicBufferAllocatorEnvironment m_environment;
+        AZStd::unique_ptr<DynamicBufferAllocator> m_allocator;
+        uint32_t m_jobCount = 1;
+    };
+
+    BENCHMARK_DEFINE_F(BM_DynamicBufferAllocator, Allocate)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AllocateFrame([this](uint32_t size, uint32_t alignment)
+            {
+                return m_allocator->Allocate(size, alignment);
+            });
+        }
+        state.SetItemsProcessed(state.iterations() * m_jobCount * AllocationsPerJob);
+    }
+
+    // Serializes the allocations like DynamicDrawSystem did before the allocator was lock-free, as a baseline.
+    BENCHMARK_DEFINE_F(BM_DynamicBufferAllocator, AllocateWithMutex)(benchmark::State& state)
+    {
+        AZStd::mutex mutex;
+        for (auto _ : state)
+        {
+            AllocateFrame([this, &mutex](uint32_t size, uint32_t alignment)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(mutex);
+                return m_allocator->Allocate(size, alignment);
+            });
+        }
+        state.SetItemsProcessed(state.iterations() * m_jobCount * AllocationsPerJob);
+    }
+
+    BENCHMARK_REGISTER_F(BM_DynamicBufferAllocator, Allocate)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(BM_DynamicBufferAllocator, AllocateWithMutex)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMicrosecond);
+}
+#endif
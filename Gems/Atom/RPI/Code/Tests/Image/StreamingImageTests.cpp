@@ -434,6 +434,11 @@ namespace UnitTest
         }
 
         AZ::Data::Asset<AZ::RPI::StreamingImageAsset> BuildTestImage()
+        {
+            return BuildTestImage(m_defaultPool->GetAssetId());
+        }
+
+        AZ::Data::Asset<AZ::RPI::StreamingImageAsset> BuildTestImage(const AZ::Data::AssetId& poolAssetId)
         {
             using namespace AZ;
 
@@ -460,7 +465,7 @@ namespace UnitTest
             assetCreator.AddMipChainAsset(*mipHead.Get());
             assetCreator.AddMipChainAsset(*mipMiddle.Get());
             assetCreator.AddMipChainAsset(*mipTail.Get());
-            assetCreator.SetPoolAssetId(m_defaultPool->GetAssetId());
+            assetCreator.SetPoolAssetId(poolAssetId);
 
             Data::Asset<RPI::StreamingImageAsset> imageAsset;
             EXPECT_TRUE(assetCreator.End(imageAsset));
@@ -727,4 +732,105 @@ namespace UnitTest
 
         RPI::ImageSystemInterface::Get()->Update();
     }
+
+    TEST_F(StreamingImageTests, CalculateTargetMip)
+    {
+        using namespace AZ;
+
+        EXPECT_EQ(RPI::StreamingImage::CalculateTargetMip(1024, 1024.0f, 1.0f), 0);
+        EXPECT_EQ(RPI::StreamingImage::CalculateTargetMip(1024, 4096.0f, 1.0f), 0);
+        EXPECT_EQ(RPI::StreamingImage::CalculateTargetMip(1024, 256.0f, 1.0f), 2);
+        EXPECT_EQ(RPI::StreamingImage::CalculateTargetMip(1024, 256.0f, 2.0f), 1);
+        EXPECT_EQ(RPI::StreamingImage::CalculateTargetMip(1024, 200.0f, 1.0f), 2);
+        EXPECT_EQ(RPI::StreamingImage::CalculateTargetMip(1024, 0.0f, 1.0f), RHI::Limits::Image::MipCountMax - 1);
+    }
+
+    TEST_F(StreamingImageTests, ControllerExpandsRequestedImage)
+    {
+        using namespace AZ;
+
+        auto imageSystem = RPI::ImageSystemInterface::Get();
+
+        Data::Asset<RPI::StreamingImageAsset> imageAsset = BuildTestImage();
+        Data::Instance<RPI::StreamingImage> imageInstance = RPI::StreamingImage::FindOrCreate(imageAsset);
+        const RPI::StreamingImageController* controller = imageInstance->GetPool()->GetController();
+
+        const size_t mipChainTailIndex = imageAsset->GetMipChainCount() - 1;
+        EXPECT_EQ(imageInstance->GetResidentMipLevel(), imageAsset->GetMipLevel(mipChainTailIndex));
+
+        // Requested images are expanded one mip chain per update.
+        imageInstance->SetTargetMip(0);
+        imageSystem->Update();
+        EXPECT_EQ(imageInstance->GetResidentMipLevel(), imageAsset->GetMipLevel(mipChainTailIndex - 1));
+        EXPECT_EQ(controller->GetStatistics().m_managedImageCount, 1);
+        EXPECT_EQ(controller->GetStatistics().m_expandCount, 1);
+
+        imageInstance->SetTargetMip(0);
+        imageSystem->Update();
+        EXPECT_EQ(imageInstance->GetResidentMipLevel(), 0);
+
+        // Nothing left to stream.
+        imageInstance->SetTargetMip(0);
+        imageSystem->Update();
+        EXPECT_EQ(controller->GetStatistics().m_pendingExpandCount, 0);
+        EXPECT_EQ(controller->GetStatistics().m_expandCount, 0);
+
+        // Without a budget to stay under, unrequested mips are kept.
+        imageSystem->Update();
+        EXPECT_EQ(imageInstance->GetResidentMipLevel(), 0);
+        EXPECT_EQ(controller->GetStatistics().m_trimCount, 0);
+    }
+
+    TEST_F(StreamingImageTests, ControllerStaysUnderBudget)
+    {
+        using namespace AZ;
+
+        auto imageSystem = RPI::ImageSystemInterface::Get();
+
+        // Sizes of the test image with all of its mips resident, and with everything but the most detailed mip chain.
+        const size_t fullImageSize = 43680;
+        const size_t trimmedImageSize = 10912;
+        Data::Asset<RPI::StreamingImagePoolAsset> poolAsset = BuildImagePoolAsset(fullImageSize + trimmedImageSize + 100);
+        Data::Instance<RPI::StreamingImagePool> pool = RPI::StreamingImagePool::FindOrCreate(poolAsset);
+
+        Data::Asset<RPI::StreamingImageAsset> imageAssetA = BuildTestImage(poolAsset.GetId());
+        Data::Asset<RPI::StreamingImageAsset> imageAssetB = BuildTestImage(poolAsset.GetId());
+        Data::Instance<RPI::StreamingImage> imageA = RPI::StreamingImage::FindOrCreate(imageAssetA);
+        Data::Instance<RPI::StreamingImage> imageB = RPI::StreamingImage::FindOrCreate(imageAssetB);
+        const RPI::StreamingImageController* controller = pool->GetController();
+
+        const size_t mipChainTailIndex = imageAssetA->GetMipChainCount() - 1;
+        const uint16_t tailMipLevel = static_cast<uint16_t>(imageAssetA->GetMipLevel(mipChainTailIndex));
+
+        // Stream all of A in, while B only needs its tail.
+        for (uint32_t i = 0; i < 2; ++i)
+        {
+            imageA->SetTargetMip(0);
+            imageB->SetTargetMip(tailMipLevel);
+            imageSystem->Update();
+        }
+        EXPECT_EQ(imageA->GetResidentMipLevel(), 0);
+        EXPECT_EQ(imageB->GetResidentMipLevel(), tailMipLevel);
+
+        // While A is still requested, B can't have all of its mips.
+        for (uint32_t i = 0; i < 2; ++i)
+        {
+            imageA->SetTargetMip(0);
+            imageB->SetTargetMip(0);
+            imageSystem->Update();
+        }
+        EXPECT_EQ(imageA->GetResidentMipLevel(), 0);
+        EXPECT_EQ(imageB->GetResidentMipLevel(), imageAssetB->GetMipLevel(mipChainTailIndex - 1));
+        EXPECT_EQ(controller->GetStatistics().m_deferredExpandCount, 1);
+        EXPECT_LE(controller->GetStatistics().m_residentInBytes, controller->GetStatistics().m_budgetInBytes);
+
+        // Once A isn't requested anymore, it's trimmed to make room for B.
+        imageB->SetTargetMip(0);
+        imageSystem->Update();
+        EXPECT_EQ(imageA->GetResidentMipLevel(), tailMipLevel);
+        EXPECT_EQ(imageB->GetResidentMipLevel(), 0);
+        EXPECT_EQ(controller->GetStatistics().m_trimCount, 1);
+        EXPECT_EQ(controller->GetStatistics().m_expandCount, 1);
+        EXPECT_LE(controller->GetStatistics().m_residentInBytes, controller->GetStatistics().m_budgetInBytes);
+    }
 }
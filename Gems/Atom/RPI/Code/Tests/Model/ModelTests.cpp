@@ -13,6 +13,7 @@
 #include <Atom/RPI.Reflect/Model/ModelKdTree.h>
 #include <Atom/RPI.Reflect/Model/ModelLodAsset.h>
 #include <Atom/RPI.Reflect/ResourcePoolAssetCreator.h>
+#include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/Model/UvStreamTangentBitmask.h>
 
 #include <AzCore/std/limits.h>
@@ -952,6 +953,55 @@ namespace UnitTest
         EXPECT_EQ(uvStreamTangentBitmask.GetFullTangentBitmask(), 0x70000F51);
     }
 
+    TEST_F(ModelTests, ApproxUvDensity)
+    {
+        using namespace AZ;
+
+        // A 2x2 quad, with a texture tiled 4 times across it
+        const AZStd::array<float, 12> positions = { 0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 2.0f, 0.0f, 0.0f, 2.0f, 0.0f };
+        const AZStd::array<float, 8> uvs = { 0.0f, 0.0f, 4.0f, 0.0f, 4.0f, 4.0f, 0.0f, 4.0f };
+        const AZStd::array<uint32_t, 6> indices = { 0, 1, 2, 0, 2, 3 };
+
+        const auto buildLod = [&](bool withUvs)
+        {
+            RPI::ModelLodAssetCreator creator;
+            creator.Begin(Data::AssetId(Uuid::CreateRandom()));
+            creator.BeginMesh();
+            creator.SetMeshAabb(Aabb::CreateFromMinMax(Vector3::CreateZero(), Vector3(2.0f, 2.0f, 0.0f)));
+
+            Data::Asset<RPI::BufferAsset> indexBuffer = BuildTestBuffer(static_cast<uint32_t>(indices.size()), sizeof(uint32_t));
+            AZStd::copy(indices.begin(), indices.end(), reinterpret_cast<uint32_t*>(const_cast<uint8_t*>(indexBuffer->GetBuffer().data())));
+            creator.SetMeshIndexBuffer({ indexBuffer, RHI::BufferViewDescriptor::CreateStructured(0, 6, sizeof(uint32_t)) });
+
+            Data::Asset<RPI::BufferAsset> positionBuffer = BuildTestBuffer(4, sizeof(float) * 3);
+            AZStd::copy(positions.begin(), positions.end(), reinterpret_cast<float*>(const_cast<uint8_t*>(positionBuffer->GetBuffer().data())));
+            creator.AddMeshStreamBuffer(
+                RHI::ShaderSemantic(Name("POSITION")), Name(), { positionBuffer, RHI::BufferViewDescriptor::CreateStructured(0, 4, sizeof(float) * 3) });
+
+            if (withUvs)
+            {
+                Data::Asset<RPI::BufferAsset> uvBuffer = BuildTestBuffer(4, sizeof(float) * 2);
+                AZStd::copy(uvs.begin(), uvs.end(), reinterpret_cast<float*>(const_cast<uint8_t*>(uvBuffer->GetBuffer().data())));
+                creator.AddMeshStreamBuffer(
+                    RHI::ShaderSemantic(Name("UV")), Name(), { uvBuffer, RHI::BufferViewDescriptor::CreateStructured(0, 4, sizeof(float) * 2) });
+            }
+            creator.EndMesh();
+
+            Data::Asset<RPI::ModelLodAsset> lodAsset;
+            EXPECT_TRUE(creator.End(lodAsset));
+            return lodAsset;
+        };
+
+        // 16 texture areas over 4 units of area, so the texture repeats twice along each unit of length
+        Data::Asset<RPI::ModelLodAsset> lodAsset = buildLod(true);
+        ASSERT_EQ(lodAsset->GetMeshes().size(), 1u);
+        EXPECT_FLOAT_EQ(RPI::ModelLodUtils::ApproxUvDensity(lodAsset->GetMeshes()[0]), 2.0f);
+
+        lodAsset = buildLod(false);
+        ASSERT_EQ(lodAsset->GetMeshes().size(), 1u);
+        EXPECT_EQ(RPI::ModelLodUtils::ApproxUvDensity(lodAsset->GetMeshes()[0]), 0.0f);
+    }
+
     //
     //   +----+
     //  /    /|
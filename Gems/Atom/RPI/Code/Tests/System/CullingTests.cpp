@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Model/ModelLodUtils.h>
+
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Common/RPITestFixture.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    namespace
+    {
+        Frustum CreateTestFrustum(float angle)
+        {
+            const Matrix4x4 viewToClip = Matrix4x4::CreateProjection(Constants::HalfPi, 16.0f / 9.0f, 0.1f, 1000.0f);
+            const Matrix4x4 worldToView = Matrix4x4::CreateRotationY(angle);
+            return Frustum::CreateFromMatrixColumnMajor(viewToClip * worldToView);
+        }
+
+        Sphere CreateRandomSphere(SimpleLcgRandom& random, float extent)
+        {
+            const Vector3 center(
+                (random.GetRandomFloat() * 2.0f - 1.0f) * extent,
+                (random.GetRandomFloat() * 2.0f - 1.0f) * extent,
+                (random.GetRandomFloat() * 2.0f - 1.0f) * extent);
+            return Sphere(center, 0.5f + random.GetRandomFloat() * 20.0f);
+        }
+    }
+
+    class CullingTests
+        : public RPITestFixture
+    {
+    };
+
+    TEST_F(CullingTests, CullableBoundsBatch_ClassifySpheres_MatchesFrustumIntersectSphere)
+    {
+        SimpleLcgRandom random;
+        const Frustum frustum = CreateTestFrustum(0.3f);
+
+        // Leave the last SIMD vector partially filled
+        const uint32_t count = CullableBoundsBatch::Capacity - 3;
+
+        CullableBoundsBatch batch;
+        Sphere spheres[CullableBoundsBatch::Capacity];
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            spheres[index] = CreateRandomSphere(random, 200.0f);
+            EXPECT_EQ(index, batch.Add(spheres[index], spheres[index].GetRadius()));
+        }
+        EXPECT_EQ(count, batch.GetCount());
+
+        IntersectResult results[CullableBoundsBatch::Capacity];
+        batch.ClassifySpheres(frustum, results);
+
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            EXPECT_EQ(frustum.IntersectSphere(spheres[index]), results[index]);
+        }
+    }
+
+    TEST_F(CullingTests, CullableBoundsBatch_ApproxScreenPercentages_MatchesModelLodUtils)
+    {
+        SimpleLcgRandom random;
+        const Vector3 cameraPosition(1.0f, 2.0f, 3.0f);
+        const float yScale = 1.5f;
+
+        const uint32_t count = 10;
+
+        CullableBoundsBatch batch;
+        Sphere spheres[count];
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            spheres[index] = CreateRandomSphere(random, 200.0f);
+            batch.Add(spheres[index], spheres[index].GetRadius() * 0.5f);
+        }
+
+        for (bool isPerspective : { true, false })
+        {
+            float screenPercentages[CullableBoundsBatch::Capacity];
+            batch.ApproxScreenPercentages(cameraPosition, yScale, isPerspective, screenPercentages);
+
+            for (uint32_t index = 0; index < count; ++index)
+            {
+                const float expected = ModelLodUtils::ApproxScreenPercentage(
+                    spheres[index].GetCenter(), spheres[index].GetRadius() * 0.5f, cameraPosition, yScale, isPerspective);
+                EXPECT_NEAR(expected, screenPercentages[index], 1.0e-5f);
+            }
+        }
+    }
+
+    TEST_F(CullingTests, CullableBoundsBatch_Clear_Empties)
+    {
+        CullableBoundsBatch batch;
+        for (uint32_t index = 0; index < CullableBoundsBatch::Capacity; ++index)
+        {
+            batch.Add(Sphere(Vector3::CreateZero(), 1.0f), 1.0f);
+        }
+        EXPECT_TRUE(batch.IsFull());
+
+        batch.Clear();
+        EXPECT_EQ(0, batch.GetCount());
+        EXPECT_FALSE(batch.IsFull());
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    //! Culls 200k cullables against 8 views, comparing one cullable at a time against the batched SIMD kernels.
+    //! Only the CPU is involved, so this runs under the stub RHI of the tests.
+    class BM_Culling
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t CullableCount = 200000;
+        static constexpr uint32_t ViewCount = 8;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            const Matrix4x4 viewToClip = Matrix4x4::CreateProjection(Constants::HalfPi, 16.0f / 9.0f, 0.1f, 1000.0f);
+            m_yScale = viewToClip.GetElement(1, 1);
+            for (uint32_t viewIndex = 0; viewIndex < ViewCount; ++viewIndex)
+            {
+                const Matrix4x4 worldToView = Matrix4x4::CreateRotationY(viewIndex * Constants::TwoPi / ViewCount);
+                m_frustums[viewIndex] = Frustum::CreateFromMatrixColumnMajor(viewToClip * worldToView);
+            }
+
+            SimpleLcgRandom random;
+            m_spheres.reserve(CullableCount);
+            m_batches.resize((CullableCount + CullableBoundsBatch::Capacity - 1) / CullableBoundsBatch::Capacity);
+            for (uint32_t index = 0; index < CullableCount; ++index)
+            {
+                const Vector3 center(
+                    (random.GetRandomFloat() * 2.0f - 1.0f) * 500.0f,
+                    (random.GetRandomFloat() * 2.0f - 1.0f) * 500.0f,
+                    (random.GetRandomFloat() * 2.0f - 1.0f) * 500.0f);
+                m_spheres.emplace_back(center, 0.5f + random.GetRandomFloat() * 10.0f);
+                m_batches[index / CullableBoundsBatch::Capacity].Add(m_spheres.back(), m_spheres.back().GetRadius() * 0.5f);
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_spheres = {};
+            m_batches = {};
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        Frustum m_frustums[ViewCount];
+        float m_yScale = 1.0f;
+        AZStd::vector<Sphere> m_spheres;
+        AZStd::vector<CullableBoundsBatch> m_batches;
+    };
+
+    BENCHMARK_F(BM_Culling, Scalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            uint32_t numVisible = 0;
+            float totalScreenPercentage = 0.0f;
+            for (const Frustum& frustum : m_frustums)
+            {
+                for (const Sphere& sphere : m_spheres)
+                {
+                    if (frustum.IntersectSphere(sphere) != IntersectResult::Exterior)
+                    {
+                        ++numVisible;
+                        totalScreenPercentage += ModelLodUtils::ApproxScreenPercentage(
+                            sphere.GetCenter(), sphere.GetRadius() * 0.5f, Vector3::CreateZero(), m_yScale, true);
+                    }
+                }
+            }
+            benchmark::DoNotOptimize(numVisible);
+            benchmark::DoNotOptimize(totalScreenPercentage);
+        }
+        state.SetItemsProcessed(state.iterations() * CullableCount * ViewCount);
+    }
+
+    BENCHMARK_F(BM_Culling, Batched)(benchmark::State& state)
+    {
+        IntersectResult results[CullableBoundsBatch::Capacity];
+        float screenPercentages[CullableBoundsBatch::Capacity];
+
+        for (auto _ : state)
+        {
+            uint32_t numVisible = 0;
+            float totalScreenPercentage = 0.0f;
+            for (const Frustum& frustum : m_frustums)
+            {
+                for (const CullableBoundsBatch& batch : m_batches)
+                {
+                    batch.ClassifySpheres(frustum, results);
+                    batch.ApproxScreenPercentages(Vector3::CreateZero(), m_yScale, true, screenPercentages);
+                    for (uint32_t index = 0; index < batch.GetCount(); ++index)
+                    {
+                        if (results[index] != IntersectResult::Exterior)
+                        {
+                            ++numVisible;
+                            totalScreenPercentage += screenPercentages[index];
+                        }
+                    }
+                }
+            }
+            benchmark::DoNotOptimize(numVisible);
+            benchmark::DoNotOptimize(totalScreenPercentage);
+        }
+        state.SetItemsProcessed(state.iterations() * CullableCount * ViewCount);
+    }
+}
+#endif
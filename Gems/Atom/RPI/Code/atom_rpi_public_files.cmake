@@ -80,6 +80,7 @@ set(FILES
     Include/Atom/RPI.Public/Pass/Specific/RenderToTexturePass.h
     Include/Atom/RPI.Public/Pass/Specific/SelectorPass.h
     Include/Atom/RPI.Public/Pass/Specific/SwapChainPass.h
+    Include/Atom/RPI.Public/Shader/PipelineStateLog.h
     Include/Atom/RPI.Public/Shader/Shader.h
     Include/Atom/RPI.Public/Shader/ShaderReloadNotificationBus.h
     Include/Atom/RPI.Public/Shader/ShaderVariant.h
@@ -156,6 +157,7 @@ set(FILES
     Source/RPI.Public/Pass/Specific/RenderToTexturePass.cpp
     Source/RPI.Public/Pass/Specific/SelectorPass.cpp
     Source/RPI.Public/Pass/Specific/SwapChainPass.cpp
+    Source/RPI.Public/Shader/PipelineStateLog.cpp
     Source/RPI.Public/Shader/Shader.cpp
     Source/RPI.Public/Shader/ShaderVariant.cpp
     Source/RPI.Public/Shader/ShaderReloadDebugTracker.cpp
@@ -168,6 +168,17 @@ namespace AZ
                     ShowRow(queueStatistics.m_queueName.GetCStr(), queueStatistics.m_executeDuration);
                 }
 
+                const auto ShowCountRow = [](const char* regionLabel, uint32_t count)
+                {
+                    ImGui::Text("%s", regionLabel);
+                    ImGui::NextColumn();
+                    ImGui::Text("%u", count);
+                    ImGui::NextColumn();
+                };
+
+                ShowCountRow("SRGs Compiled", cpuTimingStatistics.m_shaderResourceGroupCompileCount);
+                ShowCountRow("SRGs Skipped (Unchanged)", cpuTimingStatistics.m_shaderResourceGroupSkipCount);
+
                 ImGui::Separator();
                 ImGui::Columns(1, "view", false);
 
@@ -12,6 +12,7 @@
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/DataStructures/FixedSizeBitsetView.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <Multiplayer/NetworkTime/RewindableObject.h>
 #include <Multiplayer/MultiplayerStats.h>
 #include <Multiplayer/MultiplayerTypes.h>
 #include <Multiplayer/IMultiplayer.h>
@@ -102,15 +103,28 @@ namespace Multiplayer
         return GetEntity()->FindComponent<ComponentType>();
     }
 
-    template <typename TYPE>
-    inline void SerializeNetworkPropertyHelper
+    //! Serializes a network property through a quantizer.
+    template <typename TYPE, typename QUANTIZER>
+    inline bool SerializeQuantizedValue(AzNetworking::ISerializer& serializer, TYPE& value, const QUANTIZER& quantizer, const char* name)
+    {
+        return quantizer.Serialize(serializer, value, name);
+    }
+
+    //! Serializes the current value of a rewindable network property through a quantizer.
+    template <typename TYPE, AZStd::size_t REWIND_SIZE, typename QUANTIZER>
+    inline bool SerializeQuantizedValue(AzNetworking::ISerializer& serializer, RewindableObject<TYPE, REWIND_SIZE>& value, const QUANTIZER& quantizer, const char* name)
+    {
+        return value.SerializeQuantized(serializer, quantizer, name);
+    }
+
+    template <typename SERIALIZE_FUNCTION>
+    inline void SerializeNetworkPropertyHelperImpl
     (
         AzNetworking::ISerializer& serializer, 
         bool modifyRecord, 
         AzNetworking::FixedSizeBitsetView& bitset, 
         int32_t bitIndex, 
-        TYPE& value, 
-        const char* name, 
+        const SERIALIZE_FUNCTION& serializeValue, 
         NetComponentId componentId, 
         PropertyIndex propertyIndex, 
         MultiplayerStats& stats
@@ -120,7 +134,7 @@ namespace Multiplayer
         {
             const uint32_t prevUpdateSize = serializer.GetSize();
             serializer.ClearTrackedChangesFlag();
-            serializer.Serialize(value, name);
+            serializeValue();
             if (modifyRecord && !serializer.GetTrackedChangesFlag())
             {
                 // If the serializer didn't change any values, then lower the flag so we don't unnecessarily notify
@@ -142,4 +156,43 @@ namespace Multiplayer
             }
         }
     }
+
+    template <typename TYPE>
+    inline void SerializeNetworkPropertyHelper
+    (
+        AzNetworking::ISerializer& serializer, 
+        bool modifyRecord, 
+        AzNetworking::FixedSizeBitsetView& bitset, 
+        int32_t bitIndex, 
+        TYPE& value, 
+        const char* name, 
+        NetComponentId componentId, 
+        PropertyIndex propertyIndex, 
+        MultiplayerStats& stats
+    )
+    {
+        SerializeNetworkPropertyHelperImpl(serializer, modifyRecord, bitset, bitIndex,
+            [&serializer, &value, name]() { serializer.Serialize(value, name); }, componentId, propertyIndex, stats);
+    }
+
+    //! Serializes a network property declared with a quantization spec, the quantizer packs all of the property's elements
+    //! into a few integral chunks rather than visiting each element with the serializer.
+    template <typename TYPE, typename QUANTIZER>
+    inline void SerializeQuantizedNetworkPropertyHelper
+    (
+        AzNetworking::ISerializer& serializer, 
+        bool modifyRecord, 
+        AzNetworking::FixedSizeBitsetView& bitset, 
+        int32_t bitIndex, 
+        TYPE& value, 
+        const QUANTIZER& quantizer, 
+        const char* name, 
+        NetComponentId componentId, 
+        PropertyIndex propertyIndex, 
+        MultiplayerStats& stats
+    )
+    {
+        SerializeNetworkPropertyHelperImpl(serializer, modifyRecord, bitset, bitIndex,
+            [&serializer, &value, &quantizer, name]() { SerializeQuantizedValue(serializer, value, quantizer, name); }, componentId, propertyIndex, stats);
+    }
 }
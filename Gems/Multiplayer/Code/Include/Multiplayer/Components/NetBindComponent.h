@@ -17,6 +17,7 @@
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/SerializedDeltaCache.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/NetworkInput/IMultiplayerComponentInput.h>
 #include <Multiplayer/NetworkTime/INetworkTime.h>
@@ -125,6 +126,10 @@ namespace Multiplayer
         void FillReplicationRecord(ReplicationRecord& replicationRecord) const;
         void FillTotalReplicationRecord(ReplicationRecord& replicationRecord) const;
 
+        //! Returns the entity's serialized deltas shared between connections, valid until the entity next changes.
+        //! @return the entity's serialized deltas shared between connections
+        SerializedDeltaCache& GetSerializedDeltaCache();
+
     private:
         void PreInit(AZ::Entity* entity, const PrefabEntityId& prefabEntityId, NetEntityId netEntityId, NetEntityRole netEntityRole);
 
@@ -148,6 +153,7 @@ namespace Multiplayer
         ReplicationRecord m_totalRecord = NetEntityRole::InvalidRole;
         ReplicationRecord m_predictableRecord = NetEntityRole::Autonomous;
         ReplicationRecord m_localNotificationRecord = NetEntityRole::InvalidRole;
+        SerializedDeltaCache m_serializedDeltaCache;
         PrefabEntityId    m_prefabEntityId;
         AZStd::unordered_map<NetComponentId, MultiplayerComponent*> m_multiplayerComponentMap;
         AZStd::vector<MultiplayerComponent*> m_multiplayerSerializationComponentVector;
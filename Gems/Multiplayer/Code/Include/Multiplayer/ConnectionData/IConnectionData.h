@@ -40,9 +40,21 @@ namespace Multiplayer
         virtual EntityReplicationManager& GetReplicationManager() = 0;
 
         //! Creates and manages sending updates to the remote endpoint.
+        //! Equivalent to ActivatePendingEntities, followed by GatherUpdates and SendGatheredUpdates.
         //! @param hostTimeMs current server game time in milliseconds
         virtual void Update(AZ::TimeMs hostTimeMs) = 0;
 
+        //! Activates entities received from the remote endpoint, must be called from the main thread.
+        virtual void ActivatePendingEntities() = 0;
+
+        //! Serializes this tick's updates to the remote endpoint without sending them.
+        //! Safe to call for different connections in parallel, provided entity state does not change until all have completed.
+        //! @param hostTimeMs current server game time in milliseconds
+        virtual void GatherUpdates(AZ::TimeMs hostTimeMs) = 0;
+
+        //! Sends the updates serialized by GatherUpdates, must be called from the main thread.
+        virtual void SendGatheredUpdates() = 0;
+
         //! Returns whether update messages can be sent to the connection.
         //! @return true if update messages can be sent
         virtual bool CanSendUpdates() const = 0;
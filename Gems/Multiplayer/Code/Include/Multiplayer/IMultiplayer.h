@@ -15,6 +15,7 @@
 #include <Multiplayer/Components/MultiplayerComponentRegistry.h>
 #include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
 #include <Multiplayer/NetworkTime/INetworkTime.h>
+#include <Multiplayer/ReplicationWindows/ReplicationPriority.h>
 #include <Multiplayer/MultiplayerStats.h>
 
 namespace AzNetworking
@@ -139,6 +140,11 @@ namespace Multiplayer
         //! @return pointer to the user-defined filtering manager of entities. By default, this isn't set and returns nullptr.
         virtual IFilterEntityManager* GetFilterEntityManager() = 0;
 
+        //! Sets a user-defined function to prioritize entities for replication to each client connection.
+        //! Replaces the built-in priority selected by sv_ReplicationPriority, see ReplicationPriorityFunction for details.
+        //! @param priorityFunction the priority function to use, an empty function restores the built-in priority
+        virtual void SetReplicationPriorityFunction(ReplicationPriorityFunction priorityFunction) = 0;
+
         //! Retrieve the stats object bound to this multiplayer instance.
         //! @return the stats object bound to this multiplayer instance
         MultiplayerStats& GetStats() { return m_stats; }
@@ -11,6 +11,8 @@
 #include <AzCore/Time/ITime.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
 namespace AzNetworking
@@ -49,11 +51,42 @@ namespace Multiplayer
         };
         AZStd::vector<ComponentStats> m_componentStats;
 
+        //! A single property update recorded as sent, captured so the stats of a shared serialization can be replayed.
+        struct PropertySent
+        {
+            NetComponentId m_netComponentId = InvalidNetComponentId;
+            PropertyIndex m_propertyIndex = PropertyIndex{ 0 };
+            uint32_t m_totalBytes = 0;
+        };
+        using PropertySentList = AZStd::vector<PropertySent>;
+
+        //! Entity update bandwidth budget of a single connection.
+        struct ConnectionBudgetStats
+        {
+            ConnectionBudgetStats();
+            uint64_t m_budgetBytesPerSecond = 0; //!< Zero if entity updates to the connection are not budgeted
+            uint64_t m_totalBytesSent = 0;
+            uint64_t m_totalDeferredUpdates = 0; //!< Entity updates held back to a later tick by the budget
+            MetricRingbuffer m_byteHistory;
+            MetricRingbuffer m_deferredHistory;
+        };
+        AZStd::unordered_map<AzNetworking::ConnectionId, ConnectionBudgetStats> m_connectionBudgetStats;
+
         void ReserveComponentStats(NetComponentId netComponentId, uint16_t propertyCount, uint16_t rpcCount);
         void RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
+        void RecordPropertiesSent(const PropertySentList& propertiesSent);
+        //! While a capture list is set, every property recorded as sent on the calling thread is also appended to it.
+        //! @param capture the list to append to, or nullptr to stop capturing
+        void SetPropertySentCapture(PropertySentList* capture);
+        //! While a deferral list is set, properties recorded as sent on the calling thread are appended to it instead of being
+        //! recorded. Replication jobs use this to leave the stats untouched, the deferred list is recorded on the main thread.
+        //! @param deferral the list to append to, or nullptr to record properties immediately
+        void SetPropertySentDeferral(PropertySentList* deferral);
         void RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
         void RecordRpcSent(NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordRpcReceived(NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
+        void RecordEntityUpdatesSent(AzNetworking::ConnectionId connectionId, uint64_t budgetBytesPerSecond, uint32_t totalBytes, uint32_t deferredUpdates);
+        void RemoveConnectionStats(AzNetworking::ConnectionId connectionId);
         void TickStats(AZ::TimeMs metricFrameTimeMs);
 
         Metric CalculateComponentPropertyUpdateSentMetrics(NetComponentId netComponentId) const;
@@ -64,5 +97,10 @@ namespace Multiplayer
         Metric CalculateTotalPropertyUpdateRecvMetrics() const;
         Metric CalculateTotalRpcsSentMetrics() const;
         Metric CalculateTotalRpcsRecvMetrics() const;
+
+        //! Returns the fraction of a connection's entity update budget used over the stats history.
+        //! @param connectionId the connection to return the budget utilization of
+        //! @return the fraction of the budget used, or zero if the connection is not budgeted
+        float CalculateConnectionBudgetUtilization(AzNetworking::ConnectionId connectionId) const;
     };
 }
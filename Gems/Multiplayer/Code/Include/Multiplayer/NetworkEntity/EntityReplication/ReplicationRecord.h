@@ -55,6 +55,12 @@ namespace Multiplayer
         void Subtract(const ReplicationRecord &rhs);
         bool HasChanges() const;
 
+        //! Returns true if both records are for the same remote role and mark the same properties as changed.
+        //! Consumed bits and the sent packet id are not compared.
+        //! @param rhs the record to compare against
+        //! @return boolean true if both records would serialize the same properties
+        bool HasSameChanges(const ReplicationRecord& rhs) const;
+
         bool Serialize(AzNetworking::ISerializer& serializer);
 
         void ConsumeAuthorityToClientBits(uint32_t consumedBits);
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerStats.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace Multiplayer
+{
+    //! @class SerializedDeltaCache
+    //! @brief Serialized entity deltas shared by all connections that send an entity the same changes.
+    //!
+    //! A serialized delta depends only on which properties the pending replication record marks and on the entity's
+    //! current state. Connections that have acknowledged the same updates therefore produce identical bytes. The first of
+    //! them serializes the delta and later ones copy it, so serialization cost scales with entities rather than with
+    //! entities times connections. Only connections with a divergent set of unacknowledged changes serialize their own.
+    //! The owning NetBindComponent invalidates the cache whenever any of the entity's network properties change.
+    //! Connections may be serialized from parallel jobs, so every access is guarded by a lock.
+    class SerializedDeltaCache
+    {
+    public:
+
+        //! Maximum number of distinct deltas cached for an entity between invalidations.
+        static constexpr uint32_t MaxDeltas = 4;
+
+        struct Delta
+        {
+            ReplicationRecord m_record;
+            AZStd::vector<uint8_t> m_data;
+            MultiplayerStats::PropertySentList m_propertiesSent;
+        };
+
+        //! Writes the delta of the given record to a serializer. The delta is copied if another connection already serialized it,
+        //! otherwise it is serialized by the provided function and cached along with the properties it records as sent.
+        //! @param record         the pending replication record to serialize the delta of
+        //! @param serializer     the serializer to write the delta to
+        //! @param stats          the stats to record the properties sent to
+        //! @param serializeDelta function serializing the record and the entity state it marks, given the serializer
+        //! @return boolean true if the delta fit in the serializer
+        template <typename SERIALIZE_FUNCTION>
+        bool Serialize(const ReplicationRecord& record, AzNetworking::NetworkInputSerializer& serializer, MultiplayerStats& stats, SERIALIZE_FUNCTION&& serializeDelta);
+
+        //! Copies the delta cached for the given record to a serializer, and records the stats of the properties it contains.
+        //! @param record     the pending replication record to find the delta of
+        //! @param serializer the serializer to copy the cached delta to
+        //! @param stats      the stats to record the properties sent to
+        //! @return boolean true if a delta was cached and copied, false if this record has not been serialized since the last invalidation
+        bool CopyTo(const ReplicationRecord& record, AzNetworking::NetworkInputSerializer& serializer, MultiplayerStats& stats) const;
+
+        //! Caches a serialized delta for the given record, unless the cache is full or another connection stored it first.
+        //! @param record         the pending replication record that was serialized
+        //! @param data           the serialized delta
+        //! @param size           the size of the serialized delta in bytes
+        //! @param propertiesSent the properties recorded as sent while serializing the delta
+        void Store(const ReplicationRecord& record, const uint8_t* data, uint32_t size, MultiplayerStats::PropertySentList&& propertiesSent);
+
+        //! Discards all cached deltas, must be called whenever the entity's state changes.
+        void Invalidate();
+
+    private:
+
+        const Delta* FindInternal(const ReplicationRecord& record) const;
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::vector<Delta> m_deltas;
+        uint32_t m_deltaCount = 0;
+    };
+}
+
+#include <Multiplayer/NetworkEntity/EntityReplication/SerializedDeltaCache.inl>
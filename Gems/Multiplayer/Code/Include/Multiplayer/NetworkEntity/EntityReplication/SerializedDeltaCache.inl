@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace Multiplayer
+{
+    template <typename SERIALIZE_FUNCTION>
+    inline bool SerializedDeltaCache::Serialize(const ReplicationRecord& record, AzNetworking::NetworkInputSerializer& serializer, MultiplayerStats& stats, SERIALIZE_FUNCTION&& serializeDelta)
+    {
+        if (CopyTo(record, serializer, stats))
+        {
+            return serializer.IsValid();
+        }
+
+        MultiplayerStats::PropertySentList propertiesSent;
+        const uint32_t startSize = serializer.GetSize();
+        stats.SetPropertySentCapture(&propertiesSent);
+        serializeDelta(serializer);
+        stats.SetPropertySentCapture(nullptr);
+
+        // A delta that did not fit in this packet is not complete, so nobody may reuse it
+        if (serializer.IsValid())
+        {
+            Store(record, serializer.GetBuffer() + startSize, serializer.GetSize() - startSize, AZStd::move(propertiesSent));
+        }
+        return serializer.IsValid();
+    }
+}
@@ -39,6 +39,7 @@ namespace Multiplayer
         //! Return true if a given entity should be filtered out, false otherwise.
         //! Important: this method is a hot code path, it will be called over all entities around each player frequently.
         //! Ideally, this method should be implemented as a quick look up.
+        //! When sv_ReplicationWindowParallelUpdate is enabled (it is off by default), it is called concurrently from job threads for different players.
         //!
         //! @param entity the entity to be considered for filtering
         //! @param controllerEntity player's entity for the associated connection
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/vector.h>
+#include <Multiplayer/MultiplayerTypes.h>
+
+namespace Multiplayer
+{
+    //! An entity hit by a rewound raycast.
+    struct RewindRaycastHit
+    {
+        NetEntityId m_netEntityId = InvalidNetEntityId;
+        float m_distance = 0.0f; //!< Distance from the start of the ray to where it enters the entity's bounds
+    };
+    using RewindRaycastHits = AZStd::vector<RewindRaycastHit>;
+    using RewindOverlapHits = AZStd::vector<NetEntityId>;
+
+    //! @class IRewindHistory
+    //! @brief This is an AZ::Interface<> for lag compensated queries against the recorded state of past host frames.
+    //!
+    //! While sv_RewindHistory is enabled, the server records the transform and world bounds of every entity with a
+    //! NetworkTransformComponent at the end of each host frame. It is off by default, as recording walks every entity each frame.
+    //! Queries test against the state of the requested frame directly, so unlike SyncEntitiesToRewindState they neither alter
+    //! time nor touch entities, and any number of queries may run from several threads at once. Queries test entity bounds
+    //! rather than physics shapes, callers needing exact hits should refine the results with a rewound physics query.
+    class IRewindHistory
+    {
+    public:
+        AZ_RTTI(IRewindHistory, "{2C8B6A4E-7F31-4D0B-9E5A-1B63D8F4C720}");
+
+        IRewindHistory() = default;
+        virtual ~IRewindHistory() = default;
+
+        //! Returns whether the state of a host frame is still held in the history.
+        //! @param frameId the host frame to check for
+        //! @return boolean true if the frame can be queried
+        virtual bool IsFrameRecorded(HostFrameId frameId) const = 0;
+
+        //! Retrieves the recorded state of a single entity.
+        //! @param frameId      the host frame to retrieve the state at
+        //! @param netEntityId  the entity to retrieve the state of
+        //! @param outTransform receives the entity's world transform at the frame
+        //! @param outBounds    receives the entity's world bounds at the frame
+        //! @return boolean true if the entity was recorded at the frame
+        virtual bool GetEntityState(HostFrameId frameId, NetEntityId netEntityId, AZ::Transform& outTransform, AZ::Aabb& outBounds) const = 0;
+
+        //! Finds every entity whose bounds a line segment passed through at a host frame.
+        //! @param frameId    the host frame to test against
+        //! @param start      start of the segment
+        //! @param end        end of the segment
+        //! @param outHits    receives the entities hit, ordered by ascending distance
+        //! @return boolean true if the frame was recorded, false if it is too old or has not yet happened
+        virtual bool Raycast(HostFrameId frameId, const AZ::Vector3& start, const AZ::Vector3& end, RewindRaycastHits& outHits) const = 0;
+
+        //! Finds every entity whose bounds overlapped a volume at a host frame.
+        //! @param frameId    the host frame to test against
+        //! @param volume     the volume to test
+        //! @param outHits    receives the entities overlapping the volume
+        //! @return boolean true if the frame was recorded, false if it is too old or has not yet happened
+        virtual bool OverlapAabb(HostFrameId frameId, const AZ::Aabb& volume, RewindOverlapHits& outHits) const = 0;
+
+        //! Finds every entity whose bounds overlapped a sphere at a host frame.
+        //! @param frameId    the host frame to test against
+        //! @param center     center of the sphere
+        //! @param radius     radius of the sphere
+        //! @param outHits    receives the entities overlapping the sphere
+        //! @return boolean true if the frame was recorded, false if it is too old or has not yet happened
+        virtual bool OverlapSphere(HostFrameId frameId, const AZ::Vector3& center, float radius, RewindOverlapHits& outHits) const = 0;
+
+        AZ_DISABLE_COPY_MOVE(IRewindHistory);
+    };
+
+    // Convenience helpers
+    inline IRewindHistory* GetRewindHistory()
+    {
+        return AZ::Interface<IRewindHistory>::Get();
+    }
+}
@@ -79,6 +79,14 @@ namespace Multiplayer
         //! @return boolean true for success, false for serialization failure
         bool Serialize(AzNetworking::ISerializer& serializer);
 
+        //! Serializes the value for the current time through a quantizer, such as AzNetworking::QuantizedRange.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @param quantizer  quantizer providing Serialize(ISerializer&, BASE_TYPE&, const char*)
+        //! @param name       the name of the value
+        //! @return boolean true for success, false for serialization failure
+        template <typename QUANTIZER>
+        bool SerializeQuantized(AzNetworking::ISerializer& serializer, const QUANTIZER& quantizer, const char* name);
+
     private:
 
         //! Returns what the appropriate current time is for this rewindable property.
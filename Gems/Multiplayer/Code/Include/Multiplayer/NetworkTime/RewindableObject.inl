@@ -108,6 +108,19 @@ namespace Multiplayer
         return serializer.IsValid();
     }
 
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    template <typename QUANTIZER>
+    inline bool RewindableObject<BASE_TYPE, REWIND_SIZE>::SerializeQuantized(AzNetworking::ISerializer& serializer, const QUANTIZER& quantizer, const char* name)
+    {
+        const HostFrameId frameTime = GetCurrentTimeForProperty();
+        BASE_TYPE value = GetValueForTime(frameTime);
+        if (quantizer.Serialize(serializer, value, name) && (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject))
+        {
+            SetValueForTime(value, frameTime);
+        }
+        return serializer.IsValid();
+    }
+
     template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
     inline HostFrameId RewindableObject<BASE_TYPE, REWIND_SIZE>::GetCurrentTimeForProperty() const
     {
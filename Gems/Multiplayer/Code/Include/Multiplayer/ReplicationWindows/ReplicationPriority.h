@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/functional.h>
+
+namespace Multiplayer
+{
+    //! Everything a replication priority function may take into account when ranking an entity for a single client.
+    struct ReplicationPriorityContext
+    {
+        AZ::Vector3 m_viewerPosition = AZ::Vector3::CreateZero(); //!< World position of the client's controlled entity
+        AZ::Vector3 m_viewerForward = AZ::Vector3::CreateAxisY(); //!< World forward axis of the client's controlled entity
+        AZ::Vector3 m_closestPosition = AZ::Vector3::CreateZero(); //!< Point on the candidate's bounds nearest to the viewer
+        float m_distanceSquared = 0.0f; //!< Squared distance between m_viewerPosition and m_closestPosition
+        AZ::TimeMs m_timeSinceReplicatedMs = AZ::TimeMs{ 0 }; //!< Time since the candidate was last part of this client's replication set
+    };
+
+    //! Ranks an entity for replication to a client, entities with the highest priorities are replicated first.
+    //! Priority functions are invoked from job threads when replication windows are updated in parallel, so they must not
+    //! modify shared state.
+    using ReplicationPriorityFunction = AZStd::function<float(const ReplicationPriorityContext& context)>;
+
+    //! Inverse squared distance, the default priority.
+    float DistanceReplicationPriority(const ReplicationPriorityContext& context);
+
+    //! Inverse squared distance, scaled down for entities behind the viewer.
+    float ViewConeReplicationPriority(const ReplicationPriorityContext& context);
+
+    //! Inverse squared distance, scaled up the longer an entity has gone without being replicated so distant entities are not starved.
+    float RecencyReplicationPriority(const ReplicationPriorityContext& context);
+}
@@ -356,6 +356,7 @@ namespace Multiplayer
 
     void NetBindComponent::MarkDirty()
     {
+        m_serializedDeltaCache.Invalidate();
         if (!m_handleMarkedDirty.IsConnected())
         {
             GetNetworkEntityManager()->AddEntityMarkedDirtyHandler(m_handleMarkedDirty);
@@ -472,6 +473,11 @@ namespace Multiplayer
         }
     }
 
+    SerializedDeltaCache& NetBindComponent::GetSerializedDeltaCache()
+    {
+        return m_serializedDeltaCache;
+    }
+
     void NetBindComponent::FillTotalReplicationRecord(ReplicationRecord& replicationRecord) const
     {
         replicationRecord.Append(m_totalRecord);
@@ -615,6 +621,7 @@ namespace Multiplayer
             component->NetworkAttach(this, m_currentRecord, m_predictableRecord);
         }
         m_totalRecord = m_currentRecord;
+        m_serializedDeltaCache.Invalidate();
     }
 
     void NetBindComponent::HandleMarkedDirty()
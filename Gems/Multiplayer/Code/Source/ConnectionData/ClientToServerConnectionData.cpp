@@ -49,8 +49,24 @@ namespace Multiplayer
     }
 
     void ClientToServerConnectionData::Update(AZ::TimeMs hostTimeMs)
+    {
+        ActivatePendingEntities();
+        GatherUpdates(hostTimeMs);
+        SendGatheredUpdates();
+    }
+
+    void ClientToServerConnectionData::ActivatePendingEntities()
     {
         m_entityReplicationManager.ActivatePendingEntities();
-        m_entityReplicationManager.SendUpdates(hostTimeMs);
+    }
+
+    void ClientToServerConnectionData::GatherUpdates(AZ::TimeMs hostTimeMs)
+    {
+        m_entityReplicationManager.GatherUpdates(hostTimeMs);
+    }
+
+    void ClientToServerConnectionData::SendGatheredUpdates()
+    {
+        m_entityReplicationManager.SendGatheredUpdates();
     }
 }
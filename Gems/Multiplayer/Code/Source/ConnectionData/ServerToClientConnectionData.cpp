@@ -67,20 +67,36 @@ namespace Multiplayer
     }
 
     void ServerToClientConnectionData::Update(AZ::TimeMs hostTimeMs)
+    {
+        ActivatePendingEntities();
+        GatherUpdates(hostTimeMs);
+        SendGatheredUpdates();
+    }
+
+    void ServerToClientConnectionData::ActivatePendingEntities()
     {
         m_entityReplicationManager.ActivatePendingEntities();
+    }
 
+    void ServerToClientConnectionData::GatherUpdates(AZ::TimeMs hostTimeMs)
+    {
         if (CanSendUpdates())
         {
             NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
             // potentially false if we just migrated the player, if that is the case, don't send any more updates
             if (netBindComponent != nullptr && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority))
             {
-                m_entityReplicationManager.SendUpdates(hostTimeMs);
+                m_entityReplicationManager.GatherUpdates(hostTimeMs);
             }
         }
     }
 
+    void ServerToClientConnectionData::SendGatheredUpdates()
+    {
+        // Only sends if GatherUpdates gathered anything this tick
+        m_entityReplicationManager.SendGatheredUpdates();
+    }
+
     void ServerToClientConnectionData::OnControlledEntityRemove()
     {
         m_connection->Disconnect(AzNetworking::DisconnectReason::TerminatedByServer, AzNetworking::TerminationEndpoint::Local);
@@ -31,6 +31,9 @@ namespace Multiplayer
         AzNetworking::IConnection* GetConnection() const override;
         EntityReplicationManager& GetReplicationManager() override;
         void Update(AZ::TimeMs hostTimeMs) override;
+        void ActivatePendingEntities() override;
+        void GatherUpdates(AZ::TimeMs hostTimeMs) override;
+        void SendGatheredUpdates() override;
         bool CanSendUpdates() const override;
         void SetCanSendUpdates(bool canSendUpdates) override;
         //! @}
@@ -254,16 +254,20 @@ namespace Multiplayer
                     ImGui::Text(" - Total number of connections: %llu", aznumeric_cast<AZ::u64>(metrics.m_connectionCount));
                     ImGui::Text(" - Total send time in milliseconds: %lld", aznumeric_cast<AZ::s64>(metrics.m_sendTimeMs));
                     ImGui::Text(" - Total sent packets: %llu", aznumeric_cast<AZ::s64>(metrics.m_sendPackets));
+                    ImGui::Text(" - Sent packets per syscall: %.2f", metrics.m_sendCalls > 0 ? aznumeric_cast<double>(metrics.m_sendPackets) / aznumeric_cast<double>(metrics.m_sendCalls) : 0.0);
                     ImGui::Text(" - Total sent bytes after compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendBytes));
                     ImGui::Text(" - Total sent bytes before compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendBytesUncompressed));
                     ImGui::Text(" - Total sent compressed packets without benefit: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendCompressedPacketsNoGain));
                     ImGui::Text(" - Total gain from packet compression: %lld", aznumeric_cast<AZ::s64>(metrics.m_sendBytesCompressedDelta));
+                    ImGui::Text(" - Bytes copied per sent packet: %.2f", metrics.m_sendPackets > 0 ? aznumeric_cast<double>(metrics.m_sendBytesCopied) / aznumeric_cast<double>(metrics.m_sendPackets) : 0.0);
                     ImGui::Text(" - Total packets resent: %llu", aznumeric_cast<AZ::u64>(metrics.m_resentPackets));
                     ImGui::Text(" - Total receive time in milliseconds: %lld", aznumeric_cast<AZ::s64>(metrics.m_recvTimeMs));
                     ImGui::Text(" - Total received packets: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvPackets));
+                    ImGui::Text(" - Received packets per syscall: %.2f", metrics.m_recvCalls > 0 ? aznumeric_cast<double>(metrics.m_recvPackets) / aznumeric_cast<double>(metrics.m_recvCalls) : 0.0);
                     ImGui::Text(" - Total received bytes after compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytes));
                     ImGui::Text(" - Total received bytes before compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytesUncompressed));
                     ImGui::Text(" - Total packets discarded due to load: %llu", aznumeric_cast<AZ::u64>(metrics.m_discardedPackets));
+                    ImGui::Text(" - Total packets dropped by full receive queues: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvQueueDrops));
                 }
             }
         }
@@ -279,6 +283,20 @@ namespace Multiplayer
                 ImGui::Text("Total networked entities: %llu", aznumeric_cast<AZ::u64>(stats.m_entityCount));
                 ImGui::Text("Total client connections: %llu", aznumeric_cast<AZ::u64>(stats.m_clientConnectionCount));
                 ImGui::Text("Total server connections: %llu", aznumeric_cast<AZ::u64>(stats.m_serverConnectionCount));
+                for (const auto& budgetStats : stats.m_connectionBudgetStats)
+                {
+                    if (budgetStats.second.m_budgetBytesPerSecond > 0)
+                    {
+                        ImGui::Text
+                        (
+                            "Connection %u entity update budget utilization: %.1f%% of %llu bytes/sec, %llu updates deferred",
+                            aznumeric_cast<uint32_t>(budgetStats.first),
+                            stats.CalculateConnectionBudgetUtilization(budgetStats.first) * 100.0f,
+                            aznumeric_cast<AZ::u64>(budgetStats.second.m_budgetBytesPerSecond),
+                            aznumeric_cast<AZ::u64>(budgetStats.second.m_totalDeferredUpdates)
+                        );
+                    }
+                }
                 ImGui::NewLine();
 
                 static ImGuiTableFlags flags = ImGuiTableFlags_BordersV
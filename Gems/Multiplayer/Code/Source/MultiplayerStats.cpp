@@ -10,12 +10,25 @@
 
 namespace Multiplayer
 {
+    namespace MultiplayerStatsInternal
+    {
+        // Per thread, so that replication jobs serializing for different connections do not share capture state
+        static thread_local MultiplayerStats::PropertySentList* PropertySentCapture = nullptr;
+        static thread_local MultiplayerStats::PropertySentList* PropertySentDeferral = nullptr;
+    }
+
     MultiplayerStats::Metric::Metric()
     {
         AZStd::uninitialized_fill_n(m_callHistory.data(), RingbufferSamples, 0);
         AZStd::uninitialized_fill_n(m_byteHistory.data(), RingbufferSamples, 0);
     }
 
+    MultiplayerStats::ConnectionBudgetStats::ConnectionBudgetStats()
+    {
+        AZStd::uninitialized_fill_n(m_byteHistory.data(), RingbufferSamples, 0);
+        AZStd::uninitialized_fill_n(m_deferredHistory.data(), RingbufferSamples, 0);
+    }
+
     void MultiplayerStats::ReserveComponentStats(NetComponentId netComponentId, uint16_t propertyCount, uint16_t rpcCount)
     {
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
@@ -31,6 +44,18 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
     {
+        using namespace MultiplayerStatsInternal;
+        if (PropertySentCapture != nullptr)
+        {
+            PropertySentCapture->push_back({ netComponentId, propertyId, totalBytes });
+        }
+
+        if (PropertySentDeferral != nullptr)
+        {
+            PropertySentDeferral->push_back({ netComponentId, propertyId, totalBytes });
+            return;
+        }
+
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
         m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_totalCalls++;
@@ -39,6 +64,24 @@ namespace Multiplayer
         m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_byteHistory[m_recordMetricIndex] += totalBytes;
     }
 
+    void MultiplayerStats::RecordPropertiesSent(const PropertySentList& propertiesSent)
+    {
+        for (const PropertySent& propertySent : propertiesSent)
+        {
+            RecordPropertySent(propertySent.m_netComponentId, propertySent.m_propertyIndex, propertySent.m_totalBytes);
+        }
+    }
+
+    void MultiplayerStats::SetPropertySentCapture(PropertySentList* capture)
+    {
+        MultiplayerStatsInternal::PropertySentCapture = capture;
+    }
+
+    void MultiplayerStats::SetPropertySentDeferral(PropertySentList* deferral)
+    {
+        MultiplayerStatsInternal::PropertySentDeferral = deferral;
+    }
+
     void MultiplayerStats::RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
     {
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
@@ -69,6 +112,21 @@ namespace Multiplayer
         m_componentStats[netComponentIndex].m_rpcsRecv[rpcIndex].m_byteHistory[m_recordMetricIndex] += totalBytes;
     }
 
+    void MultiplayerStats::RecordEntityUpdatesSent(AzNetworking::ConnectionId connectionId, uint64_t budgetBytesPerSecond, uint32_t totalBytes, uint32_t deferredUpdates)
+    {
+        ConnectionBudgetStats& budgetStats = m_connectionBudgetStats[connectionId];
+        budgetStats.m_budgetBytesPerSecond = budgetBytesPerSecond;
+        budgetStats.m_totalBytesSent += totalBytes;
+        budgetStats.m_totalDeferredUpdates += deferredUpdates;
+        budgetStats.m_byteHistory[m_recordMetricIndex] += totalBytes;
+        budgetStats.m_deferredHistory[m_recordMetricIndex] += deferredUpdates;
+    }
+
+    void MultiplayerStats::RemoveConnectionStats(AzNetworking::ConnectionId connectionId)
+    {
+        m_connectionBudgetStats.erase(connectionId);
+    }
+
     void MultiplayerStats::TickStats(AZ::TimeMs metricFrameTimeMs)
     {
         m_totalHistoryTimeMs = metricFrameTimeMs * static_cast<AZ::TimeMs>(RingbufferSamples);
@@ -96,6 +154,11 @@ namespace Multiplayer
                 metric.m_byteHistory[m_recordMetricIndex] = 0;
             }
         }
+        for (auto& budgetStats : m_connectionBudgetStats)
+        {
+            budgetStats.second.m_byteHistory[m_recordMetricIndex] = 0;
+            budgetStats.second.m_deferredHistory[m_recordMetricIndex] = 0;
+        }
     }
 
     static void CombineMetrics(MultiplayerStats::Metric& outArg1, const MultiplayerStats::Metric& arg2)
@@ -186,4 +249,21 @@ namespace Multiplayer
         }
         return result;
     }
+
+    float MultiplayerStats::CalculateConnectionBudgetUtilization(AzNetworking::ConnectionId connectionId) const
+    {
+        auto iter = m_connectionBudgetStats.find(connectionId);
+        if ((iter == m_connectionBudgetStats.end()) || (iter->second.m_budgetBytesPerSecond == 0) || (m_totalHistoryTimeMs <= AZ::TimeMs{ 0 }))
+        {
+            return 0.0f;
+        }
+
+        uint64_t totalBytes = 0;
+        for (uint64_t bytes : iter->second.m_byteHistory)
+        {
+            totalBytes += bytes;
+        }
+        const double historySeconds = aznumeric_cast<double>(static_cast<int64_t>(m_totalHistoryTimeMs)) / 1000.0;
+        return aznumeric_cast<float>(aznumeric_cast<double>(totalBytes) / (historySeconds * aznumeric_cast<double>(iter->second.m_budgetBytesPerSecond)));
+    }
 }
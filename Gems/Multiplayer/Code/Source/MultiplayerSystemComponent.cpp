@@ -19,6 +19,9 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
@@ -80,6 +83,7 @@ namespace Multiplayer
     AZ_CVAR(bool, sv_isDedicated, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether the host command creates an independent or client hosted server");
     AZ_CVAR(bool, sv_isTransient, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether a dedicated server shuts down if all existing connections disconnect.");
     AZ_CVAR(AZ::TimeMs, cl_defaultNetworkEntityActivationTimeSliceMs, AZ::TimeMs{ 0 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Max Ms to use to activate entities coming from the network, 0 means instantiate everything");
+    AZ_CVAR(bool, sv_ParallelReplicationUpdate, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Gather the entity updates of each connection in parallel jobs, packets are still sent from the main thread in connection order. Requires replicated properties and custom serializers to be safe to read concurrently");
     AZ_CVAR(AZ::TimeMs, sv_serverSendRateMs, AZ::TimeMs{ 50 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of milliseconds between each network update");
     AZ_CVAR(AZ::CVarFixedString, sv_defaultPlayerSpawnAsset, "prefabs/player.network.spawnable", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The default spawnable to use when a new player connects");
 
@@ -320,6 +324,9 @@ namespace Multiplayer
                 return;
             }
             m_serverSendAccumulator -= serverRateSeconds;
+
+            // Entity state is final for the frame that is ending, keep it for lag compensated queries against that frame
+            m_rewindHistory.RecordFrame(m_networkTime.GetHostFrameId());
             m_networkTime.IncrementHostFrameId();
         }
 
@@ -342,12 +349,13 @@ namespace Multiplayer
 
         // Send out the game state update to all connections
         {
-            auto sendNetworkUpdates = [hostTimeMs, &stats](IConnection& connection)
+            m_updatingConnections.clear();
+            auto gatherConnections = [this, &stats](IConnection& connection)
             {
                 if (connection.GetUserData() != nullptr)
                 {
                     IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection.GetUserData());
-                    connectionData->Update(hostTimeMs);
+                    m_updatingConnections.push_back(connectionData);
                     if (connectionData->GetConnectionDataType() == ConnectionDataType::ServerToClient)
                     {
                         stats.m_clientConnectionCount++;
@@ -358,8 +366,43 @@ namespace Multiplayer
                     }
                 }
             };
+            m_networkInterface->GetConnectionSet().VisitConnections(gatherConnections);
+
+            // Activation spawns entities, so it must complete before any connection starts reading entity state
+            for (IConnectionData* connectionData : m_updatingConnections)
+            {
+                connectionData->ActivatePendingEntities();
+            }
+
+            // Entity state is not modified again until every connection has gathered its updates, so each connection sees the
+            // same snapshot of this tick and only writes to its own replication state
+            if (sv_ParallelReplicationUpdate && (m_updatingConnections.size() > 1) && (AZ::JobContext::GetGlobalContext() != nullptr))
+            {
+                AZ::JobCompletion jobCompletion;
+                for (IConnectionData* connectionData : m_updatingConnections)
+                {
+                    AZ::Job* job = AZ::CreateJobFunction([connectionData, hostTimeMs]() { connectionData->GatherUpdates(hostTimeMs); }, true);
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                }
+                jobCompletion.StartAndWaitForCompletion();
+            }
+            else
+            {
+                for (IConnectionData* connectionData : m_updatingConnections)
+                {
+                    connectionData->GatherUpdates(hostTimeMs);
+                }
+            }
 
-            m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+            // Every connection's updates for this tick are written to the socket together
+            m_networkInterface->BeginSendBatch();
+            for (IConnectionData* connectionData : m_updatingConnections)
+            {
+                connectionData->SendGatheredUpdates();
+            }
+            m_networkInterface->EndSendBatch();
+            m_updatingConnections.clear();
         }
 
         MultiplayerPackets::SyncConsole packet;
@@ -644,7 +687,7 @@ namespace Multiplayer
                 connection->SetUserData(new ServerToClientConnectionData(connection, *this, controlledEntity));
             }
 
-            AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection);
+            AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection, m_interestGrid);
             reinterpret_cast<ServerToClientConnectionData*>(connection->GetUserData())->GetReplicationManager().SetReplicationWindow(AZStd::move(window));
         }
         else
@@ -706,6 +749,7 @@ namespace Multiplayer
             delete connectionData;
             connection->SetUserData(nullptr);
         }
+        GetStats().RemoveConnectionStats(connection->GetConnectionId());
 
         // Signal to session management when there are no remaining players in a dedicated server for potential cleanup
         // We avoid this for client server as the host itself is a user and non-transient dedicated servers
@@ -823,6 +867,11 @@ namespace Multiplayer
         return m_filterEntityManager;
     }
 
+    void MultiplayerSystemComponent::SetReplicationPriorityFunction(ReplicationPriorityFunction priorityFunction)
+    {
+        m_interestGrid.SetPriorityFunction(AZStd::move(priorityFunction));
+    }
+
     void MultiplayerSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
     {
         const MultiplayerStats& stats = GetStats();
@@ -844,6 +893,19 @@ namespace Multiplayer
         AZLOG_INFO("Total RPCs sent bytes: %llu", aznumeric_cast<AZ::u64>(rpcsSent.m_totalBytes));
         AZLOG_INFO("Total RPCs received: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalCalls));
         AZLOG_INFO("Total RPCs received bytes: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalBytes));
+
+        for (const auto& budgetStats : stats.m_connectionBudgetStats)
+        {
+            AZLOG_INFO
+            (
+                "Connection %u entity updates sent bytes: %llu, deferred updates: %llu, budget: %llu bytes/sec, budget utilization: %.1f%%",
+                aznumeric_cast<uint32_t>(budgetStats.first),
+                aznumeric_cast<AZ::u64>(budgetStats.second.m_totalBytesSent),
+                aznumeric_cast<AZ::u64>(budgetStats.second.m_totalDeferredUpdates),
+                aznumeric_cast<AZ::u64>(budgetStats.second.m_budgetBytesPerSecond),
+                stats.CalculateConnectionBudgetUtilization(budgetStats.first) * 100.0f
+            );
+        }
     }
 
     void MultiplayerSystemComponent::TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds)
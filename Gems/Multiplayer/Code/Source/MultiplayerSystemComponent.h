@@ -11,7 +11,9 @@
 #include <Multiplayer/IMultiplayer.h>
 #include <Editor/MultiplayerEditorConnection.h>
 #include <NetworkTime/NetworkTime.h>
+#include <NetworkTime/RewindHistory.h>
 #include <NetworkEntity/NetworkEntityManager.h>
+#include <ReplicationWindows/ReplicationInterestGrid.h>
 #include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
 
 #include <AzCore/Component/Component.h>
@@ -20,6 +22,7 @@
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/Threading/ThreadSafeDeque.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <AzFramework/Session/ISessionHandlingRequests.h>
 #include <AzFramework/Session/SessionNotifications.h>
@@ -37,6 +40,8 @@ namespace AzNetworking
 
 namespace Multiplayer
 {
+    class IConnectionData;
+
     //! Multiplayer system component wraps the bridging logic between the game and transport layer.
     class MultiplayerSystemComponent final
         : public AZ::Component
@@ -117,6 +122,7 @@ namespace Multiplayer
         INetworkEntityManager* GetNetworkEntityManager() override;
         void SetFilterEntityManager(IFilterEntityManager* entityFilter) override;
         IFilterEntityManager* GetFilterEntityManager() override;
+        void SetReplicationPriorityFunction(ReplicationPriorityFunction priorityFunction) override;
         //! @}
 
         //! Console commands.
@@ -140,9 +146,11 @@ namespace Multiplayer
 
         NetworkEntityManager m_networkEntityManager;
         NetworkTime m_networkTime;
+        RewindHistory m_rewindHistory;
         MultiplayerAgentType m_agentType = MultiplayerAgentType::Uninitialized;
         
         IFilterEntityManager* m_filterEntityManager = nullptr; // non-owning pointer
+        ReplicationInterestGrid m_interestGrid;
 
         SessionInitEvent m_initEvent;
         SessionShutdownEvent m_shutdownEvent;
@@ -151,6 +159,9 @@ namespace Multiplayer
 
         AZStd::queue<AZStd::string> m_pendingConnectionTickets;
 
+        //! Connections being updated this tick, in the order their packets are sent
+        AZStd::vector<IConnectionData*> m_updatingConnections;
+
         AZ::TimeMs m_lastReplicatedHostTimeMs = AZ::TimeMs{ 0 };
         HostFrameId m_lastReplicatedHostFrameId = HostFrameId(0);
 
@@ -37,6 +37,9 @@ namespace Multiplayer
     constexpr uint32_t ReplicationManagerPacketOverhead = 16;
 
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
+    AZ_CVAR(uint32_t, sv_EntityUpdateBudgetBytesPerSecond, 0, nullptr, AZ::ConsoleFunctorFlags::Null, "The entity update bandwidth budget of each client connection in bytes per second, 0 disables the budget");
+    AZ_CVAR(AZ::TimeMs, sv_EntityUpdateBudgetBurstMs, AZ::TimeMs{ 250 }, nullptr, AZ::ConsoleFunctorFlags::Null, "The longest span of unused entity update budget a client connection can save up and spend at once");
+    AZ_CVAR(float, sv_EntityUpdateStalenessWeight, 0.05f, nullptr, AZ::ConsoleFunctorFlags::Null, "Priority each pending entity update gains per tick regardless of relevance, so that less relevant entities are never starved");
 
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
         : m_updateMode(updateMode)
@@ -94,9 +97,34 @@ namespace Multiplayer
     }
 
     void EntityReplicationManager::SendUpdates(AZ::TimeMs hostTimeMs)
+    {
+        GatherUpdates(hostTimeMs);
+        SendGatheredUpdates();
+    }
+
+    void EntityReplicationManager::GatherUpdates(AZ::TimeMs hostTimeMs)
     {
         m_frameTimeMs = AZ::GetElapsedTimeMs();
-        SendEntityUpdates(hostTimeMs);
+        m_gatheredHostTimeMs = hostTimeMs;
+
+        // Stats are shared by every connection, so the properties serialized here are recorded once the updates are sent
+        MultiplayerStats& stats = GetMultiplayer()->GetStats();
+        stats.SetPropertySentDeferral(&m_gatheredPropertiesSent);
+        GatherEntityUpdates();
+        stats.SetPropertySentDeferral(nullptr);
+
+        m_hasGatheredUpdates = true;
+    }
+
+    void EntityReplicationManager::SendGatheredUpdates()
+    {
+        if (!m_hasGatheredUpdates)
+        {
+            return;
+        }
+        m_hasGatheredUpdates = false;
+
+        SendEntityUpdates();
 
         SendEntityRpcs(m_deferredRpcMessagesReliable, true);
         SendEntityRpcs(m_deferredRpcMessagesUnreliable, false);
@@ -116,19 +144,11 @@ namespace Multiplayer
         );
     }
 
-    void EntityReplicationManager::SendEntityUpdatesPacketHelper
-    (
-        AZ::TimeMs hostTimeMs,
-        EntityReplicatorList& toSendList,
-        uint32_t maxPayloadSize,
-        AzNetworking::IConnection& connection
-    )
+    uint32_t EntityReplicationManager::GatherEntityUpdatesPacket(EntityReplicatorList& toSendList, uint32_t maxPayloadSize)
     {
         uint32_t pendingPacketSize = 0;
-        EntityReplicatorList replicatorUpdatedList;
-        MultiplayerPackets::EntityUpdates entityUpdatePacket;
-        entityUpdatePacket.SetHostTimeMs(hostTimeMs);
-        entityUpdatePacket.SetHostFrameId(GetNetworkTime()->GetHostFrameId());
+        GatheredPacket gatheredPacket;
+        gatheredPacket.m_firstMessage = aznumeric_cast<uint32_t>(m_gatheredMessages.size());
         // Serialize everything
         while (!toSendList.empty())
         {
@@ -139,16 +159,17 @@ namespace Multiplayer
 
             // Check if we are over our limits
             const bool payloadFull = (pendingPacketSize + nextMessageSize > maxPayloadSize);
-            const bool capacityReached = (entityUpdatePacket.GetEntityMessages().size() >= entityUpdatePacket.GetEntityMessages().capacity());
-            const bool largeEntityDetected = (payloadFull && replicatorUpdatedList.empty());
+            const bool capacityReached = (gatheredPacket.m_messageCount >= MaxAggregateEntityMessages);
+            const bool largeEntityDetected = (payloadFull && (gatheredPacket.m_messageCount == 0));
             if (capacityReached || (payloadFull && !largeEntityDetected))
             {
                 break;
             }
 
             pendingPacketSize += nextMessageSize;
-            entityUpdatePacket.ModifyEntityMessages().push_back(updateMessage);
-            replicatorUpdatedList.push_back(replicator);
+            m_gatheredMessages.push_back(AZStd::move(updateMessage));
+            m_gatheredReplicators.push_back(replicator);
+            ++gatheredPacket.m_messageCount;
             toSendList.pop_front();
 
             if (largeEntityDetected)
@@ -166,92 +187,88 @@ namespace Multiplayer
             }
         }
 
-        const AzNetworking::PacketId sentId = connection.SendUnreliablePacket(entityUpdatePacket);
-
-        // Update the sent things with the packet id
-        for (EntityReplicator* replicator : replicatorUpdatedList)
-        {
-            replicator->GetPropertyPublisher()->FinalizeSerialization(sentId);
-        }
+        m_gatheredPackets.push_back(gatheredPacket);
+        return pendingPacketSize;
     }
 
     EntityReplicationManager::EntityReplicatorList EntityReplicationManager::GenerateEntityUpdateList()
     {
+        m_deferredUpdateCount = 0;
         if (m_replicationWindow == nullptr)
         {
             return EntityReplicatorList();
         }
 
-        // Generate a list of all our entities that need updates
-        EntityReplicatorList toSendList;
-
-        uint32_t elementsAdded = 0;
-        for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end() && elementsAdded < m_replicationWindow->GetMaxEntityReplicatorSendCount(); )
+        // Gather all our entities that need updates, along with how relevant each is to the remote host
+        const ReplicationSet& replicationSet = m_replicationWindow->GetReplicationSet();
+        m_sendCandidates.clear();
+        for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end(); )
         {
-            EntityReplicator* replicator = GetEntityReplicator(*iter);
-            bool clearPendingSend = true;
-            if (replicator)
+            EntityReplicator* replicator = GetEntityReplicator(iter->first);
+            PropertyPublisher* propPublisher = (replicator != nullptr) ? replicator->GetPropertyPublisher() : nullptr;
+            if ((propPublisher == nullptr) || !propPublisher->RequiresSerialization())
             {
-                NetEntityId entityId = replicator->GetEntityHandle().GetNetEntityId();
-                PropertyPublisher* propPublisher = replicator->GetPropertyPublisher();
-                if (propPublisher)
-                {
-                    // don't have too many replicators pending creation outstanding at a time
-                    bool canSend = true;
-                    if (!propPublisher->IsRemoteReplicatorEstablished())
-                    {
-                        // If we have our maximum set of entities pending creation, and this entity isn't in that set, then skip it
-                        if ((m_remoteEntitiesPendingCreation.size() >= m_maxRemoteEntitiesPendingCreationCount) && (m_remoteEntitiesPendingCreation.find(entityId) == m_remoteEntitiesPendingCreation.end()))
-                        {
-                            canSend = false; // don't send this
-                            clearPendingSend = false;  // there might be outstanding data here, but we won't check, so we shouldn't clear it
-                        }
-                    }
-                    else
-                    {
-                        m_remoteEntitiesPendingCreation.erase(*iter);
-                    }
-
-                    if (canSend && propPublisher->RequiresSerialization())
-                    {
-                        clearPendingSend = false;
-                        if (!propPublisher->IsRemoteReplicatorEstablished())
-                        {
-                            m_remoteEntitiesPendingCreation.insert(entityId);
-                        }
-
-                        if (replicator->GetRemoteNetworkRole() == NetEntityRole::Autonomous)
-                        {
-                            toSendList.push_back(replicator);
-                        }
-                        else
-                        {
-                            if (elementsAdded < m_replicationWindow->GetMaxEntityReplicatorSendCount())
-                            {
-                                toSendList.push_back(replicator);
-                            }
-                        }
-                    }
-                    ++elementsAdded;
-                }
+                m_remoteEntitiesPendingCreation.erase(iter->first);
+                iter = m_replicatorsPendingSend.erase(iter);
+                continue;
             }
 
-            if (clearPendingSend)
+            if (propPublisher->IsRemoteReplicatorEstablished())
             {
-                m_remoteEntitiesPendingCreation.erase(*iter);
-                iter = m_replicatorsPendingSend.erase(iter);
+                m_remoteEntitiesPendingCreation.erase(iter->first);
             }
-            else
+
+            EntityUpdateScheduler::Candidate candidate;
+            candidate.m_replicator = replicator;
+            candidate.m_netEntityId = iter->first;
+            candidate.m_accumulatedPriority = &iter->second;
+            candidate.m_isAutonomous = (replicator->GetRemoteNetworkRole() == NetEntityRole::Autonomous);
+            auto replicationIter = replicationSet.find(replicator->GetEntityHandle());
+            if (replicationIter != replicationSet.end())
             {
-                ++iter;
+                candidate.m_isInWindow = true;
+                candidate.m_relevance = replicationIter->second.m_priority;
             }
+            m_sendCandidates.push_back(candidate);
+            ++iter;
         }
 
+        EntityUpdateScheduler::PrioritizeCandidates(m_sendCandidates, sv_EntityUpdateStalenessWeight);
+
+        // Send in descending priority until we reach the window's send count or the connection's bandwidth budget
+        EntityReplicatorList toSendList;
+        m_deferredUpdateCount = m_updateScheduler.SelectUpdates(m_sendCandidates, m_replicationWindow->GetMaxEntityReplicatorSendCount(),
+            [this](const EntityUpdateScheduler::Candidate& candidate)
+            {
+                // don't have too many replicators pending creation outstanding at a time
+                return candidate.m_replicator->GetPropertyPublisher()->IsRemoteReplicatorEstablished()
+                    || (m_remoteEntitiesPendingCreation.size() < m_maxRemoteEntitiesPendingCreationCount)
+                    || (m_remoteEntitiesPendingCreation.find(candidate.m_netEntityId) != m_remoteEntitiesPendingCreation.end());
+            },
+            [this, &toSendList](const EntityUpdateScheduler::Candidate& candidate)
+            {
+                if (!candidate.m_replicator->GetPropertyPublisher()->IsRemoteReplicatorEstablished())
+                {
+                    m_remoteEntitiesPendingCreation.insert(candidate.m_netEntityId);
+                }
+                toSendList.push_back(candidate.m_replicator);
+                *candidate.m_accumulatedPriority = 0.0f;
+            });
+
+        m_sendCandidates.clear();
         return toSendList;
     }
 
-    void EntityReplicationManager::SendEntityUpdates(AZ::TimeMs hostTimeMs)
+    void EntityReplicationManager::GatherEntityUpdates()
     {
+        m_gatheredPackets.clear();
+        m_gatheredMessages.clear();
+        m_gatheredReplicators.clear();
+        m_gatheredPropertiesSent.clear();
+        m_gatheredBytes = 0;
+
+        m_updateScheduler.RefillBudget(m_frameTimeMs, GetSendBudgetBytesPerSecond(), sv_EntityUpdateBudgetBurstMs, m_maxPayloadSize);
+
         EntityReplicatorList toSendList = GenerateEntityUpdateList();
     
         AZLOG(NET_ReplicationInfo, "Sending %zd updates from %d to %d", toSendList.size(), (uint8_t)GetNetworkEntityManager()->GetHostId(), (uint8_t)GetRemoteHostId());
@@ -265,10 +282,51 @@ namespace Multiplayer
         // While our to send list is not empty, build up another packet to send
         do
         {
-            SendEntityUpdatesPacketHelper(hostTimeMs, toSendList, m_maxPayloadSize, m_connection);
+            m_gatheredBytes += GatherEntityUpdatesPacket(toSendList, m_maxPayloadSize);
         } while (!toSendList.empty());
     }
 
+    void EntityReplicationManager::SendEntityUpdates()
+    {
+        // Packets are sent in the order they were gathered, so their packet ids do not depend on how the gather was scheduled
+        for (const GatheredPacket& gatheredPacket : m_gatheredPackets)
+        {
+            MultiplayerPackets::EntityUpdates entityUpdatePacket;
+            entityUpdatePacket.SetHostTimeMs(m_gatheredHostTimeMs);
+            entityUpdatePacket.SetHostFrameId(GetNetworkTime()->GetHostFrameId());
+            const uint32_t endMessage = gatheredPacket.m_firstMessage + gatheredPacket.m_messageCount;
+            for (uint32_t index = gatheredPacket.m_firstMessage; index < endMessage; ++index)
+            {
+                entityUpdatePacket.ModifyEntityMessages().push_back(AZStd::move(m_gatheredMessages[index]));
+            }
+
+            const AzNetworking::PacketId sentId = m_connection.SendUnreliablePacket(entityUpdatePacket);
+
+            // Update the sent things with the packet id
+            for (uint32_t index = gatheredPacket.m_firstMessage; index < endMessage; ++index)
+            {
+                m_gatheredReplicators[index]->GetPropertyPublisher()->FinalizeSerialization(sentId);
+            }
+        }
+
+        m_updateScheduler.RecordSentUpdates(aznumeric_cast<uint32_t>(m_gatheredReplicators.size()), m_gatheredBytes);
+
+        MultiplayerStats& stats = GetMultiplayer()->GetStats();
+        stats.RecordPropertiesSent(m_gatheredPropertiesSent);
+        stats.RecordEntityUpdatesSent(m_connection.GetConnectionId(), GetSendBudgetBytesPerSecond(), m_gatheredBytes, m_deferredUpdateCount);
+
+        m_gatheredPackets.clear();
+        m_gatheredMessages.clear();
+        m_gatheredReplicators.clear();
+        m_gatheredPropertiesSent.clear();
+    }
+
+    uint32_t EntityReplicationManager::GetSendBudgetBytesPerSecond() const
+    {
+        // Only client connections are budgeted, server to server traffic must not fall behind
+        return (m_updateMode == Mode::LocalServerToRemoteClient) ? static_cast<uint32_t>(sv_EntityUpdateBudgetBytesPerSecond) : 0;
+    }
+
     void EntityReplicationManager::SendEntityRpcs(RpcMessages& deferredRpcs, bool reliable)
     {
         while (!deferredRpcs.empty())
@@ -1214,7 +1272,8 @@ namespace Multiplayer
 
     void EntityReplicationManager::AddReplicatorToPendingSend(const EntityReplicator& replicator)
     {
-        m_replicatorsPendingSend.insert(replicator.GetEntityHandle().GetNetEntityId());
+        // Keeps any priority the replicator has already accumulated
+        m_replicatorsPendingSend.emplace(replicator.GetEntityHandle().GetNetEntityId(), 0.0f);
     }
 
     bool EntityReplicationManager::IsUpdateModeToServerClient()
@@ -9,6 +9,8 @@
 #pragma once
 
 #include <Source/NetworkEntity/EntityReplication/EntityReplicator.h>
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateScheduler.h>
+#include <Multiplayer/MultiplayerStats.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/EntityDomains/IEntityDomain.h>
 #include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
@@ -59,6 +61,16 @@ namespace Multiplayer
 
         void ActivatePendingEntities();
         void SendUpdates(AZ::TimeMs hostTimeMs);
+
+        //! Selects and serializes this tick's entity updates without sending them.
+        //! Only reads entity state and writes state owned by this connection, so the updates of different connections may be
+        //! gathered in parallel. Entity state must not change until every connection has finished gathering.
+        //! @param hostTimeMs current server game time in milliseconds
+        void GatherUpdates(AZ::TimeMs hostTimeMs);
+
+        //! Sends the entity updates collected by GatherUpdates, followed by any deferred RPCs. Must be called from the main thread.
+        void SendGatheredUpdates();
+
         void Clear(bool forMigration);
 
         bool SetEntityRebasing(NetworkEntityHandle& entityHandle);
@@ -117,9 +129,12 @@ namespace Multiplayer
         using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
         EntityReplicatorList GenerateEntityUpdateList();
 
-        void SendEntityUpdatesPacketHelper(AZ::TimeMs hostTimeMs, EntityReplicatorList& toSendList, uint32_t maxPayloadSize, AzNetworking::IConnection& connection);
+        uint32_t GatherEntityUpdatesPacket(EntityReplicatorList& toSendList, uint32_t maxPayloadSize);
+
+        uint32_t GetSendBudgetBytesPerSecond() const;
 
-        void SendEntityUpdates(AZ::TimeMs hostTimeMs);
+        void GatherEntityUpdates();
+        void SendEntityUpdates();
         void SendEntityRpcs(RpcMessages& deferredRpcs, bool reliable);
 
         void MigrateEntityInternal(NetEntityId entityId);
@@ -182,7 +197,25 @@ namespace Multiplayer
         AZStd::unordered_set<NetEntityId> m_remoteEntitiesPendingCreation;
         AZStd::deque<NetEntityId> m_entitiesPendingActivation;
         AZStd::set<NetEntityId> m_replicatorsPendingRemoval;
-        AZStd::unordered_set<NetEntityId> m_replicatorsPendingSend;
+        //! Replicators with pending changes, and the priority each has accumulated while waiting to be sent
+        AZStd::unordered_map<NetEntityId, float> m_replicatorsPendingSend;
+
+        AZStd::vector<EntityUpdateScheduler::Candidate> m_sendCandidates;
+        EntityUpdateScheduler m_updateScheduler;
+
+        //! Entity updates serialized by GatherUpdates, waiting to be sent from the main thread
+        struct GatheredPacket
+        {
+            uint32_t m_firstMessage = 0;
+            uint32_t m_messageCount = 0;
+        };
+        AZStd::vector<GatheredPacket> m_gatheredPackets;
+        AZStd::vector<NetworkEntityUpdateMessage> m_gatheredMessages;
+        AZStd::vector<EntityReplicator*> m_gatheredReplicators;
+        MultiplayerStats::PropertySentList m_gatheredPropertiesSent;
+        AZ::TimeMs m_gatheredHostTimeMs = AZ::TimeMs{ 0 };
+        uint32_t m_gatheredBytes = 0;
+        bool m_hasGatheredUpdates = false;
 
         // Deferred RPC Sends
         RpcMessages m_deferredRpcMessagesReliable;
@@ -202,6 +235,7 @@ namespace Multiplayer
         AZ::TimeMs m_entityActivationTimeSliceMs = AZ::TimeMs{ 0 };
         AZ::TimeMs m_entityPendingRemovalMs = AZ::TimeMs{ 0 };
         AZ::TimeMs m_frameTimeMs = AZ::TimeMs{ 0 };
+        uint32_t m_deferredUpdateCount = 0;
         HostId m_remoteHostId = InvalidHostId;
         uint32_t m_maxRemoteEntitiesPendingCreationCount = AZStd::numeric_limits<uint32_t>::max();
         uint32_t m_maxPayloadSize = 0;
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateScheduler.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    constexpr float UpdateSizeSmoothing = 0.1f;
+
+    void EntityUpdateScheduler::PrioritizeCandidates(AZStd::vector<Candidate>& candidates, float stalenessWeight)
+    {
+        float maxRelevance = 0.0f;
+        for (const Candidate& candidate : candidates)
+        {
+            if (candidate.m_isInWindow)
+            {
+                maxRelevance = AZStd::max(maxRelevance, candidate.m_relevance);
+            }
+        }
+
+        // Every pending update accumulates priority for each tick it waits, weighted by its relevance. The most relevant entities
+        // update most often, while the staleness weight guarantees less relevant entities still climb to the front of the queue.
+        stalenessWeight = AZStd::max(stalenessWeight, 0.0f);
+        for (Candidate& candidate : candidates)
+        {
+            // Entities leaving the window still need their removal sent, so treat them as fully relevant
+            const bool hasRelevance = candidate.m_isInWindow && (maxRelevance > 0.0f);
+            const float relevance = hasRelevance ? AZStd::max(candidate.m_relevance / maxRelevance, 0.0f) : 1.0f;
+            *candidate.m_accumulatedPriority += relevance + stalenessWeight;
+        }
+
+        AZStd::sort(candidates.begin(), candidates.end(), [](const Candidate& lhs, const Candidate& rhs)
+        {
+            // Autonomous entities are always sent first
+            if (lhs.m_isAutonomous != rhs.m_isAutonomous)
+            {
+                return lhs.m_isAutonomous;
+            }
+            return *lhs.m_accumulatedPriority > *rhs.m_accumulatedPriority;
+        });
+    }
+
+    void EntityUpdateScheduler::RefillBudget(AZ::TimeMs frameTimeMs, uint32_t budgetBytesPerSecond, AZ::TimeMs burstMs, uint32_t minBurstBytes)
+    {
+        // Start out with a full burst, rather than spending the first tick without any budget
+        const AZ::TimeMs elapsedMs = (m_lastRefillTimeMs > AZ::TimeMs{ 0 }) ? (frameTimeMs - m_lastRefillTimeMs) : burstMs;
+        m_lastRefillTimeMs = frameTimeMs;
+        m_reservedBytes = 0.0f;
+
+        m_isBudgeted = (budgetBytesPerSecond > 0);
+        if (!m_isBudgeted)
+        {
+            m_budgetBytes = 0;
+            return;
+        }
+
+        // Unused budget carries over so quiet ticks can absorb bursts, but only up to burstMs worth
+        m_maxBudgetBytes = AZStd::max<int64_t>(budgetBytesPerSecond * static_cast<int64_t>(burstMs) / 1000, minBurstBytes);
+        const int64_t refillBytes = budgetBytesPerSecond * static_cast<int64_t>(elapsedMs) / 1000;
+        m_budgetBytes = AZStd::min(m_budgetBytes + refillBytes, m_maxBudgetBytes);
+    }
+
+    bool EntityUpdateScheduler::TryReserveUpdate()
+    {
+        if (!m_isBudgeted)
+        {
+            return true;
+        }
+
+        const bool fits = (m_reservedBytes + m_updateSizeEstimate <= static_cast<float>(m_budgetBytes));
+        // Updates estimated larger than the budget can ever hold would never fit, so a full budget always admits one
+        const bool isFullBudget = (m_reservedBytes == 0.0f) && (m_budgetBytes >= m_maxBudgetBytes);
+        if (!fits && !isFullBudget)
+        {
+            return false;
+        }
+
+        m_reservedBytes += m_updateSizeEstimate;
+        return true;
+    }
+
+    void EntityUpdateScheduler::RecordSentUpdates(uint32_t updateCount, uint32_t sentBytes)
+    {
+        if (updateCount > 0)
+        {
+            const float updateSize = static_cast<float>(sentBytes) / static_cast<float>(updateCount);
+            m_updateSizeEstimate = AZ::Lerp(m_updateSizeEstimate, updateSize, UpdateSizeSmoothing);
+        }
+
+        if (m_isBudgeted)
+        {
+            // Overspending the estimate is paid back on later ticks
+            m_budgetBytes -= sentBytes;
+        }
+    }
+
+    bool EntityUpdateScheduler::IsBudgeted() const
+    {
+        return m_isBudgeted;
+    }
+
+    int64_t EntityUpdateScheduler::GetBudgetBytes() const
+    {
+        return m_budgetBytes;
+    }
+
+    float EntityUpdateScheduler::GetUpdateSizeEstimate() const
+    {
+        return m_updateSizeEstimate;
+    }
+}
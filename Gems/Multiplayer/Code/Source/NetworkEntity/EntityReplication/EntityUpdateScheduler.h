@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    class EntityReplicator;
+
+    //! @class EntityUpdateScheduler
+    //! @brief Decides which pending entity updates a connection sends each tick.
+    //!
+    //! Pending updates accumulate priority for every tick they wait, weighted by their relevance to the remote host, and are
+    //! sent in descending accumulated priority. Updates are admitted against a byte budget refilled at a fixed rate, using the
+    //! running average update size as the estimate for updates that have not been serialized yet. The bytes actually sent are
+    //! then charged to the budget, so a tick that sends more than estimated is paid back by the following ticks.
+    class EntityUpdateScheduler
+    {
+    public:
+
+        //! A pending entity update, along with the data needed to rank it.
+        struct Candidate
+        {
+            EntityReplicator* m_replicator = nullptr;
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            float* m_accumulatedPriority = nullptr; //!< Owned by the caller, persists while the update stays pending
+            float m_relevance = 0.0f; //!< Priority from the replication window, only meaningful if m_isInWindow is set
+            bool m_isInWindow = false;
+            bool m_isAutonomous = false;
+        };
+
+        //! Starting estimate for the size of an entity update, refined by the sizes of the updates actually sent.
+        static constexpr float DefaultUpdateSizeEstimate = 64.0f;
+
+        //! Adds the priority each candidate gained by waiting another tick, then sorts candidates into send order.
+        //! Autonomous candidates always come first.
+        //! @param candidates     the pending updates to rank
+        //! @param stalenessWeight priority every candidate gains per tick regardless of relevance
+        static void PrioritizeCandidates(AZStd::vector<Candidate>& candidates, float stalenessWeight);
+
+        //! Refills the budget for the time elapsed since the previous refill, and starts a new tick of reservations.
+        //! @param frameTimeMs          the current frame time
+        //! @param budgetBytesPerSecond the refill rate, 0 disables the budget
+        //! @param burstMs              the longest span of unused budget that can be saved up
+        //! @param minBurstBytes        the least the budget can save up, so that a full packet can always be sent
+        void RefillBudget(AZ::TimeMs frameTimeMs, uint32_t budgetBytesPerSecond, AZ::TimeMs burstMs, uint32_t minBurstBytes);
+
+        //! Reserves the estimated size of one more update this tick if it fits within the budget.
+        //! @return true if the update may be sent, always true when the budget is disabled
+        bool TryReserveUpdate();
+
+        //! Walks candidates in send order, sending each one that may be sent until the send count or the budget runs out.
+        //! Autonomous candidates are always sent. Candidates rejected by canSend are skipped before anything is reserved for them,
+        //! so they use up neither the send count nor the budget.
+        //! @param candidates   the pending updates, in send order
+        //! @param maxSendCount the most non-autonomous updates to send this tick
+        //! @param canSend      returns whether a candidate may be sent this tick
+        //! @param onSend       invoked for each candidate to send, in send order
+        //! @return the number of candidates left pending
+        template <typename CAN_SEND, typename ON_SEND>
+        uint32_t SelectUpdates(const AZStd::vector<Candidate>& candidates, uint32_t maxSendCount, CAN_SEND&& canSend, ON_SEND&& onSend);
+
+        //! Records the updates sent this tick, charging their actual size to the budget and refining the size estimate.
+        //! @param updateCount the number of updates sent
+        //! @param sentBytes   the serialized size of those updates
+        void RecordSentUpdates(uint32_t updateCount, uint32_t sentBytes);
+
+        //! Returns whether updates are limited by a budget.
+        //! @return whether updates are limited by a budget
+        bool IsBudgeted() const;
+
+        //! Returns the bytes left in the budget, negative while paying back an overspent tick.
+        //! @return the bytes left in the budget
+        int64_t GetBudgetBytes() const;
+
+        //! Returns the current estimate for the size of an entity update.
+        //! @return the current estimate for the size of an entity update
+        float GetUpdateSizeEstimate() const;
+
+    private:
+
+        AZ::TimeMs m_lastRefillTimeMs = AZ::TimeMs{ 0 };
+        int64_t m_budgetBytes = 0;
+        int64_t m_maxBudgetBytes = 0;
+        float m_reservedBytes = 0.0f;
+        float m_updateSizeEstimate = DefaultUpdateSizeEstimate;
+        bool m_isBudgeted = false;
+    };
+}
+
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateScheduler.inl>
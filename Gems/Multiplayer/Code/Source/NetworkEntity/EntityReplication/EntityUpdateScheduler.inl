@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace Multiplayer
+{
+    template <typename CAN_SEND, typename ON_SEND>
+    inline uint32_t EntityUpdateScheduler::SelectUpdates(const AZStd::vector<Candidate>& candidates, uint32_t maxSendCount, CAN_SEND&& canSend, ON_SEND&& onSend)
+    {
+        uint32_t sendCount = 0;
+        uint32_t pendingCount = 0;
+        for (const Candidate& candidate : candidates)
+        {
+            if (!canSend(candidate))
+            {
+                ++pendingCount;
+                continue;
+            }
+
+            if (!candidate.m_isAutonomous)
+            {
+                if ((sendCount >= maxSendCount) || !TryReserveUpdate())
+                {
+                    // Stays pending, and keeps accumulating priority until it is sent
+                    ++pendingCount;
+                    continue;
+                }
+                ++sendCount;
+            }
+
+            onSend(candidate);
+        }
+        return pendingCount;
+    }
+}
@@ -7,6 +7,7 @@
  */
 
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
+#include <Multiplayer/IMultiplayer.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
@@ -14,6 +15,7 @@
 namespace Multiplayer
 {
     AZ_CVAR(uint32_t, net_EntityReplicatorRecordsMax, 45, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of allowed outstanding entity records");
+    AZ_CVAR(bool, net_ShareEntityDeltas, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, an entity update serialized for one connection is reused by every other connection sending the same changes");
 
     PropertyPublisher::PropertyPublisher(NetEntityRole remoteNetworkRole, OwnsLifetime ownsLifetime, NetBindComponent* netBindComponent, AzNetworking::IConnection& connection)
         : m_ownsLifetime(ownsLifetime)
@@ -159,16 +161,28 @@ namespace Multiplayer
         return !IsDeleted();
     }
 
-    bool PropertyPublisher::SerializeUpdateEntityRecord(AzNetworking::ISerializer &serializer)
+    bool PropertyPublisher::SerializeUpdateEntityRecord(AzNetworking::NetworkInputSerializer& serializer)
     {
         AZ_Assert(m_netBindComponent, "NetBindComponent is nullptr");
         m_pendingRecord.ResetConsumedBits();
-        m_pendingRecord.Serialize(serializer);
-        m_netBindComponent->SerializeStateDeltaMessage(m_pendingRecord, serializer);
-        return serializer.IsValid();
+
+        if (!net_ShareEntityDeltas)
+        {
+            m_pendingRecord.Serialize(serializer);
+            m_netBindComponent->SerializeStateDeltaMessage(m_pendingRecord, serializer);
+            return serializer.IsValid();
+        }
+
+        // Every connection with the same pending changes produces the same bytes, so reuse them if another connection already serialized them
+        return m_netBindComponent->GetSerializedDeltaCache().Serialize(m_pendingRecord, serializer, GetMultiplayer()->GetStats(),
+            [this](AzNetworking::NetworkInputSerializer& deltaSerializer)
+            {
+                m_pendingRecord.Serialize(deltaSerializer);
+                m_netBindComponent->SerializeStateDeltaMessage(m_pendingRecord, deltaSerializer);
+            });
     }
 
-    bool PropertyPublisher::SerializeDeleteEntityRecord(AzNetworking::ISerializer &serializer)
+    bool PropertyPublisher::SerializeDeleteEntityRecord(AzNetworking::NetworkInputSerializer& serializer)
     {
         return serializer.IsValid();
     }
@@ -277,7 +291,7 @@ namespace Multiplayer
     }
 
 
-    bool PropertyPublisher::UpdateSerialization(AzNetworking::ISerializer& serializer)
+    bool PropertyPublisher::UpdateSerialization(AzNetworking::NetworkInputSerializer& serializer)
     {
         bool success(true);
         switch (m_replicatorState)
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzCore/std/containers/ring_buffer.h>
 
 namespace AzNetworking
@@ -43,7 +44,7 @@ namespace Multiplayer
         //! @{
         bool RequiresSerialization();
         bool PrepareSerialization();
-        bool UpdateSerialization(AzNetworking::ISerializer& serializer);
+        bool UpdateSerialization(AzNetworking::NetworkInputSerializer& serializer);
         void FinalizeSerialization(AzNetworking::PacketId sentId);
         //! @}
 
@@ -76,8 +77,8 @@ namespace Multiplayer
 
         //! Phase 2, serialize the record
         //! No add, they share the update path
-        bool SerializeUpdateEntityRecord(AzNetworking::ISerializer& serializer);
-        bool SerializeDeleteEntityRecord(AzNetworking::ISerializer& serializer);
+        bool SerializeUpdateEntityRecord(AzNetworking::NetworkInputSerializer& serializer);
+        bool SerializeDeleteEntityRecord(AzNetworking::NetworkInputSerializer& serializer);
 
         //! Phase 3, finalize with the packet id
         void FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId);
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/SerializedDeltaCache.h>
+
+namespace Multiplayer
+{
+    bool SerializedDeltaCache::CopyTo(const ReplicationRecord& record, AzNetworking::NetworkInputSerializer& serializer, MultiplayerStats& stats) const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        const Delta* delta = FindInternal(record);
+        if (delta == nullptr)
+        {
+            return false;
+        }
+
+        serializer.CopyToBuffer(delta->m_data.data(), aznumeric_cast<uint32_t>(delta->m_data.size()));
+        stats.RecordPropertiesSent(delta->m_propertiesSent);
+        return true;
+    }
+
+    void SerializedDeltaCache::Store(const ReplicationRecord& record, const uint8_t* data, uint32_t size, MultiplayerStats::PropertySentList&& propertiesSent)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if ((m_deltaCount >= MaxDeltas) || (FindInternal(record) != nullptr))
+        {
+            return;
+        }
+
+        // Deltas are reused across invalidations, so their buffers keep their capacity from tick to tick
+        if (m_deltaCount >= m_deltas.size())
+        {
+            m_deltas.emplace_back();
+        }
+
+        Delta& delta = m_deltas[m_deltaCount++];
+        delta.m_record = record;
+        delta.m_data.assign(data, data + size);
+        delta.m_propertiesSent = AZStd::move(propertiesSent);
+    }
+
+    void SerializedDeltaCache::Invalidate()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_deltaCount = 0;
+    }
+
+    const SerializedDeltaCache::Delta* SerializedDeltaCache::FindInternal(const ReplicationRecord& record) const
+    {
+        for (uint32_t index = 0; index < m_deltaCount; ++index)
+        {
+            if (m_deltas[index].m_record.HasSameChanges(record))
+            {
+                return &m_deltas[index];
+            }
+        }
+        return nullptr;
+    }
+}
@@ -0,0 +1,391 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkTime/RewindHistory.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/Components/NetworkTransformComponent.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/Sphere.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(bool, sv_RewindHistory, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Record the transforms and bounds of entities each host frame for lag compensated queries, servers that make no such queries should leave this off");
+    AZ_CVAR(uint32_t, sv_RewindHistoryFrames, RewindHistorySize, nullptr, AZ::ConsoleFunctorFlags::Null, "The number of host frames of entity transforms and bounds kept for lag compensated queries");
+    AZ_CVAR(float, sv_RewindHistoryCellSize, 16.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The horizontal size of the cells entities are bucketed into for lag compensated queries");
+
+    namespace RewindHistoryInternal
+    {
+        // Entities larger than this many cells are tested by every query rather than bucketed
+        static constexpr float LargeEntityCells = 2.0f;
+
+        static constexpr uint32_t SignFlip = 0x80000000u;
+    }
+
+    RewindHistory::RewindHistory()
+    {
+        AZ::Interface<IRewindHistory>::Register(this);
+    }
+
+    RewindHistory::~RewindHistory()
+    {
+        AZ::Interface<IRewindHistory>::Unregister(this);
+    }
+
+    RewindHistory::CellKey RewindHistory::GetCellKey(int32_t cellX, int32_t cellY)
+    {
+        // Flipping the sign bits keeps keys in coordinate order, so the cells of a column are contiguous and sorted by row
+        using namespace RewindHistoryInternal;
+        return (static_cast<CellKey>(static_cast<uint32_t>(cellX) ^ SignFlip) << 32) | static_cast<CellKey>(static_cast<uint32_t>(cellY) ^ SignFlip);
+    }
+
+    int32_t RewindHistory::GetCellCoordinate(float position, float cellSize)
+    {
+        return static_cast<int32_t>(AZStd::floor(position / cellSize));
+    }
+
+    const RewindHistory::Frame* RewindHistory::FindFrame(HostFrameId frameId) const
+    {
+        if (m_frames.empty() || (frameId == InvalidHostFrameId))
+        {
+            return nullptr;
+        }
+
+        const Frame& frame = m_frames[static_cast<uint32_t>(frameId) % m_frames.size()];
+        return (frame.m_frameId == frameId) ? &frame : nullptr;
+    }
+
+    template <typename VISITOR>
+    void RewindHistory::EnumerateCells(const Frame& frame, float minX, float minY, float maxX, float maxY, VISITOR&& visitor)
+    {
+        for (uint32_t index = frame.m_largeStart; index < frame.m_netEntityIds.size(); ++index)
+        {
+            visitor(index);
+        }
+
+        // Entities are bucketed by their center, so pad the query by the largest half extent of any bucketed entity
+        const float margin = frame.m_maxHalfExtent;
+        const int32_t minCellX = GetCellCoordinate(minX - margin, frame.m_cellSize);
+        const int32_t maxCellX = GetCellCoordinate(maxX + margin, frame.m_cellSize);
+        const int32_t minCellY = GetCellCoordinate(minY - margin, frame.m_cellSize);
+        const int32_t maxCellY = GetCellCoordinate(maxY + margin, frame.m_cellSize);
+        for (int32_t cellX = minCellX; cellX <= maxCellX; ++cellX)
+        {
+            EnumerateColumn(frame, cellX, minCellY, maxCellY, visitor);
+        }
+    }
+
+    template <typename VISITOR>
+    void RewindHistory::EnumerateColumn(const Frame& frame, int32_t cellX, int32_t minCellY, int32_t maxCellY, VISITOR&& visitor)
+    {
+        const CellKey firstKey = GetCellKey(cellX, minCellY);
+        const CellKey lastKey = GetCellKey(cellX, maxCellY);
+        auto cellIter = AZStd::lower_bound(frame.m_cells.begin(), frame.m_cells.end(), firstKey,
+            [](const Cell& cell, CellKey key) { return cell.m_key < key; });
+        for (; (cellIter != frame.m_cells.end()) && (cellIter->m_key <= lastKey); ++cellIter)
+        {
+            for (uint32_t index = cellIter->m_start; index < cellIter->m_start + cellIter->m_count; ++index)
+            {
+                visitor(index);
+            }
+        }
+    }
+
+    void RewindHistory::RecordFrame(HostFrameId frameId)
+    {
+        if (!sv_RewindHistory)
+        {
+            // Recording walks the whole visibility scene every frame, so drop the history rather than let queries see stale frames
+            if (!m_frames.empty())
+            {
+                Clear();
+            }
+            return;
+        }
+
+        AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
+        if (visibilitySystem == nullptr)
+        {
+            return;
+        }
+
+        m_gatheredStates.clear();
+        visibilitySystem->GetDefaultVisibilityScene()->EnumerateNoCull([this](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
+                {
+                    if ((visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity) == 0)
+                    {
+                        continue;
+                    }
+
+                    // Only entities with a rewindable transform can be lag compensated
+                    AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
+                    if (entity->template FindComponent<NetworkTransformComponent>() == nullptr)
+                    {
+                        continue;
+                    }
+
+                    // Due to component constraints, netBindComponent must exist if networkTransform exists
+                    const NetBindComponent* netBindComponent = entity->template FindComponent<NetBindComponent>();
+
+                    EntityState state;
+                    state.m_netEntityId = netBindComponent->GetNetEntityId();
+                    state.m_transform = entity->GetTransform()->GetWorldTM();
+                    state.m_bounds = visEntry->m_boundingVolume;
+                    m_gatheredStates.push_back(state);
+                }
+            });
+
+        RecordFrame(frameId, m_gatheredStates);
+    }
+
+    void RewindHistory::RecordFrame(HostFrameId frameId, const AZStd::vector<EntityState>& entityStates)
+    {
+        using namespace RewindHistoryInternal;
+
+        const uint32_t frameCount = AZStd::max(static_cast<uint32_t>(sv_RewindHistoryFrames), 1u);
+        if (m_frames.size() != frameCount)
+        {
+            m_frames.clear();
+            m_frames.resize(frameCount);
+        }
+
+        const float cellSize = AZStd::max(static_cast<float>(sv_RewindHistoryCellSize), 1.0f);
+        const float largeExtent = LargeEntityCells * cellSize;
+        float maxHalfExtent = 0.0f;
+
+        // Large entities sort after every cell, so they end up in one range at the end of the frame
+        m_gatheredEntities.clear();
+        for (uint32_t stateIndex = 0; stateIndex < entityStates.size(); ++stateIndex)
+        {
+            const AZ::Aabb& bounds = entityStates[stateIndex].m_bounds;
+            const AZ::Vector3 extents = bounds.GetExtents();
+            const float horizontalExtent = AZStd::max(extents.GetX(), extents.GetY());
+
+            GatheredEntity gathered;
+            gathered.m_stateIndex = stateIndex;
+            if (horizontalExtent > largeExtent)
+            {
+                gathered.m_key = AZStd::numeric_limits<CellKey>::max();
+            }
+            else
+            {
+                const AZ::Vector3 center = bounds.GetCenter();
+                gathered.m_key = GetCellKey(GetCellCoordinate(center.GetX(), cellSize), GetCellCoordinate(center.GetY(), cellSize));
+                maxHalfExtent = AZStd::max(maxHalfExtent, 0.5f * horizontalExtent);
+            }
+            m_gatheredEntities.push_back(gathered);
+        }
+
+        AZStd::sort(m_gatheredEntities.begin(), m_gatheredEntities.end(), [](const GatheredEntity& lhs, const GatheredEntity& rhs)
+        {
+            return (lhs.m_key != rhs.m_key) ? (lhs.m_key < rhs.m_key) : (lhs.m_stateIndex < rhs.m_stateIndex);
+        });
+
+        Frame& frame = m_frames[static_cast<uint32_t>(frameId) % m_frames.size()];
+        frame.m_frameId = frameId;
+        frame.m_cellSize = cellSize;
+        frame.m_maxHalfExtent = maxHalfExtent;
+        frame.m_largeStart = aznumeric_cast<uint32_t>(m_gatheredEntities.size());
+        frame.m_netEntityIds.clear();
+        frame.m_transforms.clear();
+        frame.m_bounds.clear();
+        frame.m_cells.clear();
+        frame.m_entityIndices.clear();
+
+        for (const GatheredEntity& gathered : m_gatheredEntities)
+        {
+            const uint32_t index = aznumeric_cast<uint32_t>(frame.m_netEntityIds.size());
+            if (gathered.m_key == AZStd::numeric_limits<CellKey>::max())
+            {
+                frame.m_largeStart = AZStd::min(frame.m_largeStart, index);
+            }
+            else if (frame.m_cells.empty() || (frame.m_cells.back().m_key != gathered.m_key))
+            {
+                frame.m_cells.push_back({ gathered.m_key, index, 1 });
+            }
+            else
+            {
+                ++frame.m_cells.back().m_count;
+            }
+
+            const EntityState& state = entityStates[gathered.m_stateIndex];
+            frame.m_netEntityIds.push_back(state.m_netEntityId);
+            frame.m_transforms.push_back(state.m_transform);
+            frame.m_bounds.push_back(state.m_bounds);
+            frame.m_entityIndices.emplace_back(state.m_netEntityId, index);
+        }
+
+        AZStd::sort(frame.m_entityIndices.begin(), frame.m_entityIndices.end());
+    }
+
+    void RewindHistory::Clear()
+    {
+        m_frames.clear();
+        m_gatheredStates.clear();
+        m_gatheredEntities.clear();
+    }
+
+    bool RewindHistory::IsFrameRecorded(HostFrameId frameId) const
+    {
+        return FindFrame(frameId) != nullptr;
+    }
+
+    bool RewindHistory::GetEntityState(HostFrameId frameId, NetEntityId netEntityId, AZ::Transform& outTransform, AZ::Aabb& outBounds) const
+    {
+        const Frame* frame = FindFrame(frameId);
+        if (frame == nullptr)
+        {
+            return false;
+        }
+
+        auto iter = AZStd::lower_bound(frame->m_entityIndices.begin(), frame->m_entityIndices.end(), netEntityId,
+            [](const AZStd::pair<NetEntityId, uint32_t>& entityIndex, NetEntityId id) { return entityIndex.first < id; });
+        if ((iter == frame->m_entityIndices.end()) || (iter->first != netEntityId))
+        {
+            return false;
+        }
+
+        outTransform = frame->m_transforms[iter->second];
+        outBounds = frame->m_bounds[iter->second];
+        return true;
+    }
+
+    bool RewindHistory::Raycast(HostFrameId frameId, const AZ::Vector3& start, const AZ::Vector3& end, RewindRaycastHits& outHits) const
+    {
+        using namespace RewindHistoryInternal;
+
+        const Frame* frame = FindFrame(frameId);
+        if (frame == nullptr)
+        {
+            return false;
+        }
+
+        const AZ::Vector3 delta = end - start;
+        const float length = delta.GetLength();
+        if (length <= 0.0f)
+        {
+            return true;
+        }
+
+        // The ray is parameterized over [0, 1] from start to end. Axes the ray runs parallel to have an infinite reciprocal,
+        // IntersectRayAABB tests those against the slab directly rather than using the reciprocal.
+        const AZ::Vector3 deltaRCP = delta.GetReciprocal();
+        const size_t firstHit = outHits.size();
+        auto testEntity = [frame, &start, &delta, &deltaRCP, length, &outHits](uint32_t index)
+        {
+            float tStart = 0.0f;
+            float tEnd = 0.0f;
+            AZ::Vector3 startNormal;
+            if (AZ::Intersect::IntersectRayAABB(start, delta, deltaRCP, frame->m_bounds[index], tStart, tEnd, startNormal) == AZ::Intersect::ISECT_RAY_AABB_NONE)
+            {
+                return;
+            }
+            if (tStart <= 1.0f)
+            {
+                outHits.push_back({ frame->m_netEntityIds[index], tStart * length });
+            }
+        };
+
+        for (uint32_t index = frame->m_largeStart; index < frame->m_netEntityIds.size(); ++index)
+        {
+            testEntity(index);
+        }
+
+        // Walk the columns of cells the ray crosses, visiting only the rows the ray covers within each column. Entities are
+        // bucketed by their center, so both are padded by the largest half extent of any bucketed entity.
+        const float cellSize = frame->m_cellSize;
+        const float margin = frame->m_maxHalfExtent;
+        const float startX = start.GetX();
+        const float startY = start.GetY();
+        const float deltaX = delta.GetX();
+        const float deltaY = delta.GetY();
+        const int32_t minCellX = GetCellCoordinate(AZStd::min(startX, startX + deltaX) - margin, cellSize);
+        const int32_t maxCellX = GetCellCoordinate(AZStd::max(startX, startX + deltaX) + margin, cellSize);
+        for (int32_t cellX = minCellX; cellX <= maxCellX; ++cellX)
+        {
+            float tMin = 0.0f;
+            float tMax = 1.0f;
+            if (deltaX != 0.0f)
+            {
+                const float t0 = (static_cast<float>(cellX) * cellSize - margin - startX) / deltaX;
+                const float t1 = (static_cast<float>(cellX + 1) * cellSize + margin - startX) / deltaX;
+                tMin = AZStd::max(AZStd::min(t0, t1), 0.0f);
+                tMax = AZStd::min(AZStd::max(t0, t1), 1.0f);
+                if (tMin > tMax)
+                {
+                    continue;
+                }
+            }
+
+            const float y0 = startY + deltaY * tMin;
+            const float y1 = startY + deltaY * tMax;
+            const int32_t minCellY = GetCellCoordinate(AZStd::min(y0, y1) - margin, cellSize);
+            const int32_t maxCellY = GetCellCoordinate(AZStd::max(y0, y1) + margin, cellSize);
+            EnumerateColumn(*frame, cellX, minCellY, maxCellY, testEntity);
+        }
+
+        AZStd::sort(outHits.begin() + firstHit, outHits.end(), [](const RewindRaycastHit& lhs, const RewindRaycastHit& rhs)
+        {
+            return lhs.m_distance < rhs.m_distance;
+        });
+        return true;
+    }
+
+    bool RewindHistory::OverlapAabb(HostFrameId frameId, const AZ::Aabb& volume, RewindOverlapHits& outHits) const
+    {
+        const Frame* frame = FindFrame(frameId);
+        if (frame == nullptr)
+        {
+            return false;
+        }
+
+        auto testEntity = [frame, &volume, &outHits](uint32_t index)
+        {
+            if (AZ::ShapeIntersection::Overlaps(frame->m_bounds[index], volume))
+            {
+                outHits.push_back(frame->m_netEntityIds[index]);
+            }
+        };
+
+        const AZ::Vector3 min = volume.GetMin();
+        const AZ::Vector3 max = volume.GetMax();
+        EnumerateCells(*frame, min.GetX(), min.GetY(), max.GetX(), max.GetY(), testEntity);
+        return true;
+    }
+
+    bool RewindHistory::OverlapSphere(HostFrameId frameId, const AZ::Vector3& center, float radius, RewindOverlapHits& outHits) const
+    {
+        const Frame* frame = FindFrame(frameId);
+        if (frame == nullptr)
+        {
+            return false;
+        }
+
+        const AZ::Sphere sphere(center, radius);
+        auto testEntity = [frame, &sphere, &outHits](uint32_t index)
+        {
+            if (AZ::ShapeIntersection::Overlaps(sphere, frame->m_bounds[index]))
+            {
+                outHits.push_back(frame->m_netEntityIds[index]);
+            }
+        };
+
+        EnumerateCells(*frame, center.GetX() - radius, center.GetY() - radius, center.GetX() + radius, center.GetY() + radius, testEntity);
+        return true;
+    }
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/NetworkTime/IRewindHistory.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utils.h>
+
+namespace Multiplayer
+{
+    //! Implementation of the IRewindHistory interface.
+    //!
+    //! History is a ring of frames, each laid out as parallel arrays so queries stream through bounds without touching
+    //! transforms or ids. Entities of each frame are bucketed into horizontal cells by the center of their bounds and
+    //! grouped by cell, with a sorted cell list to find the entities near a query. Frames are recycled in place, so once the
+    //! ring is warm, recording a frame does not allocate.
+    class RewindHistory
+        : public IRewindHistory
+    {
+    public:
+        //! The state of an entity recorded for a frame.
+        struct EntityState
+        {
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            AZ::Transform m_transform = AZ::Transform::CreateIdentity();
+            AZ::Aabb m_bounds = AZ::Aabb::CreateNull();
+        };
+
+        RewindHistory();
+        virtual ~RewindHistory();
+
+        //! Records the state of every rewindable entity, must be called from the main thread once the frame has been simulated.
+        //! Does nothing but discard the history unless sv_RewindHistory is enabled.
+        //! @param frameId the host frame the current entity state belongs to
+        void RecordFrame(HostFrameId frameId);
+
+        //! Records already gathered entity state as a frame, replacing the oldest frame once the history is full.
+        //! @param frameId      the host frame the entity state belongs to
+        //! @param entityStates the state of every entity to record
+        void RecordFrame(HostFrameId frameId, const AZStd::vector<EntityState>& entityStates);
+
+        //! Discards all recorded frames.
+        void Clear();
+
+        //! IRewindHistory overrides.
+        //! @{
+        bool IsFrameRecorded(HostFrameId frameId) const override;
+        bool GetEntityState(HostFrameId frameId, NetEntityId netEntityId, AZ::Transform& outTransform, AZ::Aabb& outBounds) const override;
+        bool Raycast(HostFrameId frameId, const AZ::Vector3& start, const AZ::Vector3& end, RewindRaycastHits& outHits) const override;
+        bool OverlapAabb(HostFrameId frameId, const AZ::Aabb& volume, RewindOverlapHits& outHits) const override;
+        bool OverlapSphere(HostFrameId frameId, const AZ::Vector3& center, float radius, RewindOverlapHits& outHits) const override;
+        //! @}
+
+    private:
+
+        using CellKey = uint64_t;
+
+        struct Cell
+        {
+            CellKey m_key = 0;
+            uint32_t m_start = 0;
+            uint32_t m_count = 0;
+        };
+
+        struct Frame
+        {
+            HostFrameId m_frameId = InvalidHostFrameId;
+            float m_cellSize = 1.0f;
+            float m_maxHalfExtent = 0.0f; //!< Largest horizontal half extent of an entity bucketed into a cell
+            uint32_t m_largeStart = 0; //!< Entities from this index on are larger than a cell, and tested by every query
+
+            // Entity state, grouped by cell
+            AZStd::vector<NetEntityId> m_netEntityIds;
+            AZStd::vector<AZ::Transform> m_transforms;
+            AZStd::vector<AZ::Aabb> m_bounds;
+
+            AZStd::vector<Cell> m_cells; //!< Sorted by key
+            AZStd::vector<AZStd::pair<NetEntityId, uint32_t>> m_entityIndices; //!< Sorted by id, for entity lookups
+        };
+
+        struct GatheredEntity
+        {
+            CellKey m_key = 0;
+            uint32_t m_stateIndex = 0;
+        };
+
+        static CellKey GetCellKey(int32_t cellX, int32_t cellY);
+        static int32_t GetCellCoordinate(float position, float cellSize);
+
+        const Frame* FindFrame(HostFrameId frameId) const;
+
+        //! Invokes a visitor with the index of every entity of a frame that may lie within the given horizontal bounds.
+        template <typename VISITOR>
+        static void EnumerateCells(const Frame& frame, float minX, float minY, float maxX, float maxY, VISITOR&& visitor);
+        template <typename VISITOR>
+        static void EnumerateColumn(const Frame& frame, int32_t cellX, int32_t minCellY, int32_t maxCellY, VISITOR&& visitor);
+
+        AZStd::vector<Frame> m_frames;
+        AZStd::vector<EntityState> m_gatheredStates;
+        AZStd::vector<GatheredEntity> m_gatheredEntities;
+    };
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/ReplicationInterestGrid.h>
+#include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(AZ::TimeMs, sv_ClientReplicationWindowUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate for replication window updates.");
+    AZ_CVAR(float, sv_InterestGridCellSize, 125.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The horizontal size of the cells networked entities are bucketed into when gathering entities for replication windows");
+    AZ_CVAR(bool, sv_ReplicationWindowParallelUpdate, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Evaluate client replication windows in parallel jobs, requires IFilterEntityManager and priority functions to be thread safe");
+    AZ_CVAR(AZ::CVarFixedString, sv_ReplicationPriority, "Distance", nullptr, AZ::ConsoleFunctorFlags::Null, "The built-in function used to prioritize entities for replication when none was set through IMultiplayer: Distance, ViewCone or Recency");
+
+    ReplicationInterestGrid::ReplicationInterestGrid()
+        : m_updateEvent([this]() { Update(); }, AZ::Name("Replication interest grid update event"))
+    {
+        ;
+    }
+
+    ReplicationInterestGrid::~ReplicationInterestGrid()
+    {
+        AZ_Assert(m_windows.empty(), "ReplicationInterestGrid destroyed with %u replication windows still registered", GetWindowCount());
+    }
+
+    void ReplicationInterestGrid::RegisterWindow(ServerToClientReplicationWindow* window)
+    {
+        m_windows.push_back(window);
+        if (!m_updateEvent.IsScheduled())
+        {
+            m_updateEvent.Enqueue(sv_ClientReplicationWindowUpdateMs, true);
+        }
+    }
+
+    void ReplicationInterestGrid::UnregisterWindow(ServerToClientReplicationWindow* window)
+    {
+        auto iter = AZStd::find(m_windows.begin(), m_windows.end(), window);
+        if (iter != m_windows.end())
+        {
+            m_windows.erase(iter);
+        }
+
+        if (m_windows.empty())
+        {
+            m_updateEvent.RemoveFromQueue();
+        }
+    }
+
+    uint32_t ReplicationInterestGrid::GetWindowCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_windows.size());
+    }
+
+    void ReplicationInterestGrid::SetPriorityFunction(ReplicationPriorityFunction priorityFunction)
+    {
+        m_customPriorityFunction = AZStd::move(priorityFunction);
+    }
+
+    const ReplicationPriorityFunction& ReplicationInterestGrid::GetPriorityFunction() const
+    {
+        return m_activePriorityFunction;
+    }
+
+    void ReplicationInterestGrid::Update()
+    {
+        if (m_customPriorityFunction)
+        {
+            m_activePriorityFunction = m_customPriorityFunction;
+        }
+        else
+        {
+            const AZ::CVarFixedString priorityName = static_cast<AZ::CVarFixedString>(sv_ReplicationPriority);
+            if (priorityName == "ViewCone")
+            {
+                m_activePriorityFunction = &ViewConeReplicationPriority;
+            }
+            else if (priorityName == "Recency")
+            {
+                m_activePriorityFunction = &RecencyReplicationPriority;
+            }
+            else
+            {
+                AZ_Warning("Multiplayer", priorityName == "Distance", "Unknown sv_ReplicationPriority %s, falling back to Distance", priorityName.c_str());
+                m_activePriorityFunction = &DistanceReplicationPriority;
+            }
+        }
+
+        Rebuild();
+
+        // Windows only write to their own state while evaluating, so they can all run at once
+        if (sv_ReplicationWindowParallelUpdate && (m_windows.size() > 1) && (AZ::JobContext::GetGlobalContext() != nullptr))
+        {
+            AZ::JobCompletion jobCompletion;
+            for (ServerToClientReplicationWindow* window : m_windows)
+            {
+                AZ::Job* job = AZ::CreateJobFunction([window]() { window->UpdateWindow(); }, true);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (ServerToClientReplicationWindow* window : m_windows)
+            {
+                window->UpdateWindow();
+            }
+        }
+
+        Clear();
+    }
+
+    void ReplicationInterestGrid::Rebuild()
+    {
+        AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
+        if (visibilitySystem == nullptr)
+        {
+            Clear();
+            return;
+        }
+
+        // Gather every networked entity once, rather than once per client
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        AZStd::vector<Entry> gatheredEntries;
+        gatheredEntries.reserve(m_entries.capacity() + m_largeEntries.capacity());
+        visibilitySystem->GetDefaultVisibilityScene()->EnumerateNoCull([&gatheredEntries, networkEntityTracker](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
+                {
+                    if ((visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity) == 0)
+                    {
+                        continue;
+                    }
+
+                    AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
+                    NetBindComponent* netBindComponent = entity->template FindComponent<NetBindComponent>();
+                    if (netBindComponent == nullptr)
+                    {
+                        continue;
+                    }
+
+                    Entry entry;
+                    entry.m_entity = entity;
+                    entry.m_entityHandle = ConstNetworkEntityHandle(netBindComponent, networkEntityTracker);
+                    entry.m_bounds = visEntry->m_boundingVolume;
+                    gatheredEntries.push_back(AZStd::move(entry));
+                }
+            });
+
+        Rebuild(AZStd::move(gatheredEntries));
+    }
+
+    void ReplicationInterestGrid::Rebuild(AZStd::vector<Entry>&& entries)
+    {
+        Clear();
+
+        m_cellSize = AZStd::max(static_cast<float>(sv_InterestGridCellSize), 1.0f);
+
+        for (uint32_t entryIndex = 0; entryIndex < entries.size(); ++entryIndex)
+        {
+            Entry& entry = entries[entryIndex];
+            const AZ::Vector3 extents = entry.m_bounds.GetExtents();
+            if (AZStd::max(extents.GetX(), extents.GetY()) > 2.0f * m_cellSize)
+            {
+                m_largeEntries.push_back(AZStd::move(entry));
+            }
+            else
+            {
+                const AZ::Vector3 center = entry.m_bounds.GetCenter();
+                m_sortKeys.emplace_back(GetCellKey(GetCellCoordinate(center.GetX()), GetCellCoordinate(center.GetY())), entryIndex);
+            }
+        }
+
+        // Lay entries out contiguously per cell, so a query walks a few dense ranges
+        AZStd::sort(m_sortKeys.begin(), m_sortKeys.end());
+        m_entries.reserve(m_sortKeys.size());
+        for (const AZStd::pair<CellKey, uint32_t>& sortKey : m_sortKeys)
+        {
+            CellRange& range = m_cells[sortKey.first];
+            if (range.m_count == 0)
+            {
+                range.m_start = aznumeric_cast<uint32_t>(m_entries.size());
+            }
+            ++range.m_count;
+            m_entries.push_back(AZStd::move(entries[sortKey.second]));
+        }
+    }
+
+    void ReplicationInterestGrid::Clear()
+    {
+        m_entries.clear();
+        m_largeEntries.clear();
+        m_sortKeys.clear();
+        m_cells.clear();
+    }
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <Multiplayer/ReplicationWindows/ReplicationPriority.h>
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    class Entity;
+}
+
+namespace Multiplayer
+{
+    class ServerToClientReplicationWindow;
+
+    //! @class ReplicationInterestGrid
+    //! @brief Spatial hash of every networked entity, shared by all server to client replication windows.
+    //!
+    //! Rather than each replication window enumerating the visibility octree on its own schedule, the grid gathers the
+    //! networked entities once per update into horizontal cells, then has every registered window evaluate its client
+    //! against the cells surrounding it. Clients in the same area read the same cell lists, and their windows can be evaluated
+    //! in parallel jobs through sv_ReplicationWindowParallelUpdate.
+    class ReplicationInterestGrid
+    {
+    public:
+
+        //! A networked entity gathered by the grid, along with the data windows need to rank it.
+        struct Entry
+        {
+            AZ::Entity* m_entity = nullptr;
+            ConstNetworkEntityHandle m_entityHandle;
+            AZ::Aabb m_bounds = AZ::Aabb::CreateNull();
+        };
+
+        ReplicationInterestGrid();
+        ~ReplicationInterestGrid();
+
+        //! Adds a window to be evaluated on every grid update.
+        //! @param window the window to add, must be unregistered before it is destroyed
+        void RegisterWindow(ServerToClientReplicationWindow* window);
+
+        //! Stops evaluating a window.
+        //! @param window the window to remove
+        void UnregisterWindow(ServerToClientReplicationWindow* window);
+
+        //! Returns the number of registered windows.
+        //! @return the number of registered windows
+        uint32_t GetWindowCount() const;
+
+        //! Overrides the priority function used to rank entities, an empty function restores the built-in function
+        //! selected by sv_ReplicationPriority.
+        //! @param priorityFunction the priority function to use
+        void SetPriorityFunction(ReplicationPriorityFunction priorityFunction);
+
+        //! Returns the priority function windows should rank entities with during the current update.
+        //! @return the priority function windows should rank entities with during the current update
+        const ReplicationPriorityFunction& GetPriorityFunction() const;
+
+        //! Gathers all networked entities and evaluates every registered window against them.
+        void Update();
+
+        //! Gathers all networked entities from the default visibility scene into the grid.
+        void Rebuild();
+
+        //! Buckets already gathered entities into the grid, replacing any previously gathered entities.
+        //! @param entries the entities to bucket, moved into the grid
+        void Rebuild(AZStd::vector<Entry>&& entries);
+
+        //! Releases the gathered entities, handles in the grid must not outlive the update that gathered them.
+        void Clear();
+
+        //! Invokes a visitor for every gathered entity that may lie within the given sphere.
+        //! Callers still need to test the bounds of each entry, as entries are bucketed by the center of their bounds.
+        //! Safe to call from several threads at once between Rebuild and Clear.
+        //! @param center  center of the sphere
+        //! @param radius  radius of the sphere
+        //! @param visitor callable taking a const Entry&
+        template <typename VISITOR>
+        void EnumerateSphere(const AZ::Vector3& center, float radius, VISITOR&& visitor) const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(ReplicationInterestGrid);
+
+        using CellKey = uint64_t;
+        static CellKey GetCellKey(int32_t cellX, int32_t cellY);
+        int32_t GetCellCoordinate(float position) const;
+
+        struct CellRange
+        {
+            uint32_t m_start = 0;
+            uint32_t m_count = 0;
+        };
+
+        AZStd::vector<ServerToClientReplicationWindow*> m_windows;
+        AZ::ScheduledEvent m_updateEvent;
+
+        ReplicationPriorityFunction m_customPriorityFunction;
+        ReplicationPriorityFunction m_activePriorityFunction;
+
+        float m_cellSize = 1.0f;
+        AZStd::vector<Entry> m_entries; //!< Grouped by cell, each cell's range is stored in m_cells
+        AZStd::vector<Entry> m_largeEntries; //!< Entries wider than two cells, tested by every query
+        AZStd::vector<AZStd::pair<CellKey, uint32_t>> m_sortKeys;
+        AZStd::unordered_map<CellKey, CellRange> m_cells;
+    };
+}
+
+#include <Source/ReplicationWindows/ReplicationInterestGrid.inl>
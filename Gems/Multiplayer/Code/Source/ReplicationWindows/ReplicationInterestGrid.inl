@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/math.h>
+
+namespace Multiplayer
+{
+    inline ReplicationInterestGrid::CellKey ReplicationInterestGrid::GetCellKey(int32_t cellX, int32_t cellY)
+    {
+        return (static_cast<CellKey>(static_cast<uint32_t>(cellX)) << 32) | static_cast<CellKey>(static_cast<uint32_t>(cellY));
+    }
+
+    inline int32_t ReplicationInterestGrid::GetCellCoordinate(float position) const
+    {
+        return static_cast<int32_t>(AZStd::floor(position / m_cellSize));
+    }
+
+    template <typename VISITOR>
+    inline void ReplicationInterestGrid::EnumerateSphere(const AZ::Vector3& center, float radius, VISITOR&& visitor) const
+    {
+        for (const Entry& entry : m_largeEntries)
+        {
+            visitor(entry);
+        }
+
+        if (m_cells.empty())
+        {
+            return;
+        }
+
+        // Entries are bucketed by the center of their bounds, and entries wider than two cells are kept out of the grid, so a bucketed
+        // entry reaches at most one cell from its center. Padding the query by one cell finds every entry whose bounds touch the sphere
+        const float queryRadius = radius + m_cellSize;
+        const int32_t minX = GetCellCoordinate(center.GetX() - queryRadius);
+        const int32_t maxX = GetCellCoordinate(center.GetX() + queryRadius);
+        const int32_t minY = GetCellCoordinate(center.GetY() - queryRadius);
+        const int32_t maxY = GetCellCoordinate(center.GetY() + queryRadius);
+
+        for (int32_t cellX = minX; cellX <= maxX; ++cellX)
+        {
+            for (int32_t cellY = minY; cellY <= maxY; ++cellY)
+            {
+                auto cellIter = m_cells.find(GetCellKey(cellX, cellY));
+                if (cellIter == m_cells.end())
+                {
+                    continue;
+                }
+
+                const CellRange& range = cellIter->second;
+                for (uint32_t entryIndex = range.m_start; entryIndex < range.m_start + range.m_count; ++entryIndex)
+                {
+                    visitor(m_entries[entryIndex]);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/ReplicationWindows/ReplicationPriority.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(float, sv_ReplicationPriorityBehindScale, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null, "Scale applied by the ViewCone replication priority to entities directly behind the client");
+    AZ_CVAR(float, sv_ReplicationPriorityStarvationMs, 1000.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Time without replication over which the Recency replication priority doubles an entity's priority");
+
+    float DistanceReplicationPriority(const ReplicationPriorityContext& context)
+    {
+        return (context.m_distanceSquared > 0.0f) ? 1.0f / context.m_distanceSquared : 0.0f;
+    }
+
+    float ViewConeReplicationPriority(const ReplicationPriorityContext& context)
+    {
+        const AZ::Vector3 toCandidate = context.m_closestPosition - context.m_viewerPosition;
+        const float facing = toCandidate.IsZero() ? 1.0f : context.m_viewerForward.Dot(toCandidate.GetNormalized());
+        // Full priority straight ahead, falling off to sv_ReplicationPriorityBehindScale directly behind
+        const float scale = AZ::Lerp(static_cast<float>(sv_ReplicationPriorityBehindScale), 1.0f, 0.5f * (facing + 1.0f));
+        return DistanceReplicationPriority(context) * scale;
+    }
+
+    float RecencyReplicationPriority(const ReplicationPriorityContext& context)
+    {
+        const float starvationMs = AZStd::max(static_cast<float>(sv_ReplicationPriorityStarvationMs), 1.0f);
+        const float scale = 1.0f + static_cast<float>(static_cast<int64_t>(context.m_timeSinceReplicatedMs)) / starvationMs;
+        return DistanceReplicationPriority(context) * scale;
+    }
+}
@@ -7,8 +7,8 @@
  */
 
 #include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Source/ReplicationWindows/ReplicationInterestGrid.h>
 #include <Multiplayer/Components/NetBindComponent.h>
-#include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/std/sort.h>
@@ -21,8 +21,8 @@ namespace Multiplayer
     AZ_CVAR(uint32_t, sv_MaxEntitiesToReplicate, 256, nullptr, AZ::ConsoleFunctorFlags::Null, "The default max number of entities to replicate to a client connection");
     AZ_CVAR(uint32_t, sv_PacketsToIntegrateQos, 1000, nullptr, AZ::ConsoleFunctorFlags::Null, "The number of packets to accumulate before updating connection quality of service metrics");
     AZ_CVAR(float, sv_BadConnectionThreshold, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null, "The loss percentage beyond which we consider our network bad");
-    AZ_CVAR(AZ::TimeMs, sv_ClientReplicationWindowUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate for replication window updates.");
     AZ_CVAR(float, sv_ClientAwarenessRadius, 500.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum distance entities can be from the client and still be relevant");
+    AZ_CVAR(AZ::TimeMs, sv_ReplicatedTimeHistoryMs, AZ::TimeMs{ 60000 }, nullptr, AZ::ConsoleFunctorFlags::Null, "How long a client replication window remembers when an entity was last replicated, for recency based priorities");
 
     const char* GetConnectionStateString(bool isPoor)
     {
@@ -50,26 +50,32 @@ namespace Multiplayer
         return m_priority < rhs.m_priority;
     }
 
-    ServerToClientReplicationWindow::ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, const AzNetworking::IConnection* connection)
-        : m_controlledEntity(controlledEntity)
+    ServerToClientReplicationWindow::ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, const AzNetworking::IConnection* connection, ReplicationInterestGrid& interestGrid)
+        : m_interestGrid(interestGrid)
+        , m_createdTimeMs(AZ::GetElapsedTimeMs())
+        , m_controlledEntity(controlledEntity)
         , m_entityActivatedEventHandler([this](AZ::Entity* entity) { OnEntityActivated(entity); })
         , m_entityDeactivatedEventHandler([this](AZ::Entity* entity) { OnEntityDeactivated(entity); })
         , m_connection(connection)
         , m_lastCheckedSentPackets(connection->GetMetrics().m_packetsSent)
         , m_lastCheckedLostPackets(connection->GetMetrics().m_packetsLost)
-        , m_updateWindowEvent([this]() { UpdateWindow(); }, AZ::Name("Server to client replication window update event"))
     {
         AZ::Entity* entity = m_controlledEntity.GetEntity();
         AZ_Assert(entity, "Invalid controlled entity provided to replication window");
         m_controlledEntityTransform = entity ? entity->GetTransform() : nullptr;
         AZ_Assert(m_controlledEntityTransform, "Controlled player entity must have a transform");
 
-        m_updateWindowEvent.Enqueue(sv_ClientReplicationWindowUpdateMs, true);
+        m_interestGrid.RegisterWindow(this);
 
         AZ::Interface<AZ::ComponentApplicationRequests>::Get()->RegisterEntityActivatedEventHandler(m_entityActivatedEventHandler);
         AZ::Interface<AZ::ComponentApplicationRequests>::Get()->RegisterEntityDeactivatedEventHandler(m_entityDeactivatedEventHandler);
     }
 
+    ServerToClientReplicationWindow::~ServerToClientReplicationWindow()
+    {
+        m_interestGrid.UnregisterWindow(this);
+    }
+
     bool ServerToClientReplicationWindow::ReplicationSetUpdateReady()
     {
         // if we don't have a controlled entity anymore, don't send updates (validate this)
@@ -121,50 +127,44 @@ namespace Multiplayer
 
         EvaluateConnection();
 
-        AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
-        const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
-
-        AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
-        AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
-        AZ::Interface<AzFramework::IVisibilitySystem>::Get()->GetDefaultVisibilityScene()->Enumerate(awarenessSphere, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
-            {
-                gatheredEntries.reserve(gatheredEntries.size() + nodeData.m_entries.size());
-                for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
-                {
-                    if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
-                    {
-                        gatheredEntries.push_back(visEntry);
-                    }
-                }
-            }
-        );
+        const AZ::Transform& controlledEntityTransform = m_controlledEntity.GetEntity()->GetTransform()->GetWorldTM();
+        const AZ::Vector3 controlledEntityPosition = controlledEntityTransform.GetTranslation();
+        const float awarenessRadius = sv_ClientAwarenessRadius;
+        const float awarenessRadiusSquared = awarenessRadius * awarenessRadius;
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
 
-        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();        
         IFilterEntityManager* filterEntityManager = GetMultiplayer()->GetFilterEntityManager();
+        const ReplicationPriorityFunction& priorityFunction = m_interestGrid.GetPriorityFunction();
 
-        // Add all the neighbors
-        for (AzFramework::VisibilityEntry* visEntry : gatheredEntries)
-        {
-            AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
+        ReplicationPriorityContext priorityContext;
+        priorityContext.m_viewerPosition = controlledEntityPosition;
+        priorityContext.m_viewerForward = controlledEntityTransform.GetBasisY();
 
-            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entity, m_controlledEntity, m_connection->GetConnectionId()))
+        // Add all the neighbors
+        m_interestGrid.EnumerateSphere(controlledEntityPosition, awarenessRadius, [&](const ReplicationInterestGrid::Entry& entry)
             {
-                continue;
-            }
+                if (entry.m_bounds.GetDistanceSq(controlledEntityPosition) > awarenessRadiusSquared)
+                {
+                    return;
+                }
+
+                if (filterEntityManager && filterEntityManager->IsEntityFiltered(entry.m_entity, m_controlledEntity, m_connection->GetConnectionId()))
+                {
+                    return;
+                }
 
-            NetBindComponent* entryNetBindComponent = entity->template FindComponent<NetBindComponent>();
-            if (entryNetBindComponent != nullptr)
-            {
                 // We want to find the closest extent to the player and prioritize using that distance
-                const AZ::Vector3 supportNormal = controlledEntityPosition - visEntry->m_boundingVolume.GetCenter();
-                const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
-                const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(closestPosition);
-                const float priority = (gatherDistanceSquared > 0.0f) ? 1.0f / gatherDistanceSquared : 0.0f;
+                const AZ::Vector3 supportNormal = controlledEntityPosition - entry.m_bounds.GetCenter();
+                priorityContext.m_closestPosition = entry.m_bounds.GetSupport(supportNormal);
+                priorityContext.m_distanceSquared = controlledEntityPosition.GetDistanceSq(priorityContext.m_closestPosition);
+                priorityContext.m_timeSinceReplicatedMs = GetTimeSinceReplicated(entry.m_entityHandle.GetNetEntityId(), currentTimeMs);
+                const float priority = priorityFunction ? priorityFunction(priorityContext) : DistanceReplicationPriority(priorityContext);
 
-                NetworkEntityHandle entityHandle(entryNetBindComponent, networkEntityTracker);
-                AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
-            }
-        }
+                ConstNetworkEntityHandle entityHandle = entry.m_entityHandle;
+                AddEntityToReplicationSet(entityHandle, priority, priorityContext.m_distanceSquared);
+            });
+
+        UpdateReplicatedTimes(currentTimeMs);
 
         // Add in Autonomous Entities
         // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
@@ -302,6 +302,36 @@ namespace Multiplayer
         }
     }
 
+    AZ::TimeMs ServerToClientReplicationWindow::GetTimeSinceReplicated(NetEntityId netEntityId, AZ::TimeMs currentTimeMs) const
+    {
+        auto iter = m_lastReplicatedTimeMs.find(netEntityId);
+        // Entities this client has not been sent recently have waited at least as long as the window has existed
+        const AZ::TimeMs lastReplicatedTimeMs = (iter != m_lastReplicatedTimeMs.end()) ? iter->second : m_createdTimeMs;
+        return currentTimeMs - lastReplicatedTimeMs;
+    }
+
+    void ServerToClientReplicationWindow::UpdateReplicatedTimes(AZ::TimeMs currentTimeMs)
+    {
+        for (const auto& replicationEntry : m_replicationSet)
+        {
+            m_lastReplicatedTimeMs[replicationEntry.first.GetNetEntityId()] = currentTimeMs;
+        }
+
+        // Forget entities that have not been replicated in a long time, so the history does not grow with every entity ever seen
+        const AZ::TimeMs historyMs = sv_ReplicatedTimeHistoryMs;
+        for (auto iter = m_lastReplicatedTimeMs.begin(); iter != m_lastReplicatedTimeMs.end();)
+        {
+            if (currentTimeMs - iter->second > historyMs)
+            {
+                iter = m_lastReplicatedTimeMs.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+    }
+
     //void ServerToClientReplicationWindow::CollectControlledEntitiesRecursive(ReplicationSet& replicationSet, EntityHierarchyComponent::Authority& hierarchyController)
     //{
     //    auto controlledEnts = hierarchyController.GetChildrenRelatedEntities();
@@ -15,11 +15,13 @@
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/EBus/ScheduledEvent.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace Multiplayer
 {
     class NetSystemComponent;
+    class ReplicationInterestGrid;
 
     class ServerToClientReplicationWindow
         : public IReplicationWindow
@@ -38,7 +40,8 @@ namespace Multiplayer
         // we sort lowest priority first, so that we can easily keep the biggest N priorities
         using ReplicationCandidateQueue = AZStd::priority_queue<PrioritizedReplicationCandidate>;
 
-        ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, const AzNetworking::IConnection* connection);
+        ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, const AzNetworking::IConnection* connection, ReplicationInterestGrid& interestGrid);
+        ~ServerToClientReplicationWindow() override;
 
         //! IReplicationWindow interface
         //! @{
@@ -46,6 +49,8 @@ namespace Multiplayer
         const ReplicationSet& GetReplicationSet() const override;
         uint32_t GetMaxEntityReplicatorSendCount() const override;
         bool IsInWindow(const ConstNetworkEntityHandle& entityPtr, NetEntityRole& outNetworkRole) const override;
+        //! Evaluates this client against the entities gathered by the interest grid, called by the grid on each of its updates.
+        //! May run on a job thread alongside the windows of other clients.
         void UpdateWindow() override;
         void DebugDraw() const override;
         //! @}
@@ -58,6 +63,8 @@ namespace Multiplayer
 
         void EvaluateConnection();
         void AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, float distanceSquared);
+        AZ::TimeMs GetTimeSinceReplicated(NetEntityId netEntityId, AZ::TimeMs currentTimeMs) const;
+        void UpdateReplicatedTimes(AZ::TimeMs currentTimeMs);
 
         ServerToClientReplicationWindow& operator=(const ServerToClientReplicationWindow&) = delete;
 
@@ -65,7 +72,11 @@ namespace Multiplayer
         ReplicationCandidateQueue m_candidateQueue;
         ReplicationSet m_replicationSet;
 
-        AZ::ScheduledEvent m_updateWindowEvent;
+        ReplicationInterestGrid& m_interestGrid;
+
+        // Last time each entity was part of the replication set, used by recency based priority functions
+        AZStd::unordered_map<NetEntityId, AZ::TimeMs> m_lastReplicatedTimeMs;
+        AZ::TimeMs m_createdTimeMs = AZ::TimeMs{ 0 };
 
         NetworkEntityHandle m_controlledEntity;
         AZ::TransformInterface* m_controlledEntityTransform = nullptr;
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateScheduler.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class EntityUpdateSchedulerTests
+        : public AllocatorsFixture
+    {
+    public:
+        static constexpr AZ::TimeMs TickMs = AZ::TimeMs{ 100 };
+        static constexpr AZ::TimeMs BurstMs = AZ::TimeMs{ 250 };
+        static constexpr uint32_t UpdateSize = static_cast<uint32_t>(Multiplayer::EntityUpdateScheduler::DefaultUpdateSizeEstimate);
+
+        void CreateEntities(uint32_t entityCount)
+        {
+            m_relevance.resize(entityCount);
+            m_accumulatedPriority.resize(entityCount, 0.0f);
+            m_sentCount.resize(entityCount, 0);
+            for (uint32_t index = 0; index < entityCount; ++index)
+            {
+                // From fully relevant down to barely relevant
+                m_relevance[index] = 1.0f - 0.99f * static_cast<float>(index) / static_cast<float>(entityCount - 1);
+            }
+        }
+
+        // Runs one tick in which every entity has a pending update, the way a connection under a saturated budget behaves.
+        // Returns the number of bytes sent.
+        uint32_t Tick(uint32_t budgetBytesPerSecond, uint32_t updateSize = UpdateSize)
+        {
+            m_frameTimeMs += TickMs;
+            m_scheduler.RefillBudget(m_frameTimeMs, budgetBytesPerSecond, BurstMs, 0);
+
+            AZStd::vector<Multiplayer::EntityUpdateScheduler::Candidate> candidates;
+            for (uint32_t index = 0; index < m_relevance.size(); ++index)
+            {
+                Multiplayer::EntityUpdateScheduler::Candidate candidate;
+                candidate.m_netEntityId = static_cast<Multiplayer::NetEntityId>(index);
+                candidate.m_accumulatedPriority = &m_accumulatedPriority[index];
+                candidate.m_relevance = m_relevance[index];
+                candidate.m_isInWindow = true;
+                candidates.push_back(candidate);
+            }
+            Multiplayer::EntityUpdateScheduler::PrioritizeCandidates(candidates, StalenessWeight);
+
+            uint32_t sentCount = 0;
+            for (const Multiplayer::EntityUpdateScheduler::Candidate& candidate : candidates)
+            {
+                if (m_scheduler.TryReserveUpdate())
+                {
+                    *candidate.m_accumulatedPriority = 0.0f;
+                    ++m_sentCount[static_cast<uint32_t>(candidate.m_netEntityId)];
+                    ++sentCount;
+                }
+            }
+
+            const uint32_t sentBytes = sentCount * updateSize;
+            m_scheduler.RecordSentUpdates(sentCount, sentBytes);
+            return sentBytes;
+        }
+
+        static constexpr float StalenessWeight = 0.05f;
+
+        Multiplayer::EntityUpdateScheduler m_scheduler;
+        AZ::TimeMs m_frameTimeMs = AZ::TimeMs{ 1000 };
+        AZStd::vector<float> m_relevance;
+        AZStd::vector<float> m_accumulatedPriority;
+        AZStd::vector<uint32_t> m_sentCount;
+    };
+
+    TEST_F(EntityUpdateSchedulerTests, PrioritizeCandidates_AutonomousAndMoreRelevant_SortedFirst)
+    {
+        float accumulatedPriority[3] = { 0.0f, 0.0f, 0.0f };
+        AZStd::vector<Multiplayer::EntityUpdateScheduler::Candidate> candidates(3);
+        for (uint32_t index = 0; index < 3; ++index)
+        {
+            candidates[index].m_netEntityId = static_cast<Multiplayer::NetEntityId>(index);
+            candidates[index].m_accumulatedPriority = &accumulatedPriority[index];
+            candidates[index].m_isInWindow = true;
+        }
+        candidates[0].m_relevance = 0.1f;
+        candidates[1].m_relevance = 1.0f;
+        candidates[2].m_relevance = 0.01f;
+        candidates[2].m_isAutonomous = true;
+
+        Multiplayer::EntityUpdateScheduler::PrioritizeCandidates(candidates, StalenessWeight);
+        EXPECT_EQ(static_cast<Multiplayer::NetEntityId>(2), candidates[0].m_netEntityId);
+        EXPECT_EQ(static_cast<Multiplayer::NetEntityId>(1), candidates[1].m_netEntityId);
+        EXPECT_EQ(static_cast<Multiplayer::NetEntityId>(0), candidates[2].m_netEntityId);
+
+        // The most relevant entity gains a full point per tick, others gain relative to it
+        EXPECT_FLOAT_EQ(1.0f + StalenessWeight, accumulatedPriority[1]);
+        EXPECT_FLOAT_EQ(0.1f + StalenessWeight, accumulatedPriority[0]);
+    }
+
+    TEST_F(EntityUpdateSchedulerTests, PrioritizeCandidates_OutsideWindow_TreatedAsFullyRelevant)
+    {
+        float accumulatedPriority[2] = { 0.0f, 0.0f };
+        AZStd::vector<Multiplayer::EntityUpdateScheduler::Candidate> candidates(2);
+        candidates[0].m_accumulatedPriority = &accumulatedPriority[0];
+        candidates[0].m_relevance = 0.5f;
+        candidates[0].m_isInWindow = true;
+        candidates[1].m_accumulatedPriority = &accumulatedPriority[1];
+
+        Multiplayer::EntityUpdateScheduler::PrioritizeCandidates(candidates, 0.0f);
+        EXPECT_FLOAT_EQ(1.0f, accumulatedPriority[0]);
+        EXPECT_FLOAT_EQ(1.0f, accumulatedPriority[1]);
+    }
+
+    TEST_F(EntityUpdateSchedulerTests, TryReserveUpdate_NoBudget_AlwaysAdmits)
+    {
+        m_scheduler.RefillBudget(m_frameTimeMs, 0, BurstMs, 0);
+        EXPECT_FALSE(m_scheduler.IsBudgeted());
+        for (uint32_t index = 0; index < 1000; ++index)
+        {
+            EXPECT_TRUE(m_scheduler.TryReserveUpdate());
+        }
+    }
+
+    TEST_F(EntityUpdateSchedulerTests, SelectUpdates_ThrottledCandidates_DoNotConsumeBudget)
+    {
+        // Room for 3 updates, with the throttled candidates ahead of the sendable ones
+        constexpr uint32_t CandidateCount = 6;
+        constexpr uint32_t BudgetBytesPerSecond = 3 * UpdateSize * 1000 / static_cast<uint32_t>(BurstMs);
+        float accumulatedPriority[CandidateCount] = {};
+        AZStd::vector<Multiplayer::EntityUpdateScheduler::Candidate> candidates(CandidateCount);
+        for (uint32_t index = 0; index < CandidateCount; ++index)
+        {
+            candidates[index].m_netEntityId = static_cast<Multiplayer::NetEntityId>(index);
+            candidates[index].m_accumulatedPriority = &accumulatedPriority[index];
+        }
+
+        m_scheduler.RefillBudget(m_frameTimeMs, BudgetBytesPerSecond, BurstMs, 0);
+        AZStd::vector<Multiplayer::NetEntityId> sent;
+        const uint32_t pendingCount = m_scheduler.SelectUpdates(candidates, CandidateCount,
+            [](const Multiplayer::EntityUpdateScheduler::Candidate& candidate)
+            {
+                return (static_cast<uint32_t>(candidate.m_netEntityId) % 2) == 1;
+            },
+            [&sent](const Multiplayer::EntityUpdateScheduler::Candidate& candidate)
+            {
+                sent.push_back(candidate.m_netEntityId);
+            });
+
+        const AZStd::vector<Multiplayer::NetEntityId> expected = { static_cast<Multiplayer::NetEntityId>(1), static_cast<Multiplayer::NetEntityId>(3), static_cast<Multiplayer::NetEntityId>(5) };
+        EXPECT_EQ(expected, sent);
+        EXPECT_EQ(3u, pendingCount);
+        EXPECT_FALSE(m_scheduler.TryReserveUpdate());
+    }
+
+    TEST_F(EntityUpdateSchedulerTests, SelectUpdates_ThrottledCandidates_DoNotConsumeSendCount)
+    {
+        constexpr uint32_t CandidateCount = 6;
+        float accumulatedPriority[CandidateCount] = {};
+        AZStd::vector<Multiplayer::EntityUpdateScheduler::Candidate> candidates(CandidateCount);
+        for (uint32_t index = 0; index < CandidateCount; ++index)
+        {
+            candidates[index].m_netEntityId = static_cast<Multiplayer::NetEntityId>(index);
+            candidates[index].m_accumulatedPriority = &accumulatedPriority[index];
+        }
+        candidates[0].m_isAutonomous = true;
+
+        // Without a budget, only the send count limits the non-autonomous updates
+        m_scheduler.RefillBudget(m_frameTimeMs, 0, BurstMs, 0);
+        AZStd::vector<Multiplayer::NetEntityId> sent;
+        const uint32_t pendingCount = m_scheduler.SelectUpdates(candidates, 2,
+            [](const Multiplayer::EntityUpdateScheduler::Candidate& candidate)
+            {
+                return (candidate.m_netEntityId != static_cast<Multiplayer::NetEntityId>(1)) && (candidate.m_netEntityId != static_cast<Multiplayer::NetEntityId>(2));
+            },
+            [&sent](const Multiplayer::EntityUpdateScheduler::Candidate& candidate)
+            {
+                sent.push_back(candidate.m_netEntityId);
+            });
+
+        const AZStd::vector<Multiplayer::NetEntityId> expected = { static_cast<Multiplayer::NetEntityId>(0), static_cast<Multiplayer::NetEntityId>(3), static_cast<Multiplayer::NetEntityId>(4) };
+        EXPECT_EQ(expected, sent);
+        EXPECT_EQ(3u, pendingCount);
+    }
+
+    TEST_F(EntityUpdateSchedulerTests, Tick_SaturatedBudget_LowPriorityEntitiesEventuallySent)
+    {
+        // Room for 10 of the 100 entities each tick
+        constexpr uint32_t EntityCount = 100;
+        constexpr uint32_t BudgetBytesPerSecond = 10 * UpdateSize * 1000 / static_cast<uint32_t>(TickMs);
+        constexpr uint32_t TickCount = 300;
+        CreateEntities(EntityCount);
+
+        for (uint32_t tick = 0; tick < TickCount; ++tick)
+        {
+            Tick(BudgetBytesPerSecond);
+        }
+
+        for (uint32_t index = 0; index < EntityCount; ++index)
+        {
+            EXPECT_GT(m_sentCount[index], 0u) << "Entity " << index << " was starved";
+        }
+        EXPECT_GT(m_sentCount.front(), m_sentCount.back());
+    }
+
+    TEST_F(EntityUpdateSchedulerTests, Tick_SaturatedBudget_BudgetNeverExceeded)
+    {
+        constexpr uint32_t EntityCount = 100;
+        constexpr uint32_t BudgetBytesPerSecond = 5000; // Not a multiple of the update size, so ticks leave budget unspent
+        constexpr uint32_t TickCount = 300;
+        constexpr int64_t BurstBytes = BudgetBytesPerSecond * static_cast<int64_t>(BurstMs) / 1000;
+        CreateEntities(EntityCount);
+
+        int64_t totalSentBytes = 0;
+        for (uint32_t tick = 1; tick <= TickCount; ++tick)
+        {
+            const uint32_t sentBytes = Tick(BudgetBytesPerSecond);
+            totalSentBytes += sentBytes;
+
+            // Nothing is left owing, and everything sent so far fits within the first burst plus the budget refilled since
+            EXPECT_GE(m_scheduler.GetBudgetBytes(), 0);
+            EXPECT_LE(totalSentBytes, BurstBytes + BudgetBytesPerSecond * static_cast<int64_t>(TickMs) * (tick - 1) / 1000);
+            EXPECT_GT(sentBytes, 0u);
+        }
+    }
+
+    TEST_F(EntityUpdateSchedulerTests, Tick_UpdatesLargerThanEstimated_OverspendIsPaidBack)
+    {
+        constexpr uint32_t EntityCount = 100;
+        constexpr uint32_t BudgetBytesPerSecond = 10 * UpdateSize * 1000 / static_cast<uint32_t>(TickMs);
+        constexpr uint32_t TickCount = 600;
+        CreateEntities(EntityCount);
+
+        // Updates are four times the starting estimate, so the first ticks send more than their budget
+        int64_t totalSentBytes = 0;
+        for (uint32_t tick = 0; tick < TickCount; ++tick)
+        {
+            totalSentBytes += Tick(BudgetBytesPerSecond, 4 * UpdateSize);
+        }
+
+        // The estimate catches up, and the overspending is taken from later ticks rather than raising the send rate.
+        // Only the last tick can still be owing, by less than one update.
+        EXPECT_NEAR(4.0f * UpdateSize, m_scheduler.GetUpdateSizeEstimate(), 1.0f);
+        EXPECT_GT(m_scheduler.GetBudgetBytes(), -static_cast<int64_t>(4 * UpdateSize));
+        const int64_t burstBytes = BudgetBytesPerSecond * static_cast<int64_t>(BurstMs) / 1000;
+        const int64_t refilledBytes = BudgetBytesPerSecond * static_cast<int64_t>(TickMs) * (TickCount - 1) / 1000;
+        EXPECT_LE(totalSentBytes, burstBytes + refilledBytes + 4 * UpdateSize);
+        EXPECT_GE(totalSentBytes, refilledBytes / 2);
+    }
+}
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/ReplicationInterestGrid.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    class ReplicationInterestGridTests
+        : public AllocatorsFixture
+    {
+    public:
+        static constexpr float CellSize = 125.0f; // Default sv_InterestGridCellSize
+
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            AZ::NameDictionary::Create();
+            m_grid = AZStd::make_unique<Multiplayer::ReplicationInterestGrid>();
+        }
+
+        void TearDown() override
+        {
+            m_grid.reset();
+            m_entities.clear();
+            AZ::NameDictionary::Destroy();
+            AllocatorsFixture::TearDown();
+        }
+
+        AZ::Entity* CreateEntity()
+        {
+            m_entities.emplace_back(AZStd::make_unique<AZ::Entity>());
+            return m_entities.back().get();
+        }
+
+        static Multiplayer::ReplicationInterestGrid::Entry MakeEntry(AZ::Entity* entity, const AZ::Vector3& center, float halfExtent)
+        {
+            Multiplayer::ReplicationInterestGrid::Entry entry;
+            entry.m_entity = entity;
+            entry.m_bounds = AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(halfExtent));
+            return entry;
+        }
+
+        // Returns the entities whose bounds lie within the sphere, testing the bounds the way replication windows do
+        AZStd::unordered_set<AZ::Entity*> QuerySphere(const AZ::Vector3& center, float radius) const
+        {
+            AZStd::unordered_set<AZ::Entity*> result;
+            m_grid->EnumerateSphere(center, radius, [&result, &center, radius](const Multiplayer::ReplicationInterestGrid::Entry& entry)
+            {
+                if (entry.m_bounds.GetDistanceSq(center) <= radius * radius)
+                {
+                    EXPECT_TRUE(result.insert(entry.m_entity).second); // Each entry must only be visited once
+                }
+            });
+            return result;
+        }
+
+        AZStd::unique_ptr<Multiplayer::ReplicationInterestGrid> m_grid;
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> m_entities;
+    };
+
+    TEST_F(ReplicationInterestGridTests, EnumerateSphere_EntityEntersAndLeaves_ReportedOnlyWhileInside)
+    {
+        AZ::Entity* entity = CreateEntity();
+        const AZ::Vector3 queryCenter(10.0f, 10.0f, 0.0f);
+        constexpr float QueryRadius = 50.0f;
+
+        AZStd::vector<Multiplayer::ReplicationInterestGrid::Entry> entries;
+        entries.push_back(MakeEntry(entity, AZ::Vector3(500.0f, 10.0f, 0.0f), 1.0f));
+        m_grid->Rebuild(AZStd::move(entries));
+        EXPECT_TRUE(QuerySphere(queryCenter, QueryRadius).empty());
+
+        entries.clear();
+        entries.push_back(MakeEntry(entity, AZ::Vector3(40.0f, 10.0f, 0.0f), 1.0f));
+        m_grid->Rebuild(AZStd::move(entries));
+        EXPECT_EQ(1u, QuerySphere(queryCenter, QueryRadius).count(entity));
+
+        entries.clear();
+        m_grid->Rebuild(AZStd::move(entries));
+        EXPECT_TRUE(QuerySphere(queryCenter, QueryRadius).empty());
+    }
+
+    TEST_F(ReplicationInterestGridTests, EnumerateSphere_EntityMovesAcrossCells_FollowsEntity)
+    {
+        AZ::Entity* entity = CreateEntity();
+        const AZ::Vector3 oldPosition(-3.0f * CellSize + 5.0f, 2.0f * CellSize + 5.0f, 0.0f);
+        const AZ::Vector3 newPosition(4.0f * CellSize + 5.0f, -2.0f * CellSize + 5.0f, 0.0f);
+        constexpr float QueryRadius = 10.0f;
+
+        AZStd::vector<Multiplayer::ReplicationInterestGrid::Entry> entries;
+        entries.push_back(MakeEntry(entity, oldPosition, 1.0f));
+        m_grid->Rebuild(AZStd::move(entries));
+        EXPECT_EQ(1u, QuerySphere(oldPosition, QueryRadius).count(entity));
+        EXPECT_TRUE(QuerySphere(newPosition, QueryRadius).empty());
+
+        entries.clear();
+        entries.push_back(MakeEntry(entity, newPosition, 1.0f));
+        m_grid->Rebuild(AZStd::move(entries));
+        EXPECT_TRUE(QuerySphere(oldPosition, QueryRadius).empty());
+        EXPECT_EQ(1u, QuerySphere(newPosition, QueryRadius).count(entity));
+    }
+
+    TEST_F(ReplicationInterestGridTests, EnumerateSphere_EntityInNeighboringCell_Reported)
+    {
+        // The entity's center is in the cell left of the query, but its bounds reach into the sphere
+        AZ::Entity* entity = CreateEntity();
+        AZStd::vector<Multiplayer::ReplicationInterestGrid::Entry> entries;
+        entries.push_back(MakeEntry(entity, AZ::Vector3(CellSize - 20.0f, 0.0f, 0.0f), 20.0f));
+        m_grid->Rebuild(AZStd::move(entries));
+
+        EXPECT_EQ(1u, QuerySphere(AZ::Vector3(CellSize + 5.0f, 0.0f, 0.0f), 6.0f).count(entity));
+    }
+
+    TEST_F(ReplicationInterestGridTests, EnumerateSphere_EntityLargerThanCells_ReportedFromAnyCellItOverlaps)
+    {
+        AZ::Entity* entity = CreateEntity();
+        AZStd::vector<Multiplayer::ReplicationInterestGrid::Entry> entries;
+        entries.push_back(MakeEntry(entity, AZ::Vector3::CreateZero(), 4.0f * CellSize));
+        m_grid->Rebuild(AZStd::move(entries));
+
+        EXPECT_EQ(1u, QuerySphere(AZ::Vector3(3.5f * CellSize, -3.5f * CellSize, 0.0f), 1.0f).count(entity));
+        EXPECT_EQ(1u, QuerySphere(AZ::Vector3(-3.5f * CellSize, 3.5f * CellSize, 0.0f), 1.0f).count(entity));
+        EXPECT_TRUE(QuerySphere(AZ::Vector3(6.0f * CellSize, 0.0f, 0.0f), 1.0f).empty());
+    }
+
+    TEST_F(ReplicationInterestGridTests, EnumerateSphere_RandomEntities_MatchesBruteForce)
+    {
+        constexpr uint32_t EntityCount = 500;
+        constexpr uint32_t QueryCount = 50;
+        constexpr float WorldSize = 8.0f * CellSize;
+        AZ::SimpleLcgRandom random(1234);
+
+        AZStd::vector<Multiplayer::ReplicationInterestGrid::Entry> entries;
+        for (uint32_t index = 0; index < EntityCount; ++index)
+        {
+            const AZ::Vector3 position((random.GetRandomFloat() - 0.5f) * WorldSize, (random.GetRandomFloat() - 0.5f) * WorldSize, 0.0f);
+            entries.push_back(MakeEntry(CreateEntity(), position, 1.0f + random.GetRandomFloat() * CellSize));
+        }
+        const AZStd::vector<Multiplayer::ReplicationInterestGrid::Entry> allEntries = entries;
+        m_grid->Rebuild(AZStd::move(entries));
+
+        for (uint32_t query = 0; query < QueryCount; ++query)
+        {
+            const AZ::Vector3 center((random.GetRandomFloat() - 0.5f) * WorldSize, (random.GetRandomFloat() - 0.5f) * WorldSize, 0.0f);
+            const float radius = random.GetRandomFloat() * 2.0f * CellSize;
+
+            AZStd::unordered_set<AZ::Entity*> expected;
+            for (const Multiplayer::ReplicationInterestGrid::Entry& entry : allEntries)
+            {
+                if (entry.m_bounds.GetDistanceSq(center) <= radius * radius)
+                {
+                    expected.insert(entry.m_entity);
+                }
+            }
+            EXPECT_EQ(expected, QuerySphere(center, radius));
+        }
+    }
+
+    TEST_F(ReplicationInterestGridTests, EnumerateSphere_FromManyThreads_MatchesSerialQueries)
+    {
+        constexpr uint32_t EntityCount = 500;
+        constexpr uint32_t ThreadCount = 8;
+        constexpr float WorldSize = 8.0f * CellSize;
+        constexpr float QueryRadius = CellSize;
+        AZ::SimpleLcgRandom random(5678);
+
+        AZStd::vector<Multiplayer::ReplicationInterestGrid::Entry> entries;
+        for (uint32_t index = 0; index < EntityCount; ++index)
+        {
+            const AZ::Vector3 position((random.GetRandomFloat() - 0.5f) * WorldSize, (random.GetRandomFloat() - 0.5f) * WorldSize, 0.0f);
+            entries.push_back(MakeEntry(CreateEntity(), position, 1.0f));
+        }
+        m_grid->Rebuild(AZStd::move(entries));
+
+        // Each thread stands in for the window of one client, the way windows query the grid with sv_ReplicationWindowParallelUpdate
+        AZ::Vector3 centers[ThreadCount];
+        AZStd::unordered_set<AZ::Entity*> serialResults[ThreadCount];
+        for (uint32_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            centers[threadIndex] = AZ::Vector3((random.GetRandomFloat() - 0.5f) * WorldSize, (random.GetRandomFloat() - 0.5f) * WorldSize, 0.0f);
+            serialResults[threadIndex] = QuerySphere(centers[threadIndex], QueryRadius);
+        }
+
+        AZStd::unordered_set<AZ::Entity*> parallelResults[ThreadCount];
+        AZStd::vector<AZStd::thread> threads;
+        for (uint32_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back([this, &center = centers[threadIndex], &result = parallelResults[threadIndex]]()
+            {
+                result = QuerySphere(center, QueryRadius);
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (uint32_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            EXPECT_EQ(serialResults[threadIndex], parallelResults[threadIndex]);
+        }
+    }
+}
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkTime/RewindHistory.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace UnitTest
+{
+    class RewindHistoryTests
+        : public AllocatorsFixture
+    {
+    public:
+        static constexpr float CellSize = 16.0f; // Default sv_RewindHistoryCellSize
+
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            m_history = AZStd::make_unique<Multiplayer::RewindHistory>();
+        }
+
+        void TearDown() override
+        {
+            m_history.reset();
+            AllocatorsFixture::TearDown();
+        }
+
+        static Multiplayer::RewindHistory::EntityState MakeState(uint32_t netEntityId, const AZ::Vector3& position, float halfExtent)
+        {
+            Multiplayer::RewindHistory::EntityState state;
+            state.m_netEntityId = static_cast<Multiplayer::NetEntityId>(netEntityId);
+            state.m_transform = AZ::Transform::CreateTranslation(position);
+            state.m_bounds = AZ::Aabb::CreateCenterHalfExtents(position, AZ::Vector3(halfExtent));
+            return state;
+        }
+
+        // Records a frame holding a single entity, positioned by the frame id
+        void RecordMovingEntity(uint32_t frameId)
+        {
+            AZStd::vector<Multiplayer::RewindHistory::EntityState> states;
+            states.push_back(MakeState(1, AZ::Vector3(static_cast<float>(frameId), 0.0f, 0.0f), 0.5f));
+            m_history->RecordFrame(static_cast<Multiplayer::HostFrameId>(frameId), states);
+        }
+
+        static void ExpectFiniteHits(const Multiplayer::RewindRaycastHits& hits)
+        {
+            for (const Multiplayer::RewindRaycastHit& hit : hits)
+            {
+                EXPECT_TRUE(AZ::IsFiniteFloat(hit.m_distance));
+                EXPECT_GE(hit.m_distance, 0.0f);
+            }
+        }
+
+        AZStd::unique_ptr<Multiplayer::RewindHistory> m_history;
+    };
+
+    TEST_F(RewindHistoryTests, RecordFrame_MoreFramesThanHistory_OldestFramesDiscarded)
+    {
+        constexpr uint32_t FrameCount = Multiplayer::RewindHistorySize + Multiplayer::RewindHistorySize / 2;
+        for (uint32_t frameId = 0; frameId < FrameCount; ++frameId)
+        {
+            RecordMovingEntity(frameId);
+        }
+
+        // The ring has wrapped, so only the newest frames are left, each still holding its own state
+        for (uint32_t frameId = 0; frameId < FrameCount; ++frameId)
+        {
+            const bool isRetained = (frameId >= FrameCount - Multiplayer::RewindHistorySize);
+            EXPECT_EQ(isRetained, m_history->IsFrameRecorded(static_cast<Multiplayer::HostFrameId>(frameId))) << "Frame " << frameId;
+
+            AZ::Transform transform;
+            AZ::Aabb bounds;
+            const bool hasState = m_history->GetEntityState(static_cast<Multiplayer::HostFrameId>(frameId), static_cast<Multiplayer::NetEntityId>(1), transform, bounds);
+            EXPECT_EQ(isRetained, hasState);
+            if (hasState)
+            {
+                EXPECT_FLOAT_EQ(static_cast<float>(frameId), transform.GetTranslation().GetX());
+            }
+        }
+        EXPECT_FALSE(m_history->IsFrameRecorded(static_cast<Multiplayer::HostFrameId>(FrameCount)));
+    }
+
+    TEST_F(RewindHistoryTests, RecordFrame_RecordingDisabled_HistoryDiscarded)
+    {
+        RecordMovingEntity(0);
+        ASSERT_TRUE(m_history->IsFrameRecorded(static_cast<Multiplayer::HostFrameId>(0)));
+
+        // sv_RewindHistory is off by default, so the server tick neither gathers entities nor keeps stale frames around
+        m_history->RecordFrame(static_cast<Multiplayer::HostFrameId>(1));
+        EXPECT_FALSE(m_history->IsFrameRecorded(static_cast<Multiplayer::HostFrameId>(0)));
+        EXPECT_FALSE(m_history->IsFrameRecorded(static_cast<Multiplayer::HostFrameId>(1)));
+    }
+
+    TEST_F(RewindHistoryTests, GetEntityState_BetweenRecordedFrames_ReturnsStateOfEachFrame)
+    {
+        // Record every other frame, the frames in between were never simulated
+        for (uint32_t frameId = 10; frameId <= 20; frameId += 2)
+        {
+            RecordMovingEntity(frameId);
+        }
+
+        for (uint32_t frameId = 10; frameId <= 20; ++frameId)
+        {
+            AZ::Transform transform;
+            AZ::Aabb bounds;
+            const bool hasState = m_history->GetEntityState(static_cast<Multiplayer::HostFrameId>(frameId), static_cast<Multiplayer::NetEntityId>(1), transform, bounds);
+            if (frameId % 2 == 0)
+            {
+                ASSERT_TRUE(hasState);
+                EXPECT_FLOAT_EQ(static_cast<float>(frameId), transform.GetTranslation().GetX());
+                EXPECT_TRUE(bounds.Contains(transform.GetTranslation()));
+            }
+            else
+            {
+                EXPECT_FALSE(hasState);
+                EXPECT_FALSE(m_history->IsFrameRecorded(static_cast<Multiplayer::HostFrameId>(frameId)));
+            }
+        }
+
+        AZ::Transform transform;
+        AZ::Aabb bounds;
+        EXPECT_FALSE(m_history->GetEntityState(static_cast<Multiplayer::HostFrameId>(12), static_cast<Multiplayer::NetEntityId>(2), transform, bounds));
+        EXPECT_FALSE(m_history->GetEntityState(Multiplayer::InvalidHostFrameId, static_cast<Multiplayer::NetEntityId>(1), transform, bounds));
+    }
+
+    TEST_F(RewindHistoryTests, Raycast_AcrossCells_HitsOrderedByDistance)
+    {
+        AZStd::vector<Multiplayer::RewindHistory::EntityState> states;
+        states.push_back(MakeState(1, AZ::Vector3(5.0f * CellSize, 5.0f * CellSize, 0.0f), 1.0f));
+        states.push_back(MakeState(2, AZ::Vector3(1.0f * CellSize, 1.0f * CellSize, 0.0f), 1.0f));
+        states.push_back(MakeState(3, AZ::Vector3(3.0f * CellSize, 3.0f * CellSize, 0.0f), 1.0f));
+        states.push_back(MakeState(4, AZ::Vector3(3.0f * CellSize, -3.0f * CellSize, 0.0f), 1.0f)); // Off the ray
+        states.push_back(MakeState(5, AZ::Vector3(8.0f * CellSize, 0.0f, 0.0f), 4.0f * CellSize)); // Larger than the cells
+        m_history->RecordFrame(static_cast<Multiplayer::HostFrameId>(1), states);
+
+        Multiplayer::RewindRaycastHits hits;
+        EXPECT_TRUE(m_history->Raycast(static_cast<Multiplayer::HostFrameId>(1), AZ::Vector3::CreateZero(), AZ::Vector3(6.0f * CellSize, 6.0f * CellSize, 0.0f), hits));
+        ASSERT_EQ(4u, hits.size());
+        EXPECT_EQ(static_cast<Multiplayer::NetEntityId>(2), hits[0].m_netEntityId);
+        EXPECT_EQ(static_cast<Multiplayer::NetEntityId>(3), hits[1].m_netEntityId);
+        EXPECT_EQ(static_cast<Multiplayer::NetEntityId>(5), hits[2].m_netEntityId);
+        EXPECT_EQ(static_cast<Multiplayer::NetEntityId>(1), hits[3].m_netEntityId);
+
+        // The ray enters the first box at its corner
+        EXPECT_NEAR(AZ::Vector3(CellSize - 1.0f, CellSize - 1.0f, 0.0f).GetLength(), hits[0].m_distance, 0.001f);
+        ExpectFiniteHits(hits);
+
+        // Frames that were not recorded can't be queried
+        hits.clear();
+        EXPECT_FALSE(m_history->Raycast(static_cast<Multiplayer::HostFrameId>(2), AZ::Vector3::CreateZero(), AZ::Vector3(6.0f * CellSize, 6.0f * CellSize, 0.0f), hits));
+        EXPECT_TRUE(hits.empty());
+    }
+
+    TEST_F(RewindHistoryTests, Raycast_AlongSingleAxis_HitsWithFiniteDistances)
+    {
+        AZStd::vector<Multiplayer::RewindHistory::EntityState> states;
+        states.push_back(MakeState(1, AZ::Vector3(3.0f * CellSize, 0.0f, 0.0f), 1.0f));
+        states.push_back(MakeState(2, AZ::Vector3(0.0f, -3.0f * CellSize, 0.0f), 1.0f));
+        states.push_back(MakeState(3, AZ::Vector3(0.0f, 0.0f, 20.0f), 1.0f));
+        states.push_back(MakeState(4, AZ::Vector3(3.0f * CellSize, 5.0f, 0.0f), 1.0f)); // Beside the ray along X
+        m_history->RecordFrame(static_cast<Multiplayer::HostFrameId>(1), states);
+
+        // Each ray has two zero components, which have an infinite reciprocal
+        struct AxisRay
+        {
+            AZ::Vector3 m_end;
+            Multiplayer::NetEntityId m_expectedHit;
+            float m_expectedDistance;
+        };
+        const AxisRay rays[] =
+        {
+            { AZ::Vector3(10.0f * CellSize, 0.0f, 0.0f), static_cast<Multiplayer::NetEntityId>(1), 3.0f * CellSize - 1.0f },
+            { AZ::Vector3(0.0f, -10.0f * CellSize, 0.0f), static_cast<Multiplayer::NetEntityId>(2), 3.0f * CellSize - 1.0f },
+            { AZ::Vector3(0.0f, 0.0f, 100.0f), static_cast<Multiplayer::NetEntityId>(3), 19.0f },
+        };
+
+        for (const AxisRay& ray : rays)
+        {
+            Multiplayer::RewindRaycastHits hits;
+            EXPECT_TRUE(m_history->Raycast(static_cast<Multiplayer::HostFrameId>(1), AZ::Vector3::CreateZero(), ray.m_end, hits));
+            ASSERT_EQ(1u, hits.size());
+            EXPECT_EQ(ray.m_expectedHit, hits[0].m_netEntityId);
+            EXPECT_NEAR(ray.m_expectedDistance, hits[0].m_distance, 0.001f);
+            ExpectFiniteHits(hits);
+        }
+
+        // A ray running along the face of a box still counts as hitting it
+        Multiplayer::RewindRaycastHits hits;
+        EXPECT_TRUE(m_history->Raycast(static_cast<Multiplayer::HostFrameId>(1), AZ::Vector3(0.0f, 4.0f, 0.0f), AZ::Vector3(10.0f * CellSize, 4.0f, 0.0f), hits));
+        ASSERT_EQ(1u, hits.size());
+        EXPECT_EQ(static_cast<Multiplayer::NetEntityId>(4), hits[0].m_netEntityId);
+        ExpectFiniteHits(hits);
+    }
+
+    TEST_F(RewindHistoryTests, Raycast_StartsInsideOrStopsShort_ReportsOnlyReachedEntities)
+    {
+        AZStd::vector<Multiplayer::RewindHistory::EntityState> states;
+        states.push_back(MakeState(1, AZ::Vector3::CreateZero(), 2.0f));
+        states.push_back(MakeState(2, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f));
+        m_history->RecordFrame(static_cast<Multiplayer::HostFrameId>(1), states);
+
+        // Starting inside a box hits it at the start of the ray, and the segment ends before reaching the second box
+        Multiplayer::RewindRaycastHits hits;
+        EXPECT_TRUE(m_history->Raycast(static_cast<Multiplayer::HostFrameId>(1), AZ::Vector3(0.5f, 0.0f, 0.0f), AZ::Vector3(8.0f, 0.0f, 0.0f), hits));
+        ASSERT_EQ(1u, hits.size());
+        EXPECT_EQ(static_cast<Multiplayer::NetEntityId>(1), hits[0].m_netEntityId);
+        EXPECT_FLOAT_EQ(0.0f, hits[0].m_distance);
+
+        // Pointing away from both boxes misses everything
+        hits.clear();
+        EXPECT_TRUE(m_history->Raycast(static_cast<Multiplayer::HostFrameId>(1), AZ::Vector3(5.0f, 5.0f, 0.0f), AZ::Vector3(5.0f, 50.0f, 0.0f), hits));
+        EXPECT_TRUE(hits.empty());
+    }
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/SerializedDeltaCache.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <MultiplayerSystemComponent.h>
+
+namespace UnitTest
+{
+    class SerializedDeltaCacheTests
+        : public AllocatorsFixture
+    {
+    public:
+        static constexpr Multiplayer::NetComponentId TestComponentId = Multiplayer::NetComponentId{ 0 };
+        static constexpr uint32_t PropertyCount = 4;
+        static constexpr uint32_t BufferCapacity = 1024;
+
+        void SetUp() override
+        {
+            SetupAllocator();
+            AZ::NameDictionary::Create();
+            m_netComponent = new AzNetworking::NetworkingSystemComponent();
+            m_mpComponent = new Multiplayer::MultiplayerSystemComponent();
+            m_mpComponent->Activate();
+            m_stats.ReserveComponentStats(TestComponentId, PropertyCount, 0);
+        }
+
+        void TearDown() override
+        {
+            m_mpComponent->Deactivate();
+            delete m_mpComponent;
+            delete m_netComponent;
+            AZ::NameDictionary::Destroy();
+            TeardownAllocator();
+        }
+
+        static Multiplayer::ReplicationRecord MakeRecord(
+            Multiplayer::NetEntityRole remoteRole, AZStd::initializer_list<uint32_t> authorityToClient, AZStd::initializer_list<uint32_t> authorityToAutonomous = {})
+        {
+            Multiplayer::ReplicationRecord record(remoteRole);
+            record.m_authorityToClient.Resize(PropertyCount);
+            record.m_authorityToServer.Resize(PropertyCount);
+            record.m_authorityToAutonomous.Resize(PropertyCount);
+            record.m_autonomousToAuthority.Resize(PropertyCount);
+            for (uint32_t index : authorityToClient)
+            {
+                record.m_authorityToClient.SetBit(index, true);
+            }
+            for (uint32_t index : authorityToAutonomous)
+            {
+                record.m_authorityToAutonomous.SetBit(index, true);
+            }
+            return record;
+        }
+
+        // Serializes the record and one state value per property it marks, the way NetBindComponent::SerializeStateDeltaMessage does
+        void SerializeDelta(Multiplayer::ReplicationRecord& record, AzNetworking::ISerializer& serializer)
+        {
+            ++m_serializeCount;
+            record.Serialize(serializer);
+            for (uint32_t index = 0; index < PropertyCount; ++index)
+            {
+                if (record.m_authorityToClient.GetBit(index) || record.m_authorityToAutonomous.GetBit(index))
+                {
+                    serializer.Serialize(m_state[index], "State");
+                    m_stats.RecordPropertySent(TestComponentId, static_cast<Multiplayer::PropertyIndex>(index), sizeof(uint32_t));
+                }
+            }
+        }
+
+        // Serializes the delta through the cache for one connection, after a prefix standing in for the preceding updates of its packet.
+        // Returns the bytes of the delta.
+        AZStd::vector<uint8_t> SerializeForConnection(Multiplayer::SerializedDeltaCache& cache, const Multiplayer::ReplicationRecord& record, uint32_t prefixSize)
+        {
+            uint8_t buffer[BufferCapacity];
+            AzNetworking::NetworkInputSerializer serializer(buffer, BufferCapacity);
+            for (uint32_t index = 0; index < prefixSize; ++index)
+            {
+                uint8_t prefix = static_cast<uint8_t>(index);
+                static_cast<AzNetworking::ISerializer&>(serializer).Serialize(prefix, "Prefix");
+            }
+
+            const uint32_t startSize = serializer.GetSize();
+            Multiplayer::ReplicationRecord pendingRecord = record;
+            EXPECT_TRUE(cache.Serialize(pendingRecord, serializer, m_stats, [this, &pendingRecord](AzNetworking::NetworkInputSerializer& deltaSerializer)
+            {
+                SerializeDelta(pendingRecord, deltaSerializer);
+            }));
+            return AZStd::vector<uint8_t>(serializer.GetBuffer() + startSize, serializer.GetBuffer() + serializer.GetSize());
+        }
+
+        // Serializes the delta without the cache
+        AZStd::vector<uint8_t> SerializeFresh(const Multiplayer::ReplicationRecord& record)
+        {
+            uint8_t buffer[BufferCapacity];
+            AzNetworking::NetworkInputSerializer serializer(buffer, BufferCapacity);
+            Multiplayer::ReplicationRecord pendingRecord = record;
+            SerializeDelta(pendingRecord, serializer);
+            EXPECT_TRUE(serializer.IsValid());
+            return AZStd::vector<uint8_t>(serializer.GetBuffer(), serializer.GetBuffer() + serializer.GetSize());
+        }
+
+        uint64_t GetPropertySentCount(uint32_t propertyIndex) const
+        {
+            return m_stats.m_componentStats[aznumeric_cast<uint16_t>(TestComponentId)].m_propertyUpdatesSent[propertyIndex].m_totalCalls;
+        }
+
+        uint32_t m_state[PropertyCount] = { 11, 22, 33, 44 };
+        uint32_t m_serializeCount = 0;
+        Multiplayer::MultiplayerStats m_stats;
+
+        AzNetworking::NetworkingSystemComponent* m_netComponent = nullptr;
+        Multiplayer::MultiplayerSystemComponent* m_mpComponent = nullptr;
+    };
+
+    TEST_F(SerializedDeltaCacheTests, Serialize_SameRecord_ReusedDeltaMatchesFreshSerialization)
+    {
+        Multiplayer::SerializedDeltaCache cache;
+        const Multiplayer::ReplicationRecord record = MakeRecord(Multiplayer::NetEntityRole::Client, { 0, 2 });
+
+        const AZStd::vector<uint8_t> first = SerializeForConnection(cache, record, 3);
+        const AZStd::vector<uint8_t> second = SerializeForConnection(cache, record, 7);
+        EXPECT_EQ(1u, m_serializeCount);
+
+        // The copied delta records the stats of its properties, as if it had been serialized again
+        EXPECT_EQ(2u, GetPropertySentCount(0));
+        EXPECT_EQ(0u, GetPropertySentCount(1));
+        EXPECT_EQ(2u, GetPropertySentCount(2));
+
+        const AZStd::vector<uint8_t> fresh = SerializeFresh(record);
+        EXPECT_FALSE(fresh.empty());
+        EXPECT_EQ(fresh, first);
+        EXPECT_EQ(fresh, second);
+    }
+
+    TEST_F(SerializedDeltaCacheTests, Serialize_SameChangesDifferentConsumedBitsAndPacket_Shared)
+    {
+        Multiplayer::SerializedDeltaCache cache;
+        const Multiplayer::ReplicationRecord record = MakeRecord(Multiplayer::NetEntityRole::Client, { 1 });
+        Multiplayer::ReplicationRecord sentRecord = record;
+        sentRecord.m_sentPacketId = AzNetworking::PacketId{ 17 };
+        sentRecord.ConsumeAuthorityToClientBits(PropertyCount);
+        ASSERT_TRUE(record.HasSameChanges(sentRecord));
+
+        SerializeForConnection(cache, record, 0);
+        SerializeForConnection(cache, sentRecord, 0);
+        EXPECT_EQ(1u, m_serializeCount);
+    }
+
+    TEST_F(SerializedDeltaCacheTests, Serialize_DifferentRecords_NeverShared)
+    {
+        Multiplayer::SerializedDeltaCache cache;
+        const Multiplayer::ReplicationRecord records[] =
+        {
+            MakeRecord(Multiplayer::NetEntityRole::Client, { 0 }),
+            MakeRecord(Multiplayer::NetEntityRole::Client, { 1 }),
+            // Only the remote role differs from the first record
+            MakeRecord(Multiplayer::NetEntityRole::Autonomous, { 0 }),
+            // Only the bits of another replication direction differ from the previous record
+            MakeRecord(Multiplayer::NetEntityRole::Autonomous, { 0 }, { 3 }),
+        };
+        static_assert(AZ_ARRAY_SIZE(records) <= Multiplayer::SerializedDeltaCache::MaxDeltas, "Every record must fit in the cache");
+
+        for (uint32_t index = 0; index < AZ_ARRAY_SIZE(records); ++index)
+        {
+            for (uint32_t otherIndex = 0; otherIndex < AZ_ARRAY_SIZE(records); ++otherIndex)
+            {
+                EXPECT_EQ(index == otherIndex, records[index].HasSameChanges(records[otherIndex]));
+            }
+        }
+
+        for (const Multiplayer::ReplicationRecord& record : records)
+        {
+            SerializeForConnection(cache, record, 0);
+        }
+        EXPECT_EQ(AZ_ARRAY_SIZE(records), m_serializeCount);
+
+        // Each record keeps getting its own delta
+        AZStd::vector<uint8_t> shared[AZ_ARRAY_SIZE(records)];
+        for (uint32_t index = 0; index < AZ_ARRAY_SIZE(records); ++index)
+        {
+            shared[index] = SerializeForConnection(cache, records[index], 0);
+        }
+        EXPECT_EQ(AZ_ARRAY_SIZE(records), m_serializeCount);
+        for (uint32_t index = 0; index < AZ_ARRAY_SIZE(records); ++index)
+        {
+            EXPECT_EQ(SerializeFresh(records[index]), shared[index]);
+        }
+    }
+
+    TEST_F(SerializedDeltaCacheTests, MarkDirty_StateChanged_DeltaSerializedAgain)
+    {
+        Multiplayer::NetBindComponent netBindComponent;
+        Multiplayer::SerializedDeltaCache& cache = netBindComponent.GetSerializedDeltaCache();
+        const Multiplayer::ReplicationRecord record = MakeRecord(Multiplayer::NetEntityRole::Client, { 0 });
+
+        const AZStd::vector<uint8_t> before = SerializeForConnection(cache, record, 0);
+        m_state[0] = 99;
+        netBindComponent.MarkDirty();
+
+        const AZStd::vector<uint8_t> after = SerializeForConnection(cache, record, 0);
+        EXPECT_EQ(2u, m_serializeCount);
+        EXPECT_NE(before, after);
+        EXPECT_EQ(SerializeFresh(record), after);
+    }
+}
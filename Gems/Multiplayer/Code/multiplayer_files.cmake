@@ -28,9 +28,12 @@ set(FILES
     Include/Multiplayer/NetworkEntity/NetworkEntityHandle.h
     Include/Multiplayer/NetworkEntity/NetworkEntityHandle.inl
     Include/Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h
+    Include/Multiplayer/NetworkEntity/EntityReplication/SerializedDeltaCache.h
+    Include/Multiplayer/NetworkEntity/EntityReplication/SerializedDeltaCache.inl
     Include/Multiplayer/NetworkInput/IMultiplayerComponentInput.h
     Include/Multiplayer/NetworkInput/NetworkInput.h
     Include/Multiplayer/NetworkTime/INetworkTime.h
+    Include/Multiplayer/NetworkTime/IRewindHistory.h
     Include/Multiplayer/NetworkTime/RewindableArray.h
     Include/Multiplayer/NetworkTime/RewindableArray.inl
     Include/Multiplayer/NetworkTime/RewindableFixedVector.h
@@ -39,6 +42,7 @@ set(FILES
     Include/Multiplayer/NetworkTime/RewindableObject.inl
     Include/Multiplayer/Physics/PhysicsUtils.h
     Include/Multiplayer/ReplicationWindows/IReplicationWindow.h
+    Include/Multiplayer/ReplicationWindows/ReplicationPriority.h
     Source/Multiplayer_precompiled.h
     Source/MultiplayerSystemComponent.cpp
     Source/MultiplayerSystemComponent.h
@@ -73,11 +77,15 @@ set(FILES
     Source/NetworkEntity/EntityReplication/EntityReplicator.cpp
     Source/NetworkEntity/EntityReplication/EntityReplicator.h
     Source/NetworkEntity/EntityReplication/EntityReplicator.inl
+    Source/NetworkEntity/EntityReplication/EntityUpdateScheduler.cpp
+    Source/NetworkEntity/EntityReplication/EntityUpdateScheduler.h
+    Source/NetworkEntity/EntityReplication/EntityUpdateScheduler.inl
     Source/NetworkEntity/EntityReplication/PropertyPublisher.cpp
     Source/NetworkEntity/EntityReplication/PropertyPublisher.h
     Source/NetworkEntity/EntityReplication/PropertySubscriber.cpp
     Source/NetworkEntity/EntityReplication/PropertySubscriber.h
     Source/NetworkEntity/EntityReplication/ReplicationRecord.cpp
+    Source/NetworkEntity/EntityReplication/SerializedDeltaCache.cpp
     Source/NetworkEntity/NetworkEntityAuthorityTracker.cpp
     Source/NetworkEntity/NetworkEntityAuthorityTracker.h
     Source/NetworkEntity/NetworkEntityHandle.cpp
@@ -101,6 +109,8 @@ set(FILES
     Source/NetworkInput/NetworkInputMigrationVector.h
     Source/NetworkTime/NetworkTime.cpp
     Source/NetworkTime/NetworkTime.h
+    Source/NetworkTime/RewindHistory.cpp
+    Source/NetworkTime/RewindHistory.h
     Source/Pipeline/NetBindMarkerComponent.cpp
     Source/Pipeline/NetBindMarkerComponent.h
     Source/Pipeline/NetworkSpawnableHolderComponent.cpp
@@ -108,6 +118,10 @@ set(FILES
     Source/Physics/PhysicsUtils.cpp
     Source/ReplicationWindows/NullReplicationWindow.cpp
     Source/ReplicationWindows/NullReplicationWindow.h
+    Source/ReplicationWindows/ReplicationInterestGrid.cpp
+    Source/ReplicationWindows/ReplicationInterestGrid.h
+    Source/ReplicationWindows/ReplicationInterestGrid.inl
+    Source/ReplicationWindows/ReplicationPriority.cpp
     Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
     Source/ReplicationWindows/ServerToClientReplicationWindow.h
 )
@@ -8,8 +8,12 @@
 
 set(FILES
     Tests/Main.cpp
+    Tests/EntityUpdateSchedulerTests.cpp
     Tests/IMultiplayerConnectionMock.h
     Tests/MultiplayerSystemTests.cpp
+    Tests/ReplicationInterestGridTests.cpp
+    Tests/RewindHistoryTests.cpp
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp
+    Tests/SerializedDeltaCacheTests.cpp
 )
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "CompressionDictionary.h"
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace MultiplayerCompression
+{
+    namespace CompressionDictionaryInternal
+    {
+        // Marks d-mers that straddle two samples, these never occur in real traffic and are never scored
+        static constexpr uint64_t InvalidDmer = 0;
+
+        struct Segment
+        {
+            size_t m_offset = 0;
+            uint64_t m_score = 0;
+        };
+
+        uint64_t HashDmer(const uint8_t* data, uint32_t dmerSize)
+        {
+            // FNV-1a, remapped away from the invalid marker
+            uint64_t hash = 0xcbf29ce484222325ull;
+            for (uint32_t i = 0; i < dmerSize; ++i)
+            {
+                hash = (hash ^ data[i]) * 0x100000001b3ull;
+            }
+            return (hash == InvalidDmer) ? 1 : hash;
+        }
+    }
+
+    CompressionDictionary::CompressionDictionary(AZStd::vector<uint8_t> data)
+        : m_data(AZStd::move(data))
+    {
+        if (m_data.size() > MaxDictionarySize)
+        {
+            m_data.erase(m_data.begin(), m_data.end() - MaxDictionarySize);
+        }
+
+        if (!m_data.empty())
+        {
+            m_id = static_cast<uint32_t>(AZ::Crc32(m_data.data(), m_data.size()));
+        }
+    }
+
+    uint32_t CompressionDictionary::GetId() const
+    {
+        return m_id;
+    }
+
+    const uint8_t* CompressionDictionary::GetData() const
+    {
+        return m_data.data();
+    }
+
+    size_t CompressionDictionary::GetSize() const
+    {
+        return m_data.size();
+    }
+
+    bool CompressionDictionary::IsEmpty() const
+    {
+        return m_data.empty();
+    }
+
+    AZStd::shared_ptr<const CompressionDictionary> CompressionDictionary::LoadFromFile(const char* filePath)
+    {
+        const AZ::IO::SystemFile::SizeType fileSize = AZ::IO::SystemFile::Length(filePath);
+        if (fileSize == 0)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compression dictionary %s is missing or empty", filePath);
+            return nullptr;
+        }
+
+        AZStd::vector<uint8_t> data(fileSize);
+        if (AZ::IO::SystemFile::Read(filePath, data.data(), fileSize) != fileSize)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to read compression dictionary %s", filePath);
+            return nullptr;
+        }
+
+        AZ_Warning("Multiplayer Compressor", fileSize <= MaxDictionarySize, "Compression dictionary %s is larger than %zu bytes, only the end will be used", filePath, MaxDictionarySize);
+        return AZStd::make_shared<const CompressionDictionary>(AZStd::move(data));
+    }
+
+    bool CompressionDictionary::SaveToFile(const char* filePath) const
+    {
+        AZ::IO::SystemFile file;
+        if (!file.Open(filePath, AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to open %s for writing", filePath);
+            return false;
+        }
+        return file.Write(m_data.data(), m_data.size()) == m_data.size();
+    }
+
+    AZStd::vector<uint8_t> TrainDictionary(const PacketList& samples, const DictionaryTrainingParams& params)
+    {
+        using namespace CompressionDictionaryInternal;
+
+        const uint32_t dmerSize = AZStd::clamp<uint32_t>(params.m_dmerSize, 4, 16);
+        const uint32_t segmentSize = AZStd::max(params.m_segmentSize, dmerSize);
+        const size_t dictionarySize = AZStd::min(params.m_dictionarySize, MaxDictionarySize);
+
+        // Concatenate the samples, and hash the d-mer starting at every offset
+        AZStd::vector<uint8_t> corpus;
+        AZStd::vector<uint64_t> dmers;
+        AZStd::unordered_map<uint64_t, uint32_t> frequencies;
+        {
+            AZStd::unordered_set<uint64_t> sampleDmers;
+            for (const AZStd::vector<uint8_t>& sample : samples)
+            {
+                sampleDmers.clear();
+                for (size_t offset = 0; offset < sample.size(); ++offset)
+                {
+                    uint64_t dmer = InvalidDmer;
+                    if (offset + dmerSize <= sample.size())
+                    {
+                        dmer = HashDmer(sample.data() + offset, dmerSize);
+                        // Score by the number of samples a d-mer occurs in, not the number of occurrences
+                        if (sampleDmers.insert(dmer).second)
+                        {
+                            ++frequencies[dmer];
+                        }
+                    }
+                    dmers.push_back(dmer);
+                }
+                corpus.insert(corpus.end(), sample.begin(), sample.end());
+            }
+        }
+
+        const size_t segmentCount = dictionarySize / segmentSize;
+        if (segmentCount == 0 || corpus.size() < segmentSize)
+        {
+            return {};
+        }
+
+        // Select the best segment from each epoch
+        const size_t epochSize = AZStd::max<size_t>(corpus.size() / segmentCount, segmentSize);
+        const size_t windowDmers = segmentSize - dmerSize + 1;
+        AZStd::vector<Segment> segments;
+        AZStd::unordered_map<uint64_t, uint32_t> windowCounts;
+        for (size_t epochStart = 0; epochStart + segmentSize <= corpus.size() && segments.size() < segmentCount; epochStart += epochSize)
+        {
+            const size_t epochEnd = AZStd::min(epochStart + epochSize, corpus.size() - segmentSize + 1);
+
+            // Slide a window over the epoch, each distinct d-mer in the window contributes its frequency once
+            Segment best;
+            uint64_t score = 0;
+            windowCounts.clear();
+            for (size_t offset = epochStart; offset < epochEnd + windowDmers - 1; ++offset)
+            {
+                const uint64_t entering = dmers[offset];
+                if (entering != InvalidDmer && windowCounts[entering]++ == 0)
+                {
+                    score += frequencies[entering];
+                }
+
+                if (offset >= epochStart + windowDmers)
+                {
+                    const uint64_t leaving = dmers[offset - windowDmers];
+                    if (leaving != InvalidDmer && --windowCounts[leaving] == 0)
+                    {
+                        score -= frequencies[leaving];
+                    }
+                }
+
+                if (offset + 1 >= epochStart + windowDmers && score > best.m_score)
+                {
+                    best.m_offset = offset + 1 - windowDmers;
+                    best.m_score = score;
+                }
+            }
+
+            if (best.m_score == 0)
+            {
+                continue;
+            }
+
+            // Content in the selected segment is now covered by the dictionary
+            for (size_t offset = best.m_offset; offset < best.m_offset + windowDmers; ++offset)
+            {
+                if (dmers[offset] != InvalidDmer)
+                {
+                    frequencies[dmers[offset]] = 0;
+                }
+            }
+            segments.push_back(best);
+        }
+
+        AZStd::sort(segments.begin(), segments.end(), [](const Segment& lhs, const Segment& rhs) { return lhs.m_score < rhs.m_score; });
+
+        AZStd::vector<uint8_t> dictionary;
+        dictionary.reserve(segments.size() * segmentSize);
+        for (const Segment& segment : segments)
+        {
+            dictionary.insert(dictionary.end(), corpus.begin() + segment.m_offset, corpus.begin() + segment.m_offset + segmentSize);
+        }
+        return dictionary;
+    }
+}
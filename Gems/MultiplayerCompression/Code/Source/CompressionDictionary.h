@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace MultiplayerCompression
+{
+    //! Largest dictionary that can be referenced, LZ4 cannot match against data further back than 64KB.
+    static constexpr size_t MaxDictionarySize = 64 * 1024;
+
+    using PacketList = AZStd::vector<AZStd::vector<uint8_t>>;
+
+    /**
+    * A raw content dictionary, seeded into the compressor history so that even the first bytes of a small packet can be
+    * matched against content that commonly occurs in network traffic.
+    * Dictionaries are immutable once created, and shared by every compressor that uses them.
+    */
+    class CompressionDictionary
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressionDictionary, AZ::SystemAllocator, 0);
+
+        CompressionDictionary() = default;
+
+        //! Creates a dictionary from raw content, only the last MaxDictionarySize bytes are kept.
+        //! @param data the dictionary content, most valuable content should be placed last
+        explicit CompressionDictionary(AZStd::vector<uint8_t> data);
+
+        //! Returns the identifier of this dictionary, zero for an empty dictionary.
+        //! Two dictionaries with the same content always have the same identifier.
+        //! @return the identifier of this dictionary
+        uint32_t GetId() const;
+
+        const uint8_t* GetData() const;
+        size_t GetSize() const;
+        bool IsEmpty() const;
+
+        //! Loads a dictionary from a file.
+        //! @param filePath path of the dictionary file to load
+        //! @return the loaded dictionary, nullptr on failure
+        static AZStd::shared_ptr<const CompressionDictionary> LoadFromFile(const char* filePath);
+
+        //! Saves this dictionary to a file.
+        //! @param filePath path of the dictionary file to write
+        //! @return boolean true on success
+        bool SaveToFile(const char* filePath) const;
+
+    private:
+        AZStd::vector<uint8_t> m_data;
+        uint32_t m_id = 0;
+    };
+
+    struct DictionaryTrainingParams
+    {
+        size_t m_dictionarySize = 16 * 1024; //!< Size of the dictionary to build, at most MaxDictionarySize
+        uint32_t m_segmentSize = 64;         //!< Size of each segment of sample content selected into the dictionary
+        uint32_t m_dmerSize = 8;             //!< Size of the substrings used to score segments, between 4 and m_segmentSize
+    };
+
+    //! Builds dictionary content from a set of sample packets.
+    //! The samples are divided into epochs, and from each epoch the segment containing the substrings that occur in the most
+    //! samples is selected. Substrings already covered by a selected segment no longer contribute to the score of other
+    //! segments, so the dictionary is not filled with repetitions of the same content. The best scoring segments are placed
+    //! last, where they are cheapest to reference.
+    //! @param samples the sample packets, typically loaded from a packet capture
+    //! @param params  the training parameters
+    //! @return the dictionary content, empty if the samples contain no content worth selecting
+    AZStd::vector<uint8_t> TrainDictionary(const PacketList& samples, const DictionaryTrainingParams& params);
+}
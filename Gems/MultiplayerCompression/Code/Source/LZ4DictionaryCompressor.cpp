@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "LZ4DictionaryCompressor.h"
+#include "PacketCapture.h"
+
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/algorithm.h>
+
+#include <lz4.h>
+
+namespace MultiplayerCompression
+{
+    namespace LZ4DictionaryCompressorInternal
+    {
+        static const char* CompressorName = "LZ4Dictionary";
+        static const char* StreamingCompressorName = "LZ4DictionaryStream";
+
+        // Favour speed, the dictionary rather than a more exhaustive match search is what recovers the ratio on small packets
+        static constexpr int Acceleration = 1;
+
+        // Room for the referenceable history plus the largest packet that may be appended to it
+        static constexpr size_t HistoryCapacity = 2 * MaxDictionarySize;
+    }
+
+    LZ4DictionaryCompressor::LZ4DictionaryCompressor(AZStd::shared_ptr<const CompressionDictionary> dictionary, bool streaming, PacketCaptureWriter* capture)
+        : m_dictionary(AZStd::move(dictionary))
+        , m_capture(capture)
+        , m_streaming(streaming)
+    {
+        using namespace LZ4DictionaryCompressorInternal;
+
+        const uint32_t dictionaryId = m_dictionary ? m_dictionary->GetId() : 0;
+        const uint8_t dictionaryIdBytes[4] =
+        {
+            static_cast<uint8_t>(dictionaryId), static_cast<uint8_t>(dictionaryId >> 8),
+            static_cast<uint8_t>(dictionaryId >> 16), static_cast<uint8_t>(dictionaryId >> 24)
+        };
+        AZ::Crc32 type(GetName());
+        type.Add(dictionaryIdBytes, sizeof(dictionaryIdBytes));
+        m_type = aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(type));
+
+        const char* dictionaryData = m_dictionary ? reinterpret_cast<const char*>(m_dictionary->GetData()) : nullptr;
+        const int dictionarySize = m_dictionary ? static_cast<int>(m_dictionary->GetSize()) : 0;
+
+        if (!m_streaming)
+        {
+            if (dictionarySize > 0)
+            {
+                // Indexing the dictionary is expensive, so it is done once and the indexed state is copied for every packet
+                m_dictionaryStream = LZ4_createStream();
+                LZ4_loadDict(m_dictionaryStream, dictionaryData, dictionarySize);
+            }
+            return;
+        }
+
+        // Both directions start with the dictionary as their history, and append every packet to it
+        m_sendHistory.resize(HistoryCapacity);
+        m_recvHistory.resize(HistoryCapacity);
+        if (dictionarySize > 0)
+        {
+            memcpy(m_sendHistory.data(), dictionaryData, dictionarySize);
+            memcpy(m_recvHistory.data(), dictionaryData, dictionarySize);
+        }
+        m_sendHistorySize = dictionarySize;
+        m_recvHistorySize = dictionarySize;
+
+        m_sendStream = LZ4_createStream();
+        LZ4_loadDict(m_sendStream, m_sendHistory.data(), dictionarySize);
+    }
+
+    LZ4DictionaryCompressor::~LZ4DictionaryCompressor()
+    {
+        LZ4_freeStream(m_dictionaryStream);
+        LZ4_freeStream(m_sendStream);
+    }
+
+    const char* LZ4DictionaryCompressor::GetName() const
+    {
+        using namespace LZ4DictionaryCompressorInternal;
+        return m_streaming ? StreamingCompressorName : CompressorName;
+    }
+
+    AzNetworking::CompressorType LZ4DictionaryCompressor::GetType() const
+    {
+        return m_type;
+    }
+
+    bool LZ4DictionaryCompressor::RequiresOrderedDelivery() const
+    {
+        return m_streaming;
+    }
+
+    bool LZ4DictionaryCompressor::Init()
+    {
+        return true;
+    }
+
+    size_t LZ4DictionaryCompressor::GetMaxChunkSize(size_t maxCompSize) const
+    {
+        return maxCompSize;
+    }
+
+    size_t LZ4DictionaryCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+    {
+        return LZ4_compressBound(static_cast<int>(uncompSize));
+    }
+
+    AzNetworking::CompressorError LZ4DictionaryCompressor::Compress
+    (
+        const void* uncompData,
+        size_t uncompSize,
+        void* compData,
+        size_t compDataSize,
+        size_t& compSize
+    )
+    {
+        if (uncompData == nullptr || compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input or output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (uncompSize > LZ4_MAX_INPUT_SIZE || (m_streaming && uncompSize > MaxDictionarySize))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input size (%zu) passed to Compress() is greater than max allowed", uncompSize);
+            return AzNetworking::CompressorError::InsufficientBuffer;
+        }
+
+        if (m_capture != nullptr)
+        {
+            m_capture->Write(uncompData, uncompSize);
+        }
+
+        const char* source = reinterpret_cast<const char*>(uncompData);
+        char* dest = reinterpret_cast<char*>(compData);
+        const int sourceSize = static_cast<int>(uncompSize);
+        const int destCapacity = static_cast<int>(AZStd::min<size_t>(compDataSize, LZ4_compressBound(sourceSize)));
+
+        int compressedSize = 0;
+        if (m_streaming)
+        {
+            const AzNetworking::CompressorError result = CompressStream(source, sourceSize, dest, destCapacity, compressedSize);
+            if (result != AzNetworking::CompressorError::Ok)
+            {
+                return result;
+            }
+        }
+        else if (m_dictionaryStream != nullptr)
+        {
+            // A local copy keeps Compress() safe to call from several threads sharing this compressor
+            LZ4_stream_t workStream;
+            memcpy(&workStream, m_dictionaryStream, sizeof(LZ4_stream_t));
+            compressedSize = LZ4_compress_fast_continue(&workStream, source, dest, sourceSize, destCapacity, LZ4DictionaryCompressorInternal::Acceleration);
+        }
+        else
+        {
+            compressedSize = LZ4_compress_fast(source, dest, sourceSize, destCapacity, LZ4DictionaryCompressorInternal::Acceleration);
+        }
+
+        if (compressedSize <= 0)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compression failed for uncompSize:(%zu B) compDataSize:(%zu B)", uncompSize, compDataSize);
+            return AzNetworking::CompressorError::InsufficientBuffer;
+        }
+
+        compSize = compressedSize;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError LZ4DictionaryCompressor::Decompress
+    (
+        const void* compData,
+        size_t compDataSize,
+        void* uncompData,
+        size_t uncompDataSize,
+        size_t& consumedSize,
+        size_t& uncompSize
+    )
+    {
+        if (uncompData == nullptr || compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input or output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        const char* source = reinterpret_cast<const char*>(compData);
+        char* dest = reinterpret_cast<char*>(uncompData);
+        const int sourceSize = static_cast<int>(AZStd::min<size_t>(compDataSize, LZ4_MAX_INPUT_SIZE));
+        const int destCapacity = static_cast<int>(AZStd::min<size_t>(uncompDataSize, LZ4_MAX_INPUT_SIZE));
+
+        int decompressedSize = -1;
+        if (m_streaming)
+        {
+            decompressedSize = DecompressStream(source, sourceSize, dest, destCapacity);
+        }
+        else if (m_dictionary && !m_dictionary->IsEmpty())
+        {
+            decompressedSize = LZ4_decompress_safe_usingDict(source, dest, sourceSize, destCapacity,
+                reinterpret_cast<const char*>(m_dictionary->GetData()), static_cast<int>(m_dictionary->GetSize()));
+        }
+        else
+        {
+            decompressedSize = LZ4_decompress_safe(source, dest, sourceSize, destCapacity);
+        }
+        consumedSize = compDataSize;
+
+        if (decompressedSize < 0)
+        {
+            // LZ4 returns a negative value for corrupt data and insufficient buffer
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%zu B) uncompDataSize:(%zu B)", compDataSize, uncompDataSize);
+            return AzNetworking::CompressorError::CorruptData;
+        }
+
+        uncompSize = decompressedSize;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError LZ4DictionaryCompressor::CompressStream(const char* source, int sourceSize, char* dest, int destCapacity, int& compressedSize)
+    {
+        if (m_sendHistorySize + sourceSize > m_sendHistory.size())
+        {
+            // Move the content LZ4 can still reference to the front of the history, making room for the new packet
+            m_sendHistorySize = LZ4_saveDict(m_sendStream, m_sendHistory.data(), static_cast<int>(MaxDictionarySize));
+        }
+
+        // Packets are appended to the history so that LZ4 sees the history and the packet as one contiguous block
+        char* block = m_sendHistory.data() + m_sendHistorySize;
+        memcpy(block, source, sourceSize);
+        m_sendHistorySize += sourceSize;
+
+        compressedSize = LZ4_compress_fast_continue(m_sendStream, block, dest, sourceSize, destCapacity, LZ4DictionaryCompressorInternal::Acceleration);
+        if (compressedSize <= 0)
+        {
+            // The stream has advanced past content the remote endpoint will never see, the connection can not recover
+            AZ_Error("Multiplayer Compressor", false, "Streaming compression failed, subsequent packets on this connection will fail to decompress");
+            return AzNetworking::CompressorError::CorruptData;
+        }
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    int LZ4DictionaryCompressor::DecompressStream(const char* source, int sourceSize, char* dest, int destCapacity)
+    {
+        // Mirrors CompressStream, the sender never appends more than MaxDictionarySize bytes per packet
+        const size_t blockCapacity = AZStd::min<size_t>(destCapacity, MaxDictionarySize);
+        if (m_recvHistorySize + blockCapacity > m_recvHistory.size())
+        {
+            const size_t keepSize = AZStd::min(m_recvHistorySize, MaxDictionarySize);
+            memmove(m_recvHistory.data(), m_recvHistory.data() + m_recvHistorySize - keepSize, keepSize);
+            m_recvHistorySize = keepSize;
+        }
+
+        char* block = m_recvHistory.data() + m_recvHistorySize;
+        const size_t prefixSize = AZStd::min(m_recvHistorySize, MaxDictionarySize);
+        const int decompressedSize = LZ4_decompress_safe_usingDict(source, block, sourceSize, static_cast<int>(blockCapacity), block - prefixSize, static_cast<int>(prefixSize));
+        if (decompressedSize > 0)
+        {
+            memcpy(dest, block, decompressedSize);
+            m_recvHistorySize += decompressedSize;
+        }
+        return decompressedSize;
+    }
+}
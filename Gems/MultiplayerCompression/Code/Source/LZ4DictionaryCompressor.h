@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzNetworking/Framework/ICompressor.h>
+
+#include "CompressionDictionary.h"
+
+union LZ4_stream_u;
+
+namespace MultiplayerCompression
+{
+    class PacketCaptureWriter;
+
+    /**
+    * Implements an LZ4 Compressor that primes every packet with a trained dictionary.
+    * Small packets carry too little content to compress on their own, but typically share most of their content with other
+    * packets. Matching against a dictionary built from captured traffic recovers most of that redundancy.
+    *
+    * In the default mode every packet is compressed independently, so packets may be lost or reordered, and a single
+    * compressor can be shared by every connection of a UDP network interface. In streaming mode each packet is also matched
+    * against the packets that preceded it, this requires a compressor per connection and in order, lossless delivery, so
+    * streaming mode reports RequiresOrderedDelivery() and UDP network interfaces refuse to use it.
+    *
+    * The compressor type reported by GetType() is derived from the dictionary and the mode, so endpoints using different
+    * dictionaries refuse to connect rather than failing to decode each other's packets.
+    */
+    class LZ4DictionaryCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(LZ4DictionaryCompressor, AZ::SystemAllocator, 0);
+
+        //! Constructor.
+        //! @param dictionary the dictionary to prime packets with, may be nullptr to compress without a dictionary
+        //! @param streaming  true to match packets against the packets that preceded them, reliable ordered transports only
+        //! @param capture    optional packet capture to record uncompressed payloads to
+        LZ4DictionaryCompressor(AZStd::shared_ptr<const CompressionDictionary> dictionary, bool streaming, PacketCaptureWriter* capture = nullptr);
+        ~LZ4DictionaryCompressor() override;
+
+        const char* GetName() const;
+        AzNetworking::CompressorType GetType() const override;
+        bool RequiresOrderedDelivery() const override;
+
+        bool Init() override;
+        size_t GetMaxChunkSize(size_t maxCompSize) const override;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
+
+        AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
+        AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+    private:
+
+        AzNetworking::CompressorError CompressStream(const char* source, int sourceSize, char* dest, int destCapacity, int& compressedSize);
+        int DecompressStream(const char* source, int sourceSize, char* dest, int destCapacity);
+
+        AZStd::shared_ptr<const CompressionDictionary> m_dictionary;
+        PacketCaptureWriter* m_capture = nullptr;
+        AzNetworking::CompressorType m_type;
+        bool m_streaming = false;
+
+        // Stream state with the dictionary loaded, copied for every packet in the default mode
+        LZ4_stream_u* m_dictionaryStream = nullptr;
+
+        // Stream mode state, each direction keeps the most recent dictionary and packet content in a history buffer
+        LZ4_stream_u* m_sendStream = nullptr;
+        AZStd::vector<char> m_sendHistory;
+        size_t m_sendHistorySize = 0;
+        AZStd::vector<char> m_recvHistory;
+        size_t m_recvHistorySize = 0;
+    };
+}
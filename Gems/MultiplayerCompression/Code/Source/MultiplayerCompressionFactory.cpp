@@ -7,12 +7,21 @@
  */
 
 #include "MultiplayerCompressionFactory.h"
+#include "CompressionDictionary.h"
 #include "LZ4Compressor.h"
+#include "LZ4DictionaryCompressor.h"
+#include "PacketCapture.h"
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace MultiplayerCompression
 {
+    AZ_CVAR(AZ::CVarFixedString, net_CompressionDictionary, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Path of the trained dictionary used by dictionary compressors, connecting endpoints must use the same dictionary");
+    AZ_CVAR(AZ::CVarFixedString, net_CompressionCaptureFile, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If set, payloads sent through dictionary compressors are recorded to this file for use with net_CompressionTrainDictionary");
+
     AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerCompressionFactory::Create()
     {
         return AZStd::make_unique<LZ4Compressor>();
@@ -22,4 +31,45 @@ namespace MultiplayerCompression
     {
         return m_name;
     }
+
+    MultiplayerDictionaryCompressionFactory::MultiplayerDictionaryCompressionFactory(const char* name, bool streaming, PacketCaptureWriter& capture)
+        : m_name(name)
+        , m_streaming(streaming)
+        , m_capture(capture)
+    {
+        ;
+    }
+
+    AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerDictionaryCompressionFactory::Create()
+    {
+        PacketCaptureWriter* capture = nullptr;
+        const AZ::CVarFixedString captureFile = net_CompressionCaptureFile;
+        if (!captureFile.empty())
+        {
+            if (m_capture.GetFilePath() != captureFile.c_str())
+            {
+                m_capture.Open(captureFile.c_str());
+            }
+            capture = &m_capture;
+        }
+        return AZStd::make_unique<LZ4DictionaryCompressor>(GetDictionary(), m_streaming, capture);
+    }
+
+    AZ::Name MultiplayerDictionaryCompressionFactory::GetFactoryName() const
+    {
+        return m_name;
+    }
+
+    AZStd::shared_ptr<const CompressionDictionary> MultiplayerDictionaryCompressionFactory::GetDictionary()
+    {
+        const AZ::CVarFixedString dictionaryPath = net_CompressionDictionary;
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_dictionaryMutex);
+        if (m_dictionaryPath != dictionaryPath.c_str())
+        {
+            m_dictionaryPath = dictionaryPath.c_str();
+            m_dictionary = m_dictionaryPath.empty() ? nullptr : CompressionDictionary::LoadFromFile(m_dictionaryPath.c_str());
+        }
+        return m_dictionary;
+    }
 }
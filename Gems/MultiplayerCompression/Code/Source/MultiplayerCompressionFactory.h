@@ -9,7 +9,10 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
 #include <AzNetworking/Framework/ICompressor.h>
 
 namespace MultiplayerCompression
@@ -29,4 +32,41 @@ namespace MultiplayerCompression
     private:
         const AZ::Name m_name = AZ::Name("MultiplayerCompressor");
     };
+
+    class CompressionDictionary;
+    class PacketCaptureWriter;
+
+    //! Creates LZ4DictionaryCompressors primed with the dictionary named by the net_CompressionDictionary cvar.
+    //! Streaming factories create compressors that also match against previous packets. These report RequiresOrderedDelivery(),
+    //! so they are only used for TCP and UDP network interfaces fall back to sending uncompressed.
+    class MultiplayerDictionaryCompressionFactory
+        : public AzNetworking::ICompressorFactory
+    {
+    public:
+        //! Constructor.
+        //! @param name      the name compressors are requested by through the net_UdpCompressor and net_TcpCompressor cvars
+        //! @param streaming true to create streaming compressors
+        //! @param capture   packet capture that compressors record to while net_CompressionCaptureFile is set
+        MultiplayerDictionaryCompressionFactory(const char* name, bool streaming, PacketCaptureWriter& capture);
+
+        //! Instantiate a new compressor
+        //! @return A unique_ptr to a new Compressor
+        AZStd::unique_ptr<AzNetworking::ICompressor> Create() override;
+
+        //! Gets the AZ Name of this compressor factory
+        //! @return the AZ Name of this compressor factory
+        AZ::Name GetFactoryName() const override;
+
+    private:
+        AZStd::shared_ptr<const CompressionDictionary> GetDictionary();
+
+        const AZ::Name m_name;
+        const bool m_streaming;
+        PacketCaptureWriter& m_capture;
+
+        // Loaded dictionaries are shared by every compressor created until the dictionary path changes
+        AZStd::mutex m_dictionaryMutex;
+        AZStd::string m_dictionaryPath;
+        AZStd::shared_ptr<const CompressionDictionary> m_dictionary;
+    };
 }
@@ -6,6 +6,8 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -13,11 +15,88 @@
 #include <AzNetworking/Framework/INetworking.h>
 
 #include "MultiplayerCompressionSystemComponent.h"
+#include "CompressionDictionary.h"
 #include "LZ4Compressor.h"
+#include "LZ4DictionaryCompressor.h"
 #include "MultiplayerCompressionFactory.h"
+#include "PacketCapture.h"
 
 namespace MultiplayerCompression
 {
+    void net_CompressionTrainDictionary(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 2)
+        {
+            AZLOG_INFO("Usage: net_CompressionTrainDictionary <captureFile> <dictionaryFile> [dictionarySize]");
+            return;
+        }
+
+        const AZ::CVarFixedString captureFile(arguments[0]);
+        const AZ::CVarFixedString dictionaryFile(arguments[1]);
+        DictionaryTrainingParams params;
+        if (arguments.size() > 2)
+        {
+            const AZ::CVarFixedString dictionarySize(arguments[2]);
+            params.m_dictionarySize = strtoul(dictionarySize.c_str(), nullptr, 10);
+        }
+
+        PacketList packets;
+        if (!LoadPacketCapture(captureFile.c_str(), packets))
+        {
+            return;
+        }
+
+        const CompressionDictionary dictionary(TrainDictionary(packets, params));
+        if (dictionary.IsEmpty() || !dictionary.SaveToFile(dictionaryFile.c_str()))
+        {
+            AZLOG_ERROR("Failed to train a dictionary from %s", captureFile.c_str());
+            return;
+        }
+        AZLOG_INFO("Trained %zu byte dictionary %08x from %zu packets, saved to %s",
+            dictionary.GetSize(), dictionary.GetId(), packets.size(), dictionaryFile.c_str());
+    }
+    AZ_CONSOLEFREEFUNC(net_CompressionTrainDictionary, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Trains a compression dictionary from a packet capture, arguments are the capture file, the dictionary file to write and optionally the dictionary size");
+
+    void net_CompressionBenchmark(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 1)
+        {
+            AZLOG_INFO("Usage: net_CompressionBenchmark <captureFile> [dictionaryFile]");
+            return;
+        }
+
+        const AZ::CVarFixedString captureFile(arguments[0]);
+        PacketList packets;
+        if (!LoadPacketCapture(captureFile.c_str(), packets))
+        {
+            return;
+        }
+
+        AZStd::shared_ptr<const CompressionDictionary> dictionary;
+        if (arguments.size() > 1)
+        {
+            const AZ::CVarFixedString dictionaryFile(arguments[1]);
+            dictionary = CompressionDictionary::LoadFromFile(dictionaryFile.c_str());
+        }
+
+        auto logResult = [&packets](const char* name, AzNetworking::ICompressor& compressor)
+        {
+            const PacketReplayResult result = ReplayPackets(compressor, packets);
+            AZLOG_INFO("%s: %u packets, ratio %.3f, compress %.3f us/packet, decompress %.3f us/packet, %u failed round trips",
+                name, result.m_packetCount, result.GetCompressionRatio(), result.GetCompressTimePerPacketUs(), result.GetDecompressTimePerPacketUs(), result.m_failedPackets);
+        };
+
+        LZ4Compressor lz4Compressor;
+        logResult(lz4Compressor.GetName(), lz4Compressor);
+        LZ4DictionaryCompressor dictionaryCompressor(dictionary, false);
+        logResult(dictionaryCompressor.GetName(), dictionaryCompressor);
+        LZ4DictionaryCompressor streamingCompressor(dictionary, true);
+        logResult(streamingCompressor.GetName(), streamingCompressor);
+    }
+    AZ_CONSOLEFREEFUNC(net_CompressionBenchmark, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Replays a packet capture through each compressor and reports the compression ratio and time taken per packet, arguments are the capture file and optionally a dictionary file");
+
     void MultiplayerCompressionSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
@@ -51,11 +130,19 @@ namespace MultiplayerCompression
     {
         m_multiplayerCompressionFactory = new MultiplayerCompressionFactory();
         AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_multiplayerCompressionFactory);
+        m_dictionaryCompressionFactory = new MultiplayerDictionaryCompressionFactory("MultiplayerDictionaryCompressor", false, m_packetCapture);
+        AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_dictionaryCompressionFactory);
+        m_streamingDictionaryCompressionFactory = new MultiplayerDictionaryCompressionFactory("MultiplayerStreamingDictionaryCompressor", true, m_packetCapture);
+        AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_streamingDictionaryCompressionFactory);
     }
 
     MultiplayerCompressionSystemComponent::~MultiplayerCompressionSystemComponent()
     {
         AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_multiplayerCompressionFactory->GetFactoryName());
         delete m_multiplayerCompressionFactory;
+        AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_dictionaryCompressionFactory->GetFactoryName());
+        delete m_dictionaryCompressionFactory;
+        AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_streamingDictionaryCompressionFactory->GetFactoryName());
+        delete m_streamingDictionaryCompressionFactory;
     }
 }
@@ -12,6 +12,7 @@
 #include <AzCore/std/containers/unordered_set.h>
 
 #include <MultiplayerCompressionFactory.h>
+#include <PacketCapture.h>
 
 namespace MultiplayerCompression
 {
@@ -41,5 +42,8 @@ namespace MultiplayerCompression
         ////////////////////////////////////////////////////////////////////////
     private:
         MultiplayerCompressionFactory* m_multiplayerCompressionFactory;
+        MultiplayerDictionaryCompressionFactory* m_dictionaryCompressionFactory;
+        MultiplayerDictionaryCompressionFactory* m_streamingDictionaryCompressionFactory;
+        PacketCaptureWriter m_packetCapture;
     };
 }
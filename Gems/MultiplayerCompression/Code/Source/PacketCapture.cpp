@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "PacketCapture.h"
+
+#include <AzCore/std/chrono/clocks.h>
+
+namespace MultiplayerCompression
+{
+    namespace PacketCaptureInternal
+    {
+        static constexpr uint8_t CaptureTag[4] = { 'M', 'P', 'C', '1' };
+
+        // Anything larger is not a network payload, and means the capture is corrupt
+        static constexpr uint32_t MaxCapturedPacketSize = 1024 * 1024;
+
+        void EncodeSize(uint32_t size, uint8_t* outBytes)
+        {
+            for (uint32_t i = 0; i < 4; ++i)
+            {
+                outBytes[i] = static_cast<uint8_t>(size >> (i * 8));
+            }
+        }
+
+        uint32_t DecodeSize(const uint8_t* bytes)
+        {
+            uint32_t size = 0;
+            for (uint32_t i = 0; i < 4; ++i)
+            {
+                size |= static_cast<uint32_t>(bytes[i]) << (i * 8);
+            }
+            return size;
+        }
+    }
+
+    PacketCaptureWriter::~PacketCaptureWriter()
+    {
+        Close();
+    }
+
+    bool PacketCaptureWriter::Open(const char* filePath)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_file.Close();
+        m_filePath.clear();
+
+        if (!m_file.Open(filePath, AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to open packet capture %s for writing", filePath);
+            return false;
+        }
+
+        m_file.Write(PacketCaptureInternal::CaptureTag, sizeof(PacketCaptureInternal::CaptureTag));
+        m_filePath = filePath;
+        return true;
+    }
+
+    void PacketCaptureWriter::Close()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_file.Close();
+        m_filePath.clear();
+    }
+
+    const AZStd::string& PacketCaptureWriter::GetFilePath() const
+    {
+        return m_filePath;
+    }
+
+    void PacketCaptureWriter::Write(const void* data, size_t size)
+    {
+        uint8_t sizeBytes[4];
+        PacketCaptureInternal::EncodeSize(static_cast<uint32_t>(size), sizeBytes);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_file.IsOpen())
+        {
+            m_file.Write(sizeBytes, sizeof(sizeBytes));
+            m_file.Write(data, size);
+        }
+    }
+
+    bool LoadPacketCapture(const char* filePath, PacketList& outPackets)
+    {
+        using namespace PacketCaptureInternal;
+
+        const AZ::IO::SystemFile::SizeType fileSize = AZ::IO::SystemFile::Length(filePath);
+        AZStd::vector<uint8_t> data(fileSize);
+        if ((fileSize < sizeof(CaptureTag)) || (AZ::IO::SystemFile::Read(filePath, data.data(), fileSize) != fileSize))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to read packet capture %s", filePath);
+            return false;
+        }
+
+        if (memcmp(data.data(), CaptureTag, sizeof(CaptureTag)) != 0)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "%s is not a packet capture", filePath);
+            return false;
+        }
+
+        size_t offset = sizeof(CaptureTag);
+        while (offset + 4 <= data.size())
+        {
+            const uint32_t packetSize = DecodeSize(data.data() + offset);
+            offset += 4;
+            if (packetSize > MaxCapturedPacketSize || offset + packetSize > data.size())
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Packet capture %s is truncated or corrupt, loaded %zu packets", filePath, outPackets.size());
+                return !outPackets.empty();
+            }
+            outPackets.emplace_back(data.begin() + offset, data.begin() + offset + packetSize);
+            offset += packetSize;
+        }
+        return true;
+    }
+
+    float PacketReplayResult::GetCompressionRatio() const
+    {
+        return (m_compressedBytes > 0) ? static_cast<float>(m_uncompressedBytes) / static_cast<float>(m_compressedBytes) : 0.0f;
+    }
+
+    float PacketReplayResult::GetCompressTimePerPacketUs() const
+    {
+        return (m_packetCount > 0) ? static_cast<float>(m_compressTimeUs) / static_cast<float>(m_packetCount) : 0.0f;
+    }
+
+    float PacketReplayResult::GetDecompressTimePerPacketUs() const
+    {
+        return (m_packetCount > 0) ? static_cast<float>(m_decompressTimeUs) / static_cast<float>(m_packetCount) : 0.0f;
+    }
+
+    PacketReplayResult ReplayPackets(AzNetworking::ICompressor& compressor, const PacketList& packets)
+    {
+        using Clock = AZStd::chrono::system_clock;
+
+        PacketReplayResult result;
+        result.m_packetCount = static_cast<uint32_t>(packets.size());
+
+        // Individual packets compress faster than the clock resolution, so each pass is timed as a whole
+        PacketList compressedPackets(packets.size());
+        const Clock::time_point compressStart = Clock::now();
+        for (size_t i = 0; i < packets.size(); ++i)
+        {
+            compressedPackets[i].resize(compressor.GetMaxCompressedBufferSize(packets[i].size()));
+            size_t compressedSize = 0;
+            if (compressor.Compress(packets[i].data(), packets[i].size(), compressedPackets[i].data(), compressedPackets[i].size(), compressedSize) != AzNetworking::CompressorError::Ok)
+            {
+                compressedSize = 0;
+            }
+            compressedPackets[i].resize(compressedSize);
+        }
+        const Clock::time_point compressEnd = Clock::now();
+
+        PacketList decompressedPackets(packets.size());
+        AZStd::vector<AzNetworking::CompressorError> decompressResults(packets.size());
+        const Clock::time_point decompressStart = Clock::now();
+        for (size_t i = 0; i < packets.size(); ++i)
+        {
+            decompressedPackets[i].resize(packets[i].size());
+            size_t consumedSize = 0;
+            size_t decompressedSize = 0;
+            decompressResults[i] = compressor.Decompress(compressedPackets[i].data(), compressedPackets[i].size(), decompressedPackets[i].data(), decompressedPackets[i].size(), consumedSize, decompressedSize);
+            decompressedPackets[i].resize(decompressedSize);
+        }
+        const Clock::time_point decompressEnd = Clock::now();
+
+        for (size_t i = 0; i < packets.size(); ++i)
+        {
+            if (decompressResults[i] != AzNetworking::CompressorError::Ok || decompressedPackets[i] != packets[i])
+            {
+                ++result.m_failedPackets;
+            }
+            result.m_uncompressedBytes += packets[i].size();
+            result.m_compressedBytes += compressedPackets[i].size();
+        }
+
+        result.m_compressTimeUs = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(compressEnd - compressStart).count();
+        result.m_decompressTimeUs = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(decompressEnd - decompressStart).count();
+        return result;
+    }
+}
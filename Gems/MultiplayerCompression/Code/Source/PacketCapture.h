@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+#include <AzNetworking/Framework/ICompressor.h>
+
+#include "CompressionDictionary.h"
+
+namespace MultiplayerCompression
+{
+    /**
+    * Records uncompressed packet payloads to a capture file.
+    * Captures are used offline to train compression dictionaries, and to benchmark compressors against real traffic.
+    * A capture file is a four byte tag followed by each payload, prefixed by its size as a 32 bit little endian value.
+    */
+    class PacketCaptureWriter
+    {
+    public:
+        ~PacketCaptureWriter();
+
+        //! Opens a capture file, replacing any existing file at the same path.
+        //! @param filePath path of the capture file to write
+        //! @return boolean true on success
+        bool Open(const char* filePath);
+
+        //! Closes the capture file, if one is open.
+        void Close();
+
+        //! Returns the path of the open capture file, empty if no capture file is open.
+        const AZStd::string& GetFilePath() const;
+
+        //! Appends a payload to the capture file, safe to call from multiple threads.
+        //! @param data the uncompressed payload
+        //! @param size the size of the payload in bytes
+        void Write(const void* data, size_t size);
+
+    private:
+        AZStd::mutex m_mutex;
+        AZ::IO::SystemFile m_file;
+        AZStd::string m_filePath;
+    };
+
+    //! Loads every payload recorded to a capture file.
+    //! @param filePath   path of the capture file to read
+    //! @param outPackets receives the recorded payloads
+    //! @return boolean true on success
+    bool LoadPacketCapture(const char* filePath, PacketList& outPackets);
+
+    //! Results of replaying packets through a compressor.
+    struct PacketReplayResult
+    {
+        uint32_t m_packetCount = 0;
+        uint32_t m_failedPackets = 0;
+        uint64_t m_uncompressedBytes = 0;
+        uint64_t m_compressedBytes = 0;
+        uint64_t m_compressTimeUs = 0;
+        uint64_t m_decompressTimeUs = 0;
+
+        //! Returns the uncompressed size divided by the compressed size.
+        float GetCompressionRatio() const;
+
+        //! Returns the average time taken to compress and decompress a single packet, in microseconds.
+        float GetCompressTimePerPacketUs() const;
+        float GetDecompressTimePerPacketUs() const;
+    };
+
+    //! Compresses then decompresses each packet in order, verifying the round trip and measuring size and time taken.
+    //! @param compressor the compressor to benchmark, packets are replayed in order so streaming compressors are supported
+    //! @param packets    the packets to replay, typically loaded from a packet capture
+    //! @return the replay results
+    PacketReplayResult ReplayPackets(AzNetworking::ICompressor& compressor, const PacketList& packets);
+}
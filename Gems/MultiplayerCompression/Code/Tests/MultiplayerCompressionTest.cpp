@@ -9,9 +9,13 @@
 #include <lz4.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
+#include <CompressionDictionary.h>
 #include <LZ4Compressor.h>
+#include <LZ4DictionaryCompressor.h>
+#include <PacketCapture.h>
 
 #include <AzCore/Compression/Compression.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzTest/AzTest.h>
@@ -127,4 +131,96 @@ TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_NullTest)
     EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
 }
 
+namespace MultiplayerCompressionTestInternal
+{
+    // Builds small packets resembling entity updates, a shared header and property names with varying values
+    MultiplayerCompression::PacketList CreateEntityUpdatePackets(uint32_t seed, size_t packetCount)
+    {
+        static const char* Header = "EntityUpdate NetworkTransformComponent";
+        static const char* Properties[] = { "rotation", "translation", "parentEntityId", "resetCount" };
+
+        MultiplayerCompression::PacketList packets;
+        uint32_t state = seed;
+        auto nextRandom = [&state]() { state = state * 1664525u + 1013904223u; return state >> 16; };
+        for (size_t i = 0; i < packetCount; ++i)
+        {
+            AZStd::vector<uint8_t> packet(Header, Header + strlen(Header));
+            const uint32_t entityCount = 2 + nextRandom() % 6;
+            for (uint32_t entity = 0; entity < entityCount; ++entity)
+            {
+                const char* property = Properties[nextRandom() % AZ_ARRAY_SIZE(Properties)];
+                packet.push_back(static_cast<uint8_t>(nextRandom() % 64));
+                packet.insert(packet.end(), property, property + strlen(property));
+                for (uint32_t value = 0; value < 6; ++value)
+                {
+                    packet.push_back(static_cast<uint8_t>(nextRandom()));
+                }
+            }
+            packets.push_back(AZStd::move(packet));
+        }
+        return packets;
+    }
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_DictionaryRoundTripTest)
+{
+    using namespace MultiplayerCompressionTestInternal;
+    const MultiplayerCompression::PacketList trainingPackets = CreateEntityUpdatePackets(1, 1000);
+    const MultiplayerCompression::PacketList replayPackets = CreateEntityUpdatePackets(2, 1000);
+
+    auto dictionary = AZStd::make_shared<const MultiplayerCompression::CompressionDictionary>(
+        MultiplayerCompression::TrainDictionary(trainingPackets, MultiplayerCompression::DictionaryTrainingParams()));
+    ASSERT_FALSE(dictionary->IsEmpty());
+    EXPECT_LE(dictionary->GetSize(), MultiplayerCompression::DictionaryTrainingParams().m_dictionarySize);
+
+    MultiplayerCompression::LZ4DictionaryCompressor plainCompressor(nullptr, false);
+    MultiplayerCompression::LZ4DictionaryCompressor dictionaryCompressor(dictionary, false);
+    MultiplayerCompression::LZ4DictionaryCompressor streamingCompressor(dictionary, true);
+
+    const MultiplayerCompression::PacketReplayResult plainResult = MultiplayerCompression::ReplayPackets(plainCompressor, replayPackets);
+    const MultiplayerCompression::PacketReplayResult dictionaryResult = MultiplayerCompression::ReplayPackets(dictionaryCompressor, replayPackets);
+    const MultiplayerCompression::PacketReplayResult streamingResult = MultiplayerCompression::ReplayPackets(streamingCompressor, replayPackets);
+
+    EXPECT_EQ(plainResult.m_failedPackets, 0u);
+    EXPECT_EQ(dictionaryResult.m_failedPackets, 0u);
+    EXPECT_EQ(streamingResult.m_failedPackets, 0u);
+    EXPECT_GT(dictionaryResult.GetCompressionRatio(), plainResult.GetCompressionRatio());
+    EXPECT_GT(streamingResult.GetCompressionRatio(), plainResult.GetCompressionRatio());
+
+    AZ_TracePrintf("Multiplayer Compression Test", "No dictionary ratio:(%.3f) compress:(%.3f mcs) decompress:(%.3f mcs) \n",
+        plainResult.GetCompressionRatio(), plainResult.GetCompressTimePerPacketUs(), plainResult.GetDecompressTimePerPacketUs());
+    AZ_TracePrintf("Multiplayer Compression Test", "Dictionary ratio:(%.3f) compress:(%.3f mcs) decompress:(%.3f mcs) \n",
+        dictionaryResult.GetCompressionRatio(), dictionaryResult.GetCompressTimePerPacketUs(), dictionaryResult.GetDecompressTimePerPacketUs());
+    AZ_TracePrintf("Multiplayer Compression Test", "Streaming ratio:(%.3f) compress:(%.3f mcs) decompress:(%.3f mcs) \n",
+        streamingResult.GetCompressionRatio(), streamingResult.GetCompressTimePerPacketUs(), streamingResult.GetDecompressTimePerPacketUs());
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_DictionaryTypeTest)
+{
+    using namespace MultiplayerCompressionTestInternal;
+    auto dictionaryA = AZStd::make_shared<const MultiplayerCompression::CompressionDictionary>(
+        MultiplayerCompression::TrainDictionary(CreateEntityUpdatePackets(1, 100), MultiplayerCompression::DictionaryTrainingParams()));
+    auto dictionaryB = AZStd::make_shared<const MultiplayerCompression::CompressionDictionary>(
+        MultiplayerCompression::TrainDictionary(CreateEntityUpdatePackets(2, 100), MultiplayerCompression::DictionaryTrainingParams()));
+    ASSERT_NE(dictionaryA->GetId(), dictionaryB->GetId());
+
+    // Compressors are only interchangeable when they share both a dictionary and a mode
+    EXPECT_EQ(MultiplayerCompression::LZ4DictionaryCompressor(dictionaryA, false).GetType(), MultiplayerCompression::LZ4DictionaryCompressor(dictionaryA, false).GetType());
+    EXPECT_NE(MultiplayerCompression::LZ4DictionaryCompressor(dictionaryA, false).GetType(), MultiplayerCompression::LZ4DictionaryCompressor(dictionaryB, false).GetType());
+    EXPECT_NE(MultiplayerCompression::LZ4DictionaryCompressor(dictionaryA, false).GetType(), MultiplayerCompression::LZ4DictionaryCompressor(dictionaryA, true).GetType());
+    EXPECT_NE(MultiplayerCompression::LZ4DictionaryCompressor(dictionaryA, false).GetType(), MultiplayerCompression::LZ4DictionaryCompressor(nullptr, false).GetType());
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_OrderedDeliveryTest)
+{
+    using namespace MultiplayerCompressionTestInternal;
+    auto dictionary = AZStd::make_shared<const MultiplayerCompression::CompressionDictionary>(
+        MultiplayerCompression::TrainDictionary(CreateEntityUpdatePackets(1, 100), MultiplayerCompression::DictionaryTrainingParams()));
+
+    // Only the streaming mode depends on earlier packets, so only it must be kept off UDP
+    EXPECT_FALSE(MultiplayerCompression::LZ4Compressor().RequiresOrderedDelivery());
+    EXPECT_FALSE(MultiplayerCompression::LZ4DictionaryCompressor(dictionary, false).RequiresOrderedDelivery());
+    EXPECT_TRUE(MultiplayerCompression::LZ4DictionaryCompressor(dictionary, true).RequiresOrderedDelivery());
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);